@@ -54,6 +54,7 @@
 #include <bmx/mxf_reader/MXFSequenceReader.h>
 #include <bmx/mxf_reader/MXFFrameMetadata.h>
 #include <bmx/mxf_reader/MXFTimedTextTrackReader.h>
+#include <bmx/frame/SharedBufferFrame.h>
 #include <bmx/essence_parser/SoundConversion.h>
 #include <bmx/essence_parser/MPEG2AspectRatioFilter.h>
 #include <bmx/mxf_helper/RDD36MXFDescriptorHelper.h>
@@ -118,10 +119,14 @@ static const char DEFAULT_BEXT_ORIGINATOR[] = "bmx";
 
 static const uint32_t DEFAULT_RW_INTL_SIZE  = (64 * 1024);
 
+static const uint32_t DEFAULT_ASYNC_WRITE_SIZE    = (4 * 1024 * 1024);
+static const uint32_t DEFAULT_ASYNC_WRITE_BUFFERS = 4;
+
 static const uint16_t DEFAULT_RDD6_LINES[2] = {9, 572};     /* ST 274, line 9 field 1 and 2 */
 static const uint8_t DEFAULT_RDD6_SDID      = 4;            /* first channel pair is 5/6 */
 
 static const uint32_t DEFAULT_HTTP_MIN_READ = 1024 * 1024;
+static const uint32_t DEFAULT_HTTP_CACHE_BLOCKS = 8;
 
 
 namespace bmx
@@ -366,6 +371,61 @@ static void write_anc_samples(OutputTrack *output_track, Frame *frame, set<ANCDa
     output_track->WriteSamples(0, anc_buffer.GetBytes(), anc_buffer.GetSize(), 1);
 }
 
+static uint32_t split_sound_channels(MXFInputTrack *input_track, Frame *frame, bool ignore_d10_aes3_flags,
+                                     bmx::ByteArray &sound_buffer, vector<unsigned char*> &channel_data)
+{
+    const MXFTrackInfo *track_info = input_track->GetTrackInfo();
+    const MXFSoundTrackInfo *sound_info = dynamic_cast<const MXFSoundTrackInfo*>(track_info);
+    BMX_ASSERT(sound_info);
+    uint32_t channel_block_align = (sound_info->bits_per_sample + 7) / 8;
+
+    uint32_t channel_count;
+    uint32_t num_samples;
+    if (track_info->essence_type == D10_AES3_PCM) {
+        channel_count = 8;
+        num_samples = get_aes3_sample_count(frame->GetBytes(), frame->GetSize());
+    } else {
+        channel_count = sound_info->channel_count;
+        num_samples = frame->GetSize() / (channel_count * channel_block_align);
+    }
+    uint32_t channel_size = num_samples * channel_block_align;
+
+    // only the channels that are mapped to an output track are extracted
+    vector<bool> mapped_channels(channel_count, false);
+    uint32_t mapped_count = 0;
+    size_t i;
+    for (i = 0; i < input_track->GetOutputTrackCount(); i++) {
+        uint32_t input_channel_index = input_track->GetInputChannelIndex(i);
+        BMX_CHECK(input_channel_index < channel_count);
+        if (!mapped_channels[input_channel_index]) {
+            mapped_channels[input_channel_index] = true;
+            mapped_count++;
+        }
+    }
+
+    sound_buffer.Allocate(mapped_count * channel_size);
+    channel_data.assign(channel_count, 0);
+    unsigned char *channel_bytes = sound_buffer.GetBytes();
+    for (i = 0; i < channel_count; i++) {
+        if (mapped_channels[i]) {
+            channel_data[i] = channel_bytes;
+            channel_bytes += channel_size;
+        }
+    }
+
+    if (track_info->essence_type == D10_AES3_PCM) {
+        convert_aes3_to_pcm_channels(frame->GetBytes(), frame->GetSize(), ignore_d10_aes3_flags,
+                                     sound_info->bits_per_sample, (uint8_t)channel_count,
+                                     &channel_data[0], channel_size);
+    } else {
+        deinterleave_audio_channels(frame->GetBytes(), frame->GetSize(),
+                                    sound_info->bits_per_sample, (uint16_t)channel_count,
+                                    &channel_data[0], channel_size);
+    }
+
+    return num_samples;
+}
+
 static void disable_tracks(MXFReader *reader, const set<size_t> &track_indexes,
                            bool disable_audio, bool disable_video, bool disable_data)
 {
@@ -454,6 +514,8 @@ static void usage(const char *cmd)
     printf("  --group                 Use the group reader instead of the sequence reader\n");
     printf("                          Use this option if the files have different material packages\n");
     printf("                          but actually belong to the same virtual package / group\n");
+    printf("  --open-threads <count>  Open the files of a group or sequence concurrently using up to <count> threads. The default is 1\n");
+    printf("  --parallel-read         Read each file of a group on its own thread\n");
     printf("  --no-reorder            Don't attempt to order the inputs in a sequence\n");
     printf("                          Use this option for files with broken timecode\n");
     printf("  --rt <factor>           Transwrap at realtime rate x <factor>, where <factor> is a floating point value\n");
@@ -465,22 +527,44 @@ static void usage(const char *cmd)
     printf("                          <factor> value 1.0 results in realtime rate, value < 1.0 slower and > 1.0 faster\n");
     printf(" --disable-indexing-file   Use this option to stop the reader creating an index of the partitions and essence positions in the file up front\n");
     printf("                           This option can be used to avoid indexing files containing many partitions\n");
+    printf("  --index-cache           Save the partition, essence and index table layout in a '<filename>.bmxidx' cache file next to the input file\n");
+    printf("                          and restore it when the unmodified file is opened again, instead of re-reading it from the file\n");
+    printf("  --index-cache-dir <dir> Same as --index-cache, but place the index cache files in <dir>\n");
+    printf("  --read-queue <count>    Read up to <count> frame wrapped edit units ahead of the read position on a background thread\n");
+    printf("                          The default is 0 (disabled)\n");
+    printf("  --read-queue-size <bytes>\n");
+    printf("                          Limit the read queue to a total of <bytes>, which enables the queue if --read-queue is not set\n");
+    printf("                          The default is 0 (no limit)\n");
     if (mxf_http_is_supported()) {
         printf(" --http-min-read <bytes>\n");
         printf("                          Set the minimum number of bytes to read when accessing a file over HTTP. The default is %u.\n", DEFAULT_HTTP_MIN_READ);
         printf(" --http-disable-seek      Disable seeking when reading file over HTTP\n");
+        printf(" --http-cache <count>     Set the number of --http-min-read size blocks held in the HTTP read cache. The default is %u.\n", DEFAULT_HTTP_CACHE_BLOCKS);
+        printf(" --http-prefetch <count>  Request up to <count> blocks ahead of the read position concurrently when reading sequentially over HTTP\n");
+        printf("                          The default is 0 (disabled)\n");
+        printf(" --http-stats             Log HTTP read cache and request statistics when the file is closed\n");
     }
     printf("  --no-precharge          Don't output clip/track with precharge. Adjust the start position and duration instead\n");
     printf("  --no-rollout            Don't output clip/track with rollout. Adjust the duration instead\n");
     printf("  --rw-intl               Interleave input reads with output writes\n");
     printf("  --rw-intl-size          The interleave size. Default is %u\n", DEFAULT_RW_INTL_SIZE);
     printf("                          Value must be a multiple of the system page size, %u\n", mxf_get_system_page_size());
-#if defined(_WIN32)
+    printf("  --async-write           Write the output MXF files using a background thread\n");
+    printf("  --async-write-size <bytes>\n");
+    printf("                          The size of each of the %u async write buffers. Default is %u\n", DEFAULT_ASYNC_WRITE_BUFFERS, DEFAULT_ASYNC_WRITE_SIZE);
+#if !defined(_WIN32)
+    printf("  --direct-io             Write the output MXF files using direct I/O, bypassing the system page cache\n");
+#endif
     printf("  --seq-scan              Set the sequential scan hint for optimizing file caching whilst reading\n");
+#if !defined(_WIN32)
+    printf("  --read-ahead <bytes>    Request the system to cache <bytes> ahead of the read position. The default is 0 (disabled)\n");
+    printf("  --drop-behind           Drop cached file pages that are behind the read position\n");
+    printf("  --prefetch <count>      Read up to <count> indexed edit units ahead of the read position asynchronously\n");
+    printf("                          using io_uring where available, or background threads otherwise. The default is 0 (disabled)\n");
+#endif
 #if !defined(__MINGW32__)
     printf("  --mmap-file             Use memory-mapped file I/O for the MXF files\n");
     printf("                          Note: this may reduce file I/O performance and was found to be slower over network drives\n");
-#endif
 #endif
     printf("  --avcihead <format> <file> <offset>\n");
     printf("                          Default AVC-Intra sequence header data (512 bytes) to use when the input file does not have it\n");
@@ -877,6 +961,8 @@ int main(int argc, const char** argv)
     bool do_print_version = false;
     bool use_group_reader = false;
     bool keep_input_order = false;
+    uint32_t open_threads = 1;
+    bool parallel_read = false;
     BMX_OPT_PROP_DECL_DEF(uint8_t, user_afd, 0);
     vector<AVCIHeaderInput> avci_header_inputs;
     bool show_progress = false;
@@ -919,10 +1005,19 @@ int main(int argc, const char** argv)
     bool ignore_input_desc = false;
     bool input_file_md5 = false;
     int input_file_flags = 0;
+#if !defined(_WIN32)
+    uint32_t read_ahead_size = 0;
+    uint32_t prefetch_slots = 0;
+#endif
     bool no_precharge = false;
     bool no_rollout = false;
     bool rw_interleave = false;
     uint32_t rw_interleave_size = DEFAULT_RW_INTL_SIZE;
+    bool async_write = false;
+    uint32_t async_write_size = DEFAULT_ASYNC_WRITE_SIZE;
+#if !defined(_WIN32)
+    bool direct_io = false;
+#endif
     uint32_t system_page_size = mxf_get_system_page_size();
     uint8_t d10_mute_sound_flags = 0;
     uint8_t d10_invalid_sound_flags = 0;
@@ -956,6 +1051,10 @@ int main(int argc, const char** argv)
     float gf_retry_delay = DEFAULT_GF_RETRY_DELAY;
     float gf_rate_after_fail = DEFAULT_GF_RATE_AFTER_FAIL;
     bool enable_indexing_file = true;
+    bool enable_index_cache = false;
+    const char *index_cache_dir = "";
+    uint32_t read_queue_count = 0;
+    uint64_t read_queue_size = 0;
     bool product_info_set = false;
     string company_name;
     string product_name;
@@ -982,8 +1081,11 @@ int main(int argc, const char** argv)
     uint8_t rdd6_sdid = DEFAULT_RDD6_SDID;
     uint32_t http_min_read = DEFAULT_HTTP_MIN_READ;
     bool http_enable_seek = true;
+    uint32_t http_cache_blocks = DEFAULT_HTTP_CACHE_BLOCKS;
+    uint32_t http_prefetch = 0;
+    bool http_stats = false;
     bool mp_track_num = false;
-#if defined(_WIN32) && !defined(__MINGW32__)
+#if !defined(__MINGW32__)
     bool use_mmap_file = false;
 #endif
     vector<EmbedXMLInfo> embed_xml;
@@ -1263,6 +1365,27 @@ int main(int argc, const char** argv)
         {
             use_group_reader = true;
         }
+        else if (strcmp(argv[cmdln_index], "--open-threads") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue) || uvalue == 0)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            open_threads = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--parallel-read") == 0)
+        {
+            parallel_read = true;
+        }
         else if (strcmp(argv[cmdln_index], "--no-reorder") == 0)
         {
             keep_input_order = true;
@@ -1343,6 +1466,56 @@ int main(int argc, const char** argv)
         {
             enable_indexing_file = false;
         }
+        else if (strcmp(argv[cmdln_index], "--index-cache") == 0)
+        {
+            enable_index_cache = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--index-cache-dir") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for Option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            index_cache_dir = argv[cmdln_index + 1];
+            enable_index_cache = true;
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--read-queue") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for Option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue))
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for Option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            read_queue_count = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--read-queue-size") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for Option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_bytes_size(argv[cmdln_index + 1], &i64value))
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for Option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            read_queue_size = (uint64_t)(i64value);
+            cmdln_index++;
+        }
         else if (strcmp(argv[cmdln_index], "--http-min-read") == 0)
         {
             if (cmdln_index + 1 >= argc)
@@ -1364,6 +1537,44 @@ int main(int argc, const char** argv)
         {
             http_enable_seek = false;
         }
+        else if (strcmp(argv[cmdln_index], "--http-cache") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue))
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            http_cache_blocks = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--http-prefetch") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue))
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            http_prefetch = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--http-stats") == 0)
+        {
+            http_stats = true;
+        }
         else if (strcmp(argv[cmdln_index], "--no-precharge") == 0)
         {
             no_precharge = true;
@@ -1394,17 +1605,86 @@ int main(int argc, const char** argv)
             rw_interleave_size = uvalue;
             cmdln_index++;
         }
-#if defined(_WIN32)
+        else if (strcmp(argv[cmdln_index], "--async-write") == 0)
+        {
+            async_write = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--async-write-size") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for Option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue) || uvalue == 0)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for Option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            async_write_size = uvalue;
+            cmdln_index++;
+        }
+#if !defined(_WIN32)
+        else if (strcmp(argv[cmdln_index], "--direct-io") == 0)
+        {
+            direct_io = true;
+        }
+#endif
         else if (strcmp(argv[cmdln_index], "--seq-scan") == 0)
         {
+#if defined(_WIN32)
             input_file_flags |= MXF_WIN32_FLAG_SEQUENTIAL_SCAN;
+#else
+            input_file_flags |= MXF_DISK_FLAG_SEQUENTIAL_SCAN;
+#endif
+        }
+#if !defined(_WIN32)
+        else if (strcmp(argv[cmdln_index], "--read-ahead") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue))
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            read_ahead_size = (uint32_t)(uvalue);
+            cmdln_index++;
         }
+        else if (strcmp(argv[cmdln_index], "--prefetch") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue) || uvalue > MXF_PREFETCH_MAX_SLOTS)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            prefetch_slots = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--drop-behind") == 0)
+        {
+            input_file_flags |= MXF_DISK_FLAG_DROP_BEHIND;
+        }
+#endif
 #if !defined(__MINGW32__)
         else if (strcmp(argv[cmdln_index], "--mmap-file") == 0)
         {
             use_mmap_file = true;
         }
-#endif
 #endif
         else if (strcmp(argv[cmdln_index], "--avcihead") == 0)
         {
@@ -2997,17 +3277,30 @@ int main(int argc, const char** argv)
         if (input_file_md5)
             file_factory.AddInputChecksumType(MD5_CHECKSUM);
         file_factory.SetInputFlags(input_file_flags);
+#if !defined(_WIN32)
+        file_factory.SetReadAheadSize(read_ahead_size);
+        file_factory.SetPrefetch(prefetch_slots);
+#endif
         if (rw_interleave)
             file_factory.SetRWInterleave(rw_interleave_size);
+        if (async_write)
+            file_factory.SetAsyncWrite(async_write_size, DEFAULT_ASYNC_WRITE_BUFFERS);
+#if !defined(_WIN32)
+        file_factory.SetDirectIO(direct_io);
+#endif
         file_factory.SetHTTPMinReadSize(http_min_read);
         file_factory.SetHTTPEnableSeek(http_enable_seek);
-#if defined(_WIN32) && !defined(__MINGW32__)
+        file_factory.SetHTTPCacheBlocks(http_cache_blocks);
+        file_factory.SetHTTPPrefetch(http_prefetch);
+        file_factory.SetHTTPLogStats(http_stats);
+#if !defined(__MINGW32__)
         file_factory.SetUseMMapFile(use_mmap_file);
 #endif
 
         if (use_group_reader && input_filenames.size() > 1) {
             MXFGroupReader *group_reader = new MXFGroupReader();
-            MXFFileReader::OpenResult result;
+            vector<MXFFileReader*> grp_file_readers;
+            vector<string> grp_filenames;
             size_t i;
             for (i = 0; i < input_filenames.size(); i++) {
                 MXFFileReader *grp_file_reader = new MXFFileReader();
@@ -3015,23 +3308,32 @@ int main(int argc, const char** argv)
                 grp_file_reader->GetPackageResolver()->SetFileFactory(&file_factory, false);
                 grp_file_reader->SetST436ManifestFrameCount(st436_manifest_count);
                 grp_file_reader->SetEnableIndexFile(enable_indexing_file);
-                result = grp_file_reader->Open(input_filenames[i]);
-                if (result != MXFFileReader::MXF_RESULT_SUCCESS) {
+                grp_file_reader->SetIndexCache(enable_index_cache, index_cache_dir);
+                grp_file_reader->SetReadQueue(read_queue_count, read_queue_size);
+                grp_file_readers.push_back(grp_file_reader);
+                grp_filenames.push_back(input_filenames[i]);
+            }
+            vector<MXFFileReader::OpenResult> results = MXFFileReader::OpenMultiple(grp_file_readers, grp_filenames,
+                                                                                    open_threads);
+            for (i = 0; i < input_filenames.size(); i++) {
+                if (results[i] != MXFFileReader::MXF_RESULT_SUCCESS) {
                     log_error("Failed to open MXF file '%s': %s\n", input_filenames[i],
-                              MXFFileReader::ResultToString(result).c_str());
+                              MXFFileReader::ResultToString(results[i]).c_str());
                     throw false;
                 }
-                disable_tracks(grp_file_reader, disable_track_indexes[i],
+                disable_tracks(grp_file_readers[i], disable_track_indexes[i],
                                disable_audio[i], disable_video[i], disable_data[i]);
-                group_reader->AddReader(grp_file_reader);
+                group_reader->AddReader(grp_file_readers[i]);
             }
             if (!group_reader->Finalize())
                 throw false;
+            group_reader->SetParallelRead(parallel_read);
 
             reader = group_reader;
         } else if (input_filenames.size() > 1) {
             MXFSequenceReader *seq_reader = new MXFSequenceReader();
-            MXFFileReader::OpenResult result;
+            vector<MXFFileReader*> seq_file_readers;
+            vector<string> seq_filenames;
             size_t i;
             for (i = 0; i < input_filenames.size(); i++) {
                 MXFFileReader *seq_file_reader = new MXFFileReader();
@@ -3039,15 +3341,22 @@ int main(int argc, const char** argv)
                 seq_file_reader->GetPackageResolver()->SetFileFactory(&file_factory, false);
                 seq_file_reader->SetST436ManifestFrameCount(st436_manifest_count);
                 seq_file_reader->SetEnableIndexFile(enable_indexing_file);
-                result = seq_file_reader->Open(input_filenames[i]);
-                if (result != MXFFileReader::MXF_RESULT_SUCCESS) {
+                seq_file_reader->SetIndexCache(enable_index_cache, index_cache_dir);
+                seq_file_reader->SetReadQueue(read_queue_count, read_queue_size);
+                seq_file_readers.push_back(seq_file_reader);
+                seq_filenames.push_back(input_filenames[i]);
+            }
+            vector<MXFFileReader::OpenResult> results = MXFFileReader::OpenMultiple(seq_file_readers, seq_filenames,
+                                                                                    open_threads);
+            for (i = 0; i < input_filenames.size(); i++) {
+                if (results[i] != MXFFileReader::MXF_RESULT_SUCCESS) {
                     log_error("Failed to open MXF file '%s': %s\n", input_filenames[i],
-                              MXFFileReader::ResultToString(result).c_str());
+                              MXFFileReader::ResultToString(results[i]).c_str());
                     throw false;
                 }
-                disable_tracks(seq_file_reader, disable_track_indexes[i],
+                disable_tracks(seq_file_readers[i], disable_track_indexes[i],
                                disable_audio[i], disable_video[i], disable_data[i]);
-                seq_reader->AddReader(seq_file_reader);
+                seq_reader->AddReader(seq_file_readers[i]);
             }
             if (!seq_reader->Finalize(false, keep_input_order))
                 throw false;
@@ -3060,6 +3369,8 @@ int main(int argc, const char** argv)
             file_reader->GetPackageResolver()->SetFileFactory(&file_factory, false);
             file_reader->SetST436ManifestFrameCount(st436_manifest_count);
             file_reader->SetEnableIndexFile(enable_indexing_file);
+            file_reader->SetIndexCache(enable_index_cache, index_cache_dir);
+            file_reader->SetReadQueue(read_queue_count, read_queue_size);
             if (pass_dm && clip_sub_type == AS11_CLIP_SUB_TYPE)
                 AS11Info::RegisterExtensions(file_reader->GetHeaderMetadata());
             if (pass_dm && clip_sub_type == AS10_CLIP_SUB_TYPE)
@@ -3300,6 +3611,15 @@ int main(int argc, const char** argv)
             throw false;
         }
 
+        // frames read from the same content package reference the content package buffer rather than a copy
+        // and frames are recycled once they have been written
+        vector<PooledFrameFactory*> frame_pools;
+        for (i = 0; i < reader->GetNumTrackReaders(); i++) {
+            PooledFrameFactory *frame_pool = new PooledFrameFactory(new SharedBufferFrameFactory(), true);
+            reader->GetTrackReader(i)->GetFrameBuffer()->SetFrameFactory(frame_pool, true);
+            frame_pools.push_back(frame_pool);
+        }
+
 
         // set read limits
 
@@ -4700,6 +5020,7 @@ int main(int argc, const char** argv)
         int64_t container_duration;
         int64_t prev_container_duration = -1;
         bmx::ByteArray sound_buffer;
+        vector<unsigned char*> sound_channel_data;
         while (read_duration < 0 || total_read < read_duration) {
             uint32_t num_read = read_samples(reader, sample_sequence, &sample_sequence_offset, max_samples_per_read);
             if (num_read == 0) {
@@ -4800,6 +5121,10 @@ int main(int argc, const char** argv)
                     }
                 }
 
+                // multi-channel and AES3 sound is split into its mapped channels once for all output tracks
+                bool have_sound_channels = false;
+                uint32_t sound_channel_num_samples = 0;
+
                 size_t k;
                 for (k = 0; k < input_track->GetOutputTrackCount(); k++) {
                     OutputTrack *output_track = input_track->GetOutputTrack(k);
@@ -4826,22 +5151,16 @@ int main(int argc, const char** argv)
                         if ((input_sound_info && input_sound_info->channel_count > 1) ||
                                 input_track_info->essence_type == D10_AES3_PCM)
                         {
-                            sound_buffer.Allocate(frame->GetSize()); // more than enough
-                            if (input_track_info->essence_type == D10_AES3_PCM) {
-                                convert_aes3_to_pcm(frame->GetBytes(), frame->GetSize(), ignore_d10_aes3_flags,
-                                                    bits_per_sample, input_channel_index,
-                                                    sound_buffer.GetBytes(), sound_buffer.GetAllocatedSize());
-                                num_samples = get_aes3_sample_count(frame->GetBytes(), frame->GetSize());
-                            } else {
-                                deinterleave_audio(frame->GetBytes(), frame->GetSize(),
-                                                   bits_per_sample,
-                                                   input_sound_info->channel_count, input_channel_index,
-                                                   sound_buffer.GetBytes(), sound_buffer.GetAllocatedSize());
-                                num_samples = frame->GetSize() / (input_sound_info->channel_count * channel_block_align);
+                            if (!have_sound_channels) {
+                                sound_channel_num_samples = split_sound_channels(input_track, frame,
+                                                                                 ignore_d10_aes3_flags,
+                                                                                 sound_buffer, sound_channel_data);
+                                have_sound_channels = true;
                             }
+                            num_samples = sound_channel_num_samples;
 
                             output_track->WriteSamples(output_channel_index,
-                                                       sound_buffer.GetBytes(),
+                                                       sound_channel_data[input_channel_index],
                                                        num_samples * channel_block_align,
                                                        num_samples);
                         }
@@ -4873,7 +5192,7 @@ int main(int argc, const char** argv)
                         first_sound_num_samples = num_samples;
                 }
 
-                delete frame;
+                input_track->GetFrameBuffer()->DeleteFrame(frame);
             }
 
             // write samples for silence tracks
@@ -4985,6 +5304,14 @@ int main(int argc, const char** argv)
                  clip->GetDuration(),
                  get_generic_duration_string_2(clip->GetDuration(), clip->GetFrameRate()).c_str());
 
+        uint64_t frame_pool_hits = 0;
+        uint64_t frame_pool_misses = 0;
+        for (i = 0; i < frame_pools.size(); i++) {
+            frame_pool_hits   += frame_pools[i]->GetHitCount();
+            frame_pool_misses += frame_pools[i]->GetMissCount();
+        }
+        log_debug("Frame pool hits: %" PRIu64 ", misses: %" PRIu64 "\n", frame_pool_hits, frame_pool_misses);
+
 
         if (read_duration >= 0 && total_read != read_duration) {
             bool isError = reader->IsComplete() && total_read < read_duration - check_end_tolerance;
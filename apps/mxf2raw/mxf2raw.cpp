@@ -48,6 +48,7 @@
 
 #include <map>
 #include <set>
+#include <mutex>
 
 #include <bmx/mxf_reader/MXFFileReader.h>
 #include <bmx/mxf_reader/MXFGroupReader.h>
@@ -134,6 +135,7 @@ typedef struct
 
 
 static LogData LOG_DATA;
+static mutex LOG_DATA_MUTEX;
 
 static const char *APP_NAME                     = "mxf2raw";
 static const char *XML_INFO_WRITER_NAMESPACE    = "http://bbc.co.uk/rd/bmx/201312";
@@ -142,6 +144,7 @@ static const char *XML_INFO_WRITER_VERSION      = "0.1"; // format <major>.<mino
 static const char* STDIN_FILENAME = "stdin:";
 
 static const uint32_t DEFAULT_HTTP_MIN_READ = 1024 * 1024;
+static const uint32_t DEFAULT_HTTP_CACHE_BLOCKS = 8;
 
 
 namespace bmx
@@ -312,6 +315,9 @@ static void mxf2raw_vlog2(LogLevel level, const char *source, const char *format
     if (source)
         log_message.source = source;
     log_message.message = message;
+
+    // messages can be logged from multiple threads when opening files concurrently
+    lock_guard<mutex> lock(LOG_DATA_MUTEX);
     LOG_DATA.messages.push_back(log_message);
 }
 
@@ -1710,6 +1716,9 @@ static void usage(const char *cmd)
     printf(" --group               Use the group reader instead of the sequence reader\n");
     printf("                       Use this option if the files have different material packages\n");
     printf("                       but actually belong to the same virtual package / group\n");
+    printf(" --open-threads <count>\n");
+    printf("                       Open the files of a group or sequence concurrently using up to <count> threads. The default is 1\n");
+    printf(" --parallel-read       Read each file of a group on its own thread\n");
     printf(" --no-reorder          Don't attempt to re-order the inputs, based on timecode, when constructing a sequence\n");
     printf("                       Use this option for files with broken timecode\n");
     printf("\n");
@@ -1771,12 +1780,16 @@ static void usage(const char *cmd)
     printf(" --noro                Don't include roll-out frames\n");
     printf(" --rt <factor>         Read at realtime rate x <factor>, where <factor> is a floating point value\n");
     printf("                       <factor> value 1.0 results in realtime rate, value < 1.0 slower and > 1.0 faster\n");
-#if defined(_WIN32)
     printf(" --no-seq-scan         Do not set the sequential scan hint for optimizing file caching\n");
+#if !defined(_WIN32)
+    printf(" --read-ahead <bytes>  Request the system to cache <bytes> ahead of the read position. The default is 0 (disabled)\n");
+    printf(" --drop-behind         Drop cached file pages that are behind the read position\n");
+    printf(" --prefetch <count>    Read up to <count> indexed edit units ahead of the read position asynchronously\n");
+    printf("                       using io_uring where available, or background threads otherwise. The default is 0 (disabled)\n");
+#endif
 #if !defined(__MINGW32__)
     printf(" --mmap-file           Use memory-mapped file I/O for the MXF files\n");
     printf("                       Note: this may reduce file I/O performance and was found to be slower over network drives\n");
-#endif
 #endif
     printf(" --gf                  Support growing files. Retry reading a frame when it fails\n");
     printf(" --gf-retries <max>    Set the maximum times to retry reading a frame. The default is %u.\n", DEFAULT_GF_RETRIES);
@@ -1785,10 +1798,24 @@ static void usage(const char *cmd)
     printf("                       <factor> value 1.0 results in realtime rate, value < 1.0 slower and > 1.0 faster\n");
     printf(" --disable-indexing-file   Use this option to stop the reader creating an index of the partitions and essence positions in the file up front\n");
     printf("                           This option can be used to avoid indexing files containing many partitions\n");
+    printf(" --index-cache         Save the partition, essence and index table layout in a '<filename>.bmxidx' cache file next to the input file\n");
+    printf("                       and restore it when the unmodified file is opened again, instead of re-reading it from the file\n");
+    printf(" --index-cache-dir <dir>\n");
+    printf("                       Same as --index-cache, but place the index cache files in <dir>\n");
+    printf(" --read-queue <count>  Read up to <count> frame wrapped edit units ahead of the read position on a background thread\n");
+    printf("                       The default is 0 (disabled)\n");
+    printf(" --read-queue-size <bytes>\n");
+    printf("                       Limit the read queue to a total of <bytes>, which enables the queue if --read-queue is not set\n");
+    printf("                       The default is 0 (no limit)\n");
     if (mxf_http_is_supported()) {
         printf(" --http-min-read <bytes>\n");
         printf("                       Set the minimum number of bytes to read when accessing a file over HTTP. The default is %u.\n", DEFAULT_HTTP_MIN_READ);
         printf(" --http-disable-seek   Disable seeking when reading file over HTTP\n");
+        printf(" --http-cache <count>  Set the number of --http-min-read size blocks held in the HTTP read cache. The default is %u.\n", DEFAULT_HTTP_CACHE_BLOCKS);
+        printf(" --http-prefetch <count>\n");
+        printf("                       Request up to <count> blocks ahead of the read position concurrently when reading sequentially over HTTP\n");
+        printf("                       The default is 0 (disabled)\n");
+        printf(" --http-stats          Log HTTP read cache and request statistics when the file is closed\n");
     }
     printf("\n");
     printf(" --text-out <prefix>   Extract text based objects to files starting with <prefix>\n");
@@ -1818,6 +1845,8 @@ int main(int argc, const char** argv)
     set<ChecksumType> file_checksum_only_types;
     bool use_group_reader = false;
     bool keep_input_order = false;
+    uint32_t open_threads = 1;
+    bool parallel_read = false;
     bool check_end = false;
     bool check_complete = false;
     bool check_app_issues = false;
@@ -1858,7 +1887,9 @@ int main(int argc, const char** argv)
 #if defined(_WIN32)
     int file_flags = MXF_WIN32_FLAG_SEQUENTIAL_SCAN;
 #else
-    int file_flags = 0;
+    int file_flags = MXF_DISK_FLAG_SEQUENTIAL_SCAN;
+    uint32_t read_ahead_size = 0;
+    uint32_t prefetch_slots = 0;
 #endif
     bool realtime = false;
     float rt_factor = 1.0;
@@ -1867,10 +1898,17 @@ int main(int argc, const char** argv)
     float gf_retry_delay = DEFAULT_GF_RETRY_DELAY;
     float gf_rate_after_fail = DEFAULT_GF_RATE_AFTER_FAIL;
     bool enable_indexing_file = true;
+    bool enable_index_cache = false;
+    const char *index_cache_dir = "";
+    uint32_t read_queue_count = 0;
+    uint64_t read_queue_size = 0;
     uint32_t http_min_read = DEFAULT_HTTP_MIN_READ;
     bool http_enable_seek = true;
+    uint32_t http_cache_blocks = DEFAULT_HTTP_CACHE_BLOCKS;
+    uint32_t http_prefetch = 0;
+    bool http_stats = false;
     ChecksumType checkum_type;
-#if defined(_WIN32) && !defined(__MINGW32__)
+#if !defined(__MINGW32__)
     bool use_mmap_file = false;
 #endif
     const char *text_output_prefix = 0;
@@ -1879,6 +1917,7 @@ int main(int argc, const char** argv)
     const char *chna_text_output_prefix = 0;
     bool mca_detail = false;
     unsigned int uvalue;
+    int64_t i64value;
     int cmdln_index;
 
 
@@ -1954,6 +1993,27 @@ int main(int argc, const char** argv)
         {
             use_group_reader = true;
         }
+        else if (strcmp(argv[cmdln_index], "--open-threads") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue) || uvalue == 0)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            open_threads = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--parallel-read") == 0)
+        {
+            parallel_read = true;
+        }
         else if (strcmp(argv[cmdln_index], "--no-reorder") == 0)
         {
             keep_input_order = true;
@@ -2287,17 +2347,59 @@ int main(int argc, const char** argv)
             realtime = true;
             cmdln_index++;
         }
-#if defined(_WIN32)
         else if (strcmp(argv[cmdln_index], "--no-seq-scan") == 0)
         {
+#if defined(_WIN32)
             file_flags &= ~MXF_WIN32_FLAG_SEQUENTIAL_SCAN;
+#else
+            file_flags &= ~MXF_DISK_FLAG_SEQUENTIAL_SCAN;
+#endif
         }
+#if !defined(_WIN32)
+        else if (strcmp(argv[cmdln_index], "--read-ahead") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue))
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            read_ahead_size = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--prefetch") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue) || uvalue > MXF_PREFETCH_MAX_SLOTS)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            prefetch_slots = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--drop-behind") == 0)
+        {
+            file_flags |= MXF_DISK_FLAG_DROP_BEHIND;
+        }
+#endif
 #if !defined(__MINGW32__)
         else if (strcmp(argv[cmdln_index], "--mmap-file") == 0)
         {
             use_mmap_file = true;
         }
-#endif
 #endif
         else if (strcmp(argv[cmdln_index], "--gf") == 0)
         {
@@ -2358,6 +2460,56 @@ int main(int argc, const char** argv)
         {
             enable_indexing_file = false;
         }
+        else if (strcmp(argv[cmdln_index], "--index-cache") == 0)
+        {
+            enable_index_cache = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--index-cache-dir") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            index_cache_dir = argv[cmdln_index + 1];
+            enable_index_cache = true;
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--read-queue") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue))
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            read_queue_count = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--read-queue-size") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_bytes_size(argv[cmdln_index + 1], &i64value))
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            read_queue_size = (uint64_t)(i64value);
+            cmdln_index++;
+        }
         else if (strcmp(argv[cmdln_index], "--text-out") == 0)
         {
             if (cmdln_index + 1 >= argc)
@@ -2432,6 +2584,44 @@ int main(int argc, const char** argv)
         {
             http_enable_seek = false;
         }
+        else if (strcmp(argv[cmdln_index], "--http-cache") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue))
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            http_cache_blocks = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--http-prefetch") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue))
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            http_prefetch = (uint32_t)(uvalue);
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--http-stats") == 0)
+        {
+            http_stats = true;
+        }
         else if (strcmp(argv[cmdln_index], "--regtest") == 0)
         {
             BMX_REGRESSION_TEST = true;
@@ -2591,16 +2781,24 @@ int main(int argc, const char** argv)
         if (!file_checksum_types.empty())
             file_factory.SetInputChecksumTypes(file_checksum_types);
         file_factory.SetInputFlags(file_flags);
+#if !defined(_WIN32)
+        file_factory.SetReadAheadSize(read_ahead_size);
+        file_factory.SetPrefetch(prefetch_slots);
+#endif
         file_factory.SetHTTPMinReadSize(http_min_read);
         file_factory.SetHTTPEnableSeek(http_enable_seek);
-#if defined(_WIN32) && !defined(__MINGW32__)
+        file_factory.SetHTTPCacheBlocks(http_cache_blocks);
+        file_factory.SetHTTPPrefetch(http_prefetch);
+        file_factory.SetHTTPLogStats(http_stats);
+#if !defined(__MINGW32__)
         file_factory.SetUseMMapFile(use_mmap_file);
 #endif
 
         int input_open_flags = do_parse_read && !do_ess_read ? MXFFileReader::MXF_MODE_PARSE_ONLY : 0;
         if (use_group_reader && input_filenames.size() > 1) {
             MXFGroupReader *group_reader = new MXFGroupReader();
-            MXFFileReader::OpenResult result;
+            vector<MXFFileReader*> grp_file_readers;
+            vector<string> grp_filenames;
             size_t i;
             for (i = 0; i < input_filenames.size(); i++) {
                 MXFFileReader *grp_file_reader = new MXFFileReader();
@@ -2608,23 +2806,32 @@ int main(int argc, const char** argv)
                 grp_file_reader->GetPackageResolver()->SetFileFactory(&file_factory, false);
                 grp_file_reader->SetST436ManifestFrameCount(st436_manifest_count);
                 grp_file_reader->SetEnableIndexFile(enable_indexing_file);
-                result = grp_file_reader->Open(input_filenames[i], input_open_flags);
-                if (result != MXFFileReader::MXF_RESULT_SUCCESS) {
+                grp_file_reader->SetIndexCache(enable_index_cache, index_cache_dir);
+                grp_file_reader->SetReadQueue(read_queue_count, read_queue_size);
+                grp_file_readers.push_back(grp_file_reader);
+                grp_filenames.push_back(input_filenames[i]);
+            }
+            vector<MXFFileReader::OpenResult> results = MXFFileReader::OpenMultiple(grp_file_readers, grp_filenames,
+                                                                                    open_threads, input_open_flags);
+            for (i = 0; i < input_filenames.size(); i++) {
+                if (results[i] != MXFFileReader::MXF_RESULT_SUCCESS) {
                     log_error("Failed to open MXF file '%s': %s\n", get_input_filename(input_filenames[i]),
-                              MXFFileReader::ResultToString(result).c_str());
+                              MXFFileReader::ResultToString(results[i]).c_str());
                     throw false;
                 }
-                disable_tracks(grp_file_reader, disable_track_indexes[i],
+                disable_tracks(grp_file_readers[i], disable_track_indexes[i],
                                disable_audio[i], disable_video[i], disable_data[i]);
-                group_reader->AddReader(grp_file_reader);
+                group_reader->AddReader(grp_file_readers[i]);
             }
             if (!group_reader->Finalize())
                 throw false;
+            group_reader->SetParallelRead(parallel_read);
 
             reader = group_reader;
         } else if (input_filenames.size() > 1) {
             MXFSequenceReader *seq_reader = new MXFSequenceReader();
-            MXFFileReader::OpenResult result;
+            vector<MXFFileReader*> seq_file_readers;
+            vector<string> seq_filenames;
             size_t i;
             for (i = 0; i < input_filenames.size(); i++) {
                 MXFFileReader *seq_file_reader = new MXFFileReader();
@@ -2632,15 +2839,22 @@ int main(int argc, const char** argv)
                 seq_file_reader->GetPackageResolver()->SetFileFactory(&file_factory, false);
                 seq_file_reader->SetST436ManifestFrameCount(st436_manifest_count);
                 seq_file_reader->SetEnableIndexFile(enable_indexing_file);
-                result = seq_file_reader->Open(input_filenames[i], input_open_flags);
-                if (result != MXFFileReader::MXF_RESULT_SUCCESS) {
+                seq_file_reader->SetIndexCache(enable_index_cache, index_cache_dir);
+                seq_file_reader->SetReadQueue(read_queue_count, read_queue_size);
+                seq_file_readers.push_back(seq_file_reader);
+                seq_filenames.push_back(input_filenames[i]);
+            }
+            vector<MXFFileReader::OpenResult> results = MXFFileReader::OpenMultiple(seq_file_readers, seq_filenames,
+                                                                                    open_threads, input_open_flags);
+            for (i = 0; i < input_filenames.size(); i++) {
+                if (results[i] != MXFFileReader::MXF_RESULT_SUCCESS) {
                     log_error("Failed to open MXF file '%s': %s\n", get_input_filename(input_filenames[i]),
-                              MXFFileReader::ResultToString(result).c_str());
+                              MXFFileReader::ResultToString(results[i]).c_str());
                     throw false;
                 }
-                disable_tracks(seq_file_reader, disable_track_indexes[i],
+                disable_tracks(seq_file_readers[i], disable_track_indexes[i],
                                disable_audio[i], disable_video[i], disable_data[i]);
-                seq_reader->AddReader(seq_file_reader);
+                seq_reader->AddReader(seq_file_readers[i]);
             }
             if (!seq_reader->Finalize(false, keep_input_order))
                 throw false;
@@ -2653,6 +2867,8 @@ int main(int argc, const char** argv)
             file_reader->GetPackageResolver()->SetFileFactory(&file_factory, false);
             file_reader->SetST436ManifestFrameCount(st436_manifest_count);
             file_reader->SetEnableIndexFile(enable_indexing_file);
+            file_reader->SetIndexCache(enable_index_cache, index_cache_dir);
+            file_reader->SetReadQueue(read_queue_count, read_queue_size);
             if (do_as11_info)
                 as11_register_extensions(file_reader);
             if (do_as10_info)
@@ -3028,24 +3244,33 @@ int main(int argc, const char** argv)
                             if (sound_info && deinterleave && sound_info->channel_count > 1 &&
                                 sound_info->essence_type != MGA && sound_info->essence_type != MGA_SADM)
                             {
-                                sound_buffer.Allocate(frame->GetSize()); // more than enough
+                                // split all channels in one pass
+                                uint32_t channel_size;
+                                if (sound_info->essence_type == D10_AES3_PCM) {
+                                    channel_size = sound_info->block_align / sound_info->channel_count *
+                                                        get_aes3_sample_count(frame->GetBytes(), frame->GetSize());
+                                } else {
+                                    channel_size = frame->GetSize() / sound_info->channel_count;
+                                }
+                                sound_buffer.Allocate(sound_info->channel_count * channel_size);
+                                vector<unsigned char*> channel_data(sound_info->channel_count);
                                 uint32_t c;
+                                for (c = 0; c < sound_info->channel_count; c++)
+                                    channel_data[c] = sound_buffer.GetBytes() + c * channel_size;
+                                if (sound_info->essence_type == D10_AES3_PCM) {
+                                    convert_aes3_to_pcm_channels(frame->GetBytes(), frame->GetSize(), false,
+                                                                 sound_info->bits_per_sample,
+                                                                 (uint8_t)sound_info->channel_count,
+                                                                 &channel_data[0], channel_size);
+                                } else {
+                                    deinterleave_audio_channels(frame->GetBytes(), frame->GetSize(),
+                                                                sound_info->bits_per_sample, sound_info->channel_count,
+                                                                &channel_data[0], channel_size);
+                                }
                                 for (c = 0; c < sound_info->channel_count; c++) {
-                                    if (sound_info->essence_type == D10_AES3_PCM) {
-                                        convert_aes3_to_pcm(frame->GetBytes(), frame->GetSize(), false,
-                                                            sound_info->bits_per_sample, c,
-                                                            sound_buffer.GetBytes(), sound_buffer.GetAllocatedSize());
-                                        sound_buffer.SetSize(sound_info->block_align / sound_info->channel_count *
-                                                                get_aes3_sample_count(frame->GetBytes(), frame->GetSize()));
-                                    } else {
-                                        deinterleave_audio(frame->GetBytes(), frame->GetSize(),
-                                                           sound_info->bits_per_sample, sound_info->channel_count, c,
-                                                           sound_buffer.GetBytes(), sound_buffer.GetAllocatedSize());
-                                        sound_buffer.SetSize(frame->GetSize() / sound_info->channel_count);
-                                    }
                                     output_file_manager.GetTrackFile(i, c, &file, &filename);
                                     write_data(file, filename,
-                                               sound_buffer.GetBytes(), sound_buffer.GetSize(),
+                                               channel_data[c], channel_size,
                                                (wrap_klv_mask.find(track_info->data_def) != wrap_klv_mask.end()),
                                                &frame->element_key);
                                 }
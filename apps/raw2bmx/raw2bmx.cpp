@@ -62,6 +62,7 @@
 #include <bmx/essence_parser/VC2EssenceParser.h>
 #include <bmx/essence_parser/JXSEssenceParser.h>
 #include <bmx/essence_parser/RawEssenceReader.h>
+#include <bmx/essence_parser/RawFrameScanner.h>
 #include <bmx/essence_parser/FileEssenceSource.h>
 #include <bmx/essence_parser/KLVEssenceSource.h>
 #include <bmx/essence_parser/KLVEssenceReader.h>
@@ -79,6 +80,7 @@
 #include <bmx/Utils.h>
 #include <bmx/Version.h>
 #include <bmx/apps/AppUtils.h>
+#include <bmx/apps/AppMXFFileFactory.h>
 #include <bmx/apps/TimedTextManifestParser.h>
 #include <bmx/apps/ADMCHNATextFileHelper.h>
 #include <bmx/as11/AS11Labels.h>
@@ -475,6 +477,12 @@ static void usage(const char *cmd)
     printf("  --dur <frame>           Set the duration in frames in frame rate units. Default is minimum input duration\n");
     printf("  --rt <factor>           Wrap at realtime rate x <factor>, where <factor> is a floating point value\n");
     printf("                          <factor> value 1.0 results in realtime rate, value < 1.0 slower and > 1.0 faster\n");
+    printf("  --scan-threads <count>  Find the frame boundaries of raw AVC, MPEG-2 and JPEG 2000 input files using <count> threads before wrapping\n");
+    printf("                          The file is split into chunks that are parsed in parallel. Default is 1, i.e. no frame scan\n");
+    printf("  --scan-chunk <size>     Minimum size in bytes of a chunk for --scan-threads. Default is 16777216 (16MiB)\n");
+#if !defined(_WIN32)
+    printf("  --direct-io             Write the output MXF files using direct I/O, bypassing the system page cache\n");
+#endif
     printf("  --avcihead <format> <file> <offset>\n");
     printf("                          Default AVC-Intra sequence header data (512 bytes) to use when the input file does not have it\n");
     printf("                          <format> is a comma separated list of one or more of the following integer values:\n");
@@ -992,6 +1000,11 @@ int main(int argc, const char** argv)
     bool force_no_avci_head = false;
     bool realtime = false;
     float rt_factor = 1.0;
+    uint32_t scan_threads = 1;
+    int64_t scan_chunk_size = 16 * 1024 * 1024;
+#if !defined(_WIN32)
+    bool direct_io = false;
+#endif
     bool product_info_set = false;
     string company_name;
     string product_name;
@@ -1247,6 +1260,45 @@ int main(int argc, const char** argv)
             realtime = true;
             cmdln_index++;
         }
+        else if (strcmp(argv[cmdln_index], "--scan-threads") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for Option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_int(argv[cmdln_index + 1], &uvalue) || uvalue == 0)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for Option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            scan_threads = uvalue;
+            cmdln_index++;
+        }
+        else if (strcmp(argv[cmdln_index], "--scan-chunk") == 0)
+        {
+            if (cmdln_index + 1 >= argc)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Missing argument for Option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (!parse_bytes_size(argv[cmdln_index + 1], &scan_chunk_size) || scan_chunk_size <= 0)
+            {
+                usage_ref(argv[0]);
+                fprintf(stderr, "Invalid value '%s' for Option '%s'\n", argv[cmdln_index + 1], argv[cmdln_index]);
+                return 1;
+            }
+            cmdln_index++;
+        }
+#if !defined(_WIN32)
+        else if (strcmp(argv[cmdln_index], "--direct-io") == 0)
+        {
+            direct_io = true;
+        }
+#endif
         else if (strcmp(argv[cmdln_index], "--avcihead") == 0)
         {
             if (cmdln_index + 3 >= argc)
@@ -5080,7 +5132,10 @@ int main(int argc, const char** argv)
             if (avid_gf)
                 flavour |= AVID_GROWING_FILE_FLAVOUR;
         }
-        DefaultMXFFileFactory file_factory;
+        AppMXFFileFactory file_factory;
+#if !defined(_WIN32)
+        file_factory.SetDirectIO(direct_io);
+#endif
         ClipWriter *clip = 0;
         switch (clip_type)
         {
@@ -6149,6 +6204,31 @@ int main(int argc, const char** argv)
         }
 
 
+        // find the frame boundaries of raw input files in parallel
+
+        if (scan_threads > 1) {
+            for (i = 0; i < inputs.size(); i++) {
+                RawInput *input = &inputs[i];
+                if (input->disabled || !input->raw_reader || !input->filename || input->parse_klv ||
+                    input->raw_reader->GetFixedSampleSize() != 0)
+                {
+                    continue;
+                }
+
+                RawFrameScanner scanner;
+                scanner.SetNumThreads(scan_threads);
+                scanner.SetMinChunkSize(scan_chunk_size);
+                if (scanner.Scan(input->raw_reader, input->filename, input->file_start_offset)) {
+                    input->raw_reader->SetFrameOffsets(scanner.GetFrameOffsets(), scanner.IsComplete());
+                    log_debug("Scanned %" PRIszt " frames in '%s' using %u chunks and %u seam frames%s\n",
+                              scanner.GetFrameOffsets().size() - 1, input->filename,
+                              scanner.GetNumChunks(), scanner.GetNumSeamFrames(),
+                              scanner.IsComplete() ? "" : ", remaining frames are parsed");
+                }
+            }
+        }
+
+
         // read more than 1 sample to improve efficiency if the input is sound only and the output
         // doesn't require a sample sequence
 
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <mxf/mxf_types.h>
+#include <mxf/mxf_arena.h>
+#include <mxf/mxf_macros.h>
+#include <mxf/mxf_logging.h>
+
+
+#define MIN_BLOCK_SIZE      (16 * 1024)
+#define MAX_BLOCK_SIZE      (1024 * 1024)
+#define ALIGNMENT           8
+
+#define ALIGN_SIZE(size)    (((size) + ALIGNMENT - 1) & ~((size_t)ALIGNMENT - 1))
+#define BLOCK_HEADER_SIZE   ALIGN_SIZE(sizeof(MXFArenaBlock))
+
+
+
+static MXFArenaBlock* create_block(size_t size)
+{
+    MXFArenaBlock *block;
+
+    block = (MXFArenaBlock*)malloc(BLOCK_HEADER_SIZE + size);
+    if (!block) {
+        mxf_log_error("Failed to allocate arena block of size %" PRIu64 "\n", (uint64_t)size);
+        return NULL;
+    }
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+
+    return block;
+}
+
+
+
+int mxf_create_arena(MXFArena **arena)
+{
+    MXFArena *new_arena;
+
+    CHK_MALLOC_ORET(new_arena, MXFArena);
+    memset(new_arena, 0, sizeof(*new_arena));
+    new_arena->next_block_size = MIN_BLOCK_SIZE;
+    new_arena->ref_count = 1;
+
+    *arena = new_arena;
+    return 1;
+}
+
+MXFArena* mxf_ref_arena(MXFArena *arena)
+{
+    if (arena)
+        arena->ref_count++;
+
+    return arena;
+}
+
+void mxf_unref_arena(MXFArena **arena)
+{
+    MXFArenaBlock *block;
+    MXFArenaBlock *next_block;
+
+    if (!(*arena))
+        return;
+
+    (*arena)->ref_count--;
+    if ((*arena)->ref_count == 0) {
+        block = (*arena)->blocks;
+        while (block) {
+            next_block = block->next;
+            free(block);
+            block = next_block;
+        }
+        free(*arena);
+    }
+
+    *arena = NULL;
+}
+
+void* mxf_arena_alloc(MXFArena *arena, size_t size)
+{
+    MXFArenaBlock *block = arena->blocks;
+    void *result;
+
+    size = ALIGN_SIZE(size);
+
+    if (!block || block->size - block->used < size) {
+        /* large allocations get a block of their own which is placed after the current block so that
+           the remaining space in the current block can still be used */
+        if (size > arena->next_block_size / 4) {
+            block = create_block(size);
+            if (!block)
+                return NULL;
+            if (arena->blocks) {
+                block->next = arena->blocks->next;
+                arena->blocks->next = block;
+            } else {
+                arena->blocks = block;
+            }
+        } else {
+            block = create_block(arena->next_block_size);
+            if (!block)
+                return NULL;
+            block->next = arena->blocks;
+            arena->blocks = block;
+            if (arena->next_block_size < MAX_BLOCK_SIZE)
+                arena->next_block_size *= 2;
+        }
+    }
+
+    result = (uint8_t*)block + BLOCK_HEADER_SIZE + block->used;
+    block->used += size;
+
+    return result;
+}
+
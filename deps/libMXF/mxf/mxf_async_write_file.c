@@ -0,0 +1,535 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_async_write_file.h>
+#include <mxf/mxf_macros.h>
+
+
+#if defined(_WIN32)
+
+typedef CRITICAL_SECTION    AsyncMutex;
+typedef CONDITION_VARIABLE  AsyncCond;
+typedef HANDLE              AsyncThread;
+
+#define MUTEX_INIT(m)       (InitializeCriticalSection(m), 1)
+#define MUTEX_DESTROY(m)    DeleteCriticalSection(m)
+#define MUTEX_LOCK(m)       EnterCriticalSection(m)
+#define MUTEX_UNLOCK(m)     LeaveCriticalSection(m)
+#define COND_INIT(c)        (InitializeConditionVariable(c), 1)
+#define COND_DESTROY(c)
+#define COND_WAIT(c, m)     SleepConditionVariableCS(c, m, INFINITE)
+#define COND_SIGNAL(c)      WakeConditionVariable(c)
+#define COND_BROADCAST(c)   WakeAllConditionVariable(c)
+
+#else
+
+typedef pthread_mutex_t     AsyncMutex;
+typedef pthread_cond_t      AsyncCond;
+typedef pthread_t           AsyncThread;
+
+#define MUTEX_INIT(m)       (pthread_mutex_init(m, NULL) == 0)
+#define MUTEX_DESTROY(m)    pthread_mutex_destroy(m)
+#define MUTEX_LOCK(m)       pthread_mutex_lock(m)
+#define MUTEX_UNLOCK(m)     pthread_mutex_unlock(m)
+#define COND_INIT(c)        (pthread_cond_init(c, NULL) == 0)
+#define COND_DESTROY(c)     pthread_cond_destroy(c)
+#define COND_WAIT(c, m)     pthread_cond_wait(c, m)
+#define COND_SIGNAL(c)      pthread_cond_signal(c)
+#define COND_BROADCAST(c)   pthread_cond_broadcast(c)
+
+#endif
+
+
+typedef struct
+{
+    uint8_t *data;
+    uint32_t size;
+    int64_t position;
+} WriteBuffer;
+
+struct MXFFileSysData
+{
+    MXFFile *target;
+    int64_t targetPosition;
+
+    WriteBuffer *buffers;
+    uint32_t numBuffers;
+    uint32_t bufferSize;
+
+    /* the buffer being filled by the writer. It is the buffer at fillIndex when not NULL */
+    WriteBuffer *fillBuffer;
+    int64_t position;
+
+    /* fields below are shared with the thread and are protected by the mutex */
+    uint32_t fillIndex;
+    uint32_t writeIndex;
+    uint32_t queuedCount;
+    int writeFailed;
+    int stopThread;
+
+    AsyncMutex mutex;
+    AsyncCond bufferQueuedCond;
+    AsyncCond bufferFreeCond;
+    AsyncThread thread;
+    int haveThread;
+};
+
+
+
+static int write_buffer_to_target(MXFFileSysData *sysData, WriteBuffer *buffer)
+{
+    if (sysData->targetPosition != buffer->position) {
+        if (!mxf_file_seek(sysData->target, buffer->position, SEEK_SET)) {
+            mxf_log_error("Failed to seek to async write buffer position 0x%" PRIx64 "\n", buffer->position);
+            return 0;
+        }
+        sysData->targetPosition = buffer->position;
+    }
+
+    if (mxf_file_write(sysData->target, buffer->data, buffer->size) != buffer->size) {
+        mxf_log_error("Failed to write %u bytes from async write buffer\n", buffer->size);
+        return 0;
+    }
+    sysData->targetPosition += buffer->size;
+
+    return 1;
+}
+
+static void run_write_thread(MXFFileSysData *sysData)
+{
+    WriteBuffer *buffer;
+    int writeFailed;
+
+    MUTEX_LOCK(&sysData->mutex);
+    for (;;) {
+        while (sysData->queuedCount == 0 && !sysData->stopThread)
+            COND_WAIT(&sysData->bufferQueuedCond, &sysData->mutex);
+        if (sysData->queuedCount == 0)
+            break;
+
+        buffer = &sysData->buffers[sysData->writeIndex];
+        writeFailed = sysData->writeFailed;
+        MUTEX_UNLOCK(&sysData->mutex);
+
+        /* buffers queued after a failure are discarded */
+        if (!writeFailed && !write_buffer_to_target(sysData, buffer))
+            writeFailed = 1;
+
+        MUTEX_LOCK(&sysData->mutex);
+        sysData->writeFailed = writeFailed;
+        sysData->writeIndex = (sysData->writeIndex + 1) % sysData->numBuffers;
+        sysData->queuedCount--;
+        COND_BROADCAST(&sysData->bufferFreeCond);
+    }
+    MUTEX_UNLOCK(&sysData->mutex);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI write_thread(LPVOID arg)
+{
+    run_write_thread((MXFFileSysData*)arg);
+    return 0;
+}
+#else
+static void* write_thread(void *arg)
+{
+    run_write_thread((MXFFileSysData*)arg);
+    return NULL;
+}
+#endif
+
+static int start_write_thread(MXFFileSysData *sysData)
+{
+#if defined(_WIN32)
+    sysData->thread = CreateThread(NULL, 0, write_thread, sysData, 0, NULL);
+    if (!sysData->thread) {
+        mxf_log_error("Failed to create async write thread: error %u\n", (unsigned int)GetLastError());
+        return 0;
+    }
+#else
+    int result = pthread_create(&sysData->thread, NULL, write_thread, sysData);
+    if (result != 0) {
+        char errorBuf[128];
+        mxf_log_error("Failed to create async write thread: %s\n", mxf_strerror(result, errorBuf, sizeof(errorBuf)));
+        return 0;
+    }
+#endif
+
+    sysData->haveThread = 1;
+    return 1;
+}
+
+static void stop_write_thread(MXFFileSysData *sysData)
+{
+    if (!sysData->haveThread)
+        return;
+
+    MUTEX_LOCK(&sysData->mutex);
+    sysData->stopThread = 1;
+    COND_SIGNAL(&sysData->bufferQueuedCond);
+    MUTEX_UNLOCK(&sysData->mutex);
+
+#if defined(_WIN32)
+    WaitForSingleObject(sysData->thread, INFINITE);
+    CloseHandle(sysData->thread);
+#else
+    pthread_join(sysData->thread, NULL);
+#endif
+    sysData->haveThread = 0;
+}
+
+static int get_fill_buffer(MXFFileSysData *sysData)
+{
+    int writeFailed;
+
+    MUTEX_LOCK(&sysData->mutex);
+    while (sysData->queuedCount == sysData->numBuffers && !sysData->writeFailed)
+        COND_WAIT(&sysData->bufferFreeCond, &sysData->mutex);
+    writeFailed = sysData->writeFailed;
+    MUTEX_UNLOCK(&sysData->mutex);
+
+    if (writeFailed)
+        return 0;
+
+    sysData->fillBuffer = &sysData->buffers[sysData->fillIndex];
+    sysData->fillBuffer->size     = 0;
+    sysData->fillBuffer->position = sysData->position;
+    return 1;
+}
+
+static void queue_fill_buffer(MXFFileSysData *sysData)
+{
+    if (!sysData->fillBuffer)
+        return;
+
+    if (sysData->fillBuffer->size > 0) {
+        MUTEX_LOCK(&sysData->mutex);
+        sysData->fillIndex = (sysData->fillIndex + 1) % sysData->numBuffers;
+        sysData->queuedCount++;
+        COND_SIGNAL(&sysData->bufferQueuedCond);
+        MUTEX_UNLOCK(&sysData->mutex);
+    }
+
+    sysData->fillBuffer = NULL;
+}
+
+static int wait_for_writes(MXFFileSysData *sysData)
+{
+    int writeFailed;
+
+    queue_fill_buffer(sysData);
+
+    MUTEX_LOCK(&sysData->mutex);
+    while (sysData->queuedCount > 0)
+        COND_WAIT(&sysData->bufferFreeCond, &sysData->mutex);
+    writeFailed = sysData->writeFailed;
+    MUTEX_UNLOCK(&sysData->mutex);
+
+    return !writeFailed;
+}
+
+/* the thread is idle after this call and the target can be accessed directly until the next buffer is queued */
+static int sync_target(MXFFileSysData *sysData)
+{
+    if (!wait_for_writes(sysData))
+        return 0;
+
+    if (sysData->targetPosition != sysData->position) {
+        if (!mxf_file_seek(sysData->target, sysData->position, SEEK_SET))
+            return 0;
+        sysData->targetPosition = sysData->position;
+    }
+
+    return 1;
+}
+
+
+static void async_file_close(MXFFileSysData *sysData)
+{
+    if (sysData->haveThread) {
+        queue_fill_buffer(sysData);
+        stop_write_thread(sysData);
+        if (sysData->writeFailed)
+            mxf_log_error("Async file writes failed and data was not written to the file\n");
+    }
+
+    if (sysData->target)
+        mxf_file_close(&sysData->target);
+}
+
+static int async_file_flush(MXFFileSysData *sysData)
+{
+    if (!wait_for_writes(sysData)) {
+        mxf_log_error("Async file writes failed and data was not written to the file\n");
+        return 0;
+    }
+
+    return mxf_file_flush(sysData->target);
+}
+
+static uint32_t async_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    uint32_t numRead;
+
+    if (!sync_target(sysData))
+        return 0;
+
+    numRead = mxf_file_read(sysData->target, data, count);
+    sysData->position       += numRead;
+    sysData->targetPosition += numRead;
+
+    return numRead;
+}
+
+static uint32_t async_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    uint32_t remCount = count;
+    uint32_t numWrite;
+
+    while (remCount > 0) {
+        if (!sysData->fillBuffer && !get_fill_buffer(sysData))
+            break;
+
+        numWrite = sysData->bufferSize - sysData->fillBuffer->size;
+        if (numWrite > remCount)
+            numWrite = remCount;
+        memcpy(&sysData->fillBuffer->data[sysData->fillBuffer->size], &data[count - remCount], numWrite);
+        sysData->fillBuffer->size += numWrite;
+        sysData->position         += numWrite;
+        remCount                  -= numWrite;
+
+        if (sysData->fillBuffer->size == sysData->bufferSize)
+            queue_fill_buffer(sysData);
+    }
+
+    return count - remCount;
+}
+
+static uint64_t async_file_writev(MXFFileSysData *sysData, const MXFFileIOVec *iov, uint32_t iovcnt)
+{
+    uint64_t result = 0;
+    uint32_t numWrite;
+    uint32_t i;
+
+    for (i = 0; i < iovcnt; i++) {
+        numWrite = async_file_write(sysData, iov[i].data, iov[i].size);
+        result += numWrite;
+        if (numWrite != iov[i].size)
+            break;
+    }
+
+    return result;
+}
+
+static int async_file_getchar(MXFFileSysData *sysData)
+{
+    uint8_t c;
+    if (async_file_read(sysData, &c, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int async_file_putchar(MXFFileSysData *sysData, int c)
+{
+    uint8_t data = (uint8_t)c;
+    if (async_file_write(sysData, &data, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int async_file_eof(MXFFileSysData *sysData)
+{
+    if (!sync_target(sysData))
+        return 1;
+
+    return mxf_file_eof(sysData->target);
+}
+
+static int async_file_seek(MXFFileSysData *sysData, int64_t offset, int whence)
+{
+    int64_t newPosition;
+
+    if (whence == SEEK_END) {
+        if (!sync_target(sysData) || !mxf_file_seek(sysData->target, offset, whence))
+            return 0;
+        sysData->targetPosition = mxf_file_tell(sysData->target);
+        sysData->position       = sysData->targetPosition;
+        return 1;
+    }
+
+    if (whence == SEEK_CUR)
+        newPosition = sysData->position + offset;
+    else
+        newPosition = offset;
+    if (newPosition < 0)
+        return 0;
+
+    if (newPosition != sysData->position) {
+        if (!mxf_file_is_seekable(sysData->target))
+            return 0;
+        queue_fill_buffer(sysData);
+        sysData->position = newPosition;
+    }
+
+    return 1;
+}
+
+static int64_t async_file_tell(MXFFileSysData *sysData)
+{
+    return sysData->position;
+}
+
+static int async_file_is_seekable(MXFFileSysData *sysData)
+{
+    return mxf_file_is_seekable(sysData->target);
+}
+
+static int64_t async_file_size(MXFFileSysData *sysData)
+{
+    if (!wait_for_writes(sysData))
+        return -1;
+
+    return mxf_file_size(sysData->target);
+}
+
+static void free_async_file(MXFFileSysData *sysData)
+{
+    uint32_t i;
+
+    if (!sysData)
+        return;
+
+    if (sysData->buffers) {
+        for (i = 0; i < sysData->numBuffers; i++)
+            free(sysData->buffers[i].data);
+        free(sysData->buffers);
+    }
+    COND_DESTROY(&sysData->bufferFreeCond);
+    COND_DESTROY(&sysData->bufferQueuedCond);
+    MUTEX_DESTROY(&sysData->mutex);
+
+    free(sysData);
+}
+
+
+
+int mxf_async_write_file_open(MXFFile *target, uint32_t bufferSize, uint32_t numBuffers, MXFFile **mxfFile)
+{
+    MXFFile *newMXFFile = NULL;
+    MXFFileSysData *newAsyncFile = NULL;
+    uint32_t i;
+
+    if (bufferSize == 0 || numBuffers < MXF_ASYNC_WRITE_MIN_BUFFERS) {
+        mxf_log_error("Invalid async write buffer size %u or count %u" LOG_LOC_FORMAT,
+                      bufferSize, numBuffers, LOG_LOC_PARAMS);
+        return 0;
+    }
+
+    CHK_MALLOC_ORET(newMXFFile, MXFFile);
+    memset(newMXFFile, 0, sizeof(MXFFile));
+    CHK_MALLOC_OFAIL(newAsyncFile, MXFFileSysData);
+    memset(newAsyncFile, 0, sizeof(MXFFileSysData));
+
+    /* the primitives are destroyed in free_async_file and so they are initialized before anything can fail */
+    if (!MUTEX_INIT(&newAsyncFile->mutex)) {
+        SAFE_FREE(newAsyncFile);
+        goto fail;
+    }
+    if (!COND_INIT(&newAsyncFile->bufferQueuedCond)) {
+        MUTEX_DESTROY(&newAsyncFile->mutex);
+        SAFE_FREE(newAsyncFile);
+        goto fail;
+    }
+    if (!COND_INIT(&newAsyncFile->bufferFreeCond)) {
+        COND_DESTROY(&newAsyncFile->bufferQueuedCond);
+        MUTEX_DESTROY(&newAsyncFile->mutex);
+        SAFE_FREE(newAsyncFile);
+        goto fail;
+    }
+
+    CHK_MALLOC_ARRAY_OFAIL(newAsyncFile->buffers, WriteBuffer, numBuffers);
+    memset(newAsyncFile->buffers, 0, numBuffers * sizeof(WriteBuffer));
+    newAsyncFile->numBuffers = numBuffers;
+    for (i = 0; i < numBuffers; i++)
+        CHK_MALLOC_ARRAY_OFAIL(newAsyncFile->buffers[i].data, uint8_t, bufferSize);
+    newAsyncFile->bufferSize = bufferSize;
+
+    newAsyncFile->position = mxf_file_tell(target);
+    CHK_OFAIL(newAsyncFile->position >= 0);
+    newAsyncFile->targetPosition = newAsyncFile->position;
+
+    /* free_async_file doesn't close the target and so it is left open on failure */
+    newAsyncFile->target = target;
+
+    CHK_OFAIL(start_write_thread(newAsyncFile));
+
+    newMXFFile->close         = async_file_close;
+    newMXFFile->read          = async_file_read;
+    newMXFFile->write         = async_file_write;
+    newMXFFile->get_char      = async_file_getchar;
+    newMXFFile->put_char      = async_file_putchar;
+    newMXFFile->eof           = async_file_eof;
+    newMXFFile->seek          = async_file_seek;
+    newMXFFile->tell          = async_file_tell;
+    newMXFFile->is_seekable   = async_file_is_seekable;
+    newMXFFile->size          = async_file_size;
+    newMXFFile->writev        = async_file_writev;
+    newMXFFile->flush         = async_file_flush;
+    newMXFFile->free_sys_data = free_async_file;
+    newMXFFile->sysData       = newAsyncFile;
+    newMXFFile->minLLen       = target->minLLen;
+    newMXFFile->runinLen      = target->runinLen;
+
+    *mxfFile = newMXFFile;
+    return 1;
+
+fail:
+    SAFE_FREE(newMXFFile);
+    free_async_file(newAsyncFile);
+    return 0;
+}
+
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef MXF_ASYNC_WRITE_FILE_H_
+#define MXF_ASYNC_WRITE_FILE_H_
+
+
+#include <mxf/mxf_file.h>
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+#define MXF_ASYNC_WRITE_MIN_BUFFERS     2
+
+
+/* Wrap a file opened for writing so that writes are copied into one of numBuffers buffers of bufferSize bytes
+   and written to the target file by a background thread. A write only blocks if all buffers are waiting to be
+   written. Seeks that are not relative to the end of the file don't wait; the next buffer records the new
+   position and the thread seeks the target before writing it. Reads and size and eof checks wait for all
+   buffers to be written first. A failure to write to the target causes subsequent writes to fail.
+   mxf_file_flush waits for all buffers to be written and returns 0 if any write failed; call it before closing
+   the file because a failure is only logged when the file is closed.
+   The target file is closed when the returned file is closed */
+int mxf_async_write_file_open(MXFFile *target, uint32_t bufferSize, uint32_t numBuffers, MXFFile **mxfFile);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
+
@@ -75,6 +75,7 @@ typedef struct MXFAvidObjectReference
 typedef struct
 {
     MXFAvidObjectReference *references;
+    MXFAvidObjectReference *lastReference;
 } MXFAvidObjectDirectory;
 
 
@@ -221,13 +222,9 @@ static int add_object_directory_entry(MXFAvidObjectDirectory *directory,
     }
     else
     {
-        MXFAvidObjectReference *lastEntry = directory->references;
-        while (lastEntry->next != NULL)
-        {
-            lastEntry = lastEntry->next;
-        }
-        lastEntry->next = newEntry;
+        directory->lastReference->next = newEntry;
     }
+    directory->lastReference = newEntry;
 
     return 1;
 }
@@ -292,17 +289,44 @@ static int write_root_set(MXFFile *mxfFile, const MXFAvidMetadataRoot *root)
     return 1;
 }
 
-static int write_set(MXFFile *mxfFile, MXFMetadataSet *set, int64_t *offset, MXFAvidObjectDirectory *objectDirectory)
+static int write_cached_sets(MXFFile *mxfFile, MXFAvidCachedDictionaries *cachedDicts, MXFMetadataSet *rootSet,
+                             int64_t *offset, MXFAvidObjectDirectory *objectDirectory)
+{
+    const MXFAvidCachedSetsEncoding *encoding;
+    size_t i;
+
+    CHK_ORET(mxf_avid_get_cached_sets_encoding(cachedDicts, mxfFile, rootSet, &encoding));
+    if (encoding == NULL)
+    {
+        return 1;
+    }
+
+    for (i = 0; i < encoding->numSets; i++)
+    {
+        CHK_ORET(add_object_directory_entry(objectDirectory, &encoding->instanceUIDs[i],
+                                            *offset + encoding->setOffsets[i], 0x00));
+    }
+    CHK_ORET(mxf_file_write(mxfFile, encoding->data, (uint32_t)encoding->size) == encoding->size);
+    *offset += encoding->size;
+
+    return 1;
+}
+
+static int write_set(MXFFile *mxfFile, MXFAvidCachedDictionaries *cachedDicts, MXFMetadataSet *set, int64_t *offset,
+                     MXFAvidObjectDirectory *objectDirectory)
 {
     CHK_ORET(add_object_directory_entry(objectDirectory, &set->instanceUID, *offset, 0x00));
     CHK_ORET(mxf_write_set(mxfFile, set));
     *offset += mxf_get_set_size(mxfFile, set);
 
+    /* the cached sets referenced by a MetaDictionary or Dictionary set follow it */
+    CHK_ORET(write_cached_sets(mxfFile, cachedDicts, set, offset, objectDirectory));
+
     return 1;
 }
 
 static int write_metadict_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata,
-                               MXFAvidObjectDirectory *objectDirectory)
+                               MXFAvidCachedDictionaries *cachedDicts, MXFAvidObjectDirectory *objectDirectory)
 {
     MXFListIterator iter;
     MXFMetadataSet *metaDictSet;
@@ -312,7 +336,7 @@ static int write_metadict_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetada
 
     /* must write the MetaDictionary set first */
     CHK_ORET(mxf_find_singular_set_by_key(headerMetadata, &MXF_SET_K(MetaDictionary), &metaDictSet));
-    CHK_ORET(write_set(mxfFile, metaDictSet, &offset, objectDirectory));
+    CHK_ORET(write_set(mxfFile, cachedDicts, metaDictSet, &offset, objectDirectory));
 
     mxf_initialise_list_iter(&iter, &headerMetadata->sets);
     while (mxf_next_list_iter_element(&iter))
@@ -321,7 +345,7 @@ static int write_metadict_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetada
 
         if (mxf_is_subclass_of(headerMetadata->dataModel, &set->key, &MXF_SET_K(MetaDefinition)))
         {
-            CHK_ORET(write_set(mxfFile, set, &offset, objectDirectory));
+            CHK_ORET(write_set(mxfFile, cachedDicts, set, &offset, objectDirectory));
         }
     }
 
@@ -329,7 +353,7 @@ static int write_metadict_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetada
 }
 
 static int write_preface_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata,
-                              MXFAvidObjectDirectory *objectDirectory)
+                              MXFAvidCachedDictionaries *cachedDicts, MXFAvidObjectDirectory *objectDirectory)
 {
     MXFListIterator iter;
     MXFMetadataSet *prefaceSet;
@@ -339,7 +363,7 @@ static int write_preface_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadat
 
     /* must write the Preface set first */
     CHK_ORET(mxf_find_singular_set_by_key(headerMetadata, &MXF_SET_K(Preface), &prefaceSet));
-    CHK_ORET(write_set(mxfFile, prefaceSet, &offset, objectDirectory));
+    CHK_ORET(write_set(mxfFile, cachedDicts, prefaceSet, &offset, objectDirectory));
 
     mxf_initialise_list_iter(&iter, &headerMetadata->sets);
     while (mxf_next_list_iter_element(&iter))
@@ -350,7 +374,7 @@ static int write_preface_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadat
             !mxf_is_subclass_of(headerMetadata->dataModel, &set->key, &MXF_SET_K(MetaDefinition)) &&
             !mxf_equals_key(&set->key, &MXF_SET_K(Preface)))
         {
-            CHK_ORET(write_set(mxfFile, set, &offset, objectDirectory));
+            CHK_ORET(write_set(mxfFile, cachedDicts, set, &offset, objectDirectory));
         }
     }
 
@@ -523,6 +547,10 @@ int mxf_avid_load_extensions(MXFDataModel *dataModel)
 {
     MXFItemType *itemType = NULL;
 
+    /* the static tables include the Avid extensions if no other extensions have been registered yet */
+    if (mxf_load_static_avid_extensions(dataModel))
+        return 1;
+
 #include <mxf/mxf_avid_extensions_data_model.h>
 
     return 1;
@@ -549,6 +577,12 @@ fail:
 
 
 int mxf_avid_write_header_metadata(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata, MXFPartition *headerPartition)
+{
+    return mxf_avid_write_header_metadata_2(mxfFile, headerMetadata, headerPartition, NULL);
+}
+
+int mxf_avid_write_header_metadata_2(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata, MXFPartition *headerPartition,
+                                     MXFAvidCachedDictionaries *cachedDicts)
 {
     int64_t rootPos;
     int64_t endPos;
@@ -576,9 +610,9 @@ int mxf_avid_write_header_metadata(MXFFile *mxfFile, MXFHeaderMetadata *headerMe
     CHK_OFAIL(add_object_directory_entry(objectDirectory, &root.id, rootPos, 0x00));
     CHK_OFAIL(write_root_set(mxfFile, &root));
 
-    CHK_OFAIL(write_metadict_sets(mxfFile, headerMetadata, objectDirectory));
+    CHK_OFAIL(write_metadict_sets(mxfFile, headerMetadata, cachedDicts, objectDirectory));
 
-    CHK_OFAIL(write_preface_sets(mxfFile, headerMetadata, objectDirectory));
+    CHK_OFAIL(write_preface_sets(mxfFile, headerMetadata, cachedDicts, objectDirectory));
 
     CHK_OFAIL((root.directoryOffset = mxf_file_tell(mxfFile)) >= 0);
     CHK_OFAIL(write_object_directory(mxfFile, objectDirectory));
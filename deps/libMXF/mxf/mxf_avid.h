@@ -44,6 +44,7 @@ extern "C"
 #include <mxf/mxf_avid_labels_and_keys.h>
 #include <mxf/mxf_avid_metadictionary.h>
 #include <mxf/mxf_avid_dictionary.h>
+#include <mxf/mxf_avid_dictionary_cache.h>
 
 
 #define MXF_LABEL(d0, d1, d2, d3, d4, d5, d6, d7, d8, d9, d10, d11, d12, d13, d14, d15) \
@@ -78,6 +79,8 @@ int mxf_avid_read_filtered_header_metadata(MXFFile *mxfFile, int skipDataDefs, M
                                            uint64_t headerByteCount, const mxfKey *key, uint8_t llen, uint64_t len);
 
 int mxf_avid_write_header_metadata(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata, MXFPartition *headerPartition);
+int mxf_avid_write_header_metadata_2(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata, MXFPartition *headerPartition,
+                                     MXFAvidCachedDictionaries *cachedDicts);
 
 
 extern mxf_generate_aafsdk_umid_func mxf_generate_aafsdk_umid;
@@ -0,0 +1,716 @@
+/*
+ * Cache of the serialized Avid default meta-dictionary and dictionary
+ *
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_avid.h>
+#include <mxf/mxf_macros.h>
+
+
+typedef int (*create_default_sets_func)(MXFHeaderMetadata *headerMetadata, MXFMetadataSet **rootSet);
+
+typedef struct
+{
+    mxfKey key;
+    uint64_t payloadOffset;
+    uint64_t payloadSize;
+} CachedSet;
+
+typedef struct
+{
+    mxfKey key;
+    uint64_t valueOffset;
+    uint16_t length;
+} CachedItem;
+
+typedef struct
+{
+    uint64_t offset;
+    size_t uuidIndex;
+} UUIDPatch;
+
+typedef struct
+{
+    mxfUUID uuid;
+    size_t index;
+} UUIDIndexEntry;
+
+typedef struct
+{
+    uint8_t *data;
+    uint64_t size;
+    uint64_t allocSize;
+} ByteBuffer;
+
+typedef struct
+{
+    int isCaptured;
+
+    /* the items of the root set, excluding the InstanceUID */
+    CachedItem *rootItems;
+    size_t numRootItems;
+    ByteBuffer rootValues;
+    UUIDPatch *rootPatches;
+    size_t numRootPatches;
+    size_t allocRootPatches;
+
+    /* the sets created after the root set, serialized without the key and length */
+    CachedSet *sets;
+    size_t numSets;
+    ByteBuffer payload;
+    UUIDPatch *patches;
+    size_t numPatches;
+    size_t allocPatches;
+
+    /* the primer pack entries registered when the sets were created, and their sorted keys and tags */
+    MXFPrimerPackEntry *primerEntries;
+    size_t numPrimerEntries;
+    mxfUID *sortedPrimerKeys;
+    mxfLocalTag *sortedPrimerTags;
+    size_t primerStartLength;
+    mxfLocalTag primerStartNextTag;
+    mxfLocalTag primerEndNextTag;
+} CachedDefaultSets;
+
+typedef struct
+{
+    const CachedDefaultSets *cached;
+    mxfUUID rootInstanceUID;
+    mxfUUID *instanceUIDs;
+
+    uint8_t *encodingData;
+    uint64_t *setOffsets;
+    int haveEncoding;
+    uint8_t encodingMinLLen;
+    MXFAvidCachedSetsEncoding encoding;
+} CachedSetsInstance;
+
+struct MXFAvidDictionaryCache
+{
+    CachedDefaultSets metaDict;
+    CachedDefaultSets dict;
+};
+
+struct MXFAvidCachedDictionaries
+{
+    MXFAvidDictionaryCache *cache;
+    CachedSetsInstance metaDict;
+    CachedSetsInstance dict;
+};
+
+
+
+static int reserve_buffer(ByteBuffer *buffer, uint64_t size)
+{
+    uint8_t *newData;
+    uint64_t newAllocSize;
+
+    if (size <= buffer->allocSize)
+    {
+        return 1;
+    }
+
+    newAllocSize = buffer->allocSize > 0 ? buffer->allocSize : 8192;
+    while (newAllocSize < size)
+    {
+        newAllocSize *= 2;
+    }
+
+    CHK_ORET(newAllocSize <= SIZE_MAX);
+    CHK_ORET((newData = (uint8_t*)realloc(buffer->data, (size_t)newAllocSize)) != NULL);
+    buffer->data = newData;
+    buffer->allocSize = newAllocSize;
+
+    return 1;
+}
+
+static int append_buffer(ByteBuffer *buffer, const uint8_t *data, uint64_t size)
+{
+    CHK_ORET(reserve_buffer(buffer, buffer->size + size));
+    if (size > 0)
+    {
+        memcpy(&buffer->data[buffer->size], data, (size_t)size);
+    }
+    buffer->size += size;
+
+    return 1;
+}
+
+static int append_patch(UUIDPatch **patches, size_t *numPatches, size_t *allocPatches, uint64_t offset,
+                        size_t uuidIndex)
+{
+    UUIDPatch *newPatches;
+    size_t newAllocPatches;
+
+    if (*numPatches == *allocPatches)
+    {
+        newAllocPatches = *allocPatches > 0 ? 2 * (*allocPatches) : 256;
+        CHK_ORET((newPatches = (UUIDPatch*)realloc(*patches, newAllocPatches * sizeof(UUIDPatch))) != NULL);
+        *patches = newPatches;
+        *allocPatches = newAllocPatches;
+    }
+
+    (*patches)[*numPatches].offset = offset;
+    (*patches)[*numPatches].uuidIndex = uuidIndex;
+    (*numPatches)++;
+
+    return 1;
+}
+
+static int compare_uuid_index_entry(const void *left, const void *right)
+{
+    return memcmp(&((const UUIDIndexEntry*)left)->uuid, &((const UUIDIndexEntry*)right)->uuid, mxfUUID_extlen);
+}
+
+static int compare_uid(const void *left, const void *right)
+{
+    return memcmp(left, right, mxfUID_extlen);
+}
+
+static int compare_local_tag(const void *left, const void *right)
+{
+    mxfLocalTag leftTag = *(const mxfLocalTag*)left;
+    mxfLocalTag rightTag = *(const mxfLocalTag*)right;
+
+    return leftTag < rightTag ? -1 : (leftTag > rightTag ? 1 : 0);
+}
+
+static void clear_cached_default_sets(CachedDefaultSets *cached)
+{
+    SAFE_FREE(cached->rootItems);
+    SAFE_FREE(cached->rootValues.data);
+    SAFE_FREE(cached->rootPatches);
+    SAFE_FREE(cached->sets);
+    SAFE_FREE(cached->payload.data);
+    SAFE_FREE(cached->patches);
+    SAFE_FREE(cached->primerEntries);
+    SAFE_FREE(cached->sortedPrimerKeys);
+    SAFE_FREE(cached->sortedPrimerTags);
+    memset(cached, 0, sizeof(*cached));
+}
+
+static void clear_cached_sets_instance(CachedSetsInstance *instance)
+{
+    SAFE_FREE(instance->instanceUIDs);
+    SAFE_FREE(instance->encodingData);
+    SAFE_FREE(instance->setOffsets);
+    memset(instance, 0, sizeof(*instance));
+}
+
+static int add_value_patches(MXFDataModel *dataModel, const MXFMetadataItem *item, uint64_t valueOffset,
+                             const UUIDIndexEntry *uuidIndex, size_t uuidIndexSize,
+                             UUIDPatch **patches, size_t *numPatches, size_t *allocPatches)
+{
+    MXFItemDef *itemDef;
+    UUIDIndexEntry key;
+    const UUIDIndexEntry *entry;
+    uint32_t count = 1;
+    uint32_t elementLen = mxfUUID_extlen;
+    uint32_t arrayHeaderLen = 0;
+    uint32_t i;
+
+    /* only InstanceUID and (arrays of) strong and weak references can hold the instance UID of another set */
+    if (!mxf_equals_key(&item->key, &MXF_ITEM_K(InterchangeObject, InstanceUID)))
+    {
+        if (!mxf_find_item_def(dataModel, &item->key, &itemDef))
+        {
+            return 1;
+        }
+
+        switch (itemDef->typeId)
+        {
+            case MXF_STRONGREF_TYPE:
+            case MXF_WEAKREF_TYPE:
+                break;
+            case MXF_STRONGREFARRAY_TYPE:
+            case MXF_STRONGREFBATCH_TYPE:
+            case MXF_WEAKREFARRAY_TYPE:
+            case MXF_WEAKREFBATCH_TYPE:
+                CHK_ORET(item->length >= 8);
+                mxf_get_array_header(item->value, &count, &elementLen);
+                arrayHeaderLen = 8;
+                break;
+            default:
+                return 1;
+        }
+    }
+    CHK_ORET(elementLen == mxfUUID_extlen);
+    CHK_ORET(arrayHeaderLen + (uint64_t)count * elementLen <= item->length);
+
+    for (i = 0; i < count; i++)
+    {
+        memcpy(&key.uuid, &item->value[arrayHeaderLen + i * elementLen], mxfUUID_extlen);
+        entry = (const UUIDIndexEntry*)bsearch(&key, uuidIndex, uuidIndexSize, sizeof(UUIDIndexEntry),
+                                               compare_uuid_index_entry);
+        if (entry != NULL)
+        {
+            CHK_ORET(append_patch(patches, numPatches, allocPatches, valueOffset + arrayHeaderLen + i * elementLen,
+                                  entry->index));
+        }
+    }
+
+    return 1;
+}
+
+static int capture_default_sets(CachedDefaultSets *cached, CachedSetsInstance *instance,
+                                MXFHeaderMetadata *headerMetadata, MXFMetadataSet *rootSet, size_t setsStart)
+{
+    MXFListIterator setIter;
+    MXFListIterator itemIter;
+    MXFListIterator entryIter;
+    MXFMetadataSet **sets = NULL;
+    UUIDIndexEntry *uuidIndex = NULL;
+    uint8_t itemHeader[4];
+    size_t numSets;
+    size_t i;
+
+    numSets = mxf_get_list_length(&headerMetadata->sets) - setsStart - 1;
+    CHK_OFAIL(mxf_get_list_element(&headerMetadata->sets, setsStart) == rootSet);
+
+    if (numSets > 0)
+    {
+        CHK_MALLOC_ARRAY_OFAIL(sets, MXFMetadataSet*, numSets);
+        CHK_MALLOC_ARRAY_OFAIL(uuidIndex, UUIDIndexEntry, numSets);
+        CHK_MALLOC_ARRAY_OFAIL(cached->sets, CachedSet, numSets);
+        CHK_MALLOC_ARRAY_OFAIL(instance->instanceUIDs, mxfUUID, numSets);
+    }
+
+
+    /* index the instance UIDs of the sets created after the root set */
+
+    mxf_initialise_list_iter_at(&setIter, &headerMetadata->sets, setsStart + 1);
+    i = 0;
+    while (mxf_next_list_iter_element(&setIter))
+    {
+        sets[i] = (MXFMetadataSet*)mxf_get_iter_element(&setIter);
+        uuidIndex[i].uuid = sets[i]->instanceUID;
+        uuidIndex[i].index = i;
+        instance->instanceUIDs[i] = sets[i]->instanceUID;
+        i++;
+    }
+    if (numSets > 0)
+    {
+        qsort(uuidIndex, numSets, sizeof(UUIDIndexEntry), compare_uuid_index_entry);
+    }
+
+
+    /* serialize the sets and record where they contain instance UIDs */
+
+    for (i = 0; i < numSets; i++)
+    {
+        cached->sets[i].key = sets[i]->key;
+        cached->sets[i].payloadOffset = cached->payload.size;
+
+        mxf_initialise_list_iter(&itemIter, &sets[i]->items);
+        while (mxf_next_list_iter_element(&itemIter))
+        {
+            MXFMetadataItem *item = (MXFMetadataItem*)mxf_get_iter_element(&itemIter);
+
+            mxf_set_uint16(item->tag, itemHeader);
+            mxf_set_uint16(item->length, &itemHeader[2]);
+            CHK_OFAIL(append_buffer(&cached->payload, itemHeader, sizeof(itemHeader)));
+            CHK_OFAIL(add_value_patches(headerMetadata->dataModel, item, cached->payload.size, uuidIndex, numSets,
+                                        &cached->patches, &cached->numPatches, &cached->allocPatches));
+            CHK_OFAIL(append_buffer(&cached->payload, item->value, item->length));
+        }
+
+        cached->sets[i].payloadSize = cached->payload.size - cached->sets[i].payloadOffset;
+    }
+    cached->numSets = numSets;
+
+
+    /* copy the root set items, which reference the sets */
+
+    CHK_MALLOC_ARRAY_OFAIL(cached->rootItems, CachedItem, mxf_get_list_length(&rootSet->items));
+    mxf_initialise_list_iter(&itemIter, &rootSet->items);
+    while (mxf_next_list_iter_element(&itemIter))
+    {
+        MXFMetadataItem *item = (MXFMetadataItem*)mxf_get_iter_element(&itemIter);
+
+        if (mxf_equals_key(&item->key, &MXF_ITEM_K(InterchangeObject, InstanceUID)))
+        {
+            continue;
+        }
+
+        cached->rootItems[cached->numRootItems].key = item->key;
+        cached->rootItems[cached->numRootItems].valueOffset = cached->rootValues.size;
+        cached->rootItems[cached->numRootItems].length = item->length;
+        cached->numRootItems++;
+
+        CHK_OFAIL(add_value_patches(headerMetadata->dataModel, item, cached->rootValues.size, uuidIndex, numSets,
+                                    &cached->rootPatches, &cached->numRootPatches, &cached->allocRootPatches));
+        CHK_OFAIL(append_buffer(&cached->rootValues, item->value, item->length));
+    }
+
+
+    /* copy the primer pack entries registered by the sets */
+
+    cached->numPrimerEntries = mxf_get_list_length(&headerMetadata->primerPack->entries) - cached->primerStartLength;
+    if (cached->numPrimerEntries > 0)
+    {
+        CHK_MALLOC_ARRAY_OFAIL(cached->primerEntries, MXFPrimerPackEntry, cached->numPrimerEntries);
+        CHK_MALLOC_ARRAY_OFAIL(cached->sortedPrimerKeys, mxfUID, cached->numPrimerEntries);
+        CHK_MALLOC_ARRAY_OFAIL(cached->sortedPrimerTags, mxfLocalTag, cached->numPrimerEntries);
+        mxf_initialise_list_iter_at(&entryIter, &headerMetadata->primerPack->entries, cached->primerStartLength);
+        i = 0;
+        while (mxf_next_list_iter_element(&entryIter))
+        {
+            cached->primerEntries[i] = *(MXFPrimerPackEntry*)mxf_get_iter_element(&entryIter);
+            cached->sortedPrimerKeys[i] = cached->primerEntries[i].uid;
+            cached->sortedPrimerTags[i] = cached->primerEntries[i].localTag;
+            i++;
+        }
+        qsort(cached->sortedPrimerKeys, cached->numPrimerEntries, sizeof(mxfUID), compare_uid);
+        qsort(cached->sortedPrimerTags, cached->numPrimerEntries, sizeof(mxfLocalTag), compare_local_tag);
+    }
+    cached->primerEndNextTag = headerMetadata->primerPack->nextTag;
+
+
+    /* the sets are written from the cache from now on */
+
+    for (i = 0; i < numSets; i++)
+    {
+        CHK_OFAIL(mxf_remove_set(headerMetadata, sets[i]));
+        mxf_free_set(&sets[i]);
+    }
+
+    instance->cached = cached;
+    instance->rootInstanceUID = rootSet->instanceUID;
+    cached->isCaptured = 1;
+
+    SAFE_FREE(sets);
+    SAFE_FREE(uuidIndex);
+    return 1;
+
+fail:
+    SAFE_FREE(sets);
+    SAFE_FREE(uuidIndex);
+    clear_cached_default_sets(cached);
+    clear_cached_sets_instance(instance);
+    return 0;
+}
+
+static int can_apply_cached_sets(const CachedDefaultSets *cached, MXFHeaderMetadata *headerMetadata)
+{
+    MXFPrimerPack *primerPack = headerMetadata->primerPack;
+    MXFListIterator iter;
+
+    /* the replayed primer pack entries must have the same tags as when they were first registered and so the
+       primer pack must be in the same state and not contain any of the entries */
+
+    if (mxf_get_list_length(&primerPack->entries) != cached->primerStartLength ||
+        primerPack->nextTag != cached->primerStartNextTag)
+    {
+        return 0;
+    }
+
+    if (cached->numPrimerEntries == 0)
+    {
+        return 1;
+    }
+
+    mxf_initialise_list_iter(&iter, &primerPack->entries);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        MXFPrimerPackEntry *entry = (MXFPrimerPackEntry*)mxf_get_iter_element(&iter);
+
+        if (bsearch(&entry->uid, cached->sortedPrimerKeys, cached->numPrimerEntries, sizeof(mxfUID),
+                    compare_uid) != NULL ||
+            bsearch(&entry->localTag, cached->sortedPrimerTags, cached->numPrimerEntries, sizeof(mxfLocalTag),
+                    compare_local_tag) != NULL)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static int apply_cached_sets(const CachedDefaultSets *cached, CachedSetsInstance *instance,
+                             MXFHeaderMetadata *headerMetadata, const mxfKey *rootKey, MXFMetadataSet **rootSet)
+{
+    MXFMetadataSet *newSet = NULL;
+    uint8_t *rootValues = NULL;
+    size_t i;
+
+    /* the entries are registered before the root set is created to keep the original order, which could start
+       with the InstanceUID item registered by the root set */
+    CHK_ORET(mxf_append_primer_entries(headerMetadata->primerPack, cached->primerEntries, cached->numPrimerEntries));
+    headerMetadata->primerPack->nextTag = cached->primerEndNextTag;
+
+    CHK_ORET(mxf_create_set(headerMetadata, rootKey, &newSet));
+
+    if (cached->numSets > 0)
+    {
+        CHK_MALLOC_ARRAY_OFAIL(instance->instanceUIDs, mxfUUID, cached->numSets);
+        for (i = 0; i < cached->numSets; i++)
+        {
+            mxf_generate_uuid(&instance->instanceUIDs[i]);
+        }
+    }
+
+    if (cached->rootValues.size > 0)
+    {
+        CHK_MALLOC_ARRAY_OFAIL(rootValues, uint8_t, (size_t)cached->rootValues.size);
+        memcpy(rootValues, cached->rootValues.data, (size_t)cached->rootValues.size);
+        for (i = 0; i < cached->numRootPatches; i++)
+        {
+            mxf_set_uuid(&instance->instanceUIDs[cached->rootPatches[i].uuidIndex],
+                         &rootValues[cached->rootPatches[i].offset]);
+        }
+    }
+    for (i = 0; i < cached->numRootItems; i++)
+    {
+        CHK_OFAIL(mxf_set_item(newSet, &cached->rootItems[i].key,
+                               rootValues ? &rootValues[cached->rootItems[i].valueOffset] : NULL,
+                               cached->rootItems[i].length));
+    }
+
+    instance->cached = cached;
+    instance->rootInstanceUID = newSet->instanceUID;
+
+    SAFE_FREE(rootValues);
+    *rootSet = newSet;
+    return 1;
+
+fail:
+    SAFE_FREE(rootValues);
+    clear_cached_sets_instance(instance);
+    mxf_remove_set(headerMetadata, newSet);
+    mxf_free_set(&newSet);
+    return 0;
+}
+
+static int create_cached_default_sets(CachedDefaultSets *cached, CachedSetsInstance *instance,
+                                      MXFHeaderMetadata *headerMetadata, const mxfKey *rootKey,
+                                      create_default_sets_func create_func, MXFMetadataSet **rootSet)
+{
+    size_t setsStart;
+
+    CHK_ORET(instance->cached == NULL);
+
+    if (cached->isCaptured)
+    {
+        if (can_apply_cached_sets(cached, headerMetadata))
+        {
+            return apply_cached_sets(cached, instance, headerMetadata, rootKey, rootSet);
+        }
+
+        /* the primer pack differs from when the sets were captured and so the sets are created as normal */
+        return create_func(headerMetadata, rootSet);
+    }
+
+    setsStart = mxf_get_list_length(&headerMetadata->sets);
+    cached->primerStartLength = mxf_get_list_length(&headerMetadata->primerPack->entries);
+    cached->primerStartNextTag = headerMetadata->primerPack->nextTag;
+
+    CHK_ORET(create_func(headerMetadata, rootSet));
+    CHK_ORET(capture_default_sets(cached, instance, headerMetadata, *rootSet, setsStart));
+
+    return 1;
+}
+
+static int encode_cached_sets(CachedSetsInstance *instance, MXFFile *mxfFile)
+{
+    const CachedDefaultSets *cached = instance->cached;
+    uint64_t size = 0;
+    uint8_t *data;
+    uint8_t llen;
+    size_t patchIndex = 0;
+    size_t i;
+
+    if (instance->haveEncoding && instance->encodingMinLLen == mxf_get_min_llen(mxfFile))
+    {
+        return 1;
+    }
+
+    if (instance->setOffsets == NULL && cached->numSets > 0)
+    {
+        CHK_MALLOC_ARRAY_ORET(instance->setOffsets, uint64_t, cached->numSets);
+    }
+
+    /* the set llen is at least 4, as in mxf_write_set */
+    for (i = 0; i < cached->numSets; i++)
+    {
+        llen = mxf_get_llen(mxfFile, cached->sets[i].payloadSize);
+        if (llen < 4)
+        {
+            llen = 4;
+        }
+        instance->setOffsets[i] = size;
+        size += mxfKey_extlen + llen + cached->sets[i].payloadSize;
+    }
+
+    CHK_ORET(size <= UINT32_MAX);
+    SAFE_FREE(instance->encodingData);
+    instance->haveEncoding = 0;
+    if (size > 0)
+    {
+        CHK_MALLOC_ARRAY_ORET(instance->encodingData, uint8_t, (size_t)size);
+    }
+
+    for (i = 0; i < cached->numSets; i++)
+    {
+        const CachedSet *set = &cached->sets[i];
+        uint64_t payloadStart;
+
+        data = &instance->encodingData[instance->setOffsets[i]];
+        memcpy(data, &set->key, mxfKey_extlen);
+        llen = mxf_get_llen(mxfFile, set->payloadSize);
+        if (llen < 4)
+        {
+            llen = 4;
+        }
+        CHK_ORET(mxf_encode_fixed_l(llen, set->payloadSize, &data[mxfKey_extlen]));
+        payloadStart = mxfKey_extlen + llen;
+        memcpy(&data[payloadStart], &cached->payload.data[set->payloadOffset], (size_t)set->payloadSize);
+
+        while (patchIndex < cached->numPatches &&
+               cached->patches[patchIndex].offset < set->payloadOffset + set->payloadSize)
+        {
+            mxf_set_uuid(&instance->instanceUIDs[cached->patches[patchIndex].uuidIndex],
+                         &data[payloadStart + cached->patches[patchIndex].offset - set->payloadOffset]);
+            patchIndex++;
+        }
+    }
+
+    instance->encoding.data = instance->encodingData;
+    instance->encoding.size = size;
+    instance->encoding.numSets = cached->numSets;
+    instance->encoding.instanceUIDs = instance->instanceUIDs;
+    instance->encoding.setOffsets = instance->setOffsets;
+    instance->encodingMinLLen = mxf_get_min_llen(mxfFile);
+    instance->haveEncoding = 1;
+
+    return 1;
+}
+
+
+
+int mxf_avid_create_dictionary_cache(MXFAvidDictionaryCache **cache)
+{
+    MXFAvidDictionaryCache *newCache;
+
+    CHK_MALLOC_ORET(newCache, MXFAvidDictionaryCache);
+    memset(newCache, 0, sizeof(*newCache));
+
+    *cache = newCache;
+    return 1;
+}
+
+void mxf_avid_free_dictionary_cache(MXFAvidDictionaryCache **cache)
+{
+    if (*cache == NULL)
+    {
+        return;
+    }
+
+    clear_cached_default_sets(&(*cache)->metaDict);
+    clear_cached_default_sets(&(*cache)->dict);
+    SAFE_FREE(*cache);
+}
+
+int mxf_avid_create_cached_dictionaries(MXFAvidDictionaryCache *cache, MXFAvidCachedDictionaries **cachedDicts)
+{
+    MXFAvidCachedDictionaries *newCachedDicts;
+
+    CHK_MALLOC_ORET(newCachedDicts, MXFAvidCachedDictionaries);
+    memset(newCachedDicts, 0, sizeof(*newCachedDicts));
+    newCachedDicts->cache = cache;
+
+    *cachedDicts = newCachedDicts;
+    return 1;
+}
+
+void mxf_avid_free_cached_dictionaries(MXFAvidCachedDictionaries **cachedDicts)
+{
+    if (*cachedDicts == NULL)
+    {
+        return;
+    }
+
+    clear_cached_sets_instance(&(*cachedDicts)->metaDict);
+    clear_cached_sets_instance(&(*cachedDicts)->dict);
+    SAFE_FREE(*cachedDicts);
+}
+
+int mxf_avid_create_cached_default_metadictionary(MXFAvidCachedDictionaries *cachedDicts,
+                                                  MXFHeaderMetadata *headerMetadata, MXFMetadataSet **metaDictSet)
+{
+    return create_cached_default_sets(&cachedDicts->cache->metaDict, &cachedDicts->metaDict, headerMetadata,
+                                      &MXF_SET_K(MetaDictionary), mxf_avid_create_default_metadictionary,
+                                      metaDictSet);
+}
+
+int mxf_avid_create_cached_default_dictionary(MXFAvidCachedDictionaries *cachedDicts,
+                                              MXFHeaderMetadata *headerMetadata, MXFMetadataSet **dictSet)
+{
+    return create_cached_default_sets(&cachedDicts->cache->dict, &cachedDicts->dict, headerMetadata,
+                                      &MXF_SET_K(Dictionary), mxf_avid_create_default_dictionary, dictSet);
+}
+
+int mxf_avid_get_cached_sets_encoding(MXFAvidCachedDictionaries *cachedDicts, MXFFile *mxfFile,
+                                      const MXFMetadataSet *rootSet, const MXFAvidCachedSetsEncoding **encoding)
+{
+    CachedSetsInstance *instance = NULL;
+
+    if (cachedDicts != NULL)
+    {
+        if (cachedDicts->metaDict.cached != NULL &&
+            mxf_equals_uuid(&rootSet->instanceUID, &cachedDicts->metaDict.rootInstanceUID))
+        {
+            instance = &cachedDicts->metaDict;
+        }
+        else if (cachedDicts->dict.cached != NULL &&
+                 mxf_equals_uuid(&rootSet->instanceUID, &cachedDicts->dict.rootInstanceUID))
+        {
+            instance = &cachedDicts->dict;
+        }
+    }
+
+    if (instance == NULL)
+    {
+        *encoding = NULL;
+        return 1;
+    }
+
+    CHK_ORET(encode_cached_sets(instance, mxfFile));
+
+    *encoding = &instance->encoding;
+    return 1;
+}
+
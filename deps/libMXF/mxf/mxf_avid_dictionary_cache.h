@@ -0,0 +1,90 @@
+/*
+ * Cache of the serialized Avid default meta-dictionary and dictionary
+ *
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXF_AVID_DICTIONARY_CACHE_H_
+#define MXF_AVID_DICTIONARY_CACHE_H_
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/* The default meta-dictionary and dictionary are the same in every Avid file apart from the instance UIDs.
+   The dictionary cache captures the sets below the MetaDictionary and Dictionary sets the first time they are
+   created. The cached dictionaries of each header metadata then only create the MetaDictionary and Dictionary
+   sets and write a copy of the captured sets, with new instance UIDs, after them. The primer pack entries
+   registered by the sets are replayed so that the primer pack stays the same.
+   A dictionary cache must not be used by multiple threads at the same time. */
+
+typedef struct MXFAvidDictionaryCache MXFAvidDictionaryCache;
+typedef struct MXFAvidCachedDictionaries MXFAvidCachedDictionaries;
+
+typedef struct
+{
+    const uint8_t *data;
+    uint64_t size;
+    size_t numSets;
+    const mxfUUID *instanceUIDs;
+    const uint64_t *setOffsets;     /* offset of each set in data */
+} MXFAvidCachedSetsEncoding;
+
+
+int mxf_avid_create_dictionary_cache(MXFAvidDictionaryCache **cache);
+void mxf_avid_free_dictionary_cache(MXFAvidDictionaryCache **cache);
+
+int mxf_avid_create_cached_dictionaries(MXFAvidDictionaryCache *cache, MXFAvidCachedDictionaries **cachedDicts);
+void mxf_avid_free_cached_dictionaries(MXFAvidCachedDictionaries **cachedDicts);
+
+int mxf_avid_create_cached_default_metadictionary(MXFAvidCachedDictionaries *cachedDicts,
+                                                  MXFHeaderMetadata *headerMetadata, MXFMetadataSet **metaDictSet);
+
+/* When the cached sets are used, the strong references in the returned Dictionary set (and likewise the
+   MetaDictionary set) refer to sets that are only written to the file and have no matching sets in headerMetadata.
+   The references can't be resolved, e.g. using mxf_get_strongref_item, and definitions must not be added to the
+   set, e.g. using mxf_avid_create_datadef. The sets are in headerMetadata as normal when the cache captures the sets
+   or when the primer pack differs from when they were captured */
+int mxf_avid_create_cached_default_dictionary(MXFAvidCachedDictionaries *cachedDicts,
+                                              MXFHeaderMetadata *headerMetadata, MXFMetadataSet **dictSet);
+
+/* sets encoding to NULL if rootSet is not a MetaDictionary or Dictionary set with cached sets */
+int mxf_avid_get_cached_sets_encoding(MXFAvidCachedDictionaries *cachedDicts, MXFFile *mxfFile,
+                                      const MXFMetadataSet *rootSet, const MXFAvidCachedSetsEncoding **encoding);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
+
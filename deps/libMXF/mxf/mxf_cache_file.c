@@ -162,6 +162,13 @@ static void cache_file_close(MXFFileSysData *sysData)
     SAFE_FREE(sysData->allocCacheData);
 }
 
+static int cache_file_flush(MXFFileSysData *sysData)
+{
+    CHK_ORET(flush_dirty_pages(sysData, 0, sysData->numPages));
+
+    return mxf_file_flush(sysData->target);
+}
+
 static uint32_t cache_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
 {
     int64_t pagePosition;
@@ -447,6 +454,7 @@ int mxf_cache_file_open(MXFFile *target, uint32_t in_cachePageSize, uint32_t cac
     newMXFFile->tell          = cache_file_tell;
     newMXFFile->is_seekable   = cache_file_is_seekable;
     newMXFFile->size          = cache_file_size;
+    newMXFFile->flush         = cache_file_flush;
     newMXFFile->free_sys_data = free_cache_file;
     newMXFFile->sysData       = newDiskFile;
     newMXFFile->minLLen       = target->minLLen;
@@ -40,9 +40,95 @@
 #include <stdio.h>
 
 #include <mxf/mxf.h>
+#include <mxf/mxf_avid.h>
 #include <mxf/mxf_macros.h>
 
 
+typedef struct MXFStaticDataModel
+{
+    const MXFItemType *itemTypes;
+    size_t numItemTypes;
+    const MXFItemDef *itemDefs;
+    size_t numItemDefs;
+    const MXFSetDef *setDefs;
+    size_t numSetDefs;
+} MXFStaticDataModel;
+
+#include "mxf_data_model_tables.h"
+
+
+typedef struct
+{
+    const MXFStaticDataModel *staticModel;
+    size_t staticIndex;
+    mxf_tree_process_node_f processFunc;
+    void *processData;
+} TraverseSetDefsData;
+
+
+
+static MXFSetDef* find_static_set_def(const MXFDataModel *dataModel, const mxfKey *key)
+{
+    const MXFSetDef *setDefs = dataModel->staticModel->setDefs;
+    size_t low = 0;
+    size_t high = dataModel->staticModel->numSetDefs;
+    size_t mid;
+    int result;
+
+    while (low < high) {
+        mid = low + (high - low) / 2;
+        result = memcmp(key, &setDefs[mid].key, sizeof(*key));
+        if (result == 0)
+            return (MXFSetDef*)&setDefs[mid];
+        else if (result < 0)
+            high = mid;
+        else
+            low = mid + 1;
+    }
+
+    return NULL;
+}
+
+static MXFItemDef* find_static_item_def(const MXFDataModel *dataModel, const mxfKey *key)
+{
+    const MXFItemDef *itemDefs = dataModel->staticModel->itemDefs;
+    size_t numItemDefs = dataModel->staticModel->numItemDefs;
+    size_t low = 0;
+    size_t high = numItemDefs;
+    size_t mid;
+
+    /* find the first item def with the key; duplicates are sorted in definition order */
+    while (low < high) {
+        mid = low + (high - low) / 2;
+        if (memcmp(&itemDefs[mid].key, key, sizeof(*key)) < 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    if (low < numItemDefs && mxf_equals_key(&itemDefs[low].key, key))
+        return (MXFItemDef*)&itemDefs[low];
+
+    return NULL;
+}
+
+static const MXFItemType* get_static_type(const MXFDataModel *dataModel, unsigned int typeId)
+{
+    if (typeId < dataModel->staticModel->numItemTypes &&
+        dataModel->staticModel->itemTypes[typeId].typeId != MXF_UNKNOWN_TYPE)
+    {
+        return &dataModel->staticModel->itemTypes[typeId];
+    }
+
+    return NULL;
+}
+
+static int is_static_set_def(const MXFDataModel *dataModel, const MXFSetDef *setDef)
+{
+    const MXFSetDef *setDefs = dataModel->staticModel->setDefs;
+
+    return setDef >= &setDefs[0] && setDef < &setDefs[dataModel->staticModel->numSetDefs];
+}
 
 static void clear_type(MXFItemType *type)
 {
@@ -133,7 +219,7 @@ static unsigned int get_new_type_id(MXFDataModel *dataModel)
 
     /* try from the last type id to the end of the list */
     for (i = lastTypeId; i < ARRAY_SIZE(dataModel->types); i++) {
-        if (dataModel->types[i].typeId == 0) {
+        if (dataModel->types[i].typeId == 0 && !get_static_type(dataModel, (unsigned int)i)) {
             typeId = (unsigned int)i;
             break;
         }
@@ -142,7 +228,7 @@ static unsigned int get_new_type_id(MXFDataModel *dataModel)
     if (typeId == 0 && lastTypeId > MXF_EXTENSION_TYPE) {
         /* try from MXF_EXTENSION_TYPE to lastTypeId */
         for (i = MXF_EXTENSION_TYPE; i < lastTypeId; i++) {
-            if (dataModel->types[i].typeId == 0) {
+            if (dataModel->types[i].typeId == 0 && !get_static_type(dataModel, (unsigned int)i)) {
                 typeId = (unsigned int)i;
                 break;
             }
@@ -152,8 +238,8 @@ static unsigned int get_new_type_id(MXFDataModel *dataModel)
     return typeId;
 }
 
-static MXFSetDef* register_set_def(MXFDataModel *dataModel, const char *name, const mxfKey *parentKey,
-                                   const mxfKey *key)
+static MXFSetDef* add_set_def(MXFDataModel *dataModel, const char *name, const mxfKey *parentKey,
+                              const mxfKey *key)
 {
     MXFSetDef *newSetDef = NULL;
 
@@ -174,6 +260,15 @@ fail:
     return NULL;
 }
 
+static MXFSetDef* register_set_def(MXFDataModel *dataModel, const char *name, const mxfKey *parentKey,
+                                   const mxfKey *key)
+{
+    /* the static set defs can be extended with item defs but not replaced */
+    CHK_ORET(find_static_set_def(dataModel, key) == NULL);
+
+    return add_set_def(dataModel, name, parentKey, key);
+}
+
 static MXFItemDef* register_item_def(MXFDataModel *dataModel, const char *name, const mxfKey *setKey,
                                      const mxfKey *key, mxfLocalTag tag, unsigned int typeId, int isRequired)
 {
@@ -214,7 +309,8 @@ static MXFItemType* register_type(MXFDataModel *dataModel, const char *name, uns
     /* check the type id is valid and free to use */
     CHK_ORET(actualTypeId > 0 &&
              actualTypeId < ARRAY_SIZE(dataModel->types) &&
-             dataModel->types[actualTypeId].typeId == 0);
+             dataModel->types[actualTypeId].typeId == 0 &&
+             !get_static_type(dataModel, actualTypeId));
 
     type = &dataModel->types[actualTypeId];
     type->typeId = actualTypeId; /* set first to indicate type is present */
@@ -306,6 +402,8 @@ static int finalise_set_def(void *nodeData, void *processData)
 {
     MXFSetDef *setDef = (MXFSetDef*)nodeData;
     MXFDataModel *dataModel = (MXFDataModel*)processData;
+    MXFSetDef *staticSetDef;
+    MXFListIterator iter;
 
     mxf_clear_list(&setDef->itemDefs);
     setDef->parentSetDef = NULL;
@@ -313,57 +411,118 @@ static int finalise_set_def(void *nodeData, void *processData)
     if (!mxf_equals_key(&setDef->parentSetDefKey, &g_Null_Key))
         CHK_ORET(mxf_find_set_def(dataModel, &setDef->parentSetDefKey, &setDef->parentSetDef));
 
+    /* a copy of a static set def starts with the static item defs */
+    staticSetDef = find_static_set_def(dataModel, &setDef->key);
+    if (staticSetDef) {
+        mxf_initialise_list_iter(&iter, &staticSetDef->itemDefs);
+        while (mxf_next_list_iter_element(&iter))
+            CHK_ORET(mxf_append_list_element(&setDef->itemDefs, mxf_get_iter_element(&iter)));
+    }
+
     return 1;
 }
 
+static int static_set_def_is_extended(MXFDataModel *dataModel, size_t index, int *extendedStates)
+{
+    const MXFSetDef *staticSetDefs = dataModel->staticModel->setDefs;
+    const MXFSetDef *setDef = &staticSetDefs[index];
+
+    /* 0 = unknown, 1 = not extended, 2 = extended */
+    if (extendedStates[index] == 0) {
+        if (setDef->parentSetDef &&
+            static_set_def_is_extended(dataModel, (size_t)(setDef->parentSetDef - staticSetDefs), extendedStates))
+        {
+            extendedStates[index] = 2;
+        } else {
+            extendedStates[index] = 1;
+        }
+    }
+
+    return extendedStates[index] == 2;
+}
 
+static int copy_extended_static_set_defs(MXFDataModel *dataModel)
+{
+    const MXFSetDef *staticSetDefs = dataModel->staticModel->setDefs;
+    size_t numStaticSetDefs = dataModel->staticModel->numSetDefs;
+    int *extendedStates;
+    MXFListIterator iter;
+    MXFItemDef *itemDef;
+    MXFSetDef *staticSetDef;
+    MXFSetDef setDefKey;
+    size_t i;
+    int result = 0;
 
-#define MXF_BASIC_TYPE_DEF(id, name, size) \
-    CHK_OFAIL(mxf_register_basic_type(newDataModel, name, id, size));
+    if (mxf_get_list_length(&dataModel->itemDefs) == 0)
+        return 1;
 
-#define MXF_ARRAY_TYPE_DEF(id, name, elementTypeId, fixedSize) \
-    CHK_OFAIL(mxf_register_array_type(newDataModel, name, id, elementTypeId, fixedSize));
+    /* static set defs are read-only. Set defs that have registered item defs, or that inherit from set defs with
+       registered item defs, are copied into the set def tree so that their item def lists can be extended */
+    CHK_MALLOC_ARRAY_ORET(extendedStates, int, numStaticSetDefs);
+    memset(extendedStates, 0, sizeof(*extendedStates) * numStaticSetDefs);
+    mxf_initialise_list_iter(&iter, &dataModel->itemDefs);
+    while (mxf_next_list_iter_element(&iter)) {
+        itemDef = (MXFItemDef*)mxf_get_iter_element(&iter);
+        staticSetDef = find_static_set_def(dataModel, &itemDef->setDefKey);
+        if (staticSetDef)
+            extendedStates[staticSetDef - staticSetDefs] = 2;
+    }
+    for (i = 0; i < numStaticSetDefs; i++) {
+        if (!static_set_def_is_extended(dataModel, i, extendedStates))
+            continue;
 
-#define MXF_COMPOUND_TYPE_DEF(id, name) \
-    CHK_OFAIL((itemType = mxf_register_compound_type(newDataModel, name, id)) != NULL);
+        setDefKey.key = staticSetDefs[i].key;
+        if (!mxf_tree_find(&dataModel->setDefs, &setDefKey)) {
+            CHK_OFAIL(add_set_def(dataModel, staticSetDefs[i].name, &staticSetDefs[i].parentSetDefKey,
+                                  &staticSetDefs[i].key));
+        }
+    }
+    result = 1;
 
-#define MXF_COMPOUND_TYPE_MEMBER(name, typeId) \
-    CHK_OFAIL(mxf_register_compound_type_member(itemType, name, typeId));
+fail:
+    SAFE_FREE(extendedStates);
+    return result;
+}
 
-#define MXF_INTERPRETED_TYPE_DEF(id, name, typeId, fixedSize) \
-    CHK_OFAIL(mxf_register_interpret_type(newDataModel, name, id, typeId, fixedSize));
+static int traverse_set_def(void *nodeData, void *processData)
+{
+    MXFSetDef *setDef = (MXFSetDef*)nodeData;
+    TraverseSetDefsData *data = (TraverseSetDefsData*)processData;
+    const MXFSetDef *staticSetDef;
+    int result;
+
+    /* process the static set defs ordered before this set def. A static set def with the same key has been
+       replaced by the copy in the tree */
+    while (data->staticIndex < data->staticModel->numSetDefs) {
+        staticSetDef = &data->staticModel->setDefs[data->staticIndex];
+        result = memcmp(&staticSetDef->key, &setDef->key, sizeof(setDef->key));
+        if (result > 0)
+            break;
 
+        data->staticIndex++;
+        if (result < 0)
+            CHK_ORET(data->processFunc((void*)staticSetDef, data->processData));
+    }
 
-#define MXF_SET_DEFINITION(parentName, name, label) \
-    CHK_OFAIL(mxf_register_set_def(newDataModel, #name, &MXF_SET_K(parentName), &MXF_SET_K(name)));
+    return data->processFunc(setDef, data->processData);
+}
 
-#define MXF_ITEM_DEFINITION(setName, name, label, tag, typeId, isRequired) \
-    CHK_OFAIL(mxf_register_item_def(newDataModel, #name, &MXF_SET_K(setName), &MXF_ITEM_K(setName, name), tag, \
-                                    typeId, isRequired));
 
 
 int mxf_load_data_model(MXFDataModel **dataModel)
 {
     MXFDataModel *newDataModel;
-    MXFItemType *itemType = NULL;
 
+    /* the baseline and extensions data model is provided by the static tables. The item defs list and set defs
+       tree only hold the registered extensions and the copies of extended static set defs */
     CHK_MALLOC_ORET(newDataModel, MXFDataModel);
     memset(newDataModel, 0, sizeof(MXFDataModel));
+    newDataModel->staticModel = &g_baselineStaticDataModel;
     mxf_initialise_list(&newDataModel->itemDefs, free_item_def_in_list);
     mxf_tree_init(&newDataModel->setDefs, 0, compare_set_def_in_tree, free_set_def_in_tree);
 
-#define KEEP_DATA_MODEL_DEFS 1
-#include <mxf/mxf_baseline_data_model.h>
-
-#undef KEEP_DATA_MODEL_DEFS
-#include <mxf/mxf_extensions_data_model.h>
-
     *dataModel = newDataModel;
     return 1;
-
-fail:
-    mxf_free_data_model(&newDataModel);
-    return 0;
 }
 
 void mxf_free_data_model(MXFDataModel **dataModel)
@@ -382,6 +541,26 @@ void mxf_free_data_model(MXFDataModel **dataModel)
     SAFE_FREE(*dataModel);
 }
 
+int mxf_load_static_avid_extensions(MXFDataModel *dataModel)
+{
+    size_t i;
+
+    /* the Avid static tables replace the baseline tables, which is only possible if nothing has been registered */
+    if (dataModel->staticModel != &g_baselineStaticDataModel ||
+        mxf_get_list_length(&dataModel->itemDefs) > 0 ||
+        dataModel->setDefs.root)
+    {
+        return 0;
+    }
+    for (i = 0; i < ARRAY_SIZE(dataModel->types); i++) {
+        if (dataModel->types[i].typeId != 0)
+            return 0;
+    }
+
+    dataModel->staticModel = &g_avidStaticDataModel;
+    return 1;
+}
+
 int mxf_register_set_def(MXFDataModel *dataModel, const char *name, const mxfKey *parentKey, const mxfKey *key)
 {
     return register_set_def(dataModel, name, parentKey, key) != NULL;
@@ -471,6 +650,8 @@ int mxf_finalise_data_model(MXFDataModel *dataModel)
     MXFItemDef *itemDef;
     MXFSetDef *setDef;
 
+    CHK_ORET(copy_extended_static_set_defs(dataModel));
+
     /* reset set defs and set the parent set def if the parent set def key != g_Null_Key */
     CHK_ORET(mxf_tree_traverse(&dataModel->setDefs, finalise_set_def, dataModel));
 
@@ -479,6 +660,7 @@ int mxf_finalise_data_model(MXFDataModel *dataModel)
     while (mxf_next_list_iter_element(&iter)) {
         itemDef = (MXFItemDef*)mxf_get_iter_element(&iter);
         CHK_ORET(mxf_find_set_def(dataModel, &itemDef->setDefKey, &setDef));
+        CHK_ORET(!is_static_set_def(dataModel, setDef));
         CHK_ORET(mxf_append_list_element(&setDef->itemDefs, (void*)itemDef));
     }
 
@@ -487,24 +669,32 @@ int mxf_finalise_data_model(MXFDataModel *dataModel)
 
 int mxf_check_data_model(MXFDataModel *dataModel)
 {
-    MXFListIterator iter1;
-    MXFListIterator iter2;
+    MXFListIterator iter;
+    MXFItemDef **itemDefs;
     MXFItemDef *itemDef1;
     MXFItemDef *itemDef2;
-    size_t listIndex;
+    size_t numItemDefs;
+    size_t i, j;
+    int result = 0;
+
+    /* combine the static and registered item defs */
+    numItemDefs = dataModel->staticModel->numItemDefs + mxf_get_list_length(&dataModel->itemDefs);
+    CHK_MALLOC_ARRAY_ORET(itemDefs, MXFItemDef*, numItemDefs);
+    for (i = 0; i < dataModel->staticModel->numItemDefs; i++)
+        itemDefs[i] = (MXFItemDef*)&dataModel->staticModel->itemDefs[i];
+    mxf_initialise_list_iter(&iter, &dataModel->itemDefs);
+    while (mxf_next_list_iter_element(&iter))
+        itemDefs[i++] = (MXFItemDef*)mxf_get_iter_element(&iter);
 
     /* check that the item defs are unique (both key and static local tag),
        that the item def is contained in a set def
        and the item type is known */
-    listIndex = 0;
-    mxf_initialise_list_iter(&iter1, &dataModel->itemDefs);
-    while (mxf_next_list_iter_element(&iter1)) {
-        itemDef1 = (MXFItemDef*)mxf_get_iter_element(&iter1);
+    for (i = 0; i < numItemDefs; i++) {
+        itemDef1 = itemDefs[i];
 
         /* check with item defs with higher index in list */
-        mxf_initialise_list_iter_at(&iter2, &dataModel->itemDefs, listIndex + 1);
-        while (mxf_next_list_iter_element(&iter2)) {
-            itemDef2 = (MXFItemDef*)mxf_get_iter_element(&iter2);
+        for (j = i + 1; j < numItemDefs; j++) {
+            itemDef2 = itemDefs[j];
             if (mxf_equals_key(&itemDef1->key, &itemDef2->key)) {
                 /* if the items have the same key then check the local tags are identical */
                 if (itemDef1->localTag != itemDef2->localTag) {
@@ -512,7 +702,7 @@ int mxf_check_data_model(MXFDataModel *dataModel)
                     mxf_sprint_key(keyStr, &itemDef1->key);
                     mxf_log_warn("Duplicate item defs have different local tags. Key = %s"
                                  LOG_LOC_FORMAT, keyStr, LOG_LOC_PARAMS);
-                    return 0;
+                    goto fail;
                 }
             } else {
                 /* if the items do not have the same key then check the local tags are different */
@@ -521,7 +711,7 @@ int mxf_check_data_model(MXFDataModel *dataModel)
                     mxf_sprint_key(keyStr, &itemDef1->key);
                     mxf_log_warn("Duplicate item def local tag found. LocalTag = 0x%04x, Key = %s"
                                  LOG_LOC_FORMAT, itemDef1->localTag, keyStr, LOG_LOC_PARAMS);
-                    return 0;
+                    goto fail;
                 }
             }
         }
@@ -532,13 +722,15 @@ int mxf_check_data_model(MXFDataModel *dataModel)
             mxf_sprint_key(keyStr, &itemDef1->key);
             mxf_log_warn("Item def has unknown type (%d). LocalTag = 0x%04x, Key = %s"
                          LOG_LOC_FORMAT, itemDef1->typeId, itemDef1->localTag, keyStr, LOG_LOC_PARAMS);
-            return 0;
+            goto fail;
         }
-
-        listIndex++;
     }
 
-    return 1;
+    result = 1;
+
+fail:
+    SAFE_FREE(itemDefs);
+    return result;
 }
 
 int mxf_find_set_def(MXFDataModel *dataModel, const mxfKey *key, MXFSetDef **setDef)
@@ -546,25 +738,49 @@ int mxf_find_set_def(MXFDataModel *dataModel, const mxfKey *key, MXFSetDef **set
     MXFSetDef *result;
     MXFSetDef setDefKey;
 
+    /* the set def tree contains the copies of extended static set defs and so is searched first */
     setDefKey.key = *key;
     result = mxf_tree_find(&dataModel->setDefs, &setDefKey);
-    if (!result)
-        return 0;
+    if (!result) {
+        result = find_static_set_def(dataModel, key);
+        if (!result)
+            return 0;
+    }
 
-    *setDef = (MXFSetDef*)result;
+    *setDef = result;
     return 1;
 }
 
 int mxf_find_item_def(MXFDataModel *dataModel, const mxfKey *key, MXFItemDef **itemDef)
 {
-    void *result = mxf_find_list_element(&dataModel->itemDefs, (void*)key, item_def_eq);
-    if (!result)
-        return 0;
+    void *result = find_static_item_def(dataModel, key);
+    if (!result) {
+        result = mxf_find_list_element(&dataModel->itemDefs, (void*)key, item_def_eq);
+        if (!result)
+            return 0;
+    }
 
     *itemDef = (MXFItemDef*)result;
     return 1;
 }
 
+int mxf_traverse_set_defs(MXFDataModel *dataModel, mxf_tree_process_node_f process_f, void *process_data)
+{
+    TraverseSetDefsData data;
+
+    data.staticModel = dataModel->staticModel;
+    data.staticIndex = 0;
+    data.processFunc = process_f;
+    data.processData = process_data;
+    CHK_ORET(mxf_tree_traverse(&dataModel->setDefs, traverse_set_def, &data));
+
+    /* process the remaining static set defs ordered after the last set def in the tree */
+    for (; data.staticIndex < dataModel->staticModel->numSetDefs; data.staticIndex++)
+        CHK_ORET(process_f((void*)&dataModel->staticModel->setDefs[data.staticIndex], process_data));
+
+    return 1;
+}
+
 int mxf_find_item_def_in_set_def(const mxfKey *key, const MXFSetDef *setDef, MXFItemDef **itemDef)
 {
     void *result = mxf_find_list_element(&setDef->itemDefs, (void*)key, item_def_eq);
@@ -580,6 +796,10 @@ int mxf_find_item_def_in_set_def(const mxfKey *key, const MXFSetDef *setDef, MXF
 
 MXFItemType* mxf_get_item_def_type(MXFDataModel *dataModel, unsigned int typeId)
 {
+    const MXFItemType *staticType = get_static_type(dataModel, typeId);
+    if (staticType)
+        return (MXFItemType*)staticType;
+
     if (typeId == 0 || typeId >= ARRAY_SIZE(dataModel->types) || dataModel->types[typeId].typeId == MXF_UNKNOWN_TYPE)
         return NULL;
 
@@ -618,6 +838,7 @@ int mxf_clone_set_def(MXFDataModel *fromDataModel, MXFSetDef *fromSetDef,
     MXFListIterator iter;
     MXFItemDef *fromItemDef;
     MXFItemDef *toItemDef = NULL;
+    int staticSetDefExtended = 0;
 
     if (!mxf_find_set_def(toDataModel, &fromSetDef->key, &clonedSetDef)) {
         if (fromSetDef->parentSetDef)
@@ -636,7 +857,16 @@ int mxf_clone_set_def(MXFDataModel *fromDataModel, MXFSetDef *fromSetDef,
             continue;
 
         CHK_ORET(clone_item_def(fromDataModel, fromItemDef, toDataModel, &toItemDef));
-        CHK_ORET(mxf_append_list_element(&clonedSetDef->itemDefs, (void*)toItemDef));
+        if (is_static_set_def(toDataModel, clonedSetDef))
+            staticSetDefExtended = 1;
+        else
+            CHK_ORET(mxf_append_list_element(&clonedSetDef->itemDefs, (void*)toItemDef));
+    }
+
+    /* the static set def is replaced by an extended copy when the data model is finalised */
+    if (staticSetDefExtended) {
+        CHK_ORET(mxf_finalise_data_model(toDataModel));
+        CHK_ORET(mxf_find_set_def(toDataModel, &fromSetDef->key, &clonedSetDef));
     }
 
     *toSetDef = clonedSetDef;
@@ -116,8 +116,15 @@ typedef struct MXFSetDef
     struct MXFSetDef *parentSetDef;
 } MXFSetDef;
 
+struct MXFStaticDataModel;
+
+/* The baseline and extensions data model, and the same model with the Avid extensions, are held in static, read-only
+   tables. The itemDefs, setDefs and types members hold the registered extensions and the copies of the static set
+   defs that the extensions add item defs to.
+   Use the find, get and traverse functions below to access the complete data model */
 typedef struct
 {
+    const struct MXFStaticDataModel *staticModel;
     MXFList itemDefs;
     MXFTree setDefs;
     MXFItemType types[128]; /* index 0 is not used */
@@ -242,6 +249,10 @@ typedef enum
 int mxf_load_data_model(MXFDataModel **dataModel);
 void mxf_free_data_model(MXFDataModel **dataModel);
 
+/* switches a data model that has no registered extensions to the static tables that include the Avid extensions.
+   Returns 0 if the data model has registered extensions and the Avid extensions must be registered instead */
+int mxf_load_static_avid_extensions(MXFDataModel *dataModel);
+
 int mxf_register_set_def(MXFDataModel *dataModel, const char *name, const mxfKey *parentKey, const mxfKey *key);
 int mxf_register_item_def(MXFDataModel *dataModel, const char *name, const mxfKey *setKey,
                           const mxfKey *key, mxfLocalTag tag, unsigned int typeId, int isRequired);
@@ -266,6 +277,9 @@ int mxf_find_item_def_in_set_def(const mxfKey *key, const MXFSetDef *setDef, MXF
 
 MXFItemType* mxf_get_item_def_type(MXFDataModel *dataModel, unsigned int typeId);
 
+/* processes the set defs in key order */
+int mxf_traverse_set_defs(MXFDataModel *dataModel, mxf_tree_process_node_f process_f, void *process_data);
+
 int mxf_is_subclass_of(MXFDataModel *dataModel, const mxfKey *setKey, const mxfKey *parentSetKey);
 int mxf_is_subclass_of_2(MXFDataModel *dataModel, MXFSetDef *setDef, const mxfKey *parentSetKey);
 
@@ -0,0 +1,5238 @@
+/*
+ * Static data model tables
+ *
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+    Static data model tables generated using libMXF/tools/gen_data_model_tables/gen_data_model_tables
+    from mxf_baseline_data_model.h and mxf_extensions_data_model.h, and for the Avid model
+    mxf_avid_extensions_data_model.h
+*/
+
+
+static const MXFItemType g_baselineItemTypes[MXF_EXTENSION_TYPE] =
+{
+    [MXF_INT8_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_INT8_TYPE, (char*)"Int8", {.basic = {1}}},
+    [MXF_INT16_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_INT16_TYPE, (char*)"Int16", {.basic = {2}}},
+    [MXF_INT32_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_INT32_TYPE, (char*)"Int32", {.basic = {4}}},
+    [MXF_INT64_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_INT64_TYPE, (char*)"Int64", {.basic = {8}}},
+    [MXF_UINT8_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_UINT8_TYPE, (char*)"UInt8", {.basic = {1}}},
+    [MXF_UINT16_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_UINT16_TYPE, (char*)"UInt16", {.basic = {2}}},
+    [MXF_UINT32_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_UINT32_TYPE, (char*)"UInt32", {.basic = {4}}},
+    [MXF_UINT64_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_UINT64_TYPE, (char*)"UInt64", {.basic = {8}}},
+    [MXF_RAW_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_RAW_TYPE, (char*)"Raw", {.basic = {0}}},
+    [MXF_UTF16STRING_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UTF16STRING_TYPE, (char*)"UTF16String", {.array = {MXF_UTF16_TYPE, 0}}},
+    [MXF_UTF16STRINGARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UTF16STRINGARRAY_TYPE, (char*)"UTF16StringArray", {.array = {MXF_UTF16_TYPE, 0}}},
+    [MXF_UTF8STRING_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UTF8STRING_TYPE, (char*)"UTF8String", {.array = {MXF_UTF8_TYPE, 0}}},
+    [MXF_INT8ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT8ARRAY_TYPE, (char*)"Int8Array", {.array = {MXF_INT8_TYPE, 0}}},
+    [MXF_INT16ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT16ARRAY_TYPE, (char*)"Int16Array", {.array = {MXF_INT16_TYPE, 0}}},
+    [MXF_INT32ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT32ARRAY_TYPE, (char*)"Int32Array", {.array = {MXF_INT32_TYPE, 0}}},
+    [MXF_INT64ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT64ARRAY_TYPE, (char*)"Int64Array", {.array = {MXF_INT64_TYPE, 0}}},
+    [MXF_UINT8ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT8ARRAY_TYPE, (char*)"UInt8Array", {.array = {MXF_UINT8_TYPE, 0}}},
+    [MXF_UINT16ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT16ARRAY_TYPE, (char*)"UInt16Array", {.array = {MXF_UINT16_TYPE, 0}}},
+    [MXF_UINT32ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT32ARRAY_TYPE, (char*)"UInt32Array", {.array = {MXF_UINT32_TYPE, 0}}},
+    [MXF_UINT64ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT64ARRAY_TYPE, (char*)"UInt64Array", {.array = {MXF_UINT64_TYPE, 0}}},
+    [MXF_ISO7STRING_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_ISO7STRING_TYPE, (char*)"ISO7String", {.array = {MXF_ISO7_TYPE, 0}}},
+    [MXF_INT8BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT8BATCH_TYPE, (char*)"Int8Batch", {.array = {MXF_INT8_TYPE, 0}}},
+    [MXF_INT16BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT16BATCH_TYPE, (char*)"Int16Batch", {.array = {MXF_INT16_TYPE, 0}}},
+    [MXF_INT32BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT32BATCH_TYPE, (char*)"Int32Batch", {.array = {MXF_INT32_TYPE, 0}}},
+    [MXF_INT64BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT64BATCH_TYPE, (char*)"Int64Batch", {.array = {MXF_INT64_TYPE, 0}}},
+    [MXF_UINT8BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT8BATCH_TYPE, (char*)"UInt8Batch", {.array = {MXF_UINT8_TYPE, 0}}},
+    [MXF_UINT16BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT16BATCH_TYPE, (char*)"UInt16Batch", {.array = {MXF_UINT16_TYPE, 0}}},
+    [MXF_UINT32BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT32BATCH_TYPE, (char*)"UInt32Batch", {.array = {MXF_UINT32_TYPE, 0}}},
+    [MXF_UINT64BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT64BATCH_TYPE, (char*)"UInt64Batch", {.array = {MXF_UINT64_TYPE, 0}}},
+    [MXF_AUIDARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_AUIDARRAY_TYPE, (char*)"AUIDArray", {.array = {MXF_AUID_TYPE, 0}}},
+    [MXF_ULARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_ULARRAY_TYPE, (char*)"ULArray", {.array = {MXF_UL_TYPE, 0}}},
+    [MXF_ULBATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_ULBATCH_TYPE, (char*)"ULBatch", {.array = {MXF_UL_TYPE, 0}}},
+    [MXF_UUIDARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UUIDARRAY_TYPE, (char*)"UUIDArray", {.array = {MXF_UUID_TYPE, 0}}},
+    [MXF_UUIDBATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UUIDBATCH_TYPE, (char*)"UUIDBatch", {.array = {MXF_UUID_TYPE, 0}}},
+    [MXF_STRONGREFARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_STRONGREFARRAY_TYPE, (char*)"StrongRefArray", {.array = {MXF_STRONGREF_TYPE, 0}}},
+    [MXF_STRONGREFBATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_STRONGREFBATCH_TYPE, (char*)"StrongRefBatch", {.array = {MXF_STRONGREF_TYPE, 0}}},
+    [MXF_WEAKREFARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_WEAKREFARRAY_TYPE, (char*)"WeakRefArray", {.array = {MXF_WEAKREF_TYPE, 0}}},
+    [MXF_WEAKREFBATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_WEAKREFBATCH_TYPE, (char*)"WeakRefBatch", {.array = {MXF_WEAKREF_TYPE, 0}}},
+    [MXF_RATIONALARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_RATIONALARRAY_TYPE, (char*)"RationalArray", {.array = {MXF_RATIONAL_TYPE, 0}}},
+    [MXF_RGBALAYOUT_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_RGBALAYOUT_TYPE, (char*)"RGBALayout", {.array = {MXF_RGBALAYOUTCOMPONENT_TYPE, 8}}},
+    [MXF_AES3_FIXED_DATA_ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_AES3_FIXED_DATA_ARRAY_TYPE, (char*)"AES3FixedDataArray", {.array = {MXF_AES3_FIXED_DATA_TYPE, 0}}},
+    [MXF_J2K_COMPONENT_SIZING_ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_J2K_COMPONENT_SIZING_ARRAY_TYPE, (char*)"J2KComponentSizingArray", {.array = {MXF_J2K_COMPONENT_SIZING_TYPE, 0}}},
+    [MXF_THREE_COLOR_PRIMARIES_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_THREE_COLOR_PRIMARIES_TYPE, (char*)"ThreeColorPrimaries", {.array = {MXF_COLOR_PRIMARY_TYPE, 3}}},
+    [MXF_RIFF_CHUNK_ID_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_RIFF_CHUNK_ID_TYPE, (char*)"RIFFChunkIDType", {.array = {MXF_ISO7_TYPE, 4}}},
+    [MXF_RATIONAL_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_RATIONAL_TYPE, (char*)"Rational", {.compound = {{
+        {(char*)"Numerator", MXF_INT32_TYPE},
+        {(char*)"Denominator", MXF_INT32_TYPE},
+    }}}},
+    [MXF_TIMESTAMP_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_TIMESTAMP_TYPE, (char*)"Timestamp", {.compound = {{
+        {(char*)"Year", MXF_UINT16_TYPE},
+        {(char*)"Month", MXF_UINT8_TYPE},
+        {(char*)"Day", MXF_UINT8_TYPE},
+        {(char*)"Hours", MXF_UINT8_TYPE},
+        {(char*)"Minutes", MXF_UINT8_TYPE},
+        {(char*)"Seconds", MXF_UINT8_TYPE},
+        {(char*)"QMSec", MXF_UINT8_TYPE},
+    }}}},
+    [MXF_PRODUCTVERSION_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_PRODUCTVERSION_TYPE, (char*)"ProductVersion", {.compound = {{
+        {(char*)"Major", MXF_UINT16_TYPE},
+        {(char*)"Minor", MXF_UINT16_TYPE},
+        {(char*)"Patch", MXF_UINT16_TYPE},
+        {(char*)"Build", MXF_UINT16_TYPE},
+        {(char*)"Release", MXF_UINT16_TYPE},
+    }}}},
+    [MXF_INDIRECT_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_INDIRECT_TYPE, (char*)"Indirect", {.compound = {{
+        {(char*)"Type", MXF_UL_TYPE},
+        {(char*)"Value", MXF_UINT8ARRAY_TYPE},
+    }}}},
+    [MXF_RGBALAYOUTCOMPONENT_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_RGBALAYOUTCOMPONENT_TYPE, (char*)"RGBALayoutComponent", {.compound = {{
+        {(char*)"Code", MXF_RGBACODE_TYPE},
+        {(char*)"Depth", MXF_UINT8_TYPE},
+    }}}},
+    [MXF_J2K_COMPONENT_SIZING_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_J2K_COMPONENT_SIZING_TYPE, (char*)"J2KComponentSizing", {.compound = {{
+        {(char*)"Ssiz", MXF_UINT8_TYPE},
+        {(char*)"XRsiz", MXF_UINT8_TYPE},
+        {(char*)"YRsiz", MXF_UINT8_TYPE},
+    }}}},
+    [MXF_COLOR_PRIMARY_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_COLOR_PRIMARY_TYPE, (char*)"ColorPrimary", {.compound = {{
+        {(char*)"X", MXF_UINT16_TYPE},
+        {(char*)"Y", MXF_UINT16_TYPE},
+    }}}},
+    [MXF_VERSIONTYPE_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_VERSIONTYPE_TYPE, (char*)"VersionType", {.interpret = {MXF_UINT16_TYPE, 0}}},
+    [MXF_UTF16_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UTF16_TYPE, (char*)"UTF16", {.interpret = {MXF_UINT16_TYPE, 0}}},
+    [MXF_UTF8_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UTF8_TYPE, (char*)"UTF8", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_BOOLEAN_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_BOOLEAN_TYPE, (char*)"Boolean", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_ISO7_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_ISO7_TYPE, (char*)"ISO7", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_LENGTH_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_LENGTH_TYPE, (char*)"Length", {.interpret = {MXF_INT64_TYPE, 0}}},
+    [MXF_POSITION_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_POSITION_TYPE, (char*)"Position", {.interpret = {MXF_INT64_TYPE, 0}}},
+    [MXF_RGBACODE_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_RGBACODE_TYPE, (char*)"RGBACode", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_STREAM_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_STREAM_TYPE, (char*)"Stream", {.interpret = {MXF_RAW_TYPE, 0}}},
+    [MXF_DATAVALUE_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_DATAVALUE_TYPE, (char*)"DataValue", {.interpret = {MXF_UINT8ARRAY_TYPE, 0}}},
+    [MXF_IDENTIFIER_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_IDENTIFIER_TYPE, (char*)"Identifier", {.interpret = {MXF_UINT8ARRAY_TYPE, 0}}},
+    [MXF_OPAQUE_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_OPAQUE_TYPE, (char*)"Opaque", {.interpret = {MXF_UINT8ARRAY_TYPE, 0}}},
+    [MXF_UMID_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UMID_TYPE, (char*)"UMID", {.interpret = {MXF_IDENTIFIER_TYPE, 32}}},
+    [MXF_UID_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UID_TYPE, (char*)"UID", {.interpret = {MXF_IDENTIFIER_TYPE, 16}}},
+    [MXF_UL_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UL_TYPE, (char*)"UL", {.interpret = {MXF_IDENTIFIER_TYPE, 16}}},
+    [MXF_UUID_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UUID_TYPE, (char*)"UUID", {.interpret = {MXF_IDENTIFIER_TYPE, 16}}},
+    [MXF_AUID_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_AUID_TYPE, (char*)"AUID", {.interpret = {MXF_UL_TYPE, 16}}},
+    [MXF_PACKAGEID_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_PACKAGEID_TYPE, (char*)"PackageID", {.interpret = {MXF_UMID_TYPE, 32}}},
+    [MXF_STRONGREF_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_STRONGREF_TYPE, (char*)"StrongRef", {.interpret = {MXF_UUID_TYPE, 16}}},
+    [MXF_WEAKREF_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_WEAKREF_TYPE, (char*)"WeakRef", {.interpret = {MXF_UUID_TYPE, 16}}},
+    [MXF_ORIENTATION_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_ORIENTATION_TYPE, (char*)"Orientation", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_CODED_CONTENT_TYPE_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_CODED_CONTENT_TYPE_TYPE, (char*)"CodedContentType", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_AES3_FIXED_DATA_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_AES3_FIXED_DATA_TYPE, (char*)"AES3FixedData", {.interpret = {MXF_UINT8ARRAY_TYPE, 24}}},
+    [MXF_J2K_EXTENDED_CAPABILITIES_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_J2K_EXTENDED_CAPABILITIES_TYPE, (char*)"J2KExtendedCapabilities", {.interpret = {MXF_UINT8ARRAY_TYPE, 0}}},
+};
+
+static const MXFItemDef g_baselineItemDefs[282] =
+{
+    /* InterchangeObject::InstanceUID */
+    {(char*)"InstanceUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x3c0a, MXF_UUID_TYPE, 1},
+    /* GenericPackage::PackageUID */
+    {(char*)"PackageUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x10, 0x00, 0x00, 0x00, 0x00},
+        0x4401, MXF_UMID_TYPE, 1},
+    /* NetworkLocator::URLString */
+    {(char*)"URLString",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x32, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x4001, MXF_UTF16STRING_TYPE, 1},
+    /* GenericPackage::Name */
+    {(char*)"Name",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x4402, MXF_UTF16STRING_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::AspectRatio */
+    {(char*)"AspectRatio",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x320e, MXF_RATIONAL_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::FrameLayout */
+    {(char*)"FrameLayout",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x320c, MXF_UINT8_TYPE, 0},
+    /* CDCIEssenceDescriptor::HorizontalSubsampling */
+    {(char*)"HorizontalSubsampling",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x3302, MXF_UINT32_TYPE, 0},
+    /* CDCIEssenceDescriptor::ColorSiting */
+    {(char*)"ColorSiting",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x3303, MXF_UINT8_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::SampledHeight */
+    {(char*)"SampledHeight",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x07, 0x00, 0x00, 0x00},
+        0x3204, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::SampledWidth */
+    {(char*)"SampledWidth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x08, 0x00, 0x00, 0x00},
+        0x3205, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::SampledXOffset */
+    {(char*)"SampledXOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x09, 0x00, 0x00, 0x00},
+        0x3206, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::SampledYOffset */
+    {(char*)"SampledYOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0a, 0x00, 0x00, 0x00},
+        0x3207, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::DisplayHeight */
+    {(char*)"DisplayHeight",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0b, 0x00, 0x00, 0x00},
+        0x3208, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::DisplayWidth */
+    {(char*)"DisplayWidth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0c, 0x00, 0x00, 0x00},
+        0x3209, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::DisplayXOffset */
+    {(char*)"DisplayXOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0d, 0x00, 0x00, 0x00},
+        0x320a, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::DisplayYOffset */
+    {(char*)"DisplayYOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0e, 0x00, 0x00, 0x00},
+        0x320b, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::StoredHeight */
+    {(char*)"StoredHeight",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x3202, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::StoredWidth */
+    {(char*)"StoredWidth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00},
+        0x3203, MXF_UINT32_TYPE, 0},
+    /* CDCIEssenceDescriptor::BlackRefLevel */
+    {(char*)"BlackRefLevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00},
+        0x3304, MXF_UINT32_TYPE, 0},
+    /* CDCIEssenceDescriptor::WhiteReflevel */
+    {(char*)"WhiteReflevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x03, 0x04, 0x00, 0x00, 0x00},
+        0x3305, MXF_UINT32_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::ElectroSpatialFormulation */
+    {(char*)"ElectroSpatialFormulation",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x3d05, MXF_UINT8_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::AudioRefLevel */
+    {(char*)"AudioRefLevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00},
+        0x3d04, MXF_INT8_TYPE, 0},
+    /* TimecodeComponent::DropFrame */
+    {(char*)"DropFrame",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x1503, MXF_BOOLEAN_TYPE, 1},
+    /* FileDescriptor::SampleRate */
+    {(char*)"SampleRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x3001, MXF_RATIONAL_TYPE, 1},
+    /* FileDescriptor::ContainerDuration */
+    {(char*)"ContainerDuration",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x3002, MXF_LENGTH_TYPE, 0},
+    /* TextLocator::LocatorName */
+    {(char*)"LocatorName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x33, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x4101, MXF_UTF16STRING_TYPE, 1},
+    /* GenericTrack::TrackNumber */
+    {(char*)"TrackNumber",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x4804, MXF_UINT32_TYPE, 1},
+    /* GenericTrack::TrackID */
+    {(char*)"TrackID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x4801, MXF_UINT32_TYPE, 0},
+    /* GenericTrack::TrackName */
+    {(char*)"TrackName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x07, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x4802, MXF_UTF16STRING_TYPE, 0},
+    /* Preface::ObjectModelVersion */
+    {(char*)"ObjectModelVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x3b07, MXF_UINT32_TYPE, 0},
+    /* Preface::Version */
+    {(char*)"Version",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x3b05, MXF_VERSIONTYPE_TYPE, 1},
+    /* TaggedValue::Name */
+    {(char*)"Name",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x09, 0x01, 0x00, 0x00},
+        0x5001, MXF_UTF16STRING_TYPE, 1},
+    /* TaggedValue::Value */
+    {(char*)"Value",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x0a, 0x01, 0x00, 0x00},
+        0x5003, MXF_INDIRECT_TYPE, 1},
+    /* GenericPackage::UserComments */
+    {(char*)"UserComments",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x0c, 0x00, 0x00, 0x00},
+        0x4406, MXF_STRONGREFARRAY_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::CaptureGamma */
+    {(char*)"CaptureGamma",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x00},
+        0x3210, MXF_UL_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::CodingEquations */
+    {(char*)"CodingEquations",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00},
+        0x321a, MXF_UL_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::FieldDominance */
+    {(char*)"FieldDominance",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x03, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x3212, MXF_UINT8_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::VideoLineMap */
+    {(char*)"VideoLineMap",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x03, 0x02, 0x05, 0x00, 0x00, 0x00},
+        0x320d, MXF_INT32ARRAY_TYPE, 0},
+    /* CDCIEssenceDescriptor::VerticalSubsampling */
+    {(char*)"VerticalSubsampling",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x01, 0x10, 0x00, 0x00, 0x00},
+        0x3308, MXF_UINT32_TYPE, 0},
+    /* CDCIEssenceDescriptor::ColorRange */
+    {(char*)"ColorRange",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x05, 0x00, 0x00, 0x00},
+        0x3306, MXF_UINT32_TYPE, 0},
+    /* RGBAEssenceDescriptor::PixelLayout */
+    {(char*)"PixelLayout",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x06, 0x00, 0x00, 0x00},
+        0x3401, MXF_RGBALAYOUT_TYPE, 0},
+    /* CDCIEssenceDescriptor::AlphaSampleDepth */
+    {(char*)"AlphaSampleDepth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00},
+        0x3309, MXF_UINT32_TYPE, 0},
+    /* RGBAEssenceDescriptor::Palette */
+    {(char*)"Palette",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x08, 0x00, 0x00, 0x00},
+        0x3403, MXF_DATAVALUE_TYPE, 0},
+    /* RGBAEssenceDescriptor::PaletteLayout */
+    {(char*)"PaletteLayout",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x09, 0x00, 0x00, 0x00},
+        0x3404, MXF_RGBALAYOUT_TYPE, 0},
+    /* CDCIEssenceDescriptor::ComponentDepth */
+    {(char*)"ComponentDepth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x0a, 0x00, 0x00, 0x00},
+        0x3301, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::PictureEssenceCoding */
+    {(char*)"PictureEssenceCoding",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x3201, MXF_UL_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::SoundEssenceCompression */
+    {(char*)"SoundEssenceCompression",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x02, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x3d06, MXF_UL_TYPE, 0},
+    /* TimecodeComponent::RoundedTimecodeBase */
+    {(char*)"RoundedTimecodeBase",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x04, 0x01, 0x01, 0x02, 0x06, 0x00, 0x00},
+        0x1502, MXF_UINT16_TYPE, 1},
+    /* StructuralComponent::DataDefinition */
+    {(char*)"DataDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0201, MXF_UL_TYPE, 1},
+    /* GenericPictureEssenceDescriptor::ImageAlignmentOffset */
+    {(char*)"ImageAlignmentOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x3211, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ImageStartOffset */
+    {(char*)"ImageStartOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x3213, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ImageEndOffset */
+    {(char*)"ImageEndOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x3214, MXF_UINT32_TYPE, 0},
+    /* CDCIEssenceDescriptor::PaddingBits */
+    {(char*)"PaddingBits",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00},
+        0x3307, MXF_INT16_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::AlphaTransparency */
+    {(char*)"AlphaTransparency",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x320f, MXF_UINT8_TYPE, 0},
+    /* Identification::ThisGenerationUID */
+    {(char*)"ThisGenerationUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x3c09, MXF_UUID_TYPE, 1},
+    /* Identification::CompanyName */
+    {(char*)"CompanyName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x02, 0x01, 0x00, 0x00},
+        0x3c01, MXF_UTF16STRING_TYPE, 1},
+    /* Identification::ProductName */
+    {(char*)"ProductName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x03, 0x01, 0x00, 0x00},
+        0x3c02, MXF_UTF16STRING_TYPE, 1},
+    /* Identification::ProductVersion */
+    {(char*)"ProductVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x3c03, MXF_PRODUCTVERSION_TYPE, 0},
+    /* Identification::VersionString */
+    {(char*)"VersionString",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x05, 0x01, 0x00, 0x00},
+        0x3c04, MXF_UTF16STRING_TYPE, 1},
+    /* Identification::Platform */
+    {(char*)"Platform",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x06, 0x01, 0x00, 0x00},
+        0x3c08, MXF_UTF16STRING_TYPE, 0},
+    /* Identification::ProductUID */
+    {(char*)"ProductUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x07, 0x00, 0x00, 0x00},
+        0x3c05, MXF_UUID_TYPE, 1},
+    /* InterchangeObject::GenerationUID */
+    {(char*)"GenerationUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x08, 0x00, 0x00, 0x00},
+        0x0102, MXF_UUID_TYPE, 0},
+    /* Identification::ToolkitVersion */
+    {(char*)"ToolkitVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x0a, 0x00, 0x00, 0x00},
+        0x3c07, MXF_PRODUCTVERSION_TYPE, 0},
+    /* EventTrack::EventEditRate */
+    {(char*)"EventEditRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x4901, MXF_RATIONAL_TYPE, 1},
+    /* DMSegment::EventComment */
+    {(char*)"EventComment",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x04, 0x04, 0x01, 0x00, 0x00, 0x00},
+        0x0602, MXF_UTF16STRING_TYPE, 0},
+    /* Track::EditRate */
+    {(char*)"EditRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00},
+        0x4b01, MXF_RATIONAL_TYPE, 1},
+    /* SourceClip::SourcePackageID */
+    {(char*)"SourcePackageID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00},
+        0x1101, MXF_PACKAGEID_TYPE, 1},
+    /* SourceClip::SourceTrackID */
+    {(char*)"SourceTrackID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00},
+        0x1102, MXF_UINT32_TYPE, 1},
+    /* FileDescriptor::EssenceContainer */
+    {(char*)"EssenceContainer",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x01, 0x02, 0x00, 0x00},
+        0x3004, MXF_UL_TYPE, 1},
+    /* FileDescriptor::Codec */
+    {(char*)"Codec",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x01, 0x03, 0x00, 0x00},
+        0x3005, MXF_UL_TYPE, 0},
+    /* Preface::ContentStorage */
+    {(char*)"ContentStorage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x01, 0x00, 0x00},
+        0x3b03, MXF_STRONGREF_TYPE, 1},
+    /* SourcePackage::Descriptor */
+    {(char*)"Descriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x37, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x03, 0x00, 0x00},
+        0x4701, MXF_STRONGREF_TYPE, 0},
+    /* GenericTrack::Sequence */
+    {(char*)"Sequence",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x04, 0x00, 0x00},
+        0x4803, MXF_STRONGREF_TYPE, 1},
+    /* EssenceGroup::StillFrame */
+    {(char*)"StillFrame",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x08, 0x00, 0x00},
+        0x0502, MXF_STRONGREF_TYPE, 0},
+    /* ContentStorage::Packages */
+    {(char*)"Packages",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x01, 0x00, 0x00},
+        0x1901, MXF_STRONGREFBATCH_TYPE, 1},
+    /* ContentStorage::EssenceContainerData */
+    {(char*)"EssenceContainerData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x02, 0x00, 0x00},
+        0x1902, MXF_STRONGREFBATCH_TYPE, 0},
+    /* EssenceGroup::Choices */
+    {(char*)"Choices",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x01, 0x00, 0x00},
+        0x0501, MXF_STRONGREFBATCH_TYPE, 1},
+    /* GenericDescriptor::Locators */
+    {(char*)"Locators",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x03, 0x00, 0x00},
+        0x2f01, MXF_STRONGREFARRAY_TYPE, 0},
+    /* Preface::Identifications */
+    {(char*)"Identifications",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x04, 0x00, 0x00},
+        0x3b06, MXF_STRONGREFARRAY_TYPE, 1},
+    /* GenericPackage::Tracks */
+    {(char*)"Tracks",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x05, 0x00, 0x00},
+        0x4403, MXF_STRONGREFARRAY_TYPE, 1},
+    /* Sequence::StructuralComponents */
+    {(char*)"StructuralComponents",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x09, 0x00, 0x00},
+        0x1001, MXF_STRONGREFARRAY_TYPE, 1},
+    /* EssenceContainerData::LinkedPackageUID */
+    {(char*)"LinkedPackageUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00, 0x00, 0x00},
+        0x2701, MXF_UMID_TYPE, 1},
+    /* Track::Origin */
+    {(char*)"Origin",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x01, 0x03, 0x00, 0x00},
+        0x4b02, MXF_POSITION_TYPE, 1},
+    /* SourceClip::StartPosition */
+    {(char*)"StartPosition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x01, 0x04, 0x00, 0x00},
+        0x1201, MXF_POSITION_TYPE, 1},
+    /* TimecodeComponent::StartTimecode */
+    {(char*)"StartTimecode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x01, 0x05, 0x00, 0x00},
+        0x1501, MXF_POSITION_TYPE, 1},
+    /* DMSegment::EventStartPosition */
+    {(char*)"EventStartPosition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00},
+        0x0601, MXF_POSITION_TYPE, 1},
+    /* GenericPackage::PackageCreationDate */
+    {(char*)"PackageCreationDate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x01, 0x03, 0x00, 0x00},
+        0x4405, MXF_TIMESTAMP_TYPE, 1},
+    /* Identification::ModificationDate */
+    {(char*)"ModificationDate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x02, 0x03, 0x00, 0x00},
+        0x3c06, MXF_TIMESTAMP_TYPE, 1},
+    /* Preface::LastModifiedDate */
+    {(char*)"LastModifiedDate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x02, 0x04, 0x00, 0x00},
+        0x3b02, MXF_TIMESTAMP_TYPE, 1},
+    /* GenericPackage::PackageModifiedDate */
+    {(char*)"PackageModifiedDate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x02, 0x05, 0x00, 0x00},
+        0x4404, MXF_TIMESTAMP_TYPE, 1},
+    /* StructuralComponent::Duration */
+    {(char*)"Duration",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x02, 0x01, 0x01, 0x03, 0x00, 0x00},
+        0x0202, MXF_LENGTH_TYPE, 0},
+    /* EssenceContainerData::BodySID */
+    {(char*)"BodySID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00},
+        0x3f07, MXF_UINT32_TYPE, 1},
+    /* DCTimedTextResourceSubDescriptor::EssenceStreamID */
+    {(char*)"EssenceStreamID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00},
+        0x3f07, MXF_UINT32_TYPE, 1},
+    /* EssenceContainerData::IndexSID */
+    {(char*)"IndexSID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00},
+        0x3f06, MXF_UINT32_TYPE, 0},
+    /* DMSegment::TrackIDs */
+    {(char*)"TrackIDs",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x07, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00},
+        0x6102, MXF_UINT32BATCH_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::Locked */
+    {(char*)"Locked",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x02, 0x03, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x3d02, MXF_BOOLEAN_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::QuantizationBits */
+    {(char*)"QuantizationBits",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00},
+        0x3d01, MXF_UINT32_TYPE, 0},
+    /* Preface::PrimaryPackage */
+    {(char*)"PrimaryPackage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x04, 0x01, 0x08, 0x00, 0x00},
+        0x3b08, MXF_WEAKREF_TYPE, 0},
+    /* MultipleDescriptor::SubDescriptorUIDs */
+    {(char*)"SubDescriptorUIDs",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x44, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x04, 0x06, 0x0b, 0x00, 0x00},
+        0x3f01, MXF_STRONGREFARRAY_TYPE, 1},
+    /* Preface::OperationalPattern */
+    {(char*)"OperationalPattern",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x3b09, MXF_UL_TYPE, 1},
+    /* Preface::EssenceContainers */
+    {(char*)"EssenceContainers",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x10, 0x02, 0x01, 0x00, 0x00},
+        0x3b0a, MXF_ULBATCH_TYPE, 1},
+    /* Preface::DMSchemes */
+    {(char*)"DMSchemes",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x10, 0x02, 0x02, 0x00, 0x00},
+        0x3b0b, MXF_ULBATCH_TYPE, 1},
+    /* DMSourceClip::DMSourceClipTrackIDs */
+    {(char*)"DMSourceClipTrackIDs",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x45, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x07, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00},
+        0x6103, MXF_UINT32BATCH_TYPE, 0},
+    /* CDCIEssenceDescriptor::ReversedByteOrder */
+    {(char*)"ReversedByteOrder",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x02, 0x01, 0x0a, 0x00, 0x00, 0x00},
+        0x330b, MXF_BOOLEAN_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::DisplayF2Offset */
+    {(char*)"DisplayF2Offset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x03, 0x02, 0x07, 0x00, 0x00, 0x00},
+        0x3217, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::StoredF2Offset */
+    {(char*)"StoredF2Offset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x03, 0x02, 0x08, 0x00, 0x00, 0x00},
+        0x3216, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ActiveFormatDescriptor */
+    {(char*)"ActiveFormatDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x03, 0x02, 0x09, 0x00, 0x00, 0x00},
+        0x3218, MXF_UINT8_TYPE, 0},
+    /* RGBAEssenceDescriptor::ScanningDirection */
+    {(char*)"ScanningDirection",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x00, 0x00, 0x00},
+        0x3405, MXF_ORIENTATION_TYPE, 0},
+    /* RGBAEssenceDescriptor::ComponentMaxRef */
+    {(char*)"ComponentMaxRef",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0b, 0x00, 0x00, 0x00},
+        0x3406, MXF_UINT32_TYPE, 0},
+    /* RGBAEssenceDescriptor::ComponentMinRef */
+    {(char*)"ComponentMinRef",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0c, 0x00, 0x00, 0x00},
+        0x3407, MXF_UINT32_TYPE, 0},
+    /* RGBAEssenceDescriptor::AlphaMaxRef */
+    {(char*)"AlphaMaxRef",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0d, 0x00, 0x00, 0x00},
+        0x3408, MXF_UINT32_TYPE, 0},
+    /* RGBAEssenceDescriptor::AlphaMinRef */
+    {(char*)"AlphaMinRef",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0e, 0x00, 0x00, 0x00},
+        0x3409, MXF_UINT32_TYPE, 0},
+    /* MPEGVideoDescriptor::SingleSequence */
+    {(char*)"SingleSequence",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x02, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* MPEGVideoDescriptor::ConstantBFrames */
+    {(char*)"ConstantBFrames",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x03, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* MPEGVideoDescriptor::CodedContentType */
+    {(char*)"CodedContentType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x04, 0x00, 0x00},
+        0x0000, MXF_CODED_CONTENT_TYPE_TYPE, 0},
+    /* MPEGVideoDescriptor::LowDelay */
+    {(char*)"LowDelay",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x05, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* MPEGVideoDescriptor::ClosedGOP */
+    {(char*)"ClosedGOP",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x06, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* MPEGVideoDescriptor::IdenticalGOP */
+    {(char*)"IdenticalGOP",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x07, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* MPEGVideoDescriptor::MaxGOP */
+    {(char*)"MaxGOP",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x08, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* MPEGVideoDescriptor::MaxBPictureCount */
+    {(char*)"MaxBPictureCount",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x09, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* MPEGVideoDescriptor::ProfileAndLevel */
+    {(char*)"ProfileAndLevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x0a, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* MPEGVideoDescriptor::BitRate */
+    {(char*)"BitRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x0b, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::ChannelCount */
+    {(char*)"ChannelCount",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x3d07, MXF_UINT32_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::AudioSamplingRate */
+    {(char*)"AudioSamplingRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00},
+        0x3d03, MXF_RATIONAL_TYPE, 0},
+    /* WaveAudioDescriptor::BlockAlign */
+    {(char*)"BlockAlign",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x3d0a, MXF_UINT16_TYPE, 1},
+    /* WaveAudioDescriptor::SequenceOffset */
+    {(char*)"SequenceOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00},
+        0x3d0b, MXF_UINT8_TYPE, 0},
+    /* AES3AudioDescriptor::BlockStartOffset */
+    {(char*)"BlockStartOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00},
+        0x3d0f, MXF_UINT16_TYPE, 0},
+    /* WaveAudioDescriptor::AvgBps */
+    {(char*)"AvgBps",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x03, 0x05, 0x00, 0x00, 0x00},
+        0x3d09, MXF_UINT32_TYPE, 1},
+    /* AES3AudioDescriptor::AuxiliaryBitsMode */
+    {(char*)"AuxiliaryBitsMode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x3d08, MXF_UINT8_TYPE, 0},
+    /* AES3AudioDescriptor::ChannelStatusMode */
+    {(char*)"ChannelStatusMode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x02, 0x00, 0x00, 0x00},
+        0x3d10, MXF_UINT8ARRAY_TYPE, 0},
+    /* AES3AudioDescriptor::FixedChannelStatusData */
+    {(char*)"FixedChannelStatusData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x03, 0x00, 0x00, 0x00},
+        0x3d11, MXF_AES3_FIXED_DATA_ARRAY_TYPE, 0},
+    /* AES3AudioDescriptor::UserDataMode */
+    {(char*)"UserDataMode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x3d12, MXF_UINT8ARRAY_TYPE, 0},
+    /* AES3AudioDescriptor::FixedUserData */
+    {(char*)"FixedUserData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x3d13, MXF_AES3_FIXED_DATA_ARRAY_TYPE, 0},
+    /* AES3AudioDescriptor::Emphasis */
+    {(char*)"Emphasis",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x3d0d, MXF_UINT8_TYPE, 0},
+    /* AES3AudioDescriptor::LinkedTimecodeTrackID */
+    {(char*)"LinkedTimecodeTrackID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* AES3AudioDescriptor::SMPTE377MDataStreamNumber */
+    {(char*)"SMPTE377MDataStreamNumber",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x08, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::DialNorm */
+    {(char*)"DialNorm",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x3d0c, MXF_INT8_TYPE, 0},
+    /* GenericDataEssenceDescriptor::DataEssenceCoding */
+    {(char*)"DataEssenceCoding",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x3e01, MXF_UL_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::SignalStandard */
+    {(char*)"SignalStandard",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x05, 0x01, 0x13, 0x00, 0x00, 0x00, 0x00},
+        0x3215, MXF_UINT8_TYPE, 0},
+    /* FileDescriptor::LinkedTrackID */
+    {(char*)"LinkedTrackID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00},
+        0x3006, MXF_UINT32_TYPE, 0},
+    /* DMSegment::DMFramework */
+    {(char*)"DMFramework",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x04, 0x02, 0x0c, 0x00, 0x00},
+        0x6101, MXF_STRONGREF_TYPE, 0},
+    /* EventTrack::EventOrigin */
+    {(char*)"EventOrigin",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x07, 0x02, 0x01, 0x03, 0x01, 0x0b, 0x00, 0x00},
+        0x4902, MXF_POSITION_TYPE, 0},
+    /* WaveAudioDescriptor::ChannelAssignment */
+    {(char*)"ChannelAssignment",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x07, 0x04, 0x02, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x3d32, MXF_UL_TYPE, 0},
+    /* DCTimedTextResourceSubDescriptor::MIMEType */
+    {(char*)"MIMEType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x07, 0x04, 0x09, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* DCTimedTextDescriptor::NamespaceURI */
+    {(char*)"NamespaceURI",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x01, 0x02, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* WaveAudioDescriptor::PeakEnvelopeVersion */
+    {(char*)"PeakEnvelopeVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x3d29, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PeakEnvelopeFormat */
+    {(char*)"PeakEnvelopeFormat",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x07, 0x00, 0x00, 0x00},
+        0x3d2a, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PointsPerPeakValue */
+    {(char*)"PointsPerPeakValue",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x08, 0x00, 0x00, 0x00},
+        0x3d2b, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PeakEnvelopeBlockSize */
+    {(char*)"PeakEnvelopeBlockSize",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x09, 0x00, 0x00, 0x00},
+        0x3d2c, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PeakChannels */
+    {(char*)"PeakChannels",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0a, 0x00, 0x00, 0x00},
+        0x3d2d, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PeakFrames */
+    {(char*)"PeakFrames",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0b, 0x00, 0x00, 0x00},
+        0x3d2e, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PeakOfPeaksPosition */
+    {(char*)"PeakOfPeaksPosition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0c, 0x00, 0x00, 0x00},
+        0x3d2f, MXF_POSITION_TYPE, 0},
+    /* WaveAudioDescriptor::PeakEnvelopeTimestamp */
+    {(char*)"PeakEnvelopeTimestamp",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0d, 0x00, 0x00, 0x00},
+        0x3d30, MXF_TIMESTAMP_TYPE, 0},
+    /* WaveAudioDescriptor::PeakEnvelopeData */
+    {(char*)"PeakEnvelopeData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0e, 0x00, 0x00, 0x00},
+        0x3d31, MXF_STREAM_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ColorPrimaries */
+    {(char*)"ColorPrimaries",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x04, 0x01, 0x02, 0x01, 0x01, 0x06, 0x01, 0x00},
+        0x3219, MXF_UL_TYPE, 0},
+    /* GenericDescriptor::SubDescriptors */
+    {(char*)"SubDescriptors",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x04, 0x06, 0x10, 0x00, 0x00},
+        0x0000, MXF_STRONGREFARRAY_TYPE, 0},
+    /* JPEG2000SubDescriptor::Rsiz */
+    {(char*)"Rsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEG2000SubDescriptor::Xsiz */
+    {(char*)"Xsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::Ysiz */
+    {(char*)"Ysiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::XOsiz */
+    {(char*)"XOsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::YOsiz */
+    {(char*)"YOsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x05, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::XTsiz */
+    {(char*)"XTsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::YTsiz */
+    {(char*)"YTsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::XTOsiz */
+    {(char*)"XTOsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x08, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::YTOsiz */
+    {(char*)"YTOsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x09, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::Csiz */
+    {(char*)"Csiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0a, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEG2000SubDescriptor::PictureComponentSizing */
+    {(char*)"PictureComponentSizing",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0b, 0x00, 0x00, 0x00},
+        0x0000, MXF_J2K_COMPONENT_SIZING_ARRAY_TYPE, 1},
+    /* JPEG2000SubDescriptor::CodingStyleDefault */
+    {(char*)"CodingStyleDefault",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0c, 0x00, 0x00, 0x00},
+        0x0000, MXF_DATAVALUE_TYPE, 0},
+    /* JPEG2000SubDescriptor::QuantizationDefault */
+    {(char*)"QuantizationDefault",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0d, 0x00, 0x00, 0x00},
+        0x0000, MXF_DATAVALUE_TYPE, 0},
+    /* DCTimedTextDescriptor::ResourceID */
+    {(char*)"ResourceID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x15, 0x12, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 0},
+    /* DCTimedTextResourceSubDescriptor::AncillaryResourceID */
+    {(char*)"AncillaryResourceID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x15, 0x13, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 1},
+    /* DCTimedTextDescriptor::UCSEncoding */
+    {(char*)"UCSEncoding",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* GenericStreamTextBasedSet::GenericStreamSID */
+    {(char*)"GenericStreamSID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x03, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* TextBasedObject::RFC5646TextLanguageCode */
+    {(char*)"RFC5646TextLanguageCode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x02, 0x02, 0x14, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* MCALabelSubDescriptor::RFC5646SpokenLanguage */
+    {(char*)"RFC5646SpokenLanguage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x02, 0x03, 0x15, 0x00, 0x00},
+        0x0000, MXF_ISO7STRING_TYPE, 0},
+    /* UTF8TextBasedSet::UTF8TextData */
+    {(char*)"UTF8TextData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x01, 0x02, 0x20, 0x03, 0x01, 0x00, 0x00},
+        0x0000, MXF_RAW_TYPE, 1},
+    /* UTF16TextBasedSet::UTF16TextData */
+    {(char*)"UTF16TextData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x01, 0x02, 0x20, 0x03, 0x02, 0x00, 0x00},
+        0x0000, MXF_RAW_TYPE, 1},
+    /* TextBasedObject::TextDataDescription */
+    {(char*)"TextDataDescription",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x02, 0x01, 0x06, 0x03, 0x02, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* TextBasedObject::TextBasedMetadataPayloadSchemaID */
+    {(char*)"TextBasedMetadataPayloadSchemaID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x04, 0x06, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UL_TYPE, 1},
+    /* TextBasedObject::TextMIMEMediaType */
+    {(char*)"TextMIMEMediaType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x04, 0x09, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* TextBasedDMFramework::TextBasedObject */
+    {(char*)"TextBasedObject",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x01, 0x01, 0x04, 0x05, 0x41, 0x01, 0x00},
+        0x0000, MXF_STRONGREF_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAChannelID */
+    {(char*)"MCAChannelID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* MCALabelSubDescriptor::MCALabelDictionaryID */
+    {(char*)"MCALabelDictionaryID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UL_TYPE, 1},
+    /* MCALabelSubDescriptor::MCATagSymbol */
+    {(char*)"MCATagSymbol",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* MCALabelSubDescriptor::MCATagName */
+    {(char*)"MCATagName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* SoundfieldGroupLabelSubDescriptor::GroupOfSoundfieldGroupsLinkID */
+    {(char*)"GroupOfSoundfieldGroupsLinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUIDARRAY_TYPE, 0},
+    /* MCALabelSubDescriptor::MCALinkID */
+    {(char*)"MCALinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 1},
+    /* AudioChannelLabelSubDescriptor::SoundfieldGroupLinkID */
+    {(char*)"SoundfieldGroupLinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6b, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAPartitionKind */
+    {(char*)"MCAPartitionKind",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x04, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAPartitionNumber */
+    {(char*)"MCAPartitionNumber",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x04, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCATitle */
+    {(char*)"MCATitle",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCATitleVersion */
+    {(char*)"MCATitleVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x05, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCATitleSubVersion */
+    {(char*)"MCATitleSubVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x05, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAEpisode */
+    {(char*)"MCAEpisode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x05, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* DCTimedTextDescriptor::RFC5646LanguageTagList */
+    {(char*)"RFC5646LanguageTagList",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x01, 0x01, 0x02, 0x02, 0x16, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAAudioContentKind */
+    {(char*)"MCAAudioContentKind",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x20, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAAudioElementKind */
+    {(char*)"MCAAudioElementKind",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAContent */
+    {(char*)"MCAContent",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x22, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAUseClass */
+    {(char*)"MCAUseClass",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x23, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAContentSubtype */
+    {(char*)"MCAContentSubtype",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x24, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAContentDifferentiator */
+    {(char*)"MCAContentDifferentiator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x25, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCASpokenLanguageAttribute */
+    {(char*)"MCASpokenLanguageAttribute",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x26, 0x00, 0x00, 0x00},
+        0x0000, MXF_ISO7STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::RFC5646AdditionalSpokenLanguages */
+    {(char*)"RFC5646AdditionalSpokenLanguages",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x27, 0x00, 0x00, 0x00},
+        0x0000, MXF_ISO7STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAAdditionalLanguageAttributes */
+    {(char*)"MCAAdditionalLanguageAttributes",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x28, 0x00, 0x00, 0x00},
+        0x0000, MXF_ISO7STRING_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::AlternativeCenterCuts */
+    {(char*)"AlternativeCenterCuts",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x03, 0x02, 0x0b, 0x00, 0x00, 0x00},
+        0x0000, MXF_ULBATCH_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ActiveHeight */
+    {(char*)"ActiveHeight",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x05, 0x01, 0x13, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ActiveWidth */
+    {(char*)"ActiveWidth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x05, 0x01, 0x14, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ActiveXOffset */
+    {(char*)"ActiveXOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x05, 0x01, 0x15, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ActiveYOffset */
+    {(char*)"ActiveYOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x05, 0x01, 0x16, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* JPEG2000SubDescriptor::J2CLayout */
+    {(char*)"J2CLayout",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x03, 0x0e, 0x00, 0x00, 0x00},
+        0x0000, MXF_RGBALAYOUT_TYPE, 0},
+    /* JPEG2000SubDescriptor::J2KExtendedCapabilities */
+    {(char*)"J2KExtendedCapabilities",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x03, 0x0f, 0x00, 0x00, 0x00},
+        0x0000, MXF_J2K_EXTENDED_CAPABILITIES_TYPE, 0},
+    /* JPEG2000SubDescriptor::J2KProfile */
+    {(char*)"J2KProfile",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x03, 0x10, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16ARRAY_TYPE, 0},
+    /* JPEG2000SubDescriptor::J2KCorrespondingProfile */
+    {(char*)"J2KCorrespondingProfile",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x03, 0x11, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16ARRAY_TYPE, 0},
+    /* AVCSubDescriptor::AVCConstantBPictureFlag */
+    {(char*)"AVCConstantBPictureFlag",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x03, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* AVCSubDescriptor::AVCCodedContentKind */
+    {(char*)"AVCCodedContentKind",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x04, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCClosedGOPIndicator */
+    {(char*)"AVCClosedGOPIndicator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x06, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* AVCSubDescriptor::AVCIdenticalGOPIndicator */
+    {(char*)"AVCIdenticalGOPIndicator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x07, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* AVCSubDescriptor::AVCMaximumGOPSize */
+    {(char*)"AVCMaximumGOPSize",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x08, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* AVCSubDescriptor::AVCMaximumBPictureCount */
+    {(char*)"AVCMaximumBPictureCount",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x09, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* AVCSubDescriptor::AVCProfile */
+    {(char*)"AVCProfile",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0a, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCMaximumBitrate */
+    {(char*)"AVCMaximumBitrate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0b, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* AVCSubDescriptor::AVCProfileConstraint */
+    {(char*)"AVCProfileConstraint",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0c, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCLevel */
+    {(char*)"AVCLevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0d, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCDecodingDelay */
+    {(char*)"AVCDecodingDelay",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0e, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* AVCSubDescriptor::AVCMaximumRefFrames */
+    {(char*)"AVCMaximumRefFrames",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0f, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCSequenceParameterSetFlag */
+    {(char*)"AVCSequenceParameterSetFlag",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x10, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCPictureParameterSetFlag */
+    {(char*)"AVCPictureParameterSetFlag",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x11, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCAverageBitrate */
+    {(char*)"AVCAverageBitrate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x14, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* VC2SubDescriptor::VC2MajorVersion */
+    {(char*)"VC2MajorVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* VC2SubDescriptor::VC2MinorVersion */
+    {(char*)"VC2MinorVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* VC2SubDescriptor::VC2Profile */
+    {(char*)"VC2Profile",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* VC2SubDescriptor::VC2Level */
+    {(char*)"VC2Level",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* VC2SubDescriptor::VC2WaveletFilters */
+    {(char*)"VC2WaveletFilters",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x05, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8BATCH_TYPE, 0},
+    /* VC2SubDescriptor::VC2SequenceHeadersIdentical */
+    {(char*)"VC2SequenceHeadersIdentical",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* VC2SubDescriptor::VC2EditUnitsAreCompleteSequences */
+    {(char*)"VC2EditUnitsAreCompleteSequences",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* JPEGXSSubDescriptor::JPEGXSPpih */
+    {(char*)"JPEGXSPpih",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSPlev */
+    {(char*)"JPEGXSPlev",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSWf */
+    {(char*)"JPEGXSWf",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSHf */
+    {(char*)"JPEGXSHf",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSNc */
+    {(char*)"JPEGXSNc",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x05, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSComponentTable */
+    {(char*)"JPEGXSComponentTable",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8ARRAY_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSCw */
+    {(char*)"JPEGXSCw",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* JPEGXSSubDescriptor::JPEGXSHsl */
+    {(char*)"JPEGXSHsl",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x08, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* JPEGXSSubDescriptor::JPEGXSMaximumBitRate */
+    {(char*)"JPEGXSMaximumBitRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x09, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::ReferenceImageEditRate */
+    {(char*)"ReferenceImageEditRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_RATIONAL_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::ReferenceAudioAlignmentLevel */
+    {(char*)"ReferenceAudioAlignmentLevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x01, 0x01, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_INT8_TYPE, 0},
+    /* MGASoundEssenceDescriptor::MGASoundEssenceBlockAlign */
+    {(char*)"MGASoundEssenceBlockAlign",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x06},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* MGASoundEssenceDescriptor::MGASoundEssenceAverageBytesPerSecond */
+    {(char*)"MGASoundEssenceAverageBytesPerSecond",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x06},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x04, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* MGASoundEssenceDescriptor::MGASoundEssenceSequenceOffset */
+    {(char*)"MGASoundEssenceSequenceOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x06},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x04, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* MGAAudioMetadataSubDescriptor::MGALinkID */
+    {(char*)"MGALinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x07},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x05, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 1},
+    /* MGAAudioMetadataSubDescriptor::MGAAudioMetadataIndex */
+    {(char*)"MGAAudioMetadataIndex",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x07},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x05, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* MGAAudioMetadataSubDescriptor::MGAAudioMetadataIdentifier */
+    {(char*)"MGAAudioMetadataIdentifier",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x07},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x05, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* MGAAudioMetadataSubDescriptor::MGAAudioMetadataPayloadULArray */
+    {(char*)"MGAAudioMetadataPayloadULArray",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x07},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x05, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_ULARRAY_TYPE, 1},
+    /* MGASoundfieldGroupLabelSubDescriptor::MGAMetadataSectionLinkID */
+    {(char*)"MGAMetadataSectionLinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x08},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x06, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 1},
+    /* MGASoundfieldGroupLabelSubDescriptor::ADMAudioProgrammeID */
+    {(char*)"ADMAudioProgrammeID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x08},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x06, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MGASoundfieldGroupLabelSubDescriptor::ADMAudioContentID */
+    {(char*)"ADMAudioContentID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x08},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x06, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MGASoundfieldGroupLabelSubDescriptor::ADMAudioObjectID */
+    {(char*)"ADMAudioObjectID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x08},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x06, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* SADMAudioMetadataSubDescriptor::SADMMetadataSectionLinkID */
+    {(char*)"SADMMetadataSectionLinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x09},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x07, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 1},
+    /* SADMAudioMetadataSubDescriptor::SADMProfileLevelULBatch */
+    {(char*)"SADMProfileLevelULBatch",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x09},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x07, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_ULBATCH_TYPE, 0},
+    /* RIFFChunkDefinitionSubDescriptor::RIFFChunkStreamID */
+    {(char*)"RIFFChunkStreamID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0d},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x08, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* RIFFChunkDefinitionSubDescriptor::RIFFChunkID */
+    {(char*)"RIFFChunkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0d},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x08, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_RIFF_CHUNK_ID_TYPE, 1},
+    /* RIFFChunkDefinitionSubDescriptor::RIFFChunkUUID */
+    {(char*)"RIFFChunkUUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0d},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x08, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 0},
+    /* RIFFChunkDefinitionSubDescriptor::RIFFChunkHashSHA1 */
+    {(char*)"RIFFChunkHashSHA1",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0d},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x08, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_DATAVALUE_TYPE, 0},
+    /* RIFFChunkReferencesSubDescriptor::RIFFChunkStreamIDsArray */
+    {(char*)"RIFFChunkStreamIDsArray",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x10},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x08, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32ARRAY_TYPE, 1},
+    /* ADM_CHNASubDescriptor::NumLocalChannels */
+    {(char*)"NumLocalChannels",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0e},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* ADM_CHNASubDescriptor::NumADMAudioTrackUIDs */
+    {(char*)"NumADMAudioTrackUIDs",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0e},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* ADM_CHNASubDescriptor::ADMChannelMappingsArray */
+    {(char*)"ADMChannelMappingsArray",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0e},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_STRONGREFARRAY_TYPE, 1},
+    /* ADMChannelMapping::LocalChannelID */
+    {(char*)"LocalChannelID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0f},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* ADMChannelMapping::ADMAudioTrackUID */
+    {(char*)"ADMAudioTrackUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0f},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x05, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* ADMChannelMapping::ADMAudioTrackChannelFormatID */
+    {(char*)"ADMAudioTrackChannelFormatID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0f},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* ADMChannelMapping::ADMAudioPackFormatID */
+    {(char*)"ADMAudioPackFormatID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0f},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* ADMAudioMetadataSubDescriptor::RIFFChunkStreamID_link1 */
+    {(char*)"RIFFChunkStreamID_link1",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x11},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0a, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* ADMAudioMetadataSubDescriptor::ADMProfileLevelULBatch */
+    {(char*)"ADMProfileLevelULBatch",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x11},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0a, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_ULBATCH_TYPE, 0},
+    /* ADMSoundfieldGroupLabelSubDescriptor::RIFFChunkStreamID_link2 */
+    {(char*)"RIFFChunkStreamID_link2",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x12},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0b, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* ADMSoundfieldGroupLabelSubDescriptor::ADMAudioProgrammeID_ST2131 */
+    {(char*)"ADMAudioProgrammeID_ST2131",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x12},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0b, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* ADMSoundfieldGroupLabelSubDescriptor::ADMAudioContentID_ST2131 */
+    {(char*)"ADMAudioContentID_ST2131",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x12},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0b, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* ADMSoundfieldGroupLabelSubDescriptor::ADMAudioObjectID_ST2131 */
+    {(char*)"ADMAudioObjectID_ST2131",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x12},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0b, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* Preface::IsRIPPresent */
+    {(char*)"IsRIPPresent",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::MasteringDisplayPrimaries */
+    {(char*)"MasteringDisplayPrimaries",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x20, 0x04, 0x01, 0x01, 0x01, 0x00, 0x00},
+        0x0000, MXF_THREE_COLOR_PRIMARIES_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::MasteringDisplayWhitePointChromaticity */
+    {(char*)"MasteringDisplayWhitePointChromaticity",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x20, 0x04, 0x01, 0x01, 0x02, 0x00, 0x00},
+        0x0000, MXF_COLOR_PRIMARY_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::MasteringDisplayMaximumLuminance */
+    {(char*)"MasteringDisplayMaximumLuminance",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x20, 0x04, 0x01, 0x01, 0x03, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::MasteringDisplayMinimumLuminance */
+    {(char*)"MasteringDisplayMinimumLuminance",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x20, 0x04, 0x01, 0x01, 0x04, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+};
+
+static const MXFListElement g_baselineItemDefElements[282] =
+{
+    /* InterchangeObject */
+    {(MXFListElement*)&g_baselineItemDefElements[1], (void*)&g_baselineItemDefs[0]},
+    {NULL, (void*)&g_baselineItemDefs[61]},
+    /* StructuralComponent */
+    {(MXFListElement*)&g_baselineItemDefElements[3], (void*)&g_baselineItemDefs[48]},
+    {NULL, (void*)&g_baselineItemDefs[90]},
+    /* EssenceGroup */
+    {(MXFListElement*)&g_baselineItemDefElements[5], (void*)&g_baselineItemDefs[76]},
+    {NULL, (void*)&g_baselineItemDefs[73]},
+    /* Sequence */
+    {NULL, (void*)&g_baselineItemDefs[80]},
+    /* SourceClip */
+    {(MXFListElement*)&g_baselineItemDefElements[8], (void*)&g_baselineItemDefs[83]},
+    {(MXFListElement*)&g_baselineItemDefElements[9], (void*)&g_baselineItemDefs[66]},
+    {NULL, (void*)&g_baselineItemDefs[67]},
+    /* TimecodeComponent */
+    {(MXFListElement*)&g_baselineItemDefElements[11], (void*)&g_baselineItemDefs[47]},
+    {(MXFListElement*)&g_baselineItemDefElements[12], (void*)&g_baselineItemDefs[84]},
+    {NULL, (void*)&g_baselineItemDefs[22]},
+    /* ContentStorage */
+    {(MXFListElement*)&g_baselineItemDefElements[14], (void*)&g_baselineItemDefs[74]},
+    {NULL, (void*)&g_baselineItemDefs[75]},
+    /* EssenceContainerData */
+    {(MXFListElement*)&g_baselineItemDefElements[16], (void*)&g_baselineItemDefs[81]},
+    {(MXFListElement*)&g_baselineItemDefElements[17], (void*)&g_baselineItemDefs[93]},
+    {NULL, (void*)&g_baselineItemDefs[91]},
+    /* GenericDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[19], (void*)&g_baselineItemDefs[77]},
+    {NULL, (void*)&g_baselineItemDefs[155]},
+    /* FileDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[21], (void*)&g_baselineItemDefs[139]},
+    {(MXFListElement*)&g_baselineItemDefElements[22], (void*)&g_baselineItemDefs[23]},
+    {(MXFListElement*)&g_baselineItemDefElements[23], (void*)&g_baselineItemDefs[24]},
+    {(MXFListElement*)&g_baselineItemDefElements[24], (void*)&g_baselineItemDefs[68]},
+    {NULL, (void*)&g_baselineItemDefs[69]},
+    /* GenericPictureEssenceDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[26], (void*)&g_baselineItemDefs[138]},
+    {(MXFListElement*)&g_baselineItemDefElements[27], (void*)&g_baselineItemDefs[5]},
+    {(MXFListElement*)&g_baselineItemDefElements[28], (void*)&g_baselineItemDefs[17]},
+    {(MXFListElement*)&g_baselineItemDefElements[29], (void*)&g_baselineItemDefs[16]},
+    {(MXFListElement*)&g_baselineItemDefElements[30], (void*)&g_baselineItemDefs[105]},
+    {(MXFListElement*)&g_baselineItemDefElements[31], (void*)&g_baselineItemDefs[9]},
+    {(MXFListElement*)&g_baselineItemDefElements[32], (void*)&g_baselineItemDefs[8]},
+    {(MXFListElement*)&g_baselineItemDefElements[33], (void*)&g_baselineItemDefs[10]},
+    {(MXFListElement*)&g_baselineItemDefElements[34], (void*)&g_baselineItemDefs[11]},
+    {(MXFListElement*)&g_baselineItemDefElements[35], (void*)&g_baselineItemDefs[12]},
+    {(MXFListElement*)&g_baselineItemDefElements[36], (void*)&g_baselineItemDefs[13]},
+    {(MXFListElement*)&g_baselineItemDefElements[37], (void*)&g_baselineItemDefs[14]},
+    {(MXFListElement*)&g_baselineItemDefElements[38], (void*)&g_baselineItemDefs[15]},
+    {(MXFListElement*)&g_baselineItemDefElements[39], (void*)&g_baselineItemDefs[104]},
+    {(MXFListElement*)&g_baselineItemDefElements[40], (void*)&g_baselineItemDefs[4]},
+    {(MXFListElement*)&g_baselineItemDefElements[41], (void*)&g_baselineItemDefs[106]},
+    {(MXFListElement*)&g_baselineItemDefElements[42], (void*)&g_baselineItemDefs[37]},
+    {(MXFListElement*)&g_baselineItemDefElements[43], (void*)&g_baselineItemDefs[53]},
+    {(MXFListElement*)&g_baselineItemDefElements[44], (void*)&g_baselineItemDefs[34]},
+    {(MXFListElement*)&g_baselineItemDefElements[45], (void*)&g_baselineItemDefs[49]},
+    {(MXFListElement*)&g_baselineItemDefElements[46], (void*)&g_baselineItemDefs[50]},
+    {(MXFListElement*)&g_baselineItemDefElements[47], (void*)&g_baselineItemDefs[51]},
+    {(MXFListElement*)&g_baselineItemDefElements[48], (void*)&g_baselineItemDefs[36]},
+    {(MXFListElement*)&g_baselineItemDefElements[49], (void*)&g_baselineItemDefs[45]},
+    {(MXFListElement*)&g_baselineItemDefElements[50], (void*)&g_baselineItemDefs[35]},
+    {(MXFListElement*)&g_baselineItemDefElements[51], (void*)&g_baselineItemDefs[154]},
+    {(MXFListElement*)&g_baselineItemDefElements[52], (void*)&g_baselineItemDefs[278]},
+    {(MXFListElement*)&g_baselineItemDefElements[53], (void*)&g_baselineItemDefs[279]},
+    {(MXFListElement*)&g_baselineItemDefElements[54], (void*)&g_baselineItemDefs[280]},
+    {(MXFListElement*)&g_baselineItemDefElements[55], (void*)&g_baselineItemDefs[281]},
+    {(MXFListElement*)&g_baselineItemDefElements[56], (void*)&g_baselineItemDefs[205]},
+    {(MXFListElement*)&g_baselineItemDefElements[57], (void*)&g_baselineItemDefs[206]},
+    {(MXFListElement*)&g_baselineItemDefElements[58], (void*)&g_baselineItemDefs[207]},
+    {(MXFListElement*)&g_baselineItemDefElements[59], (void*)&g_baselineItemDefs[208]},
+    {NULL, (void*)&g_baselineItemDefs[204]},
+    /* CDCIEssenceDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[61], (void*)&g_baselineItemDefs[44]},
+    {(MXFListElement*)&g_baselineItemDefElements[62], (void*)&g_baselineItemDefs[6]},
+    {(MXFListElement*)&g_baselineItemDefElements[63], (void*)&g_baselineItemDefs[38]},
+    {(MXFListElement*)&g_baselineItemDefElements[64], (void*)&g_baselineItemDefs[7]},
+    {(MXFListElement*)&g_baselineItemDefElements[65], (void*)&g_baselineItemDefs[103]},
+    {(MXFListElement*)&g_baselineItemDefElements[66], (void*)&g_baselineItemDefs[52]},
+    {(MXFListElement*)&g_baselineItemDefElements[67], (void*)&g_baselineItemDefs[41]},
+    {(MXFListElement*)&g_baselineItemDefElements[68], (void*)&g_baselineItemDefs[18]},
+    {(MXFListElement*)&g_baselineItemDefElements[69], (void*)&g_baselineItemDefs[19]},
+    {NULL, (void*)&g_baselineItemDefs[39]},
+    /* RGBAEssenceDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[71], (void*)&g_baselineItemDefs[108]},
+    {(MXFListElement*)&g_baselineItemDefElements[72], (void*)&g_baselineItemDefs[109]},
+    {(MXFListElement*)&g_baselineItemDefElements[73], (void*)&g_baselineItemDefs[110]},
+    {(MXFListElement*)&g_baselineItemDefElements[74], (void*)&g_baselineItemDefs[111]},
+    {(MXFListElement*)&g_baselineItemDefElements[75], (void*)&g_baselineItemDefs[107]},
+    {(MXFListElement*)&g_baselineItemDefElements[76], (void*)&g_baselineItemDefs[40]},
+    {(MXFListElement*)&g_baselineItemDefElements[77], (void*)&g_baselineItemDefs[42]},
+    {NULL, (void*)&g_baselineItemDefs[43]},
+    /* Preface */
+    {(MXFListElement*)&g_baselineItemDefElements[79], (void*)&g_baselineItemDefs[88]},
+    {(MXFListElement*)&g_baselineItemDefElements[80], (void*)&g_baselineItemDefs[30]},
+    {(MXFListElement*)&g_baselineItemDefElements[81], (void*)&g_baselineItemDefs[29]},
+    {(MXFListElement*)&g_baselineItemDefElements[82], (void*)&g_baselineItemDefs[97]},
+    {(MXFListElement*)&g_baselineItemDefElements[83], (void*)&g_baselineItemDefs[78]},
+    {(MXFListElement*)&g_baselineItemDefElements[84], (void*)&g_baselineItemDefs[70]},
+    {(MXFListElement*)&g_baselineItemDefElements[85], (void*)&g_baselineItemDefs[99]},
+    {(MXFListElement*)&g_baselineItemDefElements[86], (void*)&g_baselineItemDefs[100]},
+    {(MXFListElement*)&g_baselineItemDefElements[87], (void*)&g_baselineItemDefs[101]},
+    {NULL, (void*)&g_baselineItemDefs[277]},
+    /* Identification */
+    {(MXFListElement*)&g_baselineItemDefElements[89], (void*)&g_baselineItemDefs[54]},
+    {(MXFListElement*)&g_baselineItemDefElements[90], (void*)&g_baselineItemDefs[55]},
+    {(MXFListElement*)&g_baselineItemDefElements[91], (void*)&g_baselineItemDefs[56]},
+    {(MXFListElement*)&g_baselineItemDefElements[92], (void*)&g_baselineItemDefs[57]},
+    {(MXFListElement*)&g_baselineItemDefElements[93], (void*)&g_baselineItemDefs[58]},
+    {(MXFListElement*)&g_baselineItemDefElements[94], (void*)&g_baselineItemDefs[60]},
+    {(MXFListElement*)&g_baselineItemDefElements[95], (void*)&g_baselineItemDefs[87]},
+    {(MXFListElement*)&g_baselineItemDefElements[96], (void*)&g_baselineItemDefs[62]},
+    {NULL, (void*)&g_baselineItemDefs[59]},
+    /* NetworkLocator */
+    {NULL, (void*)&g_baselineItemDefs[2]},
+    /* TextLocator */
+    {NULL, (void*)&g_baselineItemDefs[25]},
+    /* GenericPackage */
+    {(MXFListElement*)&g_baselineItemDefElements[100], (void*)&g_baselineItemDefs[1]},
+    {(MXFListElement*)&g_baselineItemDefElements[101], (void*)&g_baselineItemDefs[3]},
+    {(MXFListElement*)&g_baselineItemDefElements[102], (void*)&g_baselineItemDefs[86]},
+    {(MXFListElement*)&g_baselineItemDefElements[103], (void*)&g_baselineItemDefs[89]},
+    {(MXFListElement*)&g_baselineItemDefElements[104], (void*)&g_baselineItemDefs[79]},
+    {NULL, (void*)&g_baselineItemDefs[33]},
+    /* SourcePackage */
+    {NULL, (void*)&g_baselineItemDefs[71]},
+    /* GenericTrack */
+    {(MXFListElement*)&g_baselineItemDefElements[107], (void*)&g_baselineItemDefs[27]},
+    {(MXFListElement*)&g_baselineItemDefElements[108], (void*)&g_baselineItemDefs[26]},
+    {(MXFListElement*)&g_baselineItemDefElements[109], (void*)&g_baselineItemDefs[28]},
+    {NULL, (void*)&g_baselineItemDefs[72]},
+    /* EventTrack */
+    {(MXFListElement*)&g_baselineItemDefElements[111], (void*)&g_baselineItemDefs[63]},
+    {NULL, (void*)&g_baselineItemDefs[141]},
+    /* Track */
+    {(MXFListElement*)&g_baselineItemDefElements[113], (void*)&g_baselineItemDefs[65]},
+    {NULL, (void*)&g_baselineItemDefs[82]},
+    /* TaggedValue */
+    {(MXFListElement*)&g_baselineItemDefElements[115], (void*)&g_baselineItemDefs[31]},
+    {NULL, (void*)&g_baselineItemDefs[32]},
+    /* DMSegment */
+    {(MXFListElement*)&g_baselineItemDefElements[117], (void*)&g_baselineItemDefs[85]},
+    {(MXFListElement*)&g_baselineItemDefElements[118], (void*)&g_baselineItemDefs[64]},
+    {(MXFListElement*)&g_baselineItemDefElements[119], (void*)&g_baselineItemDefs[94]},
+    {NULL, (void*)&g_baselineItemDefs[140]},
+    /* GenericSoundEssenceDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[121], (void*)&g_baselineItemDefs[123]},
+    {(MXFListElement*)&g_baselineItemDefElements[122], (void*)&g_baselineItemDefs[95]},
+    {(MXFListElement*)&g_baselineItemDefElements[123], (void*)&g_baselineItemDefs[21]},
+    {(MXFListElement*)&g_baselineItemDefElements[124], (void*)&g_baselineItemDefs[20]},
+    {(MXFListElement*)&g_baselineItemDefElements[125], (void*)&g_baselineItemDefs[122]},
+    {(MXFListElement*)&g_baselineItemDefElements[126], (void*)&g_baselineItemDefs[96]},
+    {(MXFListElement*)&g_baselineItemDefElements[127], (void*)&g_baselineItemDefs[136]},
+    {(MXFListElement*)&g_baselineItemDefElements[128], (void*)&g_baselineItemDefs[46]},
+    {(MXFListElement*)&g_baselineItemDefElements[129], (void*)&g_baselineItemDefs[244]},
+    {NULL, (void*)&g_baselineItemDefs[245]},
+    /* GenericDataEssenceDescriptor */
+    {NULL, (void*)&g_baselineItemDefs[137]},
+    /* MultipleDescriptor */
+    {NULL, (void*)&g_baselineItemDefs[98]},
+    /* DMSourceClip */
+    {NULL, (void*)&g_baselineItemDefs[102]},
+    /* AES3AudioDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[134], (void*)&g_baselineItemDefs[133]},
+    {(MXFListElement*)&g_baselineItemDefElements[135], (void*)&g_baselineItemDefs[126]},
+    {(MXFListElement*)&g_baselineItemDefElements[136], (void*)&g_baselineItemDefs[128]},
+    {(MXFListElement*)&g_baselineItemDefElements[137], (void*)&g_baselineItemDefs[129]},
+    {(MXFListElement*)&g_baselineItemDefElements[138], (void*)&g_baselineItemDefs[130]},
+    {(MXFListElement*)&g_baselineItemDefElements[139], (void*)&g_baselineItemDefs[131]},
+    {(MXFListElement*)&g_baselineItemDefElements[140], (void*)&g_baselineItemDefs[132]},
+    {(MXFListElement*)&g_baselineItemDefElements[141], (void*)&g_baselineItemDefs[134]},
+    {NULL, (void*)&g_baselineItemDefs[135]},
+    /* WaveAudioDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[143], (void*)&g_baselineItemDefs[124]},
+    {(MXFListElement*)&g_baselineItemDefElements[144], (void*)&g_baselineItemDefs[125]},
+    {(MXFListElement*)&g_baselineItemDefElements[145], (void*)&g_baselineItemDefs[127]},
+    {(MXFListElement*)&g_baselineItemDefElements[146], (void*)&g_baselineItemDefs[142]},
+    {(MXFListElement*)&g_baselineItemDefElements[147], (void*)&g_baselineItemDefs[145]},
+    {(MXFListElement*)&g_baselineItemDefElements[148], (void*)&g_baselineItemDefs[146]},
+    {(MXFListElement*)&g_baselineItemDefElements[149], (void*)&g_baselineItemDefs[147]},
+    {(MXFListElement*)&g_baselineItemDefElements[150], (void*)&g_baselineItemDefs[148]},
+    {(MXFListElement*)&g_baselineItemDefElements[151], (void*)&g_baselineItemDefs[149]},
+    {(MXFListElement*)&g_baselineItemDefElements[152], (void*)&g_baselineItemDefs[150]},
+    {(MXFListElement*)&g_baselineItemDefElements[153], (void*)&g_baselineItemDefs[151]},
+    {(MXFListElement*)&g_baselineItemDefElements[154], (void*)&g_baselineItemDefs[152]},
+    {NULL, (void*)&g_baselineItemDefs[153]},
+    /* MPEGVideoDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[156], (void*)&g_baselineItemDefs[112]},
+    {(MXFListElement*)&g_baselineItemDefElements[157], (void*)&g_baselineItemDefs[113]},
+    {(MXFListElement*)&g_baselineItemDefElements[158], (void*)&g_baselineItemDefs[114]},
+    {(MXFListElement*)&g_baselineItemDefElements[159], (void*)&g_baselineItemDefs[115]},
+    {(MXFListElement*)&g_baselineItemDefElements[160], (void*)&g_baselineItemDefs[116]},
+    {(MXFListElement*)&g_baselineItemDefElements[161], (void*)&g_baselineItemDefs[117]},
+    {(MXFListElement*)&g_baselineItemDefElements[162], (void*)&g_baselineItemDefs[118]},
+    {(MXFListElement*)&g_baselineItemDefElements[163], (void*)&g_baselineItemDefs[119]},
+    {(MXFListElement*)&g_baselineItemDefElements[164], (void*)&g_baselineItemDefs[121]},
+    {NULL, (void*)&g_baselineItemDefs[120]},
+    /* JPEG2000SubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[166], (void*)&g_baselineItemDefs[156]},
+    {(MXFListElement*)&g_baselineItemDefElements[167], (void*)&g_baselineItemDefs[157]},
+    {(MXFListElement*)&g_baselineItemDefElements[168], (void*)&g_baselineItemDefs[158]},
+    {(MXFListElement*)&g_baselineItemDefElements[169], (void*)&g_baselineItemDefs[159]},
+    {(MXFListElement*)&g_baselineItemDefElements[170], (void*)&g_baselineItemDefs[160]},
+    {(MXFListElement*)&g_baselineItemDefElements[171], (void*)&g_baselineItemDefs[161]},
+    {(MXFListElement*)&g_baselineItemDefElements[172], (void*)&g_baselineItemDefs[162]},
+    {(MXFListElement*)&g_baselineItemDefElements[173], (void*)&g_baselineItemDefs[163]},
+    {(MXFListElement*)&g_baselineItemDefElements[174], (void*)&g_baselineItemDefs[164]},
+    {(MXFListElement*)&g_baselineItemDefElements[175], (void*)&g_baselineItemDefs[165]},
+    {(MXFListElement*)&g_baselineItemDefElements[176], (void*)&g_baselineItemDefs[166]},
+    {(MXFListElement*)&g_baselineItemDefElements[177], (void*)&g_baselineItemDefs[167]},
+    {(MXFListElement*)&g_baselineItemDefElements[178], (void*)&g_baselineItemDefs[168]},
+    {(MXFListElement*)&g_baselineItemDefElements[179], (void*)&g_baselineItemDefs[209]},
+    {(MXFListElement*)&g_baselineItemDefElements[180], (void*)&g_baselineItemDefs[210]},
+    {(MXFListElement*)&g_baselineItemDefElements[181], (void*)&g_baselineItemDefs[211]},
+    {NULL, (void*)&g_baselineItemDefs[212]},
+    /* DCTimedTextDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[183], (void*)&g_baselineItemDefs[169]},
+    {(MXFListElement*)&g_baselineItemDefElements[184], (void*)&g_baselineItemDefs[144]},
+    {(MXFListElement*)&g_baselineItemDefElements[185], (void*)&g_baselineItemDefs[194]},
+    {NULL, (void*)&g_baselineItemDefs[171]},
+    /* DCTimedTextResourceSubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[187], (void*)&g_baselineItemDefs[170]},
+    {(MXFListElement*)&g_baselineItemDefElements[188], (void*)&g_baselineItemDefs[143]},
+    {NULL, (void*)&g_baselineItemDefs[92]},
+    /* MCALabelSubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[190], (void*)&g_baselineItemDefs[181]},
+    {(MXFListElement*)&g_baselineItemDefElements[191], (void*)&g_baselineItemDefs[182]},
+    {(MXFListElement*)&g_baselineItemDefElements[192], (void*)&g_baselineItemDefs[183]},
+    {(MXFListElement*)&g_baselineItemDefElements[193], (void*)&g_baselineItemDefs[184]},
+    {(MXFListElement*)&g_baselineItemDefElements[194], (void*)&g_baselineItemDefs[186]},
+    {(MXFListElement*)&g_baselineItemDefElements[195], (void*)&g_baselineItemDefs[188]},
+    {(MXFListElement*)&g_baselineItemDefElements[196], (void*)&g_baselineItemDefs[189]},
+    {(MXFListElement*)&g_baselineItemDefElements[197], (void*)&g_baselineItemDefs[190]},
+    {(MXFListElement*)&g_baselineItemDefElements[198], (void*)&g_baselineItemDefs[191]},
+    {(MXFListElement*)&g_baselineItemDefElements[199], (void*)&g_baselineItemDefs[192]},
+    {(MXFListElement*)&g_baselineItemDefElements[200], (void*)&g_baselineItemDefs[193]},
+    {(MXFListElement*)&g_baselineItemDefElements[201], (void*)&g_baselineItemDefs[174]},
+    {(MXFListElement*)&g_baselineItemDefElements[202], (void*)&g_baselineItemDefs[195]},
+    {(MXFListElement*)&g_baselineItemDefElements[203], (void*)&g_baselineItemDefs[196]},
+    {(MXFListElement*)&g_baselineItemDefElements[204], (void*)&g_baselineItemDefs[197]},
+    {(MXFListElement*)&g_baselineItemDefElements[205], (void*)&g_baselineItemDefs[198]},
+    {(MXFListElement*)&g_baselineItemDefElements[206], (void*)&g_baselineItemDefs[199]},
+    {(MXFListElement*)&g_baselineItemDefElements[207], (void*)&g_baselineItemDefs[200]},
+    {(MXFListElement*)&g_baselineItemDefElements[208], (void*)&g_baselineItemDefs[201]},
+    {(MXFListElement*)&g_baselineItemDefElements[209], (void*)&g_baselineItemDefs[202]},
+    {NULL, (void*)&g_baselineItemDefs[203]},
+    /* AudioChannelLabelSubDescriptor */
+    {NULL, (void*)&g_baselineItemDefs[187]},
+    /* SoundfieldGroupLabelSubDescriptor */
+    {NULL, (void*)&g_baselineItemDefs[185]},
+    /* AVCSubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[213], (void*)&g_baselineItemDefs[223]},
+    {(MXFListElement*)&g_baselineItemDefElements[214], (void*)&g_baselineItemDefs[213]},
+    {(MXFListElement*)&g_baselineItemDefElements[215], (void*)&g_baselineItemDefs[214]},
+    {(MXFListElement*)&g_baselineItemDefElements[216], (void*)&g_baselineItemDefs[215]},
+    {(MXFListElement*)&g_baselineItemDefElements[217], (void*)&g_baselineItemDefs[216]},
+    {(MXFListElement*)&g_baselineItemDefElements[218], (void*)&g_baselineItemDefs[217]},
+    {(MXFListElement*)&g_baselineItemDefElements[219], (void*)&g_baselineItemDefs[218]},
+    {(MXFListElement*)&g_baselineItemDefElements[220], (void*)&g_baselineItemDefs[220]},
+    {(MXFListElement*)&g_baselineItemDefElements[221], (void*)&g_baselineItemDefs[227]},
+    {(MXFListElement*)&g_baselineItemDefElements[222], (void*)&g_baselineItemDefs[219]},
+    {(MXFListElement*)&g_baselineItemDefElements[223], (void*)&g_baselineItemDefs[221]},
+    {(MXFListElement*)&g_baselineItemDefElements[224], (void*)&g_baselineItemDefs[222]},
+    {(MXFListElement*)&g_baselineItemDefElements[225], (void*)&g_baselineItemDefs[224]},
+    {(MXFListElement*)&g_baselineItemDefElements[226], (void*)&g_baselineItemDefs[225]},
+    {NULL, (void*)&g_baselineItemDefs[226]},
+    /* VC2SubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[228], (void*)&g_baselineItemDefs[228]},
+    {(MXFListElement*)&g_baselineItemDefElements[229], (void*)&g_baselineItemDefs[229]},
+    {(MXFListElement*)&g_baselineItemDefElements[230], (void*)&g_baselineItemDefs[230]},
+    {(MXFListElement*)&g_baselineItemDefElements[231], (void*)&g_baselineItemDefs[231]},
+    {(MXFListElement*)&g_baselineItemDefElements[232], (void*)&g_baselineItemDefs[232]},
+    {(MXFListElement*)&g_baselineItemDefElements[233], (void*)&g_baselineItemDefs[233]},
+    {NULL, (void*)&g_baselineItemDefs[234]},
+    /* JPEGXSSubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[235], (void*)&g_baselineItemDefs[235]},
+    {(MXFListElement*)&g_baselineItemDefElements[236], (void*)&g_baselineItemDefs[236]},
+    {(MXFListElement*)&g_baselineItemDefElements[237], (void*)&g_baselineItemDefs[237]},
+    {(MXFListElement*)&g_baselineItemDefElements[238], (void*)&g_baselineItemDefs[238]},
+    {(MXFListElement*)&g_baselineItemDefElements[239], (void*)&g_baselineItemDefs[239]},
+    {(MXFListElement*)&g_baselineItemDefElements[240], (void*)&g_baselineItemDefs[240]},
+    {(MXFListElement*)&g_baselineItemDefElements[241], (void*)&g_baselineItemDefs[241]},
+    {(MXFListElement*)&g_baselineItemDefElements[242], (void*)&g_baselineItemDefs[242]},
+    {NULL, (void*)&g_baselineItemDefs[243]},
+    /* MGASoundEssenceDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[244], (void*)&g_baselineItemDefs[246]},
+    {(MXFListElement*)&g_baselineItemDefElements[245], (void*)&g_baselineItemDefs[247]},
+    {NULL, (void*)&g_baselineItemDefs[248]},
+    /* MGAAudioMetadataSubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[247], (void*)&g_baselineItemDefs[249]},
+    {(MXFListElement*)&g_baselineItemDefElements[248], (void*)&g_baselineItemDefs[250]},
+    {(MXFListElement*)&g_baselineItemDefElements[249], (void*)&g_baselineItemDefs[251]},
+    {NULL, (void*)&g_baselineItemDefs[252]},
+    /* MGASoundfieldGroupLabelSubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[251], (void*)&g_baselineItemDefs[253]},
+    {(MXFListElement*)&g_baselineItemDefElements[252], (void*)&g_baselineItemDefs[254]},
+    {(MXFListElement*)&g_baselineItemDefElements[253], (void*)&g_baselineItemDefs[255]},
+    {NULL, (void*)&g_baselineItemDefs[256]},
+    /* SADMAudioMetadataSubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[255], (void*)&g_baselineItemDefs[257]},
+    {NULL, (void*)&g_baselineItemDefs[258]},
+    /* RIFFChunkDefinitionSubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[257], (void*)&g_baselineItemDefs[259]},
+    {(MXFListElement*)&g_baselineItemDefElements[258], (void*)&g_baselineItemDefs[260]},
+    {(MXFListElement*)&g_baselineItemDefElements[259], (void*)&g_baselineItemDefs[261]},
+    {NULL, (void*)&g_baselineItemDefs[262]},
+    /* ADM_CHNASubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[261], (void*)&g_baselineItemDefs[264]},
+    {(MXFListElement*)&g_baselineItemDefElements[262], (void*)&g_baselineItemDefs[265]},
+    {NULL, (void*)&g_baselineItemDefs[266]},
+    /* ADMChannelMapping */
+    {(MXFListElement*)&g_baselineItemDefElements[264], (void*)&g_baselineItemDefs[267]},
+    {(MXFListElement*)&g_baselineItemDefElements[265], (void*)&g_baselineItemDefs[268]},
+    {(MXFListElement*)&g_baselineItemDefElements[266], (void*)&g_baselineItemDefs[269]},
+    {NULL, (void*)&g_baselineItemDefs[270]},
+    /* RIFFChunkReferencesSubDescriptor */
+    {NULL, (void*)&g_baselineItemDefs[263]},
+    /* ADMAudioMetadataSubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[269], (void*)&g_baselineItemDefs[271]},
+    {NULL, (void*)&g_baselineItemDefs[272]},
+    /* ADMSoundfieldGroupLabelSubDescriptor */
+    {(MXFListElement*)&g_baselineItemDefElements[271], (void*)&g_baselineItemDefs[273]},
+    {(MXFListElement*)&g_baselineItemDefElements[272], (void*)&g_baselineItemDefs[274]},
+    {(MXFListElement*)&g_baselineItemDefElements[273], (void*)&g_baselineItemDefs[275]},
+    {NULL, (void*)&g_baselineItemDefs[276]},
+    /* TextBasedDMFramework */
+    {NULL, (void*)&g_baselineItemDefs[180]},
+    /* GenericStreamTextBasedSet */
+    {NULL, (void*)&g_baselineItemDefs[172]},
+    /* UTF8TextBasedSet */
+    {NULL, (void*)&g_baselineItemDefs[175]},
+    /* UTF16TextBasedSet */
+    {NULL, (void*)&g_baselineItemDefs[176]},
+    /* TextBasedObject */
+    {(MXFListElement*)&g_baselineItemDefElements[279], (void*)&g_baselineItemDefs[178]},
+    {(MXFListElement*)&g_baselineItemDefElements[280], (void*)&g_baselineItemDefs[179]},
+    {(MXFListElement*)&g_baselineItemDefElements[281], (void*)&g_baselineItemDefs[173]},
+    {NULL, (void*)&g_baselineItemDefs[177]},
+};
+
+static const MXFSetDef g_baselineSetDefs[72] =
+{
+    {(char*)"root",
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        NULL},
+    {(char*)"InterchangeObject",
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[0], (MXFListElement*)&g_baselineItemDefElements[1], 2, NULL, NULL},
+        NULL},
+    {(char*)"StructuralComponent",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[2], (MXFListElement*)&g_baselineItemDefElements[3], 2, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"EdgeCode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[2]},
+    {(char*)"EssenceGroup",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[4], (MXFListElement*)&g_baselineItemDefElements[5], 2, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[2]},
+    {(char*)"Filler",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[2]},
+    {(char*)"Sequence",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[6], (MXFListElement*)&g_baselineItemDefElements[6], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[2]},
+    {(char*)"SourceClip",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[7], (MXFListElement*)&g_baselineItemDefElements[9], 3, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[2]},
+    {(char*)"TimecodeComponent",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[10], (MXFListElement*)&g_baselineItemDefElements[12], 3, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[2]},
+    {(char*)"ContentStorage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[13], (MXFListElement*)&g_baselineItemDefElements[14], 2, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"EssenceContainerData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[15], (MXFListElement*)&g_baselineItemDefElements[17], 3, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"GenericDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[18], (MXFListElement*)&g_baselineItemDefElements[19], 2, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"FileDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[20], (MXFListElement*)&g_baselineItemDefElements[24], 5, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[11]},
+    {(char*)"GenericPictureEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[25], (MXFListElement*)&g_baselineItemDefElements[59], 35, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[12]},
+    {(char*)"CDCIEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[60], (MXFListElement*)&g_baselineItemDefElements[69], 10, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[13]},
+    {(char*)"RGBAEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[70], (MXFListElement*)&g_baselineItemDefElements[77], 8, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[13]},
+    {(char*)"TapeDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x49, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2e, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[37]},
+    {(char*)"Preface",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[78], (MXFListElement*)&g_baselineItemDefElements[87], 10, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"Identification",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[88], (MXFListElement*)&g_baselineItemDefElements[96], 9, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"Locator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"NetworkLocator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x32, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[97], (MXFListElement*)&g_baselineItemDefElements[97], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[19]},
+    {(char*)"TextLocator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x33, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[98], (MXFListElement*)&g_baselineItemDefElements[98], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[19]},
+    {(char*)"GenericPackage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[99], (MXFListElement*)&g_baselineItemDefElements[104], 6, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"MaterialPackage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x36, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[22]},
+    {(char*)"SourcePackage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x37, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[105], (MXFListElement*)&g_baselineItemDefElements[105], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[22]},
+    {(char*)"GenericTrack",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[106], (MXFListElement*)&g_baselineItemDefElements[109], 4, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"EventTrack",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[110], (MXFListElement*)&g_baselineItemDefElements[111], 2, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[25]},
+    {(char*)"StaticTrack",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[25]},
+    {(char*)"Track",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[112], (MXFListElement*)&g_baselineItemDefElements[113], 2, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[25]},
+    {(char*)"TaggedValue",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3f, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[114], (MXFListElement*)&g_baselineItemDefElements[115], 2, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"DMSegment",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[116], (MXFListElement*)&g_baselineItemDefElements[119], 4, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[2]},
+    {(char*)"GenericSoundEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[120], (MXFListElement*)&g_baselineItemDefElements[129], 10, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[12]},
+    {(char*)"GenericDataEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[130], (MXFListElement*)&g_baselineItemDefElements[130], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[12]},
+    {(char*)"MultipleDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x44, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[131], (MXFListElement*)&g_baselineItemDefElements[131], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[12]},
+    {(char*)"DMSourceClip",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x45, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[132], (MXFListElement*)&g_baselineItemDefElements[132], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[7]},
+    {(char*)"AES3AudioDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[133], (MXFListElement*)&g_baselineItemDefElements[141], 9, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[36]},
+    {(char*)"WaveAudioDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[142], (MXFListElement*)&g_baselineItemDefElements[154], 13, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[31]},
+    {(char*)"PhysicalDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x49, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[11]},
+    {(char*)"ImportDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x49, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4a, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[37]},
+    {(char*)"RecordingDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x49, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4b, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[37]},
+    {(char*)"MPEGVideoDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[155], (MXFListElement*)&g_baselineItemDefElements[164], 10, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[14]},
+    {(char*)"SubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"JPEG2000SubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[165], (MXFListElement*)&g_baselineItemDefElements[181], 17, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"VBIDataDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5b, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[32]},
+    {(char*)"ANCDataDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5c, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[32]},
+    {(char*)"DCTimedTextDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[182], (MXFListElement*)&g_baselineItemDefElements[185], 4, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[32]},
+    {(char*)"DCTimedTextResourceSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[186], (MXFListElement*)&g_baselineItemDefElements[188], 3, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"ContainerConstraintsSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x67, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"MCALabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[189], (MXFListElement*)&g_baselineItemDefElements[209], 21, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"AudioChannelLabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6b, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[210], (MXFListElement*)&g_baselineItemDefElements[210], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[48]},
+    {(char*)"SoundfieldGroupLabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6c, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[211], (MXFListElement*)&g_baselineItemDefElements[211], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[48]},
+    {(char*)"GroupOfSoundfieldGroupsLabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6d, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[48]},
+    {(char*)"AVCSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[212], (MXFListElement*)&g_baselineItemDefElements[226], 15, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"VC2SubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[227], (MXFListElement*)&g_baselineItemDefElements[233], 7, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"JPEGXSSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {(MXFListElement*)&g_baselineItemDefElements[234], (MXFListElement*)&g_baselineItemDefElements[242], 9, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"MGASoundEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x06},
+        {(MXFListElement*)&g_baselineItemDefElements[243], (MXFListElement*)&g_baselineItemDefElements[245], 3, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[31]},
+    {(char*)"MGAAudioMetadataSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x07},
+        {(MXFListElement*)&g_baselineItemDefElements[246], (MXFListElement*)&g_baselineItemDefElements[249], 4, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"MGASoundfieldGroupLabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x08},
+        {(MXFListElement*)&g_baselineItemDefElements[250], (MXFListElement*)&g_baselineItemDefElements[253], 4, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[50]},
+    {(char*)"SADMAudioMetadataSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x09},
+        {(MXFListElement*)&g_baselineItemDefElements[254], (MXFListElement*)&g_baselineItemDefElements[255], 2, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"RIFFChunkDefinitionSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0d},
+        {(MXFListElement*)&g_baselineItemDefElements[256], (MXFListElement*)&g_baselineItemDefElements[259], 4, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"ADM_CHNASubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0e},
+        {(MXFListElement*)&g_baselineItemDefElements[260], (MXFListElement*)&g_baselineItemDefElements[262], 3, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"ADMChannelMapping",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0f},
+        {(MXFListElement*)&g_baselineItemDefElements[263], (MXFListElement*)&g_baselineItemDefElements[266], 4, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"RIFFChunkReferencesSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x10},
+        {(MXFListElement*)&g_baselineItemDefElements[267], (MXFListElement*)&g_baselineItemDefElements[267], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"ADMAudioMetadataSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x11},
+        {(MXFListElement*)&g_baselineItemDefElements[268], (MXFListElement*)&g_baselineItemDefElements[269], 2, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[41]},
+    {(char*)"ADMSoundfieldGroupLabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x12},
+        {(MXFListElement*)&g_baselineItemDefElements[270], (MXFListElement*)&g_baselineItemDefElements[273], 4, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[50]},
+    {(char*)"DMSet",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"DMFramework",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[1]},
+    {(char*)"TextBasedDMFramework",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[274], (MXFListElement*)&g_baselineItemDefElements[274], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[66]},
+    {(char*)"GenericStreamTextBasedSet",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[275], (MXFListElement*)&g_baselineItemDefElements[275], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[71]},
+    {(char*)"UTF8TextBasedSet",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[276], (MXFListElement*)&g_baselineItemDefElements[276], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[71]},
+    {(char*)"UTF16TextBasedSet",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[277], (MXFListElement*)&g_baselineItemDefElements[277], 1, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[71]},
+    {(char*)"TextBasedObject",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {(MXFListElement*)&g_baselineItemDefElements[278], (MXFListElement*)&g_baselineItemDefElements[281], 4, NULL, NULL},
+        (MXFSetDef*)&g_baselineSetDefs[65]},
+};
+
+static const MXFStaticDataModel g_baselineStaticDataModel =
+{
+    g_baselineItemTypes, ARRAY_SIZE(g_baselineItemTypes),
+    g_baselineItemDefs, ARRAY_SIZE(g_baselineItemDefs),
+    g_baselineSetDefs, ARRAY_SIZE(g_baselineSetDefs),
+};
+
+
+static const MXFItemType g_avidItemTypes[MXF_EXTENSION_TYPE + 1] =
+{
+    [MXF_INT8_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_INT8_TYPE, (char*)"Int8", {.basic = {1}}},
+    [MXF_INT16_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_INT16_TYPE, (char*)"Int16", {.basic = {2}}},
+    [MXF_INT32_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_INT32_TYPE, (char*)"Int32", {.basic = {4}}},
+    [MXF_INT64_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_INT64_TYPE, (char*)"Int64", {.basic = {8}}},
+    [MXF_UINT8_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_UINT8_TYPE, (char*)"UInt8", {.basic = {1}}},
+    [MXF_UINT16_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_UINT16_TYPE, (char*)"UInt16", {.basic = {2}}},
+    [MXF_UINT32_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_UINT32_TYPE, (char*)"UInt32", {.basic = {4}}},
+    [MXF_UINT64_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_UINT64_TYPE, (char*)"UInt64", {.basic = {8}}},
+    [MXF_RAW_TYPE] = {MXF_BASIC_TYPE_CAT, MXF_RAW_TYPE, (char*)"Raw", {.basic = {0}}},
+    [MXF_UTF16STRING_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UTF16STRING_TYPE, (char*)"UTF16String", {.array = {MXF_UTF16_TYPE, 0}}},
+    [MXF_UTF16STRINGARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UTF16STRINGARRAY_TYPE, (char*)"UTF16StringArray", {.array = {MXF_UTF16_TYPE, 0}}},
+    [MXF_UTF8STRING_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UTF8STRING_TYPE, (char*)"UTF8String", {.array = {MXF_UTF8_TYPE, 0}}},
+    [MXF_INT8ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT8ARRAY_TYPE, (char*)"Int8Array", {.array = {MXF_INT8_TYPE, 0}}},
+    [MXF_INT16ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT16ARRAY_TYPE, (char*)"Int16Array", {.array = {MXF_INT16_TYPE, 0}}},
+    [MXF_INT32ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT32ARRAY_TYPE, (char*)"Int32Array", {.array = {MXF_INT32_TYPE, 0}}},
+    [MXF_INT64ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT64ARRAY_TYPE, (char*)"Int64Array", {.array = {MXF_INT64_TYPE, 0}}},
+    [MXF_UINT8ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT8ARRAY_TYPE, (char*)"UInt8Array", {.array = {MXF_UINT8_TYPE, 0}}},
+    [MXF_UINT16ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT16ARRAY_TYPE, (char*)"UInt16Array", {.array = {MXF_UINT16_TYPE, 0}}},
+    [MXF_UINT32ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT32ARRAY_TYPE, (char*)"UInt32Array", {.array = {MXF_UINT32_TYPE, 0}}},
+    [MXF_UINT64ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT64ARRAY_TYPE, (char*)"UInt64Array", {.array = {MXF_UINT64_TYPE, 0}}},
+    [MXF_ISO7STRING_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_ISO7STRING_TYPE, (char*)"ISO7String", {.array = {MXF_ISO7_TYPE, 0}}},
+    [MXF_INT8BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT8BATCH_TYPE, (char*)"Int8Batch", {.array = {MXF_INT8_TYPE, 0}}},
+    [MXF_INT16BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT16BATCH_TYPE, (char*)"Int16Batch", {.array = {MXF_INT16_TYPE, 0}}},
+    [MXF_INT32BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT32BATCH_TYPE, (char*)"Int32Batch", {.array = {MXF_INT32_TYPE, 0}}},
+    [MXF_INT64BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_INT64BATCH_TYPE, (char*)"Int64Batch", {.array = {MXF_INT64_TYPE, 0}}},
+    [MXF_UINT8BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT8BATCH_TYPE, (char*)"UInt8Batch", {.array = {MXF_UINT8_TYPE, 0}}},
+    [MXF_UINT16BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT16BATCH_TYPE, (char*)"UInt16Batch", {.array = {MXF_UINT16_TYPE, 0}}},
+    [MXF_UINT32BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT32BATCH_TYPE, (char*)"UInt32Batch", {.array = {MXF_UINT32_TYPE, 0}}},
+    [MXF_UINT64BATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UINT64BATCH_TYPE, (char*)"UInt64Batch", {.array = {MXF_UINT64_TYPE, 0}}},
+    [MXF_AUIDARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_AUIDARRAY_TYPE, (char*)"AUIDArray", {.array = {MXF_AUID_TYPE, 0}}},
+    [MXF_ULARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_ULARRAY_TYPE, (char*)"ULArray", {.array = {MXF_UL_TYPE, 0}}},
+    [MXF_ULBATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_ULBATCH_TYPE, (char*)"ULBatch", {.array = {MXF_UL_TYPE, 0}}},
+    [MXF_UUIDARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UUIDARRAY_TYPE, (char*)"UUIDArray", {.array = {MXF_UUID_TYPE, 0}}},
+    [MXF_UUIDBATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_UUIDBATCH_TYPE, (char*)"UUIDBatch", {.array = {MXF_UUID_TYPE, 0}}},
+    [MXF_STRONGREFARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_STRONGREFARRAY_TYPE, (char*)"StrongRefArray", {.array = {MXF_STRONGREF_TYPE, 0}}},
+    [MXF_STRONGREFBATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_STRONGREFBATCH_TYPE, (char*)"StrongRefBatch", {.array = {MXF_STRONGREF_TYPE, 0}}},
+    [MXF_WEAKREFARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_WEAKREFARRAY_TYPE, (char*)"WeakRefArray", {.array = {MXF_WEAKREF_TYPE, 0}}},
+    [MXF_WEAKREFBATCH_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_WEAKREFBATCH_TYPE, (char*)"WeakRefBatch", {.array = {MXF_WEAKREF_TYPE, 0}}},
+    [MXF_RATIONALARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_RATIONALARRAY_TYPE, (char*)"RationalArray", {.array = {MXF_RATIONAL_TYPE, 0}}},
+    [MXF_RGBALAYOUT_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_RGBALAYOUT_TYPE, (char*)"RGBALayout", {.array = {MXF_RGBALAYOUTCOMPONENT_TYPE, 8}}},
+    [MXF_AES3_FIXED_DATA_ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_AES3_FIXED_DATA_ARRAY_TYPE, (char*)"AES3FixedDataArray", {.array = {MXF_AES3_FIXED_DATA_TYPE, 0}}},
+    [MXF_J2K_COMPONENT_SIZING_ARRAY_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_J2K_COMPONENT_SIZING_ARRAY_TYPE, (char*)"J2KComponentSizingArray", {.array = {MXF_J2K_COMPONENT_SIZING_TYPE, 0}}},
+    [MXF_THREE_COLOR_PRIMARIES_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_THREE_COLOR_PRIMARIES_TYPE, (char*)"ThreeColorPrimaries", {.array = {MXF_COLOR_PRIMARY_TYPE, 3}}},
+    [MXF_RIFF_CHUNK_ID_TYPE] = {MXF_ARRAY_TYPE_CAT, MXF_RIFF_CHUNK_ID_TYPE, (char*)"RIFFChunkIDType", {.array = {MXF_ISO7_TYPE, 4}}},
+    [MXF_RATIONAL_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_RATIONAL_TYPE, (char*)"Rational", {.compound = {{
+        {(char*)"Numerator", MXF_INT32_TYPE},
+        {(char*)"Denominator", MXF_INT32_TYPE},
+    }}}},
+    [MXF_TIMESTAMP_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_TIMESTAMP_TYPE, (char*)"Timestamp", {.compound = {{
+        {(char*)"Year", MXF_UINT16_TYPE},
+        {(char*)"Month", MXF_UINT8_TYPE},
+        {(char*)"Day", MXF_UINT8_TYPE},
+        {(char*)"Hours", MXF_UINT8_TYPE},
+        {(char*)"Minutes", MXF_UINT8_TYPE},
+        {(char*)"Seconds", MXF_UINT8_TYPE},
+        {(char*)"QMSec", MXF_UINT8_TYPE},
+    }}}},
+    [MXF_PRODUCTVERSION_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_PRODUCTVERSION_TYPE, (char*)"ProductVersion", {.compound = {{
+        {(char*)"Major", MXF_UINT16_TYPE},
+        {(char*)"Minor", MXF_UINT16_TYPE},
+        {(char*)"Patch", MXF_UINT16_TYPE},
+        {(char*)"Build", MXF_UINT16_TYPE},
+        {(char*)"Release", MXF_UINT16_TYPE},
+    }}}},
+    [MXF_INDIRECT_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_INDIRECT_TYPE, (char*)"Indirect", {.compound = {{
+        {(char*)"Type", MXF_UL_TYPE},
+        {(char*)"Value", MXF_UINT8ARRAY_TYPE},
+    }}}},
+    [MXF_RGBALAYOUTCOMPONENT_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_RGBALAYOUTCOMPONENT_TYPE, (char*)"RGBALayoutComponent", {.compound = {{
+        {(char*)"Code", MXF_RGBACODE_TYPE},
+        {(char*)"Depth", MXF_UINT8_TYPE},
+    }}}},
+    [MXF_J2K_COMPONENT_SIZING_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_J2K_COMPONENT_SIZING_TYPE, (char*)"J2KComponentSizing", {.compound = {{
+        {(char*)"Ssiz", MXF_UINT8_TYPE},
+        {(char*)"XRsiz", MXF_UINT8_TYPE},
+        {(char*)"YRsiz", MXF_UINT8_TYPE},
+    }}}},
+    [MXF_COLOR_PRIMARY_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_COLOR_PRIMARY_TYPE, (char*)"ColorPrimary", {.compound = {{
+        {(char*)"X", MXF_UINT16_TYPE},
+        {(char*)"Y", MXF_UINT16_TYPE},
+    }}}},
+    [MXF_VERSIONTYPE_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_VERSIONTYPE_TYPE, (char*)"VersionType", {.interpret = {MXF_UINT16_TYPE, 0}}},
+    [MXF_UTF16_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UTF16_TYPE, (char*)"UTF16", {.interpret = {MXF_UINT16_TYPE, 0}}},
+    [MXF_UTF8_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UTF8_TYPE, (char*)"UTF8", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_BOOLEAN_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_BOOLEAN_TYPE, (char*)"Boolean", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_ISO7_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_ISO7_TYPE, (char*)"ISO7", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_LENGTH_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_LENGTH_TYPE, (char*)"Length", {.interpret = {MXF_INT64_TYPE, 0}}},
+    [MXF_POSITION_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_POSITION_TYPE, (char*)"Position", {.interpret = {MXF_INT64_TYPE, 0}}},
+    [MXF_RGBACODE_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_RGBACODE_TYPE, (char*)"RGBACode", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_STREAM_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_STREAM_TYPE, (char*)"Stream", {.interpret = {MXF_RAW_TYPE, 0}}},
+    [MXF_DATAVALUE_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_DATAVALUE_TYPE, (char*)"DataValue", {.interpret = {MXF_UINT8ARRAY_TYPE, 0}}},
+    [MXF_IDENTIFIER_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_IDENTIFIER_TYPE, (char*)"Identifier", {.interpret = {MXF_UINT8ARRAY_TYPE, 0}}},
+    [MXF_OPAQUE_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_OPAQUE_TYPE, (char*)"Opaque", {.interpret = {MXF_UINT8ARRAY_TYPE, 0}}},
+    [MXF_UMID_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UMID_TYPE, (char*)"UMID", {.interpret = {MXF_IDENTIFIER_TYPE, 32}}},
+    [MXF_UID_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UID_TYPE, (char*)"UID", {.interpret = {MXF_IDENTIFIER_TYPE, 16}}},
+    [MXF_UL_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UL_TYPE, (char*)"UL", {.interpret = {MXF_IDENTIFIER_TYPE, 16}}},
+    [MXF_UUID_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_UUID_TYPE, (char*)"UUID", {.interpret = {MXF_IDENTIFIER_TYPE, 16}}},
+    [MXF_AUID_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_AUID_TYPE, (char*)"AUID", {.interpret = {MXF_UL_TYPE, 16}}},
+    [MXF_PACKAGEID_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_PACKAGEID_TYPE, (char*)"PackageID", {.interpret = {MXF_UMID_TYPE, 32}}},
+    [MXF_STRONGREF_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_STRONGREF_TYPE, (char*)"StrongRef", {.interpret = {MXF_UUID_TYPE, 16}}},
+    [MXF_WEAKREF_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_WEAKREF_TYPE, (char*)"WeakRef", {.interpret = {MXF_UUID_TYPE, 16}}},
+    [MXF_ORIENTATION_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_ORIENTATION_TYPE, (char*)"Orientation", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_CODED_CONTENT_TYPE_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_CODED_CONTENT_TYPE_TYPE, (char*)"CodedContentType", {.interpret = {MXF_UINT8_TYPE, 0}}},
+    [MXF_AES3_FIXED_DATA_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_AES3_FIXED_DATA_TYPE, (char*)"AES3FixedData", {.interpret = {MXF_UINT8ARRAY_TYPE, 24}}},
+    [MXF_J2K_EXTENDED_CAPABILITIES_TYPE] = {MXF_INTERPRET_TYPE_CAT, MXF_J2K_EXTENDED_CAPABILITIES_TYPE, (char*)"J2KExtendedCapabilities", {.interpret = {MXF_UINT8ARRAY_TYPE, 0}}},
+    [MXF_RGB_COLOR_TYPE] = {MXF_COMPOUND_TYPE_CAT, MXF_RGB_COLOR_TYPE, (char*)"RGBColor", {.compound = {{
+        {(char*)"Red", MXF_UINT16_TYPE},
+        {(char*)"Green", MXF_UINT16_TYPE},
+        {(char*)"Blue", MXF_UINT16_TYPE},
+    }}}},
+};
+
+static const MXFItemDef g_avidItemDefs[373] =
+{
+    /* InterchangeObject::InstanceUID */
+    {(char*)"InstanceUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x3c0a, MXF_UUID_TYPE, 1},
+    /* GenericPackage::PackageUID */
+    {(char*)"PackageUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x10, 0x00, 0x00, 0x00, 0x00},
+        0x4401, MXF_UMID_TYPE, 1},
+    /* NetworkLocator::URLString */
+    {(char*)"URLString",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x32, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x4001, MXF_UTF16STRING_TYPE, 1},
+    /* GenericPackage::Name */
+    {(char*)"Name",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x4402, MXF_UTF16STRING_TYPE, 0},
+    /* Preface::ByteOrder */
+    {(char*)"ByteOrder",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00},
+        0x3b01, MXF_INT16_TYPE, 0},
+    /* ContainerDefinition::EssenceIsIdentified */
+    {(char*)"EssenceIsIdentified",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0x00, 0x00, 0x00},
+        0x2401, MXF_BOOLEAN_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::AspectRatio */
+    {(char*)"AspectRatio",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x320e, MXF_RATIONAL_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::FrameLayout */
+    {(char*)"FrameLayout",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x320c, MXF_UINT8_TYPE, 0},
+    /* CDCIEssenceDescriptor::HorizontalSubsampling */
+    {(char*)"HorizontalSubsampling",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x3302, MXF_UINT32_TYPE, 0},
+    /* CDCIEssenceDescriptor::ColorSiting */
+    {(char*)"ColorSiting",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x3303, MXF_UINT8_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::SampledHeight */
+    {(char*)"SampledHeight",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x07, 0x00, 0x00, 0x00},
+        0x3204, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::SampledWidth */
+    {(char*)"SampledWidth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x08, 0x00, 0x00, 0x00},
+        0x3205, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::SampledXOffset */
+    {(char*)"SampledXOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x09, 0x00, 0x00, 0x00},
+        0x3206, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::SampledYOffset */
+    {(char*)"SampledYOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0a, 0x00, 0x00, 0x00},
+        0x3207, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::DisplayHeight */
+    {(char*)"DisplayHeight",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0b, 0x00, 0x00, 0x00},
+        0x3208, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::DisplayWidth */
+    {(char*)"DisplayWidth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0c, 0x00, 0x00, 0x00},
+        0x3209, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::DisplayXOffset */
+    {(char*)"DisplayXOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0d, 0x00, 0x00, 0x00},
+        0x320a, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::DisplayYOffset */
+    {(char*)"DisplayYOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0e, 0x00, 0x00, 0x00},
+        0x320b, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::StoredHeight */
+    {(char*)"StoredHeight",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x3202, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::StoredWidth */
+    {(char*)"StoredWidth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00},
+        0x3203, MXF_UINT32_TYPE, 0},
+    /* CDCIEssenceDescriptor::BlackRefLevel */
+    {(char*)"BlackRefLevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x03, 0x03, 0x00, 0x00, 0x00},
+        0x3304, MXF_UINT32_TYPE, 0},
+    /* CDCIEssenceDescriptor::WhiteReflevel */
+    {(char*)"WhiteReflevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05, 0x03, 0x04, 0x00, 0x00, 0x00},
+        0x3305, MXF_UINT32_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::ElectroSpatialFormulation */
+    {(char*)"ElectroSpatialFormulation",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x3d05, MXF_UINT8_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::AudioRefLevel */
+    {(char*)"AudioRefLevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00},
+        0x3d04, MXF_INT8_TYPE, 0},
+    /* TimecodeComponent::DropFrame */
+    {(char*)"DropFrame",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x1503, MXF_BOOLEAN_TYPE, 1},
+    /* FileDescriptor::SampleRate */
+    {(char*)"SampleRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x3001, MXF_RATIONAL_TYPE, 1},
+    /* FileDescriptor::ContainerDuration */
+    {(char*)"ContainerDuration",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x3002, MXF_LENGTH_TYPE, 0},
+    /* OperationDefinition::IsTimeWarp */
+    {(char*)"IsTimeWarp",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x05, 0x30, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x1e02, MXF_BOOLEAN_TYPE, 0},
+    /* OperationDefinition::NumberInputs */
+    {(char*)"NumberInputs",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x05, 0x30, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00},
+        0x1e07, MXF_INT32_TYPE, 1},
+    /* OperationDefinition::Bypass */
+    {(char*)"Bypass",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x01, 0x05, 0x30, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00},
+        0x1e08, MXF_UINT32_TYPE, 0},
+    /* DefinitionObject::Identification */
+    {(char*)"Identification",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x15, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x1b01, MXF_UL_TYPE, 1},
+    /* TextLocator::LocatorName */
+    {(char*)"LocatorName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x33, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x4101, MXF_UTF16STRING_TYPE, 1},
+    /* GenericTrack::TrackNumber */
+    {(char*)"TrackNumber",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x4804, MXF_UINT32_TYPE, 1},
+    /* GenericTrack::TrackID */
+    {(char*)"TrackID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x4801, MXF_UINT32_TYPE, 0},
+    /* GenericTrack::TrackName */
+    {(char*)"TrackName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x07, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x4802, MXF_UTF16STRING_TYPE, 0},
+    /* DefinitionObject::Name */
+    {(char*)"Name",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x07, 0x01, 0x02, 0x03, 0x01, 0x00, 0x00},
+        0x1b02, MXF_UTF16STRING_TYPE, 1},
+    /* PluginDefinition::Manufacturer */
+    {(char*)"Manufacturer",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00},
+        0x2206, MXF_UTF16STRING_TYPE, 0},
+    /* PluginDefinition::ManufacturerID */
+    {(char*)"ManufacturerID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x01, 0x0a, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00},
+        0x2208, MXF_UL_TYPE, 0},
+    /* Preface::ObjectModelVersion */
+    {(char*)"ObjectModelVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x3b07, MXF_UINT32_TYPE, 0},
+    /* Preface::Version */
+    {(char*)"Version",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x3b05, MXF_VERSIONTYPE_TYPE, 1},
+    /* PropertyDefinition::IsOptional */
+    {(char*)"IsOptional",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x000c, MXF_BOOLEAN_TYPE, 1},
+    /* TypeDefinitionInteger::Size */
+    {(char*)"Size",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x04, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00},
+        0x000f, MXF_UINT8_TYPE, 1},
+    /* TypeDefinitionInteger::IsSigned */
+    {(char*)"IsSigned",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x04, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00},
+        0x0010, MXF_BOOLEAN_TYPE, 1},
+    /* TypeDefinitionFixedArray::ElementCount */
+    {(char*)"ElementCount",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x08, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00},
+        0x0018, MXF_UINT32_TYPE, 1},
+    /* TypeDefinitionEnumeration::Names */
+    {(char*)"Names",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x07, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00},
+        0x0015, MXF_UTF16STRINGARRAY_TYPE, 1},
+    /* TypeDefinitionEnumeration::Values */
+    {(char*)"Values",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x07, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x05, 0x00, 0x00, 0x00},
+        0x0016, MXF_INT64ARRAY_TYPE, 1},
+    /* TypeDefinitionRecord::MemberNames */
+    {(char*)"MemberNames",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0d, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x06, 0x00, 0x00, 0x00},
+        0x001d, MXF_UTF16STRINGARRAY_TYPE, 1},
+    /* TypeDefinitionExtendibleEnumeration::Names */
+    {(char*)"Names",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x20, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x07, 0x00, 0x00, 0x00},
+        0x001f, MXF_UTF16STRINGARRAY_TYPE, 1},
+    /* TypeDefinitionExtendibleEnumeration::Values */
+    {(char*)"Values",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x20, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x08, 0x00, 0x00, 0x00},
+        0x0020, MXF_ULARRAY_TYPE, 1},
+    /* TypeDefinitionWeakObjectReference::ReferenceTargetSet */
+    {(char*)"ReferenceTargetSet",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x06, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x01, 0x02, 0x03, 0x0b, 0x00, 0x00, 0x00},
+        0x0013, MXF_ULARRAY_TYPE, 1},
+    /* TaggedValue::Name */
+    {(char*)"Name",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x09, 0x01, 0x00, 0x00},
+        0x5001, MXF_UTF16STRING_TYPE, 1},
+    /* TaggedValue::Value */
+    {(char*)"Value",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x0a, 0x01, 0x00, 0x00},
+        0x5003, MXF_INDIRECT_TYPE, 1},
+    /* GenericPackage::UserComments */
+    {(char*)"UserComments",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x0c, 0x00, 0x00, 0x00},
+        0x4406, MXF_STRONGREFARRAY_TYPE, 0},
+    /* DefinitionObject::Description */
+    {(char*)"Description",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x03, 0x01, 0x02, 0x01, 0x00, 0x00},
+        0x1b03, MXF_UTF16STRING_TYPE, 0},
+    /* MetaDefinition::Name */
+    {(char*)"Name",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x24, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x04, 0x01, 0x02, 0x01, 0x00, 0x00},
+        0x0006, MXF_UTF16STRING_TYPE, 1},
+    /* PluginDefinition::VersionString */
+    {(char*)"VersionString",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x01, 0x02, 0x01, 0x00, 0x00},
+        0x2205, MXF_UTF16STRING_TYPE, 0},
+    /* PluginDefinition::VersionNumber */
+    {(char*)"VersionNumber",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x01, 0x03, 0x00, 0x00, 0x00},
+        0x2204, MXF_VERSIONTYPE_TYPE, 1},
+    /* GenericPictureEssenceDescriptor::CaptureGamma */
+    {(char*)"CaptureGamma",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x00},
+        0x3210, MXF_UL_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::CodingEquations */
+    {(char*)"CodingEquations",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00},
+        0x321a, MXF_UL_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::FieldDominance */
+    {(char*)"FieldDominance",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x03, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x3212, MXF_UINT8_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::VideoLineMap */
+    {(char*)"VideoLineMap",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x03, 0x02, 0x05, 0x00, 0x00, 0x00},
+        0x320d, MXF_INT32ARRAY_TYPE, 0},
+    /* CDCIEssenceDescriptor::VerticalSubsampling */
+    {(char*)"VerticalSubsampling",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x01, 0x10, 0x00, 0x00, 0x00},
+        0x3308, MXF_UINT32_TYPE, 0},
+    /* CDCIEssenceDescriptor::ColorRange */
+    {(char*)"ColorRange",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x05, 0x00, 0x00, 0x00},
+        0x3306, MXF_UINT32_TYPE, 0},
+    /* RGBAEssenceDescriptor::PixelLayout */
+    {(char*)"PixelLayout",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x06, 0x00, 0x00, 0x00},
+        0x3401, MXF_RGBALAYOUT_TYPE, 0},
+    /* CDCIEssenceDescriptor::AlphaSampleDepth */
+    {(char*)"AlphaSampleDepth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x07, 0x00, 0x00, 0x00},
+        0x3309, MXF_UINT32_TYPE, 0},
+    /* RGBAEssenceDescriptor::Palette */
+    {(char*)"Palette",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x08, 0x00, 0x00, 0x00},
+        0x3403, MXF_DATAVALUE_TYPE, 0},
+    /* RGBAEssenceDescriptor::PaletteLayout */
+    {(char*)"PaletteLayout",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x09, 0x00, 0x00, 0x00},
+        0x3404, MXF_RGBALAYOUT_TYPE, 0},
+    /* CDCIEssenceDescriptor::ComponentDepth */
+    {(char*)"ComponentDepth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x05, 0x03, 0x0a, 0x00, 0x00, 0x00},
+        0x3301, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::PictureEssenceCoding */
+    {(char*)"PictureEssenceCoding",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x01, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x3201, MXF_UL_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::SoundEssenceCompression */
+    {(char*)"SoundEssenceCompression",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x02, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x3d06, MXF_UL_TYPE, 0},
+    /* TimecodeComponent::RoundedTimecodeBase */
+    {(char*)"RoundedTimecodeBase",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x04, 0x01, 0x01, 0x02, 0x06, 0x00, 0x00},
+        0x1502, MXF_UINT16_TYPE, 1},
+    /* StructuralComponent::DataDefinition */
+    {(char*)"DataDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0201, MXF_UL_TYPE, 1},
+    /* GenericPictureEssenceDescriptor::ImageAlignmentOffset */
+    {(char*)"ImageAlignmentOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x3211, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ImageStartOffset */
+    {(char*)"ImageStartOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x3213, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ImageEndOffset */
+    {(char*)"ImageEndOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x3214, MXF_UINT32_TYPE, 0},
+    /* CDCIEssenceDescriptor::PaddingBits */
+    {(char*)"PaddingBits",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x04, 0x18, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00},
+        0x3307, MXF_INT16_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::AlphaTransparency */
+    {(char*)"AlphaTransparency",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x320f, MXF_UINT8_TYPE, 0},
+    /* Identification::ThisGenerationUID */
+    {(char*)"ThisGenerationUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x3c09, MXF_UUID_TYPE, 1},
+    /* Identification::CompanyName */
+    {(char*)"CompanyName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x02, 0x01, 0x00, 0x00},
+        0x3c01, MXF_UTF16STRING_TYPE, 1},
+    /* Identification::ProductName */
+    {(char*)"ProductName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x03, 0x01, 0x00, 0x00},
+        0x3c02, MXF_UTF16STRING_TYPE, 1},
+    /* Identification::ProductVersion */
+    {(char*)"ProductVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x3c03, MXF_PRODUCTVERSION_TYPE, 0},
+    /* Identification::VersionString */
+    {(char*)"VersionString",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x05, 0x01, 0x00, 0x00},
+        0x3c04, MXF_UTF16STRING_TYPE, 1},
+    /* Identification::Platform */
+    {(char*)"Platform",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x06, 0x01, 0x00, 0x00},
+        0x3c08, MXF_UTF16STRING_TYPE, 0},
+    /* Identification::ProductUID */
+    {(char*)"ProductUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x07, 0x00, 0x00, 0x00},
+        0x3c05, MXF_UUID_TYPE, 1},
+    /* InterchangeObject::GenerationUID */
+    {(char*)"GenerationUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x08, 0x00, 0x00, 0x00},
+        0x0102, MXF_UUID_TYPE, 0},
+    /* Identification::ToolkitVersion */
+    {(char*)"ToolkitVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x07, 0x01, 0x0a, 0x00, 0x00, 0x00},
+        0x3c07, MXF_PRODUCTVERSION_TYPE, 0},
+    /* PluginDefinition::PluginCategory */
+    {(char*)"PluginCategory",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x2203, MXF_UL_TYPE, 1},
+    /* PluginDefinition::Platform */
+    {(char*)"Platform",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x2209, MXF_UL_TYPE, 0},
+    /* PluginDefinition::MinPlatformVersion */
+    {(char*)"MinPlatformVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x220a, MXF_VERSIONTYPE_TYPE, 0},
+    /* PluginDefinition::MaxPlatformVersion */
+    {(char*)"MaxPlatformVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00},
+        0x220b, MXF_VERSIONTYPE_TYPE, 0},
+    /* PluginDefinition::Engine */
+    {(char*)"Engine",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00},
+        0x220c, MXF_UL_TYPE, 0},
+    /* PluginDefinition::MinEngineVersion */
+    {(char*)"MinEngineVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00},
+        0x220d, MXF_VERSIONTYPE_TYPE, 0},
+    /* PluginDefinition::MaxEngineVersion */
+    {(char*)"MaxEngineVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00},
+        0x220e, MXF_VERSIONTYPE_TYPE, 0},
+    /* PluginDefinition::PluginAPI */
+    {(char*)"PluginAPI",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00},
+        0x220f, MXF_UL_TYPE, 0},
+    /* PluginDefinition::MinPluginAPI */
+    {(char*)"MinPluginAPI",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00},
+        0x2210, MXF_VERSIONTYPE_TYPE, 0},
+    /* PluginDefinition::MaxPluginAPI */
+    {(char*)"MaxPluginAPI",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x0a, 0x00, 0x00, 0x00, 0x00},
+        0x2211, MXF_VERSIONTYPE_TYPE, 0},
+    /* PluginDefinition::SoftwareOnly */
+    {(char*)"SoftwareOnly",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x0b, 0x00, 0x00, 0x00, 0x00},
+        0x2212, MXF_BOOLEAN_TYPE, 0},
+    /* PluginDefinition::Accelerator */
+    {(char*)"Accelerator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x0c, 0x00, 0x00, 0x00, 0x00},
+        0x2213, MXF_BOOLEAN_TYPE, 0},
+    /* PluginDefinition::Locators */
+    {(char*)"Locators",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x0d, 0x00, 0x00, 0x00, 0x00},
+        0x2214, MXF_STRONGREFARRAY_TYPE, 0},
+    /* PluginDefinition::Authentication */
+    {(char*)"Authentication",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x0e, 0x00, 0x00, 0x00, 0x00},
+        0x2215, MXF_BOOLEAN_TYPE, 0},
+    /* PluginDefinition::DefinitionObject */
+    {(char*)"DefinitionObject",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x20, 0x09, 0x0f, 0x00, 0x00, 0x00, 0x00},
+        0x2216, MXF_UL_TYPE, 0},
+    /* EventTrack::EventEditRate */
+    {(char*)"EventEditRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x4901, MXF_RATIONAL_TYPE, 1},
+    /* DMSegment::EventComment */
+    {(char*)"EventComment",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x04, 0x04, 0x01, 0x00, 0x00, 0x00},
+        0x0602, MXF_UTF16STRING_TYPE, 0},
+    /* Track::EditRate */
+    {(char*)"EditRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00},
+        0x4b01, MXF_RATIONAL_TYPE, 1},
+    /* OperationDefinition::DataDefinition */
+    {(char*)"DataDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x05, 0x09, 0x00, 0x00, 0x00, 0x00},
+        0x1e01, MXF_UL_TYPE, 1},
+    /* OperationDefinition::OperationCategory */
+    {(char*)"OperationCategory",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x05, 0x0a, 0x00, 0x00, 0x00, 0x00},
+        0x1e06, MXF_UL_TYPE, 0},
+    /* ParameterDefinition::DisplayUnits */
+    {(char*)"DisplayUnits",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x05, 0x30, 0x05, 0x0b, 0x01, 0x00, 0x00, 0x00},
+        0x1f03, MXF_UTF16STRING_TYPE, 0},
+    /* SourceClip::SourcePackageID */
+    {(char*)"SourcePackageID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00},
+        0x1101, MXF_PACKAGEID_TYPE, 1},
+    /* SourceClip::SourceTrackID */
+    {(char*)"SourceTrackID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00},
+        0x1102, MXF_UINT32_TYPE, 1},
+    /* FileDescriptor::EssenceContainer */
+    {(char*)"EssenceContainer",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x01, 0x02, 0x00, 0x00},
+        0x3004, MXF_UL_TYPE, 1},
+    /* FileDescriptor::Codec */
+    {(char*)"Codec",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x01, 0x03, 0x00, 0x00},
+        0x3005, MXF_UL_TYPE, 0},
+    /* ParameterDefinition::Type */
+    {(char*)"Type",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x01, 0x06, 0x00, 0x00},
+        0x1f01, MXF_UL_TYPE, 1},
+    /* CodecDefinition::FileDescriptorClass */
+    {(char*)"FileDescriptorClass",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x01, 0x07, 0x00, 0x00},
+        0x2301, MXF_UL_TYPE, 1},
+    /* Preface::ContentStorage */
+    {(char*)"ContentStorage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x01, 0x00, 0x00},
+        0x3b03, MXF_STRONGREF_TYPE, 1},
+    /* Preface::Dictionary */
+    {(char*)"Dictionary",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x02, 0x00, 0x00},
+        0x3b04, MXF_STRONGREF_TYPE, 0},
+    /* SourcePackage::Descriptor */
+    {(char*)"Descriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x37, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x03, 0x00, 0x00},
+        0x4701, MXF_STRONGREF_TYPE, 0},
+    /* GenericTrack::Sequence */
+    {(char*)"Sequence",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x04, 0x00, 0x00},
+        0x4803, MXF_STRONGREF_TYPE, 1},
+    /* EssenceGroup::StillFrame */
+    {(char*)"StillFrame",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x08, 0x00, 0x00},
+        0x0502, MXF_STRONGREF_TYPE, 0},
+    /* PluginDefinition::ManufacturerInfo */
+    {(char*)"ManufacturerInfo",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x02, 0x0b, 0x00, 0x00},
+        0x2207, MXF_STRONGREF_TYPE, 0},
+    /* CodecDefinition::DataDefinitions */
+    {(char*)"DataDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x03, 0x01, 0x00, 0x00},
+        0x2302, MXF_ULARRAY_TYPE, 1},
+    /* OperationDefinition::ParametersDefined */
+    {(char*)"ParametersDefined",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x03, 0x02, 0x00, 0x00},
+        0x1e09, MXF_ULBATCH_TYPE, 0},
+    /* OperationDefinition::DegradeTo */
+    {(char*)"DegradeTo",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x04, 0x01, 0x00, 0x00},
+        0x1e03, MXF_ULARRAY_TYPE, 0},
+    /* ContentStorage::Packages */
+    {(char*)"Packages",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x01, 0x00, 0x00},
+        0x1901, MXF_STRONGREFBATCH_TYPE, 1},
+    /* ContentStorage::EssenceContainerData */
+    {(char*)"EssenceContainerData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x02, 0x00, 0x00},
+        0x1902, MXF_STRONGREFBATCH_TYPE, 0},
+    /* Dictionary::OperationDefinitions */
+    {(char*)"OperationDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x03, 0x00, 0x00},
+        0x2603, MXF_STRONGREFARRAY_TYPE, 0},
+    /* Dictionary::ParameterDefinitions */
+    {(char*)"ParameterDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x04, 0x00, 0x00},
+        0x2604, MXF_STRONGREFARRAY_TYPE, 0},
+    /* Dictionary::DataDefinitions */
+    {(char*)"DataDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x05, 0x00, 0x00},
+        0x2605, MXF_STRONGREFARRAY_TYPE, 0},
+    /* Dictionary::PluginDefinitions */
+    {(char*)"PluginDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x06, 0x00, 0x00},
+        0x2606, MXF_STRONGREFARRAY_TYPE, 0},
+    /* Dictionary::CodecDefinitions */
+    {(char*)"CodecDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x07, 0x00, 0x00},
+        0x2607, MXF_STRONGREFARRAY_TYPE, 0},
+    /* Dictionary::ContainerDefinitions */
+    {(char*)"ContainerDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x08, 0x00, 0x00},
+        0x2608, MXF_STRONGREFARRAY_TYPE, 0},
+    /* Dictionary::InterpolationDefinitions */
+    {(char*)"InterpolationDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x05, 0x09, 0x00, 0x00},
+        0x2609, MXF_STRONGREFARRAY_TYPE, 0},
+    /* EssenceGroup::Choices */
+    {(char*)"Choices",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x01, 0x00, 0x00},
+        0x0501, MXF_STRONGREFBATCH_TYPE, 1},
+    /* GenericDescriptor::Locators */
+    {(char*)"Locators",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x03, 0x00, 0x00},
+        0x2f01, MXF_STRONGREFARRAY_TYPE, 0},
+    /* Preface::Identifications */
+    {(char*)"Identifications",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x04, 0x00, 0x00},
+        0x3b06, MXF_STRONGREFARRAY_TYPE, 1},
+    /* GenericPackage::Tracks */
+    {(char*)"Tracks",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x05, 0x00, 0x00},
+        0x4403, MXF_STRONGREFARRAY_TYPE, 1},
+    /* Sequence::StructuralComponents */
+    {(char*)"StructuralComponents",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x04, 0x06, 0x09, 0x00, 0x00},
+        0x1001, MXF_STRONGREFARRAY_TYPE, 1},
+    /* EssenceContainerData::LinkedPackageUID */
+    {(char*)"LinkedPackageUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x06, 0x01, 0x00, 0x00, 0x00},
+        0x2701, MXF_UMID_TYPE, 1},
+    /* ClassDefinition::ParentClass */
+    {(char*)"ParentClass",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x01, 0x00, 0x00, 0x00},
+        0x0008, MXF_WEAKREF_TYPE, 1},
+    /* ClassDefinition::Properties */
+    {(char*)"Properties",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x02, 0x00, 0x00, 0x00},
+        0x0009, MXF_STRONGREFARRAY_TYPE, 0},
+    /* ClassDefinition::IsConcrete */
+    {(char*)"IsConcrete",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x03, 0x00, 0x00, 0x00},
+        0x000a, MXF_BOOLEAN_TYPE, 1},
+    /* PropertyDefinition::Type */
+    {(char*)"Type",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x04, 0x00, 0x00, 0x00},
+        0x000b, MXF_UL_TYPE, 1},
+    /* PropertyDefinition::LocalIdentification */
+    {(char*)"LocalIdentification",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x05, 0x00, 0x00, 0x00},
+        0x000d, MXF_UINT16_TYPE, 1},
+    /* PropertyDefinition::IsUniqueIdentifier */
+    {(char*)"IsUniqueIdentifier",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x06, 0x00, 0x00, 0x00},
+        0x000e, MXF_BOOLEAN_TYPE, 0},
+    /* MetaDictionary::ClassDefinitions */
+    {(char*)"ClassDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x25, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x07, 0x00, 0x00, 0x00},
+        0x0003, MXF_STRONGREFARRAY_TYPE, 0},
+    /* MetaDictionary::TypeDefinitions */
+    {(char*)"TypeDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x25, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x08, 0x00, 0x00, 0x00},
+        0x0004, MXF_STRONGREFARRAY_TYPE, 0},
+    /* TypeDefinitionStrongObjectReference::ReferencedType */
+    {(char*)"ReferencedType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x05, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x09, 0x00, 0x00, 0x00},
+        0x0011, MXF_WEAKREF_TYPE, 1},
+    /* TypeDefinitionWeakObjectReference::ReferencedType */
+    {(char*)"ReferencedType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x06, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0a, 0x00, 0x00, 0x00},
+        0x0012, MXF_WEAKREF_TYPE, 1},
+    /* TypeDefinitionEnumeration::Type */
+    {(char*)"Type",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x07, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0b, 0x00, 0x00, 0x00},
+        0x0014, MXF_WEAKREF_TYPE, 1},
+    /* TypeDefinitionFixedArray::ElementType */
+    {(char*)"ElementType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x08, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0c, 0x00, 0x00, 0x00},
+        0x0017, MXF_WEAKREF_TYPE, 1},
+    /* TypeDefinitionVariableArray::ElementType */
+    {(char*)"ElementType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x09, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0d, 0x00, 0x00, 0x00},
+        0x0019, MXF_WEAKREF_TYPE, 1},
+    /* TypeDefinitionSet::ElementType */
+    {(char*)"ElementType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0a, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0e, 0x00, 0x00, 0x00},
+        0x001a, MXF_WEAKREF_TYPE, 1},
+    /* TypeDefinitionString::ElementType */
+    {(char*)"ElementType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0b, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x0f, 0x00, 0x00, 0x00},
+        0x001b, MXF_WEAKREF_TYPE, 1},
+    /* TypeDefinitionRecord::MemberTypes */
+    {(char*)"MemberTypes",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0d, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x11, 0x00, 0x00, 0x00},
+        0x001c, MXF_WEAKREFARRAY_TYPE, 1},
+    /* TypeDefinitionRename::RenamedType */
+    {(char*)"RenamedType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0e, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x12, 0x00, 0x00, 0x00},
+        0x001e, MXF_WEAKREF_TYPE, 1},
+    /* MetaDefinition::Identification */
+    {(char*)"Identification",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x24, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x13, 0x00, 0x00, 0x00},
+        0x0005, MXF_UL_TYPE, 1},
+    /* MetaDefinition::Description */
+    {(char*)"Description",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x24, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x07, 0x14, 0x01, 0x00, 0x00},
+        0x0007, MXF_UTF16STRING_TYPE, 0},
+    /* Track::Origin */
+    {(char*)"Origin",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x01, 0x03, 0x00, 0x00},
+        0x4b02, MXF_POSITION_TYPE, 1},
+    /* SourceClip::StartPosition */
+    {(char*)"StartPosition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x01, 0x04, 0x00, 0x00},
+        0x1201, MXF_POSITION_TYPE, 1},
+    /* TimecodeComponent::StartTimecode */
+    {(char*)"StartTimecode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x01, 0x05, 0x00, 0x00},
+        0x1501, MXF_POSITION_TYPE, 1},
+    /* DMSegment::EventStartPosition */
+    {(char*)"EventStartPosition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00},
+        0x0601, MXF_POSITION_TYPE, 1},
+    /* GenericPackage::PackageCreationDate */
+    {(char*)"PackageCreationDate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x01, 0x03, 0x00, 0x00},
+        0x4405, MXF_TIMESTAMP_TYPE, 1},
+    /* Identification::ModificationDate */
+    {(char*)"ModificationDate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x02, 0x03, 0x00, 0x00},
+        0x3c06, MXF_TIMESTAMP_TYPE, 1},
+    /* Preface::LastModifiedDate */
+    {(char*)"LastModifiedDate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x02, 0x04, 0x00, 0x00},
+        0x3b02, MXF_TIMESTAMP_TYPE, 1},
+    /* GenericPackage::PackageModifiedDate */
+    {(char*)"PackageModifiedDate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x01, 0x10, 0x02, 0x05, 0x00, 0x00},
+        0x4404, MXF_TIMESTAMP_TYPE, 1},
+    /* StructuralComponent::Duration */
+    {(char*)"Duration",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x02, 0x07, 0x02, 0x02, 0x01, 0x01, 0x03, 0x00, 0x00},
+        0x0202, MXF_LENGTH_TYPE, 0},
+    /* EssenceContainerData::BodySID */
+    {(char*)"BodySID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00},
+        0x3f07, MXF_UINT32_TYPE, 1},
+    /* DCTimedTextResourceSubDescriptor::EssenceStreamID */
+    {(char*)"EssenceStreamID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00},
+        0x3f07, MXF_UINT32_TYPE, 1},
+    /* EssenceContainerData::IndexSID */
+    {(char*)"IndexSID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00},
+        0x3f06, MXF_UINT32_TYPE, 0},
+    /* DMSegment::TrackIDs */
+    {(char*)"TrackIDs",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x01, 0x07, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00},
+        0x6102, MXF_UINT32BATCH_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::Locked */
+    {(char*)"Locked",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x02, 0x03, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x3d02, MXF_BOOLEAN_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::QuantizationBits */
+    {(char*)"QuantizationBits",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x04, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00},
+        0x3d01, MXF_UINT32_TYPE, 0},
+    /* Preface::PrimaryPackage */
+    {(char*)"PrimaryPackage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x04, 0x01, 0x08, 0x00, 0x00},
+        0x3b08, MXF_WEAKREF_TYPE, 0},
+    /* MultipleDescriptor::SubDescriptorUIDs */
+    {(char*)"SubDescriptorUIDs",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x44, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x04, 0x06, 0x0b, 0x00, 0x00},
+        0x3f01, MXF_STRONGREFARRAY_TYPE, 1},
+    /* Preface::OperationalPattern */
+    {(char*)"OperationalPattern",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x3b09, MXF_UL_TYPE, 1},
+    /* Preface::EssenceContainers */
+    {(char*)"EssenceContainers",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x10, 0x02, 0x01, 0x00, 0x00},
+        0x3b0a, MXF_ULBATCH_TYPE, 1},
+    /* Preface::DMSchemes */
+    {(char*)"DMSchemes",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x02, 0x02, 0x10, 0x02, 0x02, 0x00, 0x00},
+        0x3b0b, MXF_ULBATCH_TYPE, 1},
+    /* DMSourceClip::DMSourceClipTrackIDs */
+    {(char*)"DMSourceClipTrackIDs",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x45, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x01, 0x07, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00},
+        0x6103, MXF_UINT32BATCH_TYPE, 0},
+    /* CDCIEssenceDescriptor::ReversedByteOrder */
+    {(char*)"ReversedByteOrder",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x02, 0x01, 0x0a, 0x00, 0x00, 0x00},
+        0x330b, MXF_BOOLEAN_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::DisplayF2Offset */
+    {(char*)"DisplayF2Offset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x03, 0x02, 0x07, 0x00, 0x00, 0x00},
+        0x3217, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::StoredF2Offset */
+    {(char*)"StoredF2Offset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x03, 0x02, 0x08, 0x00, 0x00, 0x00},
+        0x3216, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ActiveFormatDescriptor */
+    {(char*)"ActiveFormatDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x03, 0x02, 0x09, 0x00, 0x00, 0x00},
+        0x3218, MXF_UINT8_TYPE, 0},
+    /* RGBAEssenceDescriptor::ScanningDirection */
+    {(char*)"ScanningDirection",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x04, 0x04, 0x01, 0x00, 0x00, 0x00},
+        0x3405, MXF_ORIENTATION_TYPE, 0},
+    /* RGBAEssenceDescriptor::ComponentMaxRef */
+    {(char*)"ComponentMaxRef",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0b, 0x00, 0x00, 0x00},
+        0x3406, MXF_UINT32_TYPE, 0},
+    /* RGBAEssenceDescriptor::ComponentMinRef */
+    {(char*)"ComponentMinRef",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0c, 0x00, 0x00, 0x00},
+        0x3407, MXF_UINT32_TYPE, 0},
+    /* RGBAEssenceDescriptor::AlphaMaxRef */
+    {(char*)"AlphaMaxRef",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0d, 0x00, 0x00, 0x00},
+        0x3408, MXF_UINT32_TYPE, 0},
+    /* RGBAEssenceDescriptor::AlphaMinRef */
+    {(char*)"AlphaMinRef",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x05, 0x03, 0x0e, 0x00, 0x00, 0x00},
+        0x3409, MXF_UINT32_TYPE, 0},
+    /* MPEGVideoDescriptor::SingleSequence */
+    {(char*)"SingleSequence",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x02, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* MPEGVideoDescriptor::ConstantBFrames */
+    {(char*)"ConstantBFrames",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x03, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* MPEGVideoDescriptor::CodedContentType */
+    {(char*)"CodedContentType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x04, 0x00, 0x00},
+        0x0000, MXF_CODED_CONTENT_TYPE_TYPE, 0},
+    /* MPEGVideoDescriptor::LowDelay */
+    {(char*)"LowDelay",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x05, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* MPEGVideoDescriptor::ClosedGOP */
+    {(char*)"ClosedGOP",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x06, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* MPEGVideoDescriptor::IdenticalGOP */
+    {(char*)"IdenticalGOP",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x07, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* MPEGVideoDescriptor::MaxGOP */
+    {(char*)"MaxGOP",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x08, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* MPEGVideoDescriptor::MaxBPictureCount */
+    {(char*)"MaxBPictureCount",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x09, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* MPEGVideoDescriptor::ProfileAndLevel */
+    {(char*)"ProfileAndLevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x0a, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* MPEGVideoDescriptor::BitRate */
+    {(char*)"BitRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x01, 0x06, 0x02, 0x01, 0x0b, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::ChannelCount */
+    {(char*)"ChannelCount",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x3d07, MXF_UINT32_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::AudioSamplingRate */
+    {(char*)"AudioSamplingRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x01, 0x01, 0x01, 0x00, 0x00},
+        0x3d03, MXF_RATIONAL_TYPE, 0},
+    /* WaveAudioDescriptor::BlockAlign */
+    {(char*)"BlockAlign",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00},
+        0x3d0a, MXF_UINT16_TYPE, 1},
+    /* WaveAudioDescriptor::SequenceOffset */
+    {(char*)"SequenceOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00},
+        0x3d0b, MXF_UINT8_TYPE, 0},
+    /* AES3AudioDescriptor::BlockStartOffset */
+    {(char*)"BlockStartOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00},
+        0x3d0f, MXF_UINT16_TYPE, 0},
+    /* WaveAudioDescriptor::AvgBps */
+    {(char*)"AvgBps",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x03, 0x03, 0x05, 0x00, 0x00, 0x00},
+        0x3d09, MXF_UINT32_TYPE, 1},
+    /* AES3AudioDescriptor::AuxiliaryBitsMode */
+    {(char*)"AuxiliaryBitsMode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x3d08, MXF_UINT8_TYPE, 0},
+    /* AES3AudioDescriptor::ChannelStatusMode */
+    {(char*)"ChannelStatusMode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x02, 0x00, 0x00, 0x00},
+        0x3d10, MXF_UINT8ARRAY_TYPE, 0},
+    /* AES3AudioDescriptor::FixedChannelStatusData */
+    {(char*)"FixedChannelStatusData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x03, 0x00, 0x00, 0x00},
+        0x3d11, MXF_AES3_FIXED_DATA_ARRAY_TYPE, 0},
+    /* AES3AudioDescriptor::UserDataMode */
+    {(char*)"UserDataMode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x3d12, MXF_UINT8ARRAY_TYPE, 0},
+    /* AES3AudioDescriptor::FixedUserData */
+    {(char*)"FixedUserData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x3d13, MXF_AES3_FIXED_DATA_ARRAY_TYPE, 0},
+    /* AES3AudioDescriptor::Emphasis */
+    {(char*)"Emphasis",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x3d0d, MXF_UINT8_TYPE, 0},
+    /* AES3AudioDescriptor::LinkedTimecodeTrackID */
+    {(char*)"LinkedTimecodeTrackID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* AES3AudioDescriptor::SMPTE377MDataStreamNumber */
+    {(char*)"SMPTE377MDataStreamNumber",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x05, 0x01, 0x08, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::DialNorm */
+    {(char*)"DialNorm",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x02, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x3d0c, MXF_INT8_TYPE, 0},
+    /* GenericDataEssenceDescriptor::DataEssenceCoding */
+    {(char*)"DataEssenceCoding",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x03, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x3e01, MXF_UL_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::SignalStandard */
+    {(char*)"SignalStandard",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x04, 0x05, 0x01, 0x13, 0x00, 0x00, 0x00, 0x00},
+        0x3215, MXF_UINT8_TYPE, 0},
+    /* FileDescriptor::LinkedTrackID */
+    {(char*)"LinkedTrackID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00},
+        0x3006, MXF_UINT32_TYPE, 0},
+    /* DMSegment::DMFramework */
+    {(char*)"DMFramework",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x04, 0x02, 0x0c, 0x00, 0x00},
+        0x6101, MXF_STRONGREF_TYPE, 0},
+    /* EventTrack::EventOrigin */
+    {(char*)"EventOrigin",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x05, 0x07, 0x02, 0x01, 0x03, 0x01, 0x0b, 0x00, 0x00},
+        0x4902, MXF_POSITION_TYPE, 0},
+    /* WaveAudioDescriptor::ChannelAssignment */
+    {(char*)"ChannelAssignment",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x07, 0x04, 0x02, 0x01, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x3d32, MXF_UL_TYPE, 0},
+    /* DCTimedTextResourceSubDescriptor::MIMEType */
+    {(char*)"MIMEType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x07, 0x04, 0x09, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* Dictionary::KLVDataDefinitions */
+    {(char*)"KLVDataDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x04, 0x05, 0x0a, 0x00, 0x00},
+        0x260a, MXF_STRONGREFARRAY_TYPE, 0},
+    /* Dictionary::TaggedValueDefinitions */
+    {(char*)"TaggedValueDefinitions",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x07, 0x06, 0x01, 0x01, 0x04, 0x05, 0x0b, 0x00, 0x00},
+        0x260b, MXF_STRONGREFARRAY_TYPE, 0},
+    /* DCTimedTextDescriptor::NamespaceURI */
+    {(char*)"NamespaceURI",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x01, 0x02, 0x01, 0x05, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* WaveAudioDescriptor::PeakEnvelopeVersion */
+    {(char*)"PeakEnvelopeVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x3d29, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PeakEnvelopeFormat */
+    {(char*)"PeakEnvelopeFormat",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x07, 0x00, 0x00, 0x00},
+        0x3d2a, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PointsPerPeakValue */
+    {(char*)"PointsPerPeakValue",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x08, 0x00, 0x00, 0x00},
+        0x3d2b, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PeakEnvelopeBlockSize */
+    {(char*)"PeakEnvelopeBlockSize",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x09, 0x00, 0x00, 0x00},
+        0x3d2c, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PeakChannels */
+    {(char*)"PeakChannels",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0a, 0x00, 0x00, 0x00},
+        0x3d2d, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PeakFrames */
+    {(char*)"PeakFrames",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0b, 0x00, 0x00, 0x00},
+        0x3d2e, MXF_UINT32_TYPE, 0},
+    /* WaveAudioDescriptor::PeakOfPeaksPosition */
+    {(char*)"PeakOfPeaksPosition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0c, 0x00, 0x00, 0x00},
+        0x3d2f, MXF_POSITION_TYPE, 0},
+    /* WaveAudioDescriptor::PeakEnvelopeTimestamp */
+    {(char*)"PeakEnvelopeTimestamp",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0d, 0x00, 0x00, 0x00},
+        0x3d30, MXF_TIMESTAMP_TYPE, 0},
+    /* WaveAudioDescriptor::PeakEnvelopeData */
+    {(char*)"PeakEnvelopeData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x08, 0x04, 0x02, 0x03, 0x01, 0x0e, 0x00, 0x00, 0x00},
+        0x3d31, MXF_STREAM_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ColorPrimaries */
+    {(char*)"ColorPrimaries",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x04, 0x01, 0x02, 0x01, 0x01, 0x06, 0x01, 0x00},
+        0x3219, MXF_UL_TYPE, 0},
+    /* GenericDescriptor::SubDescriptors */
+    {(char*)"SubDescriptors",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x04, 0x06, 0x10, 0x00, 0x00},
+        0x0000, MXF_STRONGREFARRAY_TYPE, 0},
+    /* JPEG2000SubDescriptor::Rsiz */
+    {(char*)"Rsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEG2000SubDescriptor::Xsiz */
+    {(char*)"Xsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::Ysiz */
+    {(char*)"Ysiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::XOsiz */
+    {(char*)"XOsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::YOsiz */
+    {(char*)"YOsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x05, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::XTsiz */
+    {(char*)"XTsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::YTsiz */
+    {(char*)"YTsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::XTOsiz */
+    {(char*)"XTOsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x08, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::YTOsiz */
+    {(char*)"YTOsiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x09, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* JPEG2000SubDescriptor::Csiz */
+    {(char*)"Csiz",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0a, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEG2000SubDescriptor::PictureComponentSizing */
+    {(char*)"PictureComponentSizing",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0b, 0x00, 0x00, 0x00},
+        0x0000, MXF_J2K_COMPONENT_SIZING_ARRAY_TYPE, 1},
+    /* JPEG2000SubDescriptor::CodingStyleDefault */
+    {(char*)"CodingStyleDefault",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0c, 0x00, 0x00, 0x00},
+        0x0000, MXF_DATAVALUE_TYPE, 0},
+    /* JPEG2000SubDescriptor::QuantizationDefault */
+    {(char*)"QuantizationDefault",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0a, 0x04, 0x01, 0x06, 0x03, 0x0d, 0x00, 0x00, 0x00},
+        0x0000, MXF_DATAVALUE_TYPE, 0},
+    /* DCTimedTextDescriptor::ResourceID */
+    {(char*)"ResourceID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x15, 0x12, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 0},
+    /* DCTimedTextResourceSubDescriptor::AncillaryResourceID */
+    {(char*)"AncillaryResourceID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x15, 0x13, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 1},
+    /* DCTimedTextDescriptor::UCSEncoding */
+    {(char*)"UCSEncoding",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0c, 0x04, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* GenericStreamTextBasedSet::GenericStreamSID */
+    {(char*)"GenericStreamSID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x03, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* TextBasedObject::RFC5646TextLanguageCode */
+    {(char*)"RFC5646TextLanguageCode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x02, 0x02, 0x14, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* MCALabelSubDescriptor::RFC5646SpokenLanguage */
+    {(char*)"RFC5646SpokenLanguage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x01, 0x01, 0x02, 0x03, 0x15, 0x00, 0x00},
+        0x0000, MXF_ISO7STRING_TYPE, 0},
+    /* UTF8TextBasedSet::UTF8TextData */
+    {(char*)"UTF8TextData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x01, 0x02, 0x20, 0x03, 0x01, 0x00, 0x00},
+        0x0000, MXF_RAW_TYPE, 1},
+    /* UTF16TextBasedSet::UTF16TextData */
+    {(char*)"UTF16TextData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x01, 0x02, 0x20, 0x03, 0x02, 0x00, 0x00},
+        0x0000, MXF_RAW_TYPE, 1},
+    /* TextBasedObject::TextDataDescription */
+    {(char*)"TextDataDescription",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x03, 0x02, 0x01, 0x06, 0x03, 0x02, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* TextBasedObject::TextBasedMetadataPayloadSchemaID */
+    {(char*)"TextBasedMetadataPayloadSchemaID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x04, 0x06, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UL_TYPE, 1},
+    /* TextBasedObject::TextMIMEMediaType */
+    {(char*)"TextMIMEMediaType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x04, 0x09, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* TextBasedDMFramework::TextBasedObject */
+    {(char*)"TextBasedObject",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x01, 0x01, 0x04, 0x05, 0x41, 0x01, 0x00},
+        0x0000, MXF_STRONGREF_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAChannelID */
+    {(char*)"MCAChannelID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* MCALabelSubDescriptor::MCALabelDictionaryID */
+    {(char*)"MCALabelDictionaryID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UL_TYPE, 1},
+    /* MCALabelSubDescriptor::MCATagSymbol */
+    {(char*)"MCATagSymbol",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* MCALabelSubDescriptor::MCATagName */
+    {(char*)"MCATagName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* SoundfieldGroupLabelSubDescriptor::GroupOfSoundfieldGroupsLinkID */
+    {(char*)"GroupOfSoundfieldGroupsLinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUIDARRAY_TYPE, 0},
+    /* MCALabelSubDescriptor::MCALinkID */
+    {(char*)"MCALinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x05, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 1},
+    /* AudioChannelLabelSubDescriptor::SoundfieldGroupLinkID */
+    {(char*)"SoundfieldGroupLinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6b, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x03, 0x07, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAPartitionKind */
+    {(char*)"MCAPartitionKind",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x04, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAPartitionNumber */
+    {(char*)"MCAPartitionNumber",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x04, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCATitle */
+    {(char*)"MCATitle",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCATitleVersion */
+    {(char*)"MCATitleVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x05, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCATitleSubVersion */
+    {(char*)"MCATitleSubVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x05, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAEpisode */
+    {(char*)"MCAEpisode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x05, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* DCTimedTextDescriptor::RFC5646LanguageTagList */
+    {(char*)"RFC5646LanguageTagList",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x01, 0x01, 0x02, 0x02, 0x16, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAAudioContentKind */
+    {(char*)"MCAAudioContentKind",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x20, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAAudioElementKind */
+    {(char*)"MCAAudioElementKind",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x21, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAContent */
+    {(char*)"MCAContent",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x22, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAUseClass */
+    {(char*)"MCAUseClass",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x23, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAContentSubtype */
+    {(char*)"MCAContentSubtype",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x24, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAContentDifferentiator */
+    {(char*)"MCAContentDifferentiator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x25, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCASpokenLanguageAttribute */
+    {(char*)"MCASpokenLanguageAttribute",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x26, 0x00, 0x00, 0x00},
+        0x0000, MXF_ISO7STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::RFC5646AdditionalSpokenLanguages */
+    {(char*)"RFC5646AdditionalSpokenLanguages",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x27, 0x00, 0x00, 0x00},
+        0x0000, MXF_ISO7STRING_TYPE, 0},
+    /* MCALabelSubDescriptor::MCAAdditionalLanguageAttributes */
+    {(char*)"MCAAdditionalLanguageAttributes",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x03, 0x02, 0x01, 0x02, 0x28, 0x00, 0x00, 0x00},
+        0x0000, MXF_ISO7STRING_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::AlternativeCenterCuts */
+    {(char*)"AlternativeCenterCuts",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x03, 0x02, 0x0b, 0x00, 0x00, 0x00},
+        0x0000, MXF_ULBATCH_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ActiveHeight */
+    {(char*)"ActiveHeight",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x05, 0x01, 0x13, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ActiveWidth */
+    {(char*)"ActiveWidth",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x05, 0x01, 0x14, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ActiveXOffset */
+    {(char*)"ActiveXOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x05, 0x01, 0x15, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ActiveYOffset */
+    {(char*)"ActiveYOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x05, 0x01, 0x16, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* JPEG2000SubDescriptor::J2CLayout */
+    {(char*)"J2CLayout",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x03, 0x0e, 0x00, 0x00, 0x00},
+        0x0000, MXF_RGBALAYOUT_TYPE, 0},
+    /* JPEG2000SubDescriptor::J2KExtendedCapabilities */
+    {(char*)"J2KExtendedCapabilities",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x03, 0x0f, 0x00, 0x00, 0x00},
+        0x0000, MXF_J2K_EXTENDED_CAPABILITIES_TYPE, 0},
+    /* JPEG2000SubDescriptor::J2KProfile */
+    {(char*)"J2KProfile",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x03, 0x10, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16ARRAY_TYPE, 0},
+    /* JPEG2000SubDescriptor::J2KCorrespondingProfile */
+    {(char*)"J2KCorrespondingProfile",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x03, 0x11, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16ARRAY_TYPE, 0},
+    /* AVCSubDescriptor::AVCConstantBPictureFlag */
+    {(char*)"AVCConstantBPictureFlag",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x03, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* AVCSubDescriptor::AVCCodedContentKind */
+    {(char*)"AVCCodedContentKind",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x04, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCClosedGOPIndicator */
+    {(char*)"AVCClosedGOPIndicator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x06, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* AVCSubDescriptor::AVCIdenticalGOPIndicator */
+    {(char*)"AVCIdenticalGOPIndicator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x07, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* AVCSubDescriptor::AVCMaximumGOPSize */
+    {(char*)"AVCMaximumGOPSize",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x08, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* AVCSubDescriptor::AVCMaximumBPictureCount */
+    {(char*)"AVCMaximumBPictureCount",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x09, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* AVCSubDescriptor::AVCProfile */
+    {(char*)"AVCProfile",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0a, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCMaximumBitrate */
+    {(char*)"AVCMaximumBitrate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0b, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* AVCSubDescriptor::AVCProfileConstraint */
+    {(char*)"AVCProfileConstraint",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0c, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCLevel */
+    {(char*)"AVCLevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0d, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCDecodingDelay */
+    {(char*)"AVCDecodingDelay",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0e, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* AVCSubDescriptor::AVCMaximumRefFrames */
+    {(char*)"AVCMaximumRefFrames",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0f, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCSequenceParameterSetFlag */
+    {(char*)"AVCSequenceParameterSetFlag",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x10, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCPictureParameterSetFlag */
+    {(char*)"AVCPictureParameterSetFlag",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x11, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* AVCSubDescriptor::AVCAverageBitrate */
+    {(char*)"AVCAverageBitrate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x06, 0x01, 0x14, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* VC2SubDescriptor::VC2MajorVersion */
+    {(char*)"VC2MajorVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* VC2SubDescriptor::VC2MinorVersion */
+    {(char*)"VC2MinorVersion",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* VC2SubDescriptor::VC2Profile */
+    {(char*)"VC2Profile",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* VC2SubDescriptor::VC2Level */
+    {(char*)"VC2Level",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* VC2SubDescriptor::VC2WaveletFilters */
+    {(char*)"VC2WaveletFilters",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x05, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8BATCH_TYPE, 0},
+    /* VC2SubDescriptor::VC2SequenceHeadersIdentical */
+    {(char*)"VC2SequenceHeadersIdentical",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* VC2SubDescriptor::VC2EditUnitsAreCompleteSequences */
+    {(char*)"VC2EditUnitsAreCompleteSequences",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x07, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* JPEGXSSubDescriptor::JPEGXSPpih */
+    {(char*)"JPEGXSPpih",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSPlev */
+    {(char*)"JPEGXSPlev",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSWf */
+    {(char*)"JPEGXSWf",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSHf */
+    {(char*)"JPEGXSHf",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSNc */
+    {(char*)"JPEGXSNc",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x05, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSComponentTable */
+    {(char*)"JPEGXSComponentTable",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8ARRAY_TYPE, 1},
+    /* JPEGXSSubDescriptor::JPEGXSCw */
+    {(char*)"JPEGXSCw",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* JPEGXSSubDescriptor::JPEGXSHsl */
+    {(char*)"JPEGXSHsl",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x08, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 0},
+    /* JPEGXSSubDescriptor::JPEGXSMaximumBitRate */
+    {(char*)"JPEGXSMaximumBitRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x01, 0x06, 0x0b, 0x09, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::ReferenceImageEditRate */
+    {(char*)"ReferenceImageEditRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x01, 0x01, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_RATIONAL_TYPE, 0},
+    /* GenericSoundEssenceDescriptor::ReferenceAudioAlignmentLevel */
+    {(char*)"ReferenceAudioAlignmentLevel",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x01, 0x01, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_INT8_TYPE, 0},
+    /* MGASoundEssenceDescriptor::MGASoundEssenceBlockAlign */
+    {(char*)"MGASoundEssenceBlockAlign",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x06},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x04, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* MGASoundEssenceDescriptor::MGASoundEssenceAverageBytesPerSecond */
+    {(char*)"MGASoundEssenceAverageBytesPerSecond",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x06},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x04, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* MGASoundEssenceDescriptor::MGASoundEssenceSequenceOffset */
+    {(char*)"MGASoundEssenceSequenceOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x06},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x04, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 0},
+    /* MGAAudioMetadataSubDescriptor::MGALinkID */
+    {(char*)"MGALinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x07},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x05, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 1},
+    /* MGAAudioMetadataSubDescriptor::MGAAudioMetadataIndex */
+    {(char*)"MGAAudioMetadataIndex",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x07},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x05, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* MGAAudioMetadataSubDescriptor::MGAAudioMetadataIdentifier */
+    {(char*)"MGAAudioMetadataIdentifier",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x07},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x05, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT8_TYPE, 1},
+    /* MGAAudioMetadataSubDescriptor::MGAAudioMetadataPayloadULArray */
+    {(char*)"MGAAudioMetadataPayloadULArray",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x07},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x05, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_ULARRAY_TYPE, 1},
+    /* MGASoundfieldGroupLabelSubDescriptor::MGAMetadataSectionLinkID */
+    {(char*)"MGAMetadataSectionLinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x08},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x06, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 1},
+    /* MGASoundfieldGroupLabelSubDescriptor::ADMAudioProgrammeID */
+    {(char*)"ADMAudioProgrammeID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x08},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x06, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MGASoundfieldGroupLabelSubDescriptor::ADMAudioContentID */
+    {(char*)"ADMAudioContentID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x08},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x06, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* MGASoundfieldGroupLabelSubDescriptor::ADMAudioObjectID */
+    {(char*)"ADMAudioObjectID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x08},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x06, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* SADMAudioMetadataSubDescriptor::SADMMetadataSectionLinkID */
+    {(char*)"SADMMetadataSectionLinkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x09},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x07, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 1},
+    /* SADMAudioMetadataSubDescriptor::SADMProfileLevelULBatch */
+    {(char*)"SADMProfileLevelULBatch",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x09},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x07, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_ULBATCH_TYPE, 0},
+    /* RIFFChunkDefinitionSubDescriptor::RIFFChunkStreamID */
+    {(char*)"RIFFChunkStreamID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0d},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x08, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* RIFFChunkDefinitionSubDescriptor::RIFFChunkID */
+    {(char*)"RIFFChunkID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0d},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x08, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_RIFF_CHUNK_ID_TYPE, 1},
+    /* RIFFChunkDefinitionSubDescriptor::RIFFChunkUUID */
+    {(char*)"RIFFChunkUUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0d},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x08, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UUID_TYPE, 0},
+    /* RIFFChunkDefinitionSubDescriptor::RIFFChunkHashSHA1 */
+    {(char*)"RIFFChunkHashSHA1",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0d},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x08, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_DATAVALUE_TYPE, 0},
+    /* RIFFChunkReferencesSubDescriptor::RIFFChunkStreamIDsArray */
+    {(char*)"RIFFChunkStreamIDsArray",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x10},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x08, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32ARRAY_TYPE, 1},
+    /* ADM_CHNASubDescriptor::NumLocalChannels */
+    {(char*)"NumLocalChannels",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0e},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* ADM_CHNASubDescriptor::NumADMAudioTrackUIDs */
+    {(char*)"NumADMAudioTrackUIDs",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0e},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT16_TYPE, 1},
+    /* ADM_CHNASubDescriptor::ADMChannelMappingsArray */
+    {(char*)"ADMChannelMappingsArray",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0e},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_STRONGREFARRAY_TYPE, 1},
+    /* ADMChannelMapping::LocalChannelID */
+    {(char*)"LocalChannelID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0f},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* ADMChannelMapping::ADMAudioTrackUID */
+    {(char*)"ADMAudioTrackUID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0f},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x05, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* ADMChannelMapping::ADMAudioTrackChannelFormatID */
+    {(char*)"ADMAudioTrackChannelFormatID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0f},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x06, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 1},
+    /* ADMChannelMapping::ADMAudioPackFormatID */
+    {(char*)"ADMAudioPackFormatID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0f},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x09, 0x07, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* ADMAudioMetadataSubDescriptor::RIFFChunkStreamID_link1 */
+    {(char*)"RIFFChunkStreamID_link1",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x11},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0a, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* ADMAudioMetadataSubDescriptor::ADMProfileLevelULBatch */
+    {(char*)"ADMProfileLevelULBatch",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x11},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0a, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_ULBATCH_TYPE, 0},
+    /* ADMSoundfieldGroupLabelSubDescriptor::RIFFChunkStreamID_link2 */
+    {(char*)"RIFFChunkStreamID_link2",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x12},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0b, 0x01, 0x00, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 1},
+    /* ADMSoundfieldGroupLabelSubDescriptor::ADMAudioProgrammeID_ST2131 */
+    {(char*)"ADMAudioProgrammeID_ST2131",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x12},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0b, 0x02, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* ADMSoundfieldGroupLabelSubDescriptor::ADMAudioContentID_ST2131 */
+    {(char*)"ADMAudioContentID_ST2131",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x12},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0b, 0x03, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* ADMSoundfieldGroupLabelSubDescriptor::ADMAudioObjectID_ST2131 */
+    {(char*)"ADMAudioObjectID_ST2131",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x12},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x02, 0x03, 0x0b, 0x04, 0x00, 0x00, 0x00},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* Preface::IsRIPPresent */
+    {(char*)"IsRIPPresent",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::MasteringDisplayPrimaries */
+    {(char*)"MasteringDisplayPrimaries",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x20, 0x04, 0x01, 0x01, 0x01, 0x00, 0x00},
+        0x0000, MXF_THREE_COLOR_PRIMARIES_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::MasteringDisplayWhitePointChromaticity */
+    {(char*)"MasteringDisplayWhitePointChromaticity",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x20, 0x04, 0x01, 0x01, 0x02, 0x00, 0x00},
+        0x0000, MXF_COLOR_PRIMARY_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::MasteringDisplayMaximumLuminance */
+    {(char*)"MasteringDisplayMaximumLuminance",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x20, 0x04, 0x01, 0x01, 0x03, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::MasteringDisplayMinimumLuminance */
+    {(char*)"MasteringDisplayMinimumLuminance",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x01, 0x01, 0x01, 0x0e, 0x04, 0x20, 0x04, 0x01, 0x01, 0x04, 0x00, 0x00},
+        0x0000, MXF_UINT32_TYPE, 0},
+    /* Preface::EssenceFileMobID */
+    {(char*)"EssenceFileMobID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x8b, 0x2f, 0x68, 0x0d, 0xff, 0x61, 0x13, 0x81, 0xab, 0xf1, 0xb7, 0x71, 0x8e, 0xfd, 0x48, 0x02},
+        0x0000, MXF_UMID_TYPE, 0},
+    /* Preface::ProjectEditRate */
+    {(char*)"ProjectEditRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0x8c, 0x70, 0xa7, 0x18, 0x46, 0x7a, 0xe4, 0x86, 0xf3, 0x65, 0x46, 0xb1, 0x38, 0x7c, 0x4e, 0xe9},
+        0x0000, MXF_RATIONAL_TYPE, 0},
+    /* GenericPackage::MobAttributeList */
+    {(char*)"MobAttributeList",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0xa0, 0x1c, 0x00, 0x04, 0xac, 0x96, 0x9f, 0x50, 0x60, 0x95, 0x81, 0x83, 0x47, 0xb1, 0x11, 0xd4},
+        0x0000, MXF_STRONGREFARRAY_TYPE, 0},
+    /* TaggedValue::TaggedValueAttributeList */
+    {(char*)"TaggedValueAttributeList",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3f, 0x00},
+        {0xa0, 0x1c, 0x00, 0x04, 0xac, 0x96, 0x9f, 0x50, 0x60, 0x95, 0x81, 0x85, 0x47, 0xb1, 0x11, 0xd4},
+        0x0000, MXF_STRONGREFARRAY_TYPE, 0},
+    /* GenericPackage::AppCode */
+    {(char*)"AppCode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0xa0, 0x22, 0x00, 0x60, 0x94, 0xeb, 0x75, 0xcb, 0x96, 0xc4, 0x69, 0x92, 0x4f, 0x62, 0x11, 0xd3},
+        0x0000, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ResolutionID */
+    {(char*)"ResolutionID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0xa0, 0x24, 0x00, 0x60, 0x94, 0xeb, 0x75, 0xcb, 0xce, 0x2a, 0xca, 0x4d, 0x51, 0xab, 0x11, 0xd3},
+        0x0000, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::FirstFrameOffset */
+    {(char*)"FirstFrameOffset",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0xa0, 0x24, 0x00, 0x60, 0x94, 0xeb, 0x75, 0xcb, 0xce, 0x2a, 0xca, 0x4e, 0x51, 0xab, 0x11, 0xd3},
+        0x0000, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::ImageSize */
+    {(char*)"ImageSize",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0xa0, 0x24, 0x00, 0x60, 0x94, 0xeb, 0x75, 0xcb, 0xce, 0x2a, 0xca, 0x4f, 0x51, 0xab, 0x11, 0xd3},
+        0x0000, MXF_INT32_TYPE, 0},
+    /* GenericPictureEssenceDescriptor::FrameSampleSize */
+    {(char*)"FrameSampleSize",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0xa0, 0x24, 0x00, 0x60, 0x94, 0xeb, 0x75, 0xcb, 0xce, 0x2a, 0xca, 0x50, 0x51, 0xab, 0x11, 0xd3},
+        0x0000, MXF_INT32_TYPE, 0},
+    /* DMSegment::CommentMarkerColor */
+    {(char*)"CommentMarkerColor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {0xa0, 0x69, 0x00, 0x60, 0x94, 0xeb, 0x75, 0xcb, 0xe9, 0x6e, 0x6d, 0x44, 0xc3, 0x83, 0x11, 0xd3},
+        0x0000, MXF_RGB_COLOR_TYPE, 0},
+    /* EssenceGroup::EssenceGroupType */
+    {(char*)"EssenceGroupType",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00},
+        {0xa0, 0x83, 0x00, 0x60, 0x94, 0xeb, 0x75, 0xcb, 0xd9, 0xc9, 0xbf, 0x24, 0xf6, 0xb8, 0x11, 0xd3},
+        0x0000, MXF_INT32_TYPE, 0},
+    /* TapeDescriptor::ColorFrame */
+    {(char*)"ColorFrame",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2e, 0x00},
+        {0xa0, 0x8f, 0x00, 0x60, 0x94, 0xeb, 0x75, 0xcb, 0x95, 0x48, 0xb0, 0x3a, 0x15, 0xfb, 0x11, 0xd4},
+        0x0000, MXF_INT32_TYPE, 0},
+    /* Preface::ProjectName */
+    {(char*)"ProjectName",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0xa5, 0xfb, 0x7b, 0x25, 0xf6, 0x15, 0x94, 0xb9, 0x62, 0xfc, 0x37, 0x17, 0x49, 0x2d, 0x42, 0xbf},
+        0x0000, MXF_UTF16STRING_TYPE, 0},
+    /* GenericPackage::ConvertFrameRate */
+    {(char*)"ConvertFrameRate",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0xa8, 0xf3, 0xf2, 0xeb, 0xa5, 0x42, 0x44, 0xde, 0xd4, 0x24, 0x3b, 0xd4, 0x01, 0x42, 0x45, 0x95},
+        0x0000, MXF_BOOLEAN_TYPE, 0},
+    /* Preface::MasterMobID */
+    {(char*)"MasterMobID",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {0xae, 0x58, 0x78, 0xe0, 0x41, 0x45, 0x41, 0x79, 0xff, 0xdd, 0x41, 0xe1, 0xae, 0x2c, 0x49, 0xc6},
+        0x0000, MXF_UMID_TYPE, 0},
+};
+
+static const MXFListElement g_avidItemDefElements[373] =
+{
+    /* InterchangeObject */
+    {(MXFListElement*)&g_avidItemDefElements[1], (void*)&g_avidItemDefs[0]},
+    {NULL, (void*)&g_avidItemDefs[84]},
+    /* StructuralComponent */
+    {(MXFListElement*)&g_avidItemDefElements[3], (void*)&g_avidItemDefs[71]},
+    {NULL, (void*)&g_avidItemDefs[164]},
+    /* EssenceGroup */
+    {(MXFListElement*)&g_avidItemDefElements[5], (void*)&g_avidItemDefs[131]},
+    {(MXFListElement*)&g_avidItemDefElements[6], (void*)&g_avidItemDefs[117]},
+    {NULL, (void*)&g_avidItemDefs[368]},
+    /* Sequence */
+    {NULL, (void*)&g_avidItemDefs[135]},
+    /* SourceClip */
+    {(MXFListElement*)&g_avidItemDefElements[9], (void*)&g_avidItemDefs[157]},
+    {(MXFListElement*)&g_avidItemDefElements[10], (void*)&g_avidItemDefs[107]},
+    {NULL, (void*)&g_avidItemDefs[108]},
+    /* TimecodeComponent */
+    {(MXFListElement*)&g_avidItemDefElements[12], (void*)&g_avidItemDefs[70]},
+    {(MXFListElement*)&g_avidItemDefElements[13], (void*)&g_avidItemDefs[158]},
+    {NULL, (void*)&g_avidItemDefs[24]},
+    /* ContentStorage */
+    {(MXFListElement*)&g_avidItemDefElements[15], (void*)&g_avidItemDefs[122]},
+    {NULL, (void*)&g_avidItemDefs[123]},
+    /* DefinitionObject */
+    {(MXFListElement*)&g_avidItemDefElements[17], (void*)&g_avidItemDefs[30]},
+    {(MXFListElement*)&g_avidItemDefElements[18], (void*)&g_avidItemDefs[35]},
+    {NULL, (void*)&g_avidItemDefs[53]},
+    /* OperationDefinition */
+    {(MXFListElement*)&g_avidItemDefElements[20], (void*)&g_avidItemDefs[104]},
+    {(MXFListElement*)&g_avidItemDefElements[21], (void*)&g_avidItemDefs[27]},
+    {(MXFListElement*)&g_avidItemDefElements[22], (void*)&g_avidItemDefs[121]},
+    {(MXFListElement*)&g_avidItemDefElements[23], (void*)&g_avidItemDefs[105]},
+    {(MXFListElement*)&g_avidItemDefElements[24], (void*)&g_avidItemDefs[28]},
+    {(MXFListElement*)&g_avidItemDefElements[25], (void*)&g_avidItemDefs[29]},
+    {NULL, (void*)&g_avidItemDefs[120]},
+    /* ParameterDefinition */
+    {(MXFListElement*)&g_avidItemDefElements[27], (void*)&g_avidItemDefs[111]},
+    {NULL, (void*)&g_avidItemDefs[106]},
+    /* PluginDefinition */
+    {(MXFListElement*)&g_avidItemDefElements[29], (void*)&g_avidItemDefs[86]},
+    {(MXFListElement*)&g_avidItemDefElements[30], (void*)&g_avidItemDefs[56]},
+    {(MXFListElement*)&g_avidItemDefElements[31], (void*)&g_avidItemDefs[55]},
+    {(MXFListElement*)&g_avidItemDefElements[32], (void*)&g_avidItemDefs[36]},
+    {(MXFListElement*)&g_avidItemDefElements[33], (void*)&g_avidItemDefs[118]},
+    {(MXFListElement*)&g_avidItemDefElements[34], (void*)&g_avidItemDefs[37]},
+    {(MXFListElement*)&g_avidItemDefElements[35], (void*)&g_avidItemDefs[87]},
+    {(MXFListElement*)&g_avidItemDefElements[36], (void*)&g_avidItemDefs[88]},
+    {(MXFListElement*)&g_avidItemDefElements[37], (void*)&g_avidItemDefs[89]},
+    {(MXFListElement*)&g_avidItemDefElements[38], (void*)&g_avidItemDefs[90]},
+    {(MXFListElement*)&g_avidItemDefElements[39], (void*)&g_avidItemDefs[91]},
+    {(MXFListElement*)&g_avidItemDefElements[40], (void*)&g_avidItemDefs[92]},
+    {(MXFListElement*)&g_avidItemDefElements[41], (void*)&g_avidItemDefs[93]},
+    {(MXFListElement*)&g_avidItemDefElements[42], (void*)&g_avidItemDefs[94]},
+    {(MXFListElement*)&g_avidItemDefElements[43], (void*)&g_avidItemDefs[95]},
+    {(MXFListElement*)&g_avidItemDefElements[44], (void*)&g_avidItemDefs[96]},
+    {(MXFListElement*)&g_avidItemDefElements[45], (void*)&g_avidItemDefs[97]},
+    {(MXFListElement*)&g_avidItemDefElements[46], (void*)&g_avidItemDefs[98]},
+    {(MXFListElement*)&g_avidItemDefElements[47], (void*)&g_avidItemDefs[99]},
+    {NULL, (void*)&g_avidItemDefs[100]},
+    /* CodecDefinition */
+    {(MXFListElement*)&g_avidItemDefElements[49], (void*)&g_avidItemDefs[112]},
+    {NULL, (void*)&g_avidItemDefs[119]},
+    /* ContainerDefinition */
+    {NULL, (void*)&g_avidItemDefs[5]},
+    /* Dictionary */
+    {(MXFListElement*)&g_avidItemDefElements[52], (void*)&g_avidItemDefs[124]},
+    {(MXFListElement*)&g_avidItemDefElements[53], (void*)&g_avidItemDefs[125]},
+    {(MXFListElement*)&g_avidItemDefElements[54], (void*)&g_avidItemDefs[126]},
+    {(MXFListElement*)&g_avidItemDefElements[55], (void*)&g_avidItemDefs[127]},
+    {(MXFListElement*)&g_avidItemDefElements[56], (void*)&g_avidItemDefs[128]},
+    {(MXFListElement*)&g_avidItemDefElements[57], (void*)&g_avidItemDefs[129]},
+    {(MXFListElement*)&g_avidItemDefElements[58], (void*)&g_avidItemDefs[130]},
+    {(MXFListElement*)&g_avidItemDefElements[59], (void*)&g_avidItemDefs[218]},
+    {NULL, (void*)&g_avidItemDefs[219]},
+    /* EssenceContainerData */
+    {(MXFListElement*)&g_avidItemDefElements[61], (void*)&g_avidItemDefs[136]},
+    {(MXFListElement*)&g_avidItemDefElements[62], (void*)&g_avidItemDefs[167]},
+    {NULL, (void*)&g_avidItemDefs[165]},
+    /* GenericDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[64], (void*)&g_avidItemDefs[132]},
+    {NULL, (void*)&g_avidItemDefs[231]},
+    /* FileDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[66], (void*)&g_avidItemDefs[213]},
+    {(MXFListElement*)&g_avidItemDefElements[67], (void*)&g_avidItemDefs[25]},
+    {(MXFListElement*)&g_avidItemDefElements[68], (void*)&g_avidItemDefs[26]},
+    {(MXFListElement*)&g_avidItemDefElements[69], (void*)&g_avidItemDefs[109]},
+    {NULL, (void*)&g_avidItemDefs[110]},
+    /* GenericPictureEssenceDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[71], (void*)&g_avidItemDefs[212]},
+    {(MXFListElement*)&g_avidItemDefElements[72], (void*)&g_avidItemDefs[7]},
+    {(MXFListElement*)&g_avidItemDefElements[73], (void*)&g_avidItemDefs[19]},
+    {(MXFListElement*)&g_avidItemDefElements[74], (void*)&g_avidItemDefs[18]},
+    {(MXFListElement*)&g_avidItemDefElements[75], (void*)&g_avidItemDefs[179]},
+    {(MXFListElement*)&g_avidItemDefElements[76], (void*)&g_avidItemDefs[11]},
+    {(MXFListElement*)&g_avidItemDefElements[77], (void*)&g_avidItemDefs[10]},
+    {(MXFListElement*)&g_avidItemDefElements[78], (void*)&g_avidItemDefs[12]},
+    {(MXFListElement*)&g_avidItemDefElements[79], (void*)&g_avidItemDefs[13]},
+    {(MXFListElement*)&g_avidItemDefElements[80], (void*)&g_avidItemDefs[14]},
+    {(MXFListElement*)&g_avidItemDefElements[81], (void*)&g_avidItemDefs[15]},
+    {(MXFListElement*)&g_avidItemDefElements[82], (void*)&g_avidItemDefs[16]},
+    {(MXFListElement*)&g_avidItemDefElements[83], (void*)&g_avidItemDefs[17]},
+    {(MXFListElement*)&g_avidItemDefElements[84], (void*)&g_avidItemDefs[178]},
+    {(MXFListElement*)&g_avidItemDefElements[85], (void*)&g_avidItemDefs[6]},
+    {(MXFListElement*)&g_avidItemDefElements[86], (void*)&g_avidItemDefs[180]},
+    {(MXFListElement*)&g_avidItemDefElements[87], (void*)&g_avidItemDefs[60]},
+    {(MXFListElement*)&g_avidItemDefElements[88], (void*)&g_avidItemDefs[76]},
+    {(MXFListElement*)&g_avidItemDefElements[89], (void*)&g_avidItemDefs[57]},
+    {(MXFListElement*)&g_avidItemDefElements[90], (void*)&g_avidItemDefs[72]},
+    {(MXFListElement*)&g_avidItemDefElements[91], (void*)&g_avidItemDefs[73]},
+    {(MXFListElement*)&g_avidItemDefElements[92], (void*)&g_avidItemDefs[74]},
+    {(MXFListElement*)&g_avidItemDefElements[93], (void*)&g_avidItemDefs[59]},
+    {(MXFListElement*)&g_avidItemDefElements[94], (void*)&g_avidItemDefs[68]},
+    {(MXFListElement*)&g_avidItemDefElements[95], (void*)&g_avidItemDefs[58]},
+    {(MXFListElement*)&g_avidItemDefElements[96], (void*)&g_avidItemDefs[230]},
+    {(MXFListElement*)&g_avidItemDefElements[97], (void*)&g_avidItemDefs[354]},
+    {(MXFListElement*)&g_avidItemDefElements[98], (void*)&g_avidItemDefs[355]},
+    {(MXFListElement*)&g_avidItemDefElements[99], (void*)&g_avidItemDefs[356]},
+    {(MXFListElement*)&g_avidItemDefElements[100], (void*)&g_avidItemDefs[357]},
+    {(MXFListElement*)&g_avidItemDefElements[101], (void*)&g_avidItemDefs[281]},
+    {(MXFListElement*)&g_avidItemDefElements[102], (void*)&g_avidItemDefs[282]},
+    {(MXFListElement*)&g_avidItemDefElements[103], (void*)&g_avidItemDefs[283]},
+    {(MXFListElement*)&g_avidItemDefElements[104], (void*)&g_avidItemDefs[284]},
+    {(MXFListElement*)&g_avidItemDefElements[105], (void*)&g_avidItemDefs[280]},
+    {(MXFListElement*)&g_avidItemDefElements[106], (void*)&g_avidItemDefs[363]},
+    {(MXFListElement*)&g_avidItemDefElements[107], (void*)&g_avidItemDefs[366]},
+    {(MXFListElement*)&g_avidItemDefElements[108], (void*)&g_avidItemDefs[365]},
+    {NULL, (void*)&g_avidItemDefs[364]},
+    /* CDCIEssenceDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[110], (void*)&g_avidItemDefs[67]},
+    {(MXFListElement*)&g_avidItemDefElements[111], (void*)&g_avidItemDefs[8]},
+    {(MXFListElement*)&g_avidItemDefElements[112], (void*)&g_avidItemDefs[61]},
+    {(MXFListElement*)&g_avidItemDefElements[113], (void*)&g_avidItemDefs[9]},
+    {(MXFListElement*)&g_avidItemDefElements[114], (void*)&g_avidItemDefs[177]},
+    {(MXFListElement*)&g_avidItemDefElements[115], (void*)&g_avidItemDefs[75]},
+    {(MXFListElement*)&g_avidItemDefElements[116], (void*)&g_avidItemDefs[64]},
+    {(MXFListElement*)&g_avidItemDefElements[117], (void*)&g_avidItemDefs[20]},
+    {(MXFListElement*)&g_avidItemDefElements[118], (void*)&g_avidItemDefs[21]},
+    {NULL, (void*)&g_avidItemDefs[62]},
+    /* RGBAEssenceDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[120], (void*)&g_avidItemDefs[182]},
+    {(MXFListElement*)&g_avidItemDefElements[121], (void*)&g_avidItemDefs[183]},
+    {(MXFListElement*)&g_avidItemDefElements[122], (void*)&g_avidItemDefs[184]},
+    {(MXFListElement*)&g_avidItemDefElements[123], (void*)&g_avidItemDefs[185]},
+    {(MXFListElement*)&g_avidItemDefElements[124], (void*)&g_avidItemDefs[181]},
+    {(MXFListElement*)&g_avidItemDefElements[125], (void*)&g_avidItemDefs[63]},
+    {(MXFListElement*)&g_avidItemDefElements[126], (void*)&g_avidItemDefs[65]},
+    {NULL, (void*)&g_avidItemDefs[66]},
+    /* TapeDescriptor */
+    {NULL, (void*)&g_avidItemDefs[369]},
+    /* Preface */
+    {(MXFListElement*)&g_avidItemDefElements[129], (void*)&g_avidItemDefs[162]},
+    {(MXFListElement*)&g_avidItemDefElements[130], (void*)&g_avidItemDefs[39]},
+    {(MXFListElement*)&g_avidItemDefElements[131], (void*)&g_avidItemDefs[38]},
+    {(MXFListElement*)&g_avidItemDefElements[132], (void*)&g_avidItemDefs[171]},
+    {(MXFListElement*)&g_avidItemDefElements[133], (void*)&g_avidItemDefs[133]},
+    {(MXFListElement*)&g_avidItemDefElements[134], (void*)&g_avidItemDefs[113]},
+    {(MXFListElement*)&g_avidItemDefElements[135], (void*)&g_avidItemDefs[173]},
+    {(MXFListElement*)&g_avidItemDefElements[136], (void*)&g_avidItemDefs[174]},
+    {(MXFListElement*)&g_avidItemDefElements[137], (void*)&g_avidItemDefs[175]},
+    {(MXFListElement*)&g_avidItemDefElements[138], (void*)&g_avidItemDefs[353]},
+    {(MXFListElement*)&g_avidItemDefElements[139], (void*)&g_avidItemDefs[114]},
+    {(MXFListElement*)&g_avidItemDefElements[140], (void*)&g_avidItemDefs[4]},
+    {(MXFListElement*)&g_avidItemDefElements[141], (void*)&g_avidItemDefs[370]},
+    {(MXFListElement*)&g_avidItemDefElements[142], (void*)&g_avidItemDefs[359]},
+    {(MXFListElement*)&g_avidItemDefElements[143], (void*)&g_avidItemDefs[372]},
+    {NULL, (void*)&g_avidItemDefs[358]},
+    /* Identification */
+    {(MXFListElement*)&g_avidItemDefElements[145], (void*)&g_avidItemDefs[77]},
+    {(MXFListElement*)&g_avidItemDefElements[146], (void*)&g_avidItemDefs[78]},
+    {(MXFListElement*)&g_avidItemDefElements[147], (void*)&g_avidItemDefs[79]},
+    {(MXFListElement*)&g_avidItemDefElements[148], (void*)&g_avidItemDefs[80]},
+    {(MXFListElement*)&g_avidItemDefElements[149], (void*)&g_avidItemDefs[81]},
+    {(MXFListElement*)&g_avidItemDefElements[150], (void*)&g_avidItemDefs[83]},
+    {(MXFListElement*)&g_avidItemDefElements[151], (void*)&g_avidItemDefs[161]},
+    {(MXFListElement*)&g_avidItemDefElements[152], (void*)&g_avidItemDefs[85]},
+    {NULL, (void*)&g_avidItemDefs[82]},
+    /* NetworkLocator */
+    {NULL, (void*)&g_avidItemDefs[2]},
+    /* TextLocator */
+    {NULL, (void*)&g_avidItemDefs[31]},
+    /* GenericPackage */
+    {(MXFListElement*)&g_avidItemDefElements[156], (void*)&g_avidItemDefs[1]},
+    {(MXFListElement*)&g_avidItemDefElements[157], (void*)&g_avidItemDefs[3]},
+    {(MXFListElement*)&g_avidItemDefElements[158], (void*)&g_avidItemDefs[160]},
+    {(MXFListElement*)&g_avidItemDefElements[159], (void*)&g_avidItemDefs[163]},
+    {(MXFListElement*)&g_avidItemDefElements[160], (void*)&g_avidItemDefs[134]},
+    {(MXFListElement*)&g_avidItemDefElements[161], (void*)&g_avidItemDefs[52]},
+    {(MXFListElement*)&g_avidItemDefElements[162], (void*)&g_avidItemDefs[371]},
+    {(MXFListElement*)&g_avidItemDefElements[163], (void*)&g_avidItemDefs[362]},
+    {NULL, (void*)&g_avidItemDefs[360]},
+    /* SourcePackage */
+    {NULL, (void*)&g_avidItemDefs[115]},
+    /* GenericTrack */
+    {(MXFListElement*)&g_avidItemDefElements[166], (void*)&g_avidItemDefs[33]},
+    {(MXFListElement*)&g_avidItemDefElements[167], (void*)&g_avidItemDefs[32]},
+    {(MXFListElement*)&g_avidItemDefElements[168], (void*)&g_avidItemDefs[34]},
+    {NULL, (void*)&g_avidItemDefs[116]},
+    /* EventTrack */
+    {(MXFListElement*)&g_avidItemDefElements[170], (void*)&g_avidItemDefs[101]},
+    {NULL, (void*)&g_avidItemDefs[215]},
+    /* Track */
+    {(MXFListElement*)&g_avidItemDefElements[172], (void*)&g_avidItemDefs[103]},
+    {NULL, (void*)&g_avidItemDefs[156]},
+    /* TaggedValue */
+    {(MXFListElement*)&g_avidItemDefElements[174], (void*)&g_avidItemDefs[50]},
+    {(MXFListElement*)&g_avidItemDefElements[175], (void*)&g_avidItemDefs[51]},
+    {NULL, (void*)&g_avidItemDefs[361]},
+    /* DMSegment */
+    {(MXFListElement*)&g_avidItemDefElements[177], (void*)&g_avidItemDefs[159]},
+    {(MXFListElement*)&g_avidItemDefElements[178], (void*)&g_avidItemDefs[102]},
+    {(MXFListElement*)&g_avidItemDefElements[179], (void*)&g_avidItemDefs[168]},
+    {(MXFListElement*)&g_avidItemDefElements[180], (void*)&g_avidItemDefs[214]},
+    {NULL, (void*)&g_avidItemDefs[367]},
+    /* GenericSoundEssenceDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[182], (void*)&g_avidItemDefs[197]},
+    {(MXFListElement*)&g_avidItemDefElements[183], (void*)&g_avidItemDefs[169]},
+    {(MXFListElement*)&g_avidItemDefElements[184], (void*)&g_avidItemDefs[23]},
+    {(MXFListElement*)&g_avidItemDefElements[185], (void*)&g_avidItemDefs[22]},
+    {(MXFListElement*)&g_avidItemDefElements[186], (void*)&g_avidItemDefs[196]},
+    {(MXFListElement*)&g_avidItemDefElements[187], (void*)&g_avidItemDefs[170]},
+    {(MXFListElement*)&g_avidItemDefElements[188], (void*)&g_avidItemDefs[210]},
+    {(MXFListElement*)&g_avidItemDefElements[189], (void*)&g_avidItemDefs[69]},
+    {(MXFListElement*)&g_avidItemDefElements[190], (void*)&g_avidItemDefs[320]},
+    {NULL, (void*)&g_avidItemDefs[321]},
+    /* GenericDataEssenceDescriptor */
+    {NULL, (void*)&g_avidItemDefs[211]},
+    /* MultipleDescriptor */
+    {NULL, (void*)&g_avidItemDefs[172]},
+    /* DMSourceClip */
+    {NULL, (void*)&g_avidItemDefs[176]},
+    /* AES3AudioDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[195], (void*)&g_avidItemDefs[207]},
+    {(MXFListElement*)&g_avidItemDefElements[196], (void*)&g_avidItemDefs[200]},
+    {(MXFListElement*)&g_avidItemDefElements[197], (void*)&g_avidItemDefs[202]},
+    {(MXFListElement*)&g_avidItemDefElements[198], (void*)&g_avidItemDefs[203]},
+    {(MXFListElement*)&g_avidItemDefElements[199], (void*)&g_avidItemDefs[204]},
+    {(MXFListElement*)&g_avidItemDefElements[200], (void*)&g_avidItemDefs[205]},
+    {(MXFListElement*)&g_avidItemDefElements[201], (void*)&g_avidItemDefs[206]},
+    {(MXFListElement*)&g_avidItemDefElements[202], (void*)&g_avidItemDefs[208]},
+    {NULL, (void*)&g_avidItemDefs[209]},
+    /* WaveAudioDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[204], (void*)&g_avidItemDefs[198]},
+    {(MXFListElement*)&g_avidItemDefElements[205], (void*)&g_avidItemDefs[199]},
+    {(MXFListElement*)&g_avidItemDefElements[206], (void*)&g_avidItemDefs[201]},
+    {(MXFListElement*)&g_avidItemDefElements[207], (void*)&g_avidItemDefs[216]},
+    {(MXFListElement*)&g_avidItemDefElements[208], (void*)&g_avidItemDefs[221]},
+    {(MXFListElement*)&g_avidItemDefElements[209], (void*)&g_avidItemDefs[222]},
+    {(MXFListElement*)&g_avidItemDefElements[210], (void*)&g_avidItemDefs[223]},
+    {(MXFListElement*)&g_avidItemDefElements[211], (void*)&g_avidItemDefs[224]},
+    {(MXFListElement*)&g_avidItemDefElements[212], (void*)&g_avidItemDefs[225]},
+    {(MXFListElement*)&g_avidItemDefElements[213], (void*)&g_avidItemDefs[226]},
+    {(MXFListElement*)&g_avidItemDefElements[214], (void*)&g_avidItemDefs[227]},
+    {(MXFListElement*)&g_avidItemDefElements[215], (void*)&g_avidItemDefs[228]},
+    {NULL, (void*)&g_avidItemDefs[229]},
+    /* MPEGVideoDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[217], (void*)&g_avidItemDefs[186]},
+    {(MXFListElement*)&g_avidItemDefElements[218], (void*)&g_avidItemDefs[187]},
+    {(MXFListElement*)&g_avidItemDefElements[219], (void*)&g_avidItemDefs[188]},
+    {(MXFListElement*)&g_avidItemDefElements[220], (void*)&g_avidItemDefs[189]},
+    {(MXFListElement*)&g_avidItemDefElements[221], (void*)&g_avidItemDefs[190]},
+    {(MXFListElement*)&g_avidItemDefElements[222], (void*)&g_avidItemDefs[191]},
+    {(MXFListElement*)&g_avidItemDefElements[223], (void*)&g_avidItemDefs[192]},
+    {(MXFListElement*)&g_avidItemDefElements[224], (void*)&g_avidItemDefs[193]},
+    {(MXFListElement*)&g_avidItemDefElements[225], (void*)&g_avidItemDefs[195]},
+    {NULL, (void*)&g_avidItemDefs[194]},
+    /* JPEG2000SubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[227], (void*)&g_avidItemDefs[232]},
+    {(MXFListElement*)&g_avidItemDefElements[228], (void*)&g_avidItemDefs[233]},
+    {(MXFListElement*)&g_avidItemDefElements[229], (void*)&g_avidItemDefs[234]},
+    {(MXFListElement*)&g_avidItemDefElements[230], (void*)&g_avidItemDefs[235]},
+    {(MXFListElement*)&g_avidItemDefElements[231], (void*)&g_avidItemDefs[236]},
+    {(MXFListElement*)&g_avidItemDefElements[232], (void*)&g_avidItemDefs[237]},
+    {(MXFListElement*)&g_avidItemDefElements[233], (void*)&g_avidItemDefs[238]},
+    {(MXFListElement*)&g_avidItemDefElements[234], (void*)&g_avidItemDefs[239]},
+    {(MXFListElement*)&g_avidItemDefElements[235], (void*)&g_avidItemDefs[240]},
+    {(MXFListElement*)&g_avidItemDefElements[236], (void*)&g_avidItemDefs[241]},
+    {(MXFListElement*)&g_avidItemDefElements[237], (void*)&g_avidItemDefs[242]},
+    {(MXFListElement*)&g_avidItemDefElements[238], (void*)&g_avidItemDefs[243]},
+    {(MXFListElement*)&g_avidItemDefElements[239], (void*)&g_avidItemDefs[244]},
+    {(MXFListElement*)&g_avidItemDefElements[240], (void*)&g_avidItemDefs[285]},
+    {(MXFListElement*)&g_avidItemDefElements[241], (void*)&g_avidItemDefs[286]},
+    {(MXFListElement*)&g_avidItemDefElements[242], (void*)&g_avidItemDefs[287]},
+    {NULL, (void*)&g_avidItemDefs[288]},
+    /* DCTimedTextDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[244], (void*)&g_avidItemDefs[245]},
+    {(MXFListElement*)&g_avidItemDefElements[245], (void*)&g_avidItemDefs[220]},
+    {(MXFListElement*)&g_avidItemDefElements[246], (void*)&g_avidItemDefs[270]},
+    {NULL, (void*)&g_avidItemDefs[247]},
+    /* DCTimedTextResourceSubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[248], (void*)&g_avidItemDefs[246]},
+    {(MXFListElement*)&g_avidItemDefElements[249], (void*)&g_avidItemDefs[217]},
+    {NULL, (void*)&g_avidItemDefs[166]},
+    /* MCALabelSubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[251], (void*)&g_avidItemDefs[257]},
+    {(MXFListElement*)&g_avidItemDefElements[252], (void*)&g_avidItemDefs[258]},
+    {(MXFListElement*)&g_avidItemDefElements[253], (void*)&g_avidItemDefs[259]},
+    {(MXFListElement*)&g_avidItemDefElements[254], (void*)&g_avidItemDefs[260]},
+    {(MXFListElement*)&g_avidItemDefElements[255], (void*)&g_avidItemDefs[262]},
+    {(MXFListElement*)&g_avidItemDefElements[256], (void*)&g_avidItemDefs[264]},
+    {(MXFListElement*)&g_avidItemDefElements[257], (void*)&g_avidItemDefs[265]},
+    {(MXFListElement*)&g_avidItemDefElements[258], (void*)&g_avidItemDefs[266]},
+    {(MXFListElement*)&g_avidItemDefElements[259], (void*)&g_avidItemDefs[267]},
+    {(MXFListElement*)&g_avidItemDefElements[260], (void*)&g_avidItemDefs[268]},
+    {(MXFListElement*)&g_avidItemDefElements[261], (void*)&g_avidItemDefs[269]},
+    {(MXFListElement*)&g_avidItemDefElements[262], (void*)&g_avidItemDefs[250]},
+    {(MXFListElement*)&g_avidItemDefElements[263], (void*)&g_avidItemDefs[271]},
+    {(MXFListElement*)&g_avidItemDefElements[264], (void*)&g_avidItemDefs[272]},
+    {(MXFListElement*)&g_avidItemDefElements[265], (void*)&g_avidItemDefs[273]},
+    {(MXFListElement*)&g_avidItemDefElements[266], (void*)&g_avidItemDefs[274]},
+    {(MXFListElement*)&g_avidItemDefElements[267], (void*)&g_avidItemDefs[275]},
+    {(MXFListElement*)&g_avidItemDefElements[268], (void*)&g_avidItemDefs[276]},
+    {(MXFListElement*)&g_avidItemDefElements[269], (void*)&g_avidItemDefs[277]},
+    {(MXFListElement*)&g_avidItemDefElements[270], (void*)&g_avidItemDefs[278]},
+    {NULL, (void*)&g_avidItemDefs[279]},
+    /* AudioChannelLabelSubDescriptor */
+    {NULL, (void*)&g_avidItemDefs[263]},
+    /* SoundfieldGroupLabelSubDescriptor */
+    {NULL, (void*)&g_avidItemDefs[261]},
+    /* AVCSubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[274], (void*)&g_avidItemDefs[299]},
+    {(MXFListElement*)&g_avidItemDefElements[275], (void*)&g_avidItemDefs[289]},
+    {(MXFListElement*)&g_avidItemDefElements[276], (void*)&g_avidItemDefs[290]},
+    {(MXFListElement*)&g_avidItemDefElements[277], (void*)&g_avidItemDefs[291]},
+    {(MXFListElement*)&g_avidItemDefElements[278], (void*)&g_avidItemDefs[292]},
+    {(MXFListElement*)&g_avidItemDefElements[279], (void*)&g_avidItemDefs[293]},
+    {(MXFListElement*)&g_avidItemDefElements[280], (void*)&g_avidItemDefs[294]},
+    {(MXFListElement*)&g_avidItemDefElements[281], (void*)&g_avidItemDefs[296]},
+    {(MXFListElement*)&g_avidItemDefElements[282], (void*)&g_avidItemDefs[303]},
+    {(MXFListElement*)&g_avidItemDefElements[283], (void*)&g_avidItemDefs[295]},
+    {(MXFListElement*)&g_avidItemDefElements[284], (void*)&g_avidItemDefs[297]},
+    {(MXFListElement*)&g_avidItemDefElements[285], (void*)&g_avidItemDefs[298]},
+    {(MXFListElement*)&g_avidItemDefElements[286], (void*)&g_avidItemDefs[300]},
+    {(MXFListElement*)&g_avidItemDefElements[287], (void*)&g_avidItemDefs[301]},
+    {NULL, (void*)&g_avidItemDefs[302]},
+    /* VC2SubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[289], (void*)&g_avidItemDefs[304]},
+    {(MXFListElement*)&g_avidItemDefElements[290], (void*)&g_avidItemDefs[305]},
+    {(MXFListElement*)&g_avidItemDefElements[291], (void*)&g_avidItemDefs[306]},
+    {(MXFListElement*)&g_avidItemDefElements[292], (void*)&g_avidItemDefs[307]},
+    {(MXFListElement*)&g_avidItemDefElements[293], (void*)&g_avidItemDefs[308]},
+    {(MXFListElement*)&g_avidItemDefElements[294], (void*)&g_avidItemDefs[309]},
+    {NULL, (void*)&g_avidItemDefs[310]},
+    /* JPEGXSSubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[296], (void*)&g_avidItemDefs[311]},
+    {(MXFListElement*)&g_avidItemDefElements[297], (void*)&g_avidItemDefs[312]},
+    {(MXFListElement*)&g_avidItemDefElements[298], (void*)&g_avidItemDefs[313]},
+    {(MXFListElement*)&g_avidItemDefElements[299], (void*)&g_avidItemDefs[314]},
+    {(MXFListElement*)&g_avidItemDefElements[300], (void*)&g_avidItemDefs[315]},
+    {(MXFListElement*)&g_avidItemDefElements[301], (void*)&g_avidItemDefs[316]},
+    {(MXFListElement*)&g_avidItemDefElements[302], (void*)&g_avidItemDefs[317]},
+    {(MXFListElement*)&g_avidItemDefElements[303], (void*)&g_avidItemDefs[318]},
+    {NULL, (void*)&g_avidItemDefs[319]},
+    /* MGASoundEssenceDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[305], (void*)&g_avidItemDefs[322]},
+    {(MXFListElement*)&g_avidItemDefElements[306], (void*)&g_avidItemDefs[323]},
+    {NULL, (void*)&g_avidItemDefs[324]},
+    /* MGAAudioMetadataSubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[308], (void*)&g_avidItemDefs[325]},
+    {(MXFListElement*)&g_avidItemDefElements[309], (void*)&g_avidItemDefs[326]},
+    {(MXFListElement*)&g_avidItemDefElements[310], (void*)&g_avidItemDefs[327]},
+    {NULL, (void*)&g_avidItemDefs[328]},
+    /* MGASoundfieldGroupLabelSubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[312], (void*)&g_avidItemDefs[329]},
+    {(MXFListElement*)&g_avidItemDefElements[313], (void*)&g_avidItemDefs[330]},
+    {(MXFListElement*)&g_avidItemDefElements[314], (void*)&g_avidItemDefs[331]},
+    {NULL, (void*)&g_avidItemDefs[332]},
+    /* SADMAudioMetadataSubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[316], (void*)&g_avidItemDefs[333]},
+    {NULL, (void*)&g_avidItemDefs[334]},
+    /* RIFFChunkDefinitionSubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[318], (void*)&g_avidItemDefs[335]},
+    {(MXFListElement*)&g_avidItemDefElements[319], (void*)&g_avidItemDefs[336]},
+    {(MXFListElement*)&g_avidItemDefElements[320], (void*)&g_avidItemDefs[337]},
+    {NULL, (void*)&g_avidItemDefs[338]},
+    /* ADM_CHNASubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[322], (void*)&g_avidItemDefs[340]},
+    {(MXFListElement*)&g_avidItemDefElements[323], (void*)&g_avidItemDefs[341]},
+    {NULL, (void*)&g_avidItemDefs[342]},
+    /* ADMChannelMapping */
+    {(MXFListElement*)&g_avidItemDefElements[325], (void*)&g_avidItemDefs[343]},
+    {(MXFListElement*)&g_avidItemDefElements[326], (void*)&g_avidItemDefs[344]},
+    {(MXFListElement*)&g_avidItemDefElements[327], (void*)&g_avidItemDefs[345]},
+    {NULL, (void*)&g_avidItemDefs[346]},
+    /* RIFFChunkReferencesSubDescriptor */
+    {NULL, (void*)&g_avidItemDefs[339]},
+    /* ADMAudioMetadataSubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[330], (void*)&g_avidItemDefs[347]},
+    {NULL, (void*)&g_avidItemDefs[348]},
+    /* ADMSoundfieldGroupLabelSubDescriptor */
+    {(MXFListElement*)&g_avidItemDefElements[332], (void*)&g_avidItemDefs[349]},
+    {(MXFListElement*)&g_avidItemDefElements[333], (void*)&g_avidItemDefs[350]},
+    {(MXFListElement*)&g_avidItemDefElements[334], (void*)&g_avidItemDefs[351]},
+    {NULL, (void*)&g_avidItemDefs[352]},
+    /* ClassDefinition */
+    {(MXFListElement*)&g_avidItemDefElements[336], (void*)&g_avidItemDefs[137]},
+    {(MXFListElement*)&g_avidItemDefElements[337], (void*)&g_avidItemDefs[138]},
+    {NULL, (void*)&g_avidItemDefs[139]},
+    /* PropertyDefinition */
+    {(MXFListElement*)&g_avidItemDefElements[339], (void*)&g_avidItemDefs[140]},
+    {(MXFListElement*)&g_avidItemDefElements[340], (void*)&g_avidItemDefs[40]},
+    {(MXFListElement*)&g_avidItemDefElements[341], (void*)&g_avidItemDefs[141]},
+    {NULL, (void*)&g_avidItemDefs[142]},
+    /* TypeDefinitionInteger */
+    {(MXFListElement*)&g_avidItemDefElements[343], (void*)&g_avidItemDefs[41]},
+    {NULL, (void*)&g_avidItemDefs[42]},
+    /* TypeDefinitionStrongObjectReference */
+    {NULL, (void*)&g_avidItemDefs[145]},
+    /* TypeDefinitionWeakObjectReference */
+    {(MXFListElement*)&g_avidItemDefElements[346], (void*)&g_avidItemDefs[146]},
+    {NULL, (void*)&g_avidItemDefs[49]},
+    /* TypeDefinitionEnumeration */
+    {(MXFListElement*)&g_avidItemDefElements[348], (void*)&g_avidItemDefs[147]},
+    {(MXFListElement*)&g_avidItemDefElements[349], (void*)&g_avidItemDefs[44]},
+    {NULL, (void*)&g_avidItemDefs[45]},
+    /* TypeDefinitionFixedArray */
+    {(MXFListElement*)&g_avidItemDefElements[351], (void*)&g_avidItemDefs[148]},
+    {NULL, (void*)&g_avidItemDefs[43]},
+    /* TypeDefinitionVariableArray */
+    {NULL, (void*)&g_avidItemDefs[149]},
+    /* TypeDefinitionSet */
+    {NULL, (void*)&g_avidItemDefs[150]},
+    /* TypeDefinitionString */
+    {NULL, (void*)&g_avidItemDefs[151]},
+    /* TypeDefinitionRecord */
+    {(MXFListElement*)&g_avidItemDefElements[356], (void*)&g_avidItemDefs[152]},
+    {NULL, (void*)&g_avidItemDefs[46]},
+    /* TypeDefinitionRename */
+    {NULL, (void*)&g_avidItemDefs[153]},
+    /* TypeDefinitionExtendibleEnumeration */
+    {(MXFListElement*)&g_avidItemDefElements[359], (void*)&g_avidItemDefs[47]},
+    {NULL, (void*)&g_avidItemDefs[48]},
+    /* MetaDefinition */
+    {(MXFListElement*)&g_avidItemDefElements[361], (void*)&g_avidItemDefs[154]},
+    {(MXFListElement*)&g_avidItemDefElements[362], (void*)&g_avidItemDefs[54]},
+    {NULL, (void*)&g_avidItemDefs[155]},
+    /* MetaDictionary */
+    {(MXFListElement*)&g_avidItemDefElements[364], (void*)&g_avidItemDefs[143]},
+    {NULL, (void*)&g_avidItemDefs[144]},
+    /* TextBasedDMFramework */
+    {NULL, (void*)&g_avidItemDefs[256]},
+    /* GenericStreamTextBasedSet */
+    {NULL, (void*)&g_avidItemDefs[248]},
+    /* UTF8TextBasedSet */
+    {NULL, (void*)&g_avidItemDefs[251]},
+    /* UTF16TextBasedSet */
+    {NULL, (void*)&g_avidItemDefs[252]},
+    /* TextBasedObject */
+    {(MXFListElement*)&g_avidItemDefElements[370], (void*)&g_avidItemDefs[254]},
+    {(MXFListElement*)&g_avidItemDefElements[371], (void*)&g_avidItemDefs[255]},
+    {(MXFListElement*)&g_avidItemDefElements[372], (void*)&g_avidItemDefs[249]},
+    {NULL, (void*)&g_avidItemDefs[253]},
+};
+
+static const MXFSetDef g_avidSetDefs[103] =
+{
+    {(char*)"root",
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        NULL},
+    {(char*)"InterchangeObject",
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[0], (MXFListElement*)&g_avidItemDefElements[1], 2, NULL, NULL},
+        NULL},
+    {(char*)"StructuralComponent",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[2], (MXFListElement*)&g_avidItemDefElements[3], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"EdgeCode",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[2]},
+    {(char*)"EssenceGroup",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[4], (MXFListElement*)&g_avidItemDefElements[6], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[2]},
+    {(char*)"Filler",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[2]},
+    {(char*)"Sequence",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[7], (MXFListElement*)&g_avidItemDefElements[7], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[2]},
+    {(char*)"SourceClip",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[8], (MXFListElement*)&g_avidItemDefElements[10], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[2]},
+    {(char*)"TimecodeComponent",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[11], (MXFListElement*)&g_avidItemDefElements[13], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[2]},
+    {(char*)"ContentStorage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x18, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[14], (MXFListElement*)&g_avidItemDefElements[15], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"DefinitionObject",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[16], (MXFListElement*)&g_avidItemDefElements[18], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"DataDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1b, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[10]},
+    {(char*)"OperationDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1c, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[19], (MXFListElement*)&g_avidItemDefElements[25], 7, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[10]},
+    {(char*)"ParameterDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1d, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[26], (MXFListElement*)&g_avidItemDefElements[27], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[10]},
+    {(char*)"PluginDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1e, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[28], (MXFListElement*)&g_avidItemDefElements[47], 20, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[10]},
+    {(char*)"CodecDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[48], (MXFListElement*)&g_avidItemDefElements[49], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[10]},
+    {(char*)"ContainerDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x20, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[50], (MXFListElement*)&g_avidItemDefElements[50], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[10]},
+    {(char*)"InterpolationDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x21, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[10]},
+    {(char*)"Dictionary",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x22, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[51], (MXFListElement*)&g_avidItemDefElements[59], 9, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"EssenceContainerData",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[60], (MXFListElement*)&g_avidItemDefElements[62], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"GenericDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[63], (MXFListElement*)&g_avidItemDefElements[64], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"FileDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[65], (MXFListElement*)&g_avidItemDefElements[69], 5, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[20]},
+    {(char*)"GenericPictureEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[70], (MXFListElement*)&g_avidItemDefElements[108], 39, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[21]},
+    {(char*)"CDCIEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[109], (MXFListElement*)&g_avidItemDefElements[118], 10, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[22]},
+    {(char*)"RGBAEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x29, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[119], (MXFListElement*)&g_avidItemDefElements[126], 8, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[22]},
+    {(char*)"TapeDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x49, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2e, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[127], (MXFListElement*)&g_avidItemDefElements[127], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[46]},
+    {(char*)"Preface",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2f, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[128], (MXFListElement*)&g_avidItemDefElements[143], 16, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"Identification",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x30, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[144], (MXFListElement*)&g_avidItemDefElements[152], 9, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"Locator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"NetworkLocator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x32, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[153], (MXFListElement*)&g_avidItemDefElements[153], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[28]},
+    {(char*)"TextLocator",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x33, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[154], (MXFListElement*)&g_avidItemDefElements[154], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[28]},
+    {(char*)"GenericPackage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[155], (MXFListElement*)&g_avidItemDefElements[163], 9, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"MaterialPackage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x36, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[31]},
+    {(char*)"SourcePackage",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x37, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[164], (MXFListElement*)&g_avidItemDefElements[164], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[31]},
+    {(char*)"GenericTrack",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[165], (MXFListElement*)&g_avidItemDefElements[168], 4, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"EventTrack",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x39, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[169], (MXFListElement*)&g_avidItemDefElements[170], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[34]},
+    {(char*)"StaticTrack",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[34]},
+    {(char*)"Track",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x38, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[171], (MXFListElement*)&g_avidItemDefElements[172], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[34]},
+    {(char*)"TaggedValue",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3f, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[173], (MXFListElement*)&g_avidItemDefElements[175], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"DMSegment",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x41, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[176], (MXFListElement*)&g_avidItemDefElements[180], 5, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[2]},
+    {(char*)"GenericSoundEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[181], (MXFListElement*)&g_avidItemDefElements[190], 10, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[21]},
+    {(char*)"GenericDataEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[191], (MXFListElement*)&g_avidItemDefElements[191], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[21]},
+    {(char*)"MultipleDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x44, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[192], (MXFListElement*)&g_avidItemDefElements[192], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[21]},
+    {(char*)"DMSourceClip",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x45, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[193], (MXFListElement*)&g_avidItemDefElements[193], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[7]},
+    {(char*)"AES3AudioDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[194], (MXFListElement*)&g_avidItemDefElements[202], 9, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[45]},
+    {(char*)"WaveAudioDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[203], (MXFListElement*)&g_avidItemDefElements[215], 13, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[40]},
+    {(char*)"PhysicalDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x49, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[20]},
+    {(char*)"ImportDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x49, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4a, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[46]},
+    {(char*)"RecordingDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x49, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4b, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[46]},
+    {(char*)"TaggedValueDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[10]},
+    {(char*)"KLVDataDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4d, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[10]},
+    {(char*)"MPEGVideoDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x51, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[216], (MXFListElement*)&g_avidItemDefElements[225], 10, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[23]},
+    {(char*)"SubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"JPEG2000SubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5a, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[226], (MXFListElement*)&g_avidItemDefElements[242], 17, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"VBIDataDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5b, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[41]},
+    {(char*)"ANCDataDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x5c, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[41]},
+    {(char*)"DCTimedTextDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x43, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[243], (MXFListElement*)&g_avidItemDefElements[246], 4, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[41]},
+    {(char*)"DCTimedTextResourceSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x65, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[247], (MXFListElement*)&g_avidItemDefElements[249], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"ContainerConstraintsSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x67, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"MCALabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[250], (MXFListElement*)&g_avidItemDefElements[270], 21, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"AudioChannelLabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6b, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[271], (MXFListElement*)&g_avidItemDefElements[271], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[59]},
+    {(char*)"SoundfieldGroupLabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6c, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[272], (MXFListElement*)&g_avidItemDefElements[272], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[59]},
+    {(char*)"GroupOfSoundfieldGroupsLabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6a, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6d, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[59]},
+    {(char*)"AVCSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6e, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[273], (MXFListElement*)&g_avidItemDefElements[287], 15, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"VC2SubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x74, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[288], (MXFListElement*)&g_avidItemDefElements[294], 7, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"JPEGXSSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x02},
+        {(MXFListElement*)&g_avidItemDefElements[295], (MXFListElement*)&g_avidItemDefElements[303], 9, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"MGASoundEssenceDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x06},
+        {(MXFListElement*)&g_avidItemDefElements[304], (MXFListElement*)&g_avidItemDefElements[306], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[40]},
+    {(char*)"MGAAudioMetadataSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x07},
+        {(MXFListElement*)&g_avidItemDefElements[307], (MXFListElement*)&g_avidItemDefElements[310], 4, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"MGASoundfieldGroupLabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x08},
+        {(MXFListElement*)&g_avidItemDefElements[311], (MXFListElement*)&g_avidItemDefElements[314], 4, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[61]},
+    {(char*)"SADMAudioMetadataSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x09},
+        {(MXFListElement*)&g_avidItemDefElements[315], (MXFListElement*)&g_avidItemDefElements[316], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"RIFFChunkDefinitionSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0d},
+        {(MXFListElement*)&g_avidItemDefElements[317], (MXFListElement*)&g_avidItemDefElements[320], 4, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"ADM_CHNASubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0e},
+        {(MXFListElement*)&g_avidItemDefElements[321], (MXFListElement*)&g_avidItemDefElements[323], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"ADMChannelMapping",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x0f},
+        {(MXFListElement*)&g_avidItemDefElements[324], (MXFListElement*)&g_avidItemDefElements[327], 4, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"RIFFChunkReferencesSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x10},
+        {(MXFListElement*)&g_avidItemDefElements[328], (MXFListElement*)&g_avidItemDefElements[328], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"ADMAudioMetadataSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x59, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x11},
+        {(MXFListElement*)&g_avidItemDefElements[329], (MXFListElement*)&g_avidItemDefElements[330], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[52]},
+    {(char*)"ADMSoundfieldGroupLabelSubDescriptor",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x6c, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x12},
+        {(MXFListElement*)&g_avidItemDefElements[331], (MXFListElement*)&g_avidItemDefElements[334], 4, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[61]},
+    {(char*)"ClassDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x24, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[335], (MXFListElement*)&g_avidItemDefElements[337], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[94]},
+    {(char*)"PropertyDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x24, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[338], (MXFListElement*)&g_avidItemDefElements[341], 4, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[94]},
+    {(char*)"TypeDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x24, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[94]},
+    {(char*)"TypeDefinitionInteger",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x04, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[342], (MXFListElement*)&g_avidItemDefElements[343], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionStrongObjectReference",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x05, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[344], (MXFListElement*)&g_avidItemDefElements[344], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionWeakObjectReference",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x06, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[345], (MXFListElement*)&g_avidItemDefElements[346], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionEnumeration",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x07, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[347], (MXFListElement*)&g_avidItemDefElements[349], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionFixedArray",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x08, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[350], (MXFListElement*)&g_avidItemDefElements[351], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionVariableArray",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x09, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[352], (MXFListElement*)&g_avidItemDefElements[352], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionSet",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0a, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[353], (MXFListElement*)&g_avidItemDefElements[353], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionString",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0b, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[354], (MXFListElement*)&g_avidItemDefElements[354], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionStream",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0c, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionRecord",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0d, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[355], (MXFListElement*)&g_avidItemDefElements[356], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionRename",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x0e, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[357], (MXFListElement*)&g_avidItemDefElements[357], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionExtendibleEnumeration",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x20, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[358], (MXFListElement*)&g_avidItemDefElements[359], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionIndirect",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x21, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"TypeDefinitionOpaque",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x21, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x22, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[91]},
+    {(char*)"TypeDefinitionCharacter",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x23, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[78]},
+    {(char*)"MetaDefinition",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x24, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[360], (MXFListElement*)&g_avidItemDefElements[362], 3, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"MetaDictionary",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x02, 0x25, 0x00, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[363], (MXFListElement*)&g_avidItemDefElements[364], 2, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"DMSet",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"DMFramework",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00},
+        {NULL, NULL, 0, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[1]},
+    {(char*)"TextBasedDMFramework",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[365], (MXFListElement*)&g_avidItemDefElements[365], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[97]},
+    {(char*)"GenericStreamTextBasedSet",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x01, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[366], (MXFListElement*)&g_avidItemDefElements[366], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[102]},
+    {(char*)"UTF8TextBasedSet",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x02, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[367], (MXFListElement*)&g_avidItemDefElements[367], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[102]},
+    {(char*)"UTF16TextBasedSet",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x02, 0x03, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[368], (MXFListElement*)&g_avidItemDefElements[368], 1, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[102]},
+    {(char*)"TextBasedObject",
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x06, 0x0e, 0x2b, 0x34, 0x02, 0x53, 0x01, 0x01, 0x0d, 0x01, 0x04, 0x01, 0x04, 0x03, 0x01, 0x00},
+        {(MXFListElement*)&g_avidItemDefElements[369], (MXFListElement*)&g_avidItemDefElements[372], 4, NULL, NULL},
+        (MXFSetDef*)&g_avidSetDefs[96]},
+};
+
+static const MXFStaticDataModel g_avidStaticDataModel =
+{
+    g_avidItemTypes, ARRAY_SIZE(g_avidItemTypes),
+    g_avidItemDefs, ARRAY_SIZE(g_avidItemDefs),
+    g_avidSetDefs, ARRAY_SIZE(g_avidSetDefs),
+};
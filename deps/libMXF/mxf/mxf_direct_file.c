@@ -0,0 +1,401 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE     /* O_DIRECT */
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_direct_file.h>
+#include <mxf/mxf_macros.h>
+
+
+#define ALIGN_DOWN(v)   ((v) - (v) % MXF_DIRECT_FILE_ALIGNMENT)
+#define ALIGN_UP(v)     ALIGN_DOWN((v) + MXF_DIRECT_FILE_ALIGNMENT - 1)
+
+
+struct MXFFileSysData
+{
+    int fd;
+
+    uint8_t *buffer;        // aligned staging buffer
+    uint32_t bufferSize;
+    int haveBuffer;
+    int64_t bufferStart;    // aligned file offset of buffer
+    int64_t dirtyStart;     // file range in buffer that has not been written
+    int64_t dirtyEnd;
+
+    int64_t position;
+    int64_t fileSize;       // size of the file excluding any padding in the last block
+    int64_t diskSize;       // size of the file on disk, including padding
+};
+
+
+static int pwrite_all(int fd, const uint8_t *data, size_t count, int64_t offset)
+{
+    char errorBuf[128];
+    ssize_t numWrite;
+
+    while (count > 0) {
+        numWrite = pwrite(fd, data, count, (off_t)offset);
+        if (numWrite < 0) {
+            if (errno == EINTR)
+                continue;
+            mxf_log_error("pwrite failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            return 0;
+        }
+        data   += numWrite;
+        offset += numWrite;
+        count  -= numWrite;
+    }
+
+    return 1;
+}
+
+static int pread_all(int fd, uint8_t *data, size_t count, int64_t offset)
+{
+    char errorBuf[128];
+    ssize_t numRead;
+
+    while (count > 0) {
+        numRead = pread(fd, data, count, (off_t)offset);
+        if (numRead < 0) {
+            if (errno == EINTR)
+                continue;
+            mxf_log_error("pread failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            return 0;
+        }
+        if (numRead == 0)
+            break;
+        data   += numRead;
+        offset += numRead;
+        count  -= numRead;
+    }
+
+    return 1;
+}
+
+static int flush_buffer(MXFFileSysData *sysData)
+{
+    int64_t start, end;
+
+    if (sysData->dirtyEnd <= sysData->dirtyStart)
+        return 1;
+
+    /* write whole blocks; the buffer holds the file data either side of the dirty range */
+    start = ALIGN_DOWN(sysData->dirtyStart);
+    end   = ALIGN_UP(sysData->dirtyEnd);
+    if (!pwrite_all(sysData->fd, &sysData->buffer[start - sysData->bufferStart], (size_t)(end - start), start))
+        return 0;
+
+    if (end > sysData->diskSize)
+        sysData->diskSize = end;
+    sysData->dirtyStart = 0;
+    sysData->dirtyEnd   = 0;
+
+    return 1;
+}
+
+static int load_buffer(MXFFileSysData *sysData)
+{
+    int64_t start;
+
+    if (sysData->haveBuffer &&
+        sysData->position >= sysData->bufferStart &&
+        sysData->position < sysData->bufferStart + sysData->bufferSize)
+    {
+        return 1;
+    }
+
+    if (!flush_buffer(sysData))
+        return 0;
+    sysData->haveBuffer = 0;
+
+    start = ALIGN_DOWN(sysData->position);
+    memset(sysData->buffer, 0, sysData->bufferSize);
+    if (start < sysData->diskSize && !pread_all(sysData->fd, sysData->buffer, sysData->bufferSize, start))
+        return 0;
+
+    sysData->bufferStart = start;
+    sysData->haveBuffer  = 1;
+
+    return 1;
+}
+
+
+static int direct_file_flush(MXFFileSysData *sysData)
+{
+    char errorBuf[128];
+
+    if (!flush_buffer(sysData))
+        return 0;
+
+    if (sysData->diskSize > sysData->fileSize) {
+        if (ftruncate(sysData->fd, (off_t)sysData->fileSize) != 0) {
+            mxf_log_error("ftruncate failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            return 0;
+        }
+        sysData->diskSize = sysData->fileSize;
+    }
+
+    /* the file is opened without bypassing the cache if O_DIRECT is not supported and so write errors
+       may only be reported when the data is synced */
+    if (fsync(sysData->fd) != 0) {
+        mxf_log_error("fsync failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        return 0;
+    }
+
+    return 1;
+}
+
+static void direct_file_close(MXFFileSysData *sysData)
+{
+    if (sysData->fd < 0)
+        return;
+
+    direct_file_flush(sysData);
+
+    close(sysData->fd);
+    sysData->fd = -1;
+}
+
+static uint32_t direct_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    uint32_t remCount = count;
+    int64_t available;
+    uint32_t numRead;
+
+    while (remCount > 0 && sysData->position < sysData->fileSize) {
+        if (!load_buffer(sysData))
+            break;
+
+        available = sysData->bufferStart + sysData->bufferSize;
+        if (available > sysData->fileSize)
+            available = sysData->fileSize;
+        available -= sysData->position;
+        numRead = (available < remCount ? (uint32_t)available : remCount);
+
+        memcpy(&data[count - remCount], &sysData->buffer[sysData->position - sysData->bufferStart], numRead);
+        sysData->position += numRead;
+        remCount          -= numRead;
+    }
+
+    return count - remCount;
+}
+
+static uint32_t direct_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    uint32_t remCount = count;
+    int64_t available;
+    uint32_t numWrite;
+
+    while (remCount > 0) {
+        if (!load_buffer(sysData))
+            break;
+
+        available = sysData->bufferStart + sysData->bufferSize - sysData->position;
+        numWrite = (available < remCount ? (uint32_t)available : remCount);
+
+        memcpy(&sysData->buffer[sysData->position - sysData->bufferStart], &data[count - remCount], numWrite);
+        if (sysData->dirtyEnd <= sysData->dirtyStart) {
+            sysData->dirtyStart = sysData->position;
+            sysData->dirtyEnd   = sysData->position + numWrite;
+        } else {
+            if (sysData->position < sysData->dirtyStart)
+                sysData->dirtyStart = sysData->position;
+            if (sysData->position + numWrite > sysData->dirtyEnd)
+                sysData->dirtyEnd = sysData->position + numWrite;
+        }
+        sysData->position += numWrite;
+        remCount          -= numWrite;
+
+        if (sysData->position > sysData->fileSize)
+            sysData->fileSize = sysData->position;
+    }
+
+    return count - remCount;
+}
+
+static int direct_file_getchar(MXFFileSysData *sysData)
+{
+    uint8_t c;
+    if (direct_file_read(sysData, &c, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int direct_file_putchar(MXFFileSysData *sysData, int c)
+{
+    uint8_t data = (uint8_t)c;
+    if (direct_file_write(sysData, &data, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int direct_file_eof(MXFFileSysData *sysData)
+{
+    return sysData->position >= sysData->fileSize;
+}
+
+static int direct_file_seek(MXFFileSysData *sysData, int64_t offset, int whence)
+{
+    int64_t newPosition;
+
+    if (whence == SEEK_SET)
+        newPosition = offset;
+    else if (whence == SEEK_CUR)
+        newPosition = sysData->position + offset;
+    else
+        newPosition = sysData->fileSize + offset;
+    if (newPosition < 0)
+        return 0;
+
+    sysData->position = newPosition;
+    return 1;
+}
+
+static int64_t direct_file_tell(MXFFileSysData *sysData)
+{
+    return sysData->position;
+}
+
+static int direct_file_is_seekable(MXFFileSysData *sysData)
+{
+    (void)sysData;
+    return 1;
+}
+
+static int64_t direct_file_size(MXFFileSysData *sysData)
+{
+    return sysData->fileSize;
+}
+
+static void free_direct_file(MXFFileSysData *sysData)
+{
+    if (!sysData)
+        return;
+
+    free(sysData->buffer);
+    free(sysData);
+}
+
+
+static int open_direct(const char *filename)
+{
+    char errorBuf[128];
+    int fd;
+
+#if defined(O_DIRECT)
+    fd = open(filename, O_RDWR | O_CREAT | O_TRUNC | O_DIRECT, 0666);
+    if (fd < 0 && errno == EINVAL) {
+        mxf_log_warn("File system does not support O_DIRECT for '%s'; using the page cache\n", filename);
+        fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    }
+#else
+    fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0666);
+#if defined(F_NOCACHE)
+    if (fd >= 0 && fcntl(fd, F_NOCACHE, 1) != 0)
+        mxf_log_warn("Failed to disable caching for '%s'\n", filename);
+#endif
+#endif
+    if (fd < 0)
+        mxf_log_error("Failed to open '%s': %s\n", filename, mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+
+    return fd;
+}
+
+
+
+int mxf_direct_file_open_new(const char *filename, uint32_t bufferSize, MXFFile **mxfFile)
+{
+    MXFFile *newMXFFile = NULL;
+    MXFFileSysData *newDirectFile = NULL;
+    void *buffer;
+
+    if (bufferSize == 0 || bufferSize > UINT32_MAX - MXF_DIRECT_FILE_ALIGNMENT) {
+        mxf_log_error("Invalid direct file buffer size %u" LOG_LOC_FORMAT, bufferSize, LOG_LOC_PARAMS);
+        return 0;
+    }
+
+    CHK_MALLOC_ORET(newMXFFile, MXFFile);
+    memset(newMXFFile, 0, sizeof(MXFFile));
+    CHK_MALLOC_OFAIL(newDirectFile, MXFFileSysData);
+    memset(newDirectFile, 0, sizeof(MXFFileSysData));
+    newDirectFile->fd = -1;
+
+    newDirectFile->bufferSize = ALIGN_UP(bufferSize);
+    if (posix_memalign(&buffer, MXF_DIRECT_FILE_ALIGNMENT, newDirectFile->bufferSize) != 0) {
+        mxf_log_error("Failed to allocate direct file buffer" LOG_LOC_FORMAT, LOG_LOC_PARAMS);
+        goto fail;
+    }
+    newDirectFile->buffer = (uint8_t*)buffer;
+
+    newDirectFile->fd = open_direct(filename);
+    if (newDirectFile->fd < 0)
+        goto fail;
+
+    newMXFFile->close         = direct_file_close;
+    newMXFFile->read          = direct_file_read;
+    newMXFFile->write         = direct_file_write;
+    newMXFFile->get_char      = direct_file_getchar;
+    newMXFFile->put_char      = direct_file_putchar;
+    newMXFFile->eof           = direct_file_eof;
+    newMXFFile->seek          = direct_file_seek;
+    newMXFFile->tell          = direct_file_tell;
+    newMXFFile->is_seekable   = direct_file_is_seekable;
+    newMXFFile->size          = direct_file_size;
+    newMXFFile->flush         = direct_file_flush;
+    newMXFFile->free_sys_data = free_direct_file;
+    newMXFFile->sysData       = newDirectFile;
+
+    *mxfFile = newMXFFile;
+    return 1;
+
+fail:
+    SAFE_FREE(newMXFFile);
+    free_direct_file(newDirectFile);
+    return 0;
+}
+
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef MXF_DIRECT_FILE_H_
+#define MXF_DIRECT_FILE_H_
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+#include <mxf/mxf_file.h>
+
+
+#define MXF_DIRECT_FILE_ALIGNMENT       4096
+
+
+/* Open a new file for writing that bypasses the system page cache using O_DIRECT, or F_NOCACHE on macOS.
+   Data is staged in an aligned buffer of bufferSize bytes, rounded up to a multiple of MXF_DIRECT_FILE_ALIGNMENT,
+   and written in aligned blocks. The blocks that are partially covered when seeking back to rewrite the header
+   or footer are read from the file and merged. The last block is written with padding and the file is truncated
+   to its actual size and synced by mxf_file_flush, or when closed if not flushed before.
+   The file is opened without bypassing the cache, with a warning, if the file system does not support it */
+int mxf_direct_file_open_new(const char *filename, uint32_t bufferSize, MXFFile **mxfFile);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
+
@@ -45,6 +45,10 @@
 #if defined(_WIN32)
 #include <io.h>
 #include <fcntl.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
 #endif
 
 #include <mxf/mxf.h>
@@ -64,6 +68,24 @@
 #define MAX_ZEROS_BUFFER_SIZE   16384
 #define ZEROS_BUFFER_INCREMENT  2048
 
+/* the read-ahead window is extended once half of it has been consumed */
+#define READ_AHEAD_REFILL_DIVISOR   2
+
+/* pages behind the read position are dropped in chunks of this size, keeping the most recent chunk cached */
+#define DROP_BEHIND_CHUNK_SIZE  (8 * 1024 * 1024)
+
+#if !defined(_WIN32) && defined(POSIX_FADV_SEQUENTIAL)
+#define HAVE_POSIX_FADVISE
+#endif
+
+#if !defined(_WIN32)
+#define HAVE_WRITEV
+#endif
+
+/* vectored writes bypass the stdio buffer, which is only worthwhile for larger writes */
+#define MIN_WRITEV_SIZE         (64 * 1024)
+#define MAX_WRITEV_COUNT        64
+
 
 typedef enum
 {
@@ -77,6 +99,14 @@ struct MXFFileSysData
     FILE *file;
     OpenMode mode;
     int isSeekable;
+
+    /* page cache hints for files opened for reading */
+    int trackPosition;
+    int dropBehind;
+    uint32_t readAheadSize;
+    int64_t position;
+    int64_t readAheadEnd;
+    int64_t dropBehindStart;
 };
 
 
@@ -110,6 +140,42 @@ static int check_file_is_seekable(FILE *file, int *isSeekable)
 }
 
 
+static void disk_file_advise(MXFFileSysData *sysData)
+{
+#if defined(HAVE_POSIX_FADVISE)
+    int fd = fileno(sysData->file);
+
+    if (sysData->readAheadSize > 0 &&
+        sysData->position + sysData->readAheadSize / READ_AHEAD_REFILL_DIVISOR >= sysData->readAheadEnd)
+    {
+        int64_t start = sysData->readAheadEnd;
+        int64_t end   = sysData->position + sysData->readAheadSize;
+        if (start < sysData->position)
+            start = sysData->position;
+        posix_fadvise(fd, (off_t)start, (off_t)(end - start), POSIX_FADV_WILLNEED);
+        sysData->readAheadEnd = end;
+    }
+
+    if (sysData->dropBehind &&
+        sysData->position >= sysData->dropBehindStart + 2 * DROP_BEHIND_CHUNK_SIZE)
+    {
+        int64_t end = sysData->position - DROP_BEHIND_CHUNK_SIZE;
+        posix_fadvise(fd, (off_t)sysData->dropBehindStart, (off_t)(end - sysData->dropBehindStart),
+                      POSIX_FADV_DONTNEED);
+        sysData->dropBehindStart = end;
+    }
+#else
+    (void)sysData;
+#endif
+}
+
+static void disk_file_reset_advise(MXFFileSysData *sysData)
+{
+    sysData->readAheadEnd = sysData->position;
+    if (sysData->position < sysData->dropBehindStart)
+        sysData->dropBehindStart = sysData->position;
+}
+
 static void disk_file_close(MXFFileSysData *sysData)
 {
     if (sysData->file &&
@@ -129,6 +195,10 @@ static uint32_t disk_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t
         result = (uint32_t)fread(data, 1, count, sysData->file);
         if (result != count && ferror(sysData->file))
             mxf_log_error("fread failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        if (sysData->trackPosition) {
+            sysData->position += result;
+            disk_file_advise(sysData);
+        }
     } else {
         result = 0;
         if (result != count)
@@ -156,9 +226,91 @@ static uint32_t disk_file_write(MXFFileSysData *sysData, const uint8_t *data, ui
     return result;
 }
 
+#if defined(HAVE_WRITEV)
+static uint64_t disk_file_writev(MXFFileSysData *sysData, const MXFFileIOVec *iov, uint32_t iovcnt)
+{
+    char errorBuf[128];
+    struct iovec vec[MAX_WRITEV_COUNT];
+    uint64_t totalCount = 0;
+    uint64_t result = 0;
+    int64_t position;
+    uint32_t offset;
+    uint32_t i;
+    int j;
+
+    for (i = 0; i < iovcnt; i++)
+        totalCount += iov[i].size;
+
+    if (!sysData->isSeekable || totalCount < MIN_WRITEV_SIZE) {
+        for (i = 0; i < iovcnt; i++) {
+            uint32_t numWrite = disk_file_write(sysData, iov[i].data, iov[i].size);
+            result += numWrite;
+            if (numWrite != iov[i].size)
+                break;
+        }
+        return result;
+    }
+
+    /* write any data in the stream buffer before writing to the file descriptor */
+    if (fflush(sysData->file) != 0) {
+        mxf_log_error("fflush failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        return 0;
+    }
+    position = ftello(sysData->file);
+    if (position < 0) {
+        mxf_log_error("ftello failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        return 0;
+    }
+
+    i = 0;
+    offset = 0;
+    while (i < iovcnt) {
+        ssize_t numWrite;
+        uint64_t remCount;
+
+        vec[0].iov_base = (void*)(iov[i].data + offset);
+        vec[0].iov_len  = iov[i].size - offset;
+        for (j = 1; j < MAX_WRITEV_COUNT && i + j < iovcnt; j++) {
+            vec[j].iov_base = (void*)iov[i + j].data;
+            vec[j].iov_len  = iov[i + j].size;
+        }
+
+        numWrite = writev(fileno(sysData->file), vec, j);
+        if (numWrite < 0 && errno == EINTR)
+            continue;
+        if (numWrite <= 0) {
+            mxf_log_error("writev failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            break;
+        }
+        result += numWrite;
+
+        /* skip the buffers that were completely written */
+        remCount = (uint64_t)numWrite;
+        while (i < iovcnt && remCount >= iov[i].size - offset) {
+            remCount -= iov[i].size - offset;
+            offset = 0;
+            i++;
+        }
+        if (i < iovcnt)
+            offset += (uint32_t)remCount;
+    }
+
+    /* the stream's position is no longer in sync with the file descriptor */
+    if (fseeko(sysData->file, position + result, SEEK_SET) != 0) {
+        mxf_log_error("fseeko failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        return 0;
+    }
+
+    return result;
+}
+#endif
+
 static int disk_file_getchar(MXFFileSysData *sysData)
 {
-    return fgetc(sysData->file);
+    int c = fgetc(sysData->file);
+    if (sysData->trackPosition && c != EOF)
+        sysData->position++;
+    return c;
 }
 
 static int disk_file_putchar(MXFFileSysData *sysData, int c)
@@ -174,10 +326,38 @@ static int disk_file_eof(MXFFileSysData *sysData)
 static int disk_file_seek(MXFFileSysData *sysData, int64_t offset, int whence)
 {
 #if defined(_WIN32)
-    return _fseeki64(sysData->file, offset, whence) == 0;
+    if (_fseeki64(sysData->file, offset, whence) != 0)
+        return 0;
+#else
+    if (fseeko(sysData->file, offset, whence) != 0)
+        return 0;
+#endif
+
+    if (sysData->trackPosition) {
+#if defined(_WIN32)
+        sysData->position = _ftelli64(sysData->file);
 #else
-    return fseeko(sysData->file, offset, whence) == 0;
+        sysData->position = ftello(sysData->file);
 #endif
+        disk_file_reset_advise(sysData);
+    }
+
+    return 1;
+}
+
+static int disk_file_flush(MXFFileSysData *sysData)
+{
+    char errorBuf[128];
+
+    if (sysData->mode == READ_MODE)
+        return 1;
+
+    if (fflush(sysData->file) != 0) {
+        mxf_log_error("fflush failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        return 0;
+    }
+
+    return 1;
 }
 
 static int64_t disk_file_tell(MXFFileSysData *sysData)
@@ -252,6 +432,10 @@ static int disk_file_open(FILE *file, OpenMode mode, MXFFile **mxfFile)
     newMXFFile->tell          = disk_file_tell;
     newMXFFile->is_seekable   = disk_file_is_seekable;
     newMXFFile->size          = disk_file_size;
+#if defined(HAVE_WRITEV)
+    newMXFFile->writev        = disk_file_writev;
+#endif
+    newMXFFile->flush         = disk_file_flush;
     newMXFFile->free_sys_data = free_disk_file;
     newMXFFile->sysData       = newDiskFile;
 
@@ -293,6 +477,39 @@ int mxf_disk_file_open_read(const char *filename, MXFFile **mxfFile)
     return disk_file_open(file, READ_MODE, mxfFile);
 }
 
+int mxf_disk_file_open_read_2(const char *filename, int flags, uint32_t readAheadSize, MXFFile **mxfFile)
+{
+    MXFFileSysData *sysData;
+
+    if (!mxf_disk_file_open_read(filename, mxfFile))
+        return 0;
+
+    /* the hints are not applied to non-seekable files that have been wrapped in a stream file */
+    if ((*mxfFile)->close != disk_file_close)
+        return 1;
+
+    sysData = (*mxfFile)->sysData;
+
+#if defined(HAVE_POSIX_FADVISE)
+    if (flags & MXF_DISK_FLAG_SEQUENTIAL_SCAN)
+        posix_fadvise(fileno(sysData->file), 0, 0, POSIX_FADV_SEQUENTIAL);
+    else if (flags & MXF_DISK_FLAG_RANDOM_ACCESS)
+        posix_fadvise(fileno(sysData->file), 0, 0, POSIX_FADV_RANDOM);
+
+    sysData->readAheadSize = readAheadSize;
+    sysData->dropBehind    = !!(flags & MXF_DISK_FLAG_DROP_BEHIND);
+    sysData->trackPosition = (sysData->readAheadSize > 0 || sysData->dropBehind);
+    if (sysData->trackPosition)
+        disk_file_advise(sysData);
+#else
+    (void)flags;
+    (void)readAheadSize;
+    (void)sysData;
+#endif
+
+    return 1;
+}
+
 int mxf_disk_file_open_modify(const char *filename, MXFFile **mxfFile)
 {
     FILE *file = fopen(filename, "r+b");
@@ -364,6 +581,25 @@ uint32_t mxf_file_write(MXFFile *mxfFile, const uint8_t *data, uint32_t count)
     return mxfFile->write(mxfFile->sysData, data, count);
 }
 
+uint64_t mxf_file_writev(MXFFile *mxfFile, const MXFFileIOVec *iov, uint32_t iovcnt)
+{
+    uint64_t result = 0;
+    uint32_t numWrite;
+    uint32_t i;
+
+    if (mxfFile->writev)
+        return mxfFile->writev(mxfFile->sysData, iov, iovcnt);
+
+    for (i = 0; i < iovcnt; i++) {
+        numWrite = mxfFile->write(mxfFile->sysData, iov[i].data, iov[i].size);
+        result += numWrite;
+        if (numWrite != iov[i].size)
+            break;
+    }
+
+    return result;
+}
+
 int mxf_file_getc(MXFFile *mxfFile)
 {
     return mxfFile->get_char(mxfFile->sysData);
@@ -399,6 +635,27 @@ int64_t mxf_file_size(MXFFile *mxfFile)
     return mxfFile->size(mxfFile->sysData);
 }
 
+int mxf_file_supports_prefetch(MXFFile *mxfFile)
+{
+    return mxfFile->prefetch != NULL;
+}
+
+int mxf_file_prefetch(MXFFile *mxfFile, int64_t offset, uint32_t size)
+{
+    if (!mxfFile->prefetch)
+        return 0;
+
+    return mxfFile->prefetch(mxfFile->sysData, offset, size);
+}
+
+int mxf_file_flush(MXFFile *mxfFile)
+{
+    if (!mxfFile->flush)
+        return 1;
+
+    return mxfFile->flush(mxfFile->sysData);
+}
+
 
 void mxf_file_set_min_llen(MXFFile *mxfFile, uint8_t llen)
 {
@@ -694,9 +951,8 @@ int mxf_write_kl(MXFFile *mxfFile, const mxfKey *key, uint64_t len)
     return 1;
 }
 
-int mxf_write_fixed_l(MXFFile *mxfFile, uint8_t llen, uint64_t len)
+int mxf_encode_fixed_l(uint8_t llen, uint64_t len, uint8_t *buffer)
 {
-    uint8_t buffer[9];
     uint8_t i;
 
     assert(llen > 0 && llen <= 9);
@@ -707,8 +963,7 @@ int mxf_write_fixed_l(MXFFile *mxfFile, uint8_t llen, uint64_t len)
             return 0;
         }
 
-        if (mxf_file_putc(mxfFile, (int)len) != (int)len)
-            return 0;
+        buffer[0] = (uint8_t)len;
     } else {
         if (llen != 9 && (len >> ((llen - 1) * 8)) > 0) {
             mxf_log_error("Could not write BER length %" PRIu64 " for llen equal %u"
@@ -716,16 +971,24 @@ int mxf_write_fixed_l(MXFFile *mxfFile, uint8_t llen, uint64_t len)
             return 0;
         }
 
+        buffer[0] = 0x80 + llen - 1;
         for (i = 0; i < llen - 1; i++)
-            buffer[llen - 1 - i - 1] = (uint8_t)((len >> (i * 8)) & 0xff);
-
-        CHK_ORET(mxf_file_putc(mxfFile, 0x80 + llen - 1) == 0x80 + llen - 1);
-        CHK_ORET(mxf_file_write(mxfFile, buffer, llen - 1) == (uint8_t)(llen - 1));
+            buffer[llen - 1 - i] = (uint8_t)((len >> (i * 8)) & 0xff);
     }
 
     return 1;
 }
 
+int mxf_write_fixed_l(MXFFile *mxfFile, uint8_t llen, uint64_t len)
+{
+    uint8_t buffer[9];
+
+    CHK_ORET(mxf_encode_fixed_l(llen, len, buffer));
+    CHK_ORET(mxf_file_write(mxfFile, buffer, llen) == llen);
+
+    return 1;
+}
+
 int mxf_write_fixed_kl(MXFFile *mxfFile, const mxfKey *key, uint8_t llen, uint64_t len)
 {
     CHK_ORET(mxf_write_k(mxfFile, key));
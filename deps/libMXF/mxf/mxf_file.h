@@ -46,6 +46,12 @@ extern "C"
 
 typedef struct MXFFileSysData MXFFileSysData;
 
+typedef struct
+{
+    const uint8_t *data;
+    uint32_t size;
+} MXFFileIOVec;
+
 typedef struct
 {
     /* MXF file implementations must set and implement these functions */
@@ -60,6 +66,15 @@ typedef struct
     int         (*is_seekable)  (MXFFileSysData *sysData);
     int64_t     (*size)         (MXFFileSysData *sysData);
 
+    /* MXF file implementations may set this function. mxf_file_writev calls write for each buffer if not set */
+    uint64_t    (*writev)       (MXFFileSysData *sysData, const MXFFileIOVec *iov, uint32_t iovcnt);
+    /* MXF file implementations may set this function to start reading a range that is expected to be read soon.
+       It returns 0 if the range was not accepted, e.g. because the maximum number of ranges are in flight */
+    int         (*prefetch)     (MXFFileSysData *sysData, int64_t offset, uint32_t size);
+    /* MXF file implementations that buffer or defer writes may set this function to complete the pending
+       writes. It returns 0 if any write since the file was opened failed */
+    int         (*flush)        (MXFFileSysData *sysData);
+
     /* private data for the MXF file implementation */
     void (*free_sys_data)(MXFFileSysData *sysData);
     MXFFileSysData *sysData;
@@ -77,6 +92,17 @@ int mxf_disk_file_open_new(const char *filename, MXFFile **mxfFile);
 int mxf_disk_file_open_read(const char *filename, MXFFile **mxfFile);
 int mxf_disk_file_open_modify(const char *filename, MXFFile **mxfFile);
 
+/* open a file on disk for reading with page cache hints. The flags set the expected access pattern
+   and whether pages behind the read position should be dropped from the cache. A non-zero
+   readAheadSize sets the number of bytes ahead of the read position to request the system to cache.
+   The hints are ignored if posix_fadvise is not supported */
+#define MXF_DISK_FLAG_DEFAULT               0x00
+#define MXF_DISK_FLAG_SEQUENTIAL_SCAN       0x01
+#define MXF_DISK_FLAG_RANDOM_ACCESS         0x02
+#define MXF_DISK_FLAG_DROP_BEHIND           0x04
+
+int mxf_disk_file_open_read_2(const char *filename, int flags, uint32_t readAheadSize, MXFFile **mxfFile);
+
 /* wrap standard input and output in an MXF file */
 int mxf_stdin_wrap_read(MXFFile **mxfFile);
 int mxf_stdout_wrap_write(MXFFile **mxfFile);
@@ -85,6 +111,7 @@ void mxf_file_close(MXFFile **mxfFile);
 void mxf_file_close_2(MXFFile **mxfFile, void (*free_func)(void*));
 uint32_t mxf_file_read(MXFFile *mxfFile, uint8_t *data, uint32_t count);
 uint32_t mxf_file_write(MXFFile *mxfFile, const uint8_t *data, uint32_t count);
+uint64_t mxf_file_writev(MXFFile *mxfFile, const MXFFileIOVec *iov, uint32_t iovcnt);
 int mxf_file_getc(MXFFile *mxfFile);
 int mxf_file_putc(MXFFile *mxfFile, int c);
 int mxf_file_eof(MXFFile *mxfFile);
@@ -92,6 +119,11 @@ int mxf_file_seek(MXFFile *mxfFile, int64_t offset, int whence);
 int64_t mxf_file_tell(MXFFile *mxfFile);
 int mxf_file_is_seekable(MXFFile *mxfFile);
 int64_t mxf_file_size(MXFFile *mxfFile);
+int mxf_file_supports_prefetch(MXFFile *mxfFile);
+int mxf_file_prefetch(MXFFile *mxfFile, int64_t offset, uint32_t size);
+/* complete buffered or deferred writes. Writers call this before they finish so that a write failure
+   fails the job rather than leaving a truncated file. Returns 0 if any write failed */
+int mxf_file_flush(MXFFile *mxfFile);
 
 
 void mxf_file_set_min_llen(MXFFile *mxfFile, uint8_t llen);
@@ -140,6 +172,7 @@ int mxf_write_uid(MXFFile *mxfFile, const mxfUID *uid);
 int mxf_write_uuid(MXFFile *mxfFile, const mxfUUID *uuid);
 
 uint8_t mxf_get_llen(MXFFile *mxfFile, uint64_t len);
+int mxf_encode_fixed_l(uint8_t llen, uint64_t len, uint8_t *buffer);
 
 int mxf_read_batch_header(MXFFile *mxfFile, uint32_t *len, uint32_t *eleLen);
 int mxf_write_batch_header(MXFFile *mxfFile, uint32_t len, uint32_t eleLen);
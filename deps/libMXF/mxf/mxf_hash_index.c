@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <mxf/mxf_types.h>
+#include <mxf/mxf_hash_index.h>
+#include <mxf/mxf_macros.h>
+#include <mxf/mxf_logging.h>
+
+
+#define KEY_SIZE            16
+#define MIN_NUM_SLOTS       16
+
+/* marks a slot whose element was removed, allowing the probe sequence to continue past it */
+static char g_removed_slot;
+#define REMOVED_SLOT        ((void*)&g_removed_slot)
+
+#define ELEMENT_KEY(index, data)    ((const uint8_t*)(data) + (index)->key_offset)
+
+
+
+static size_t hash_key(const uint8_t *key)
+{
+    uint64_t first;
+    uint64_t second;
+    uint64_t hash;
+
+    /* the keys are either random UUIDs or ULs that share a common prefix and so the
+       second half of the key is mixed into the first */
+    memcpy(&first, key, sizeof(first));
+    memcpy(&second, &key[8], sizeof(second));
+    hash = first ^ (second * 0x9e3779b97f4a7c15ULL);
+    hash ^= hash >> 32;
+    hash *= 0xd6e8feb86659fd93ULL;
+    hash ^= hash >> 32;
+
+    return (size_t)hash;
+}
+
+static size_t find_slot(MXFHashIndex *index, const void *key)
+{
+    size_t mask = index->num_slots - 1;
+    size_t i = hash_key((const uint8_t*)key) & mask;
+
+    while (index->slots[i] != NULL) {
+        if (index->slots[i] != REMOVED_SLOT && memcmp(ELEMENT_KEY(index, index->slots[i]), key, KEY_SIZE) == 0)
+            return i;
+        i = (i + 1) & mask;
+    }
+
+    return (size_t)(-1);
+}
+
+static int resize(MXFHashIndex *index, size_t num_slots)
+{
+    void **old_slots = index->slots;
+    size_t old_num_slots = index->num_slots;
+    size_t mask = num_slots - 1;
+    size_t i, j;
+
+    index->slots = (void**)calloc(num_slots, sizeof(void*));
+    if (!index->slots) {
+        mxf_log_error("Failed to allocate hash index slots" LOG_LOC_FORMAT, LOG_LOC_PARAMS);
+        index->slots = old_slots;
+        return 0;
+    }
+    index->num_slots = num_slots;
+    index->num_used_slots = index->num_elements;
+
+    for (i = 0; i < old_num_slots; i++) {
+        if (old_slots[i] == NULL || old_slots[i] == REMOVED_SLOT)
+            continue;
+
+        j = hash_key(ELEMENT_KEY(index, old_slots[i])) & mask;
+        while (index->slots[j] != NULL)
+            j = (j + 1) & mask;
+        index->slots[j] = old_slots[i];
+    }
+
+    SAFE_FREE(old_slots);
+    return 1;
+}
+
+
+
+void mxf_hash_index_init(MXFHashIndex *index, size_t key_offset)
+{
+    memset(index, 0, sizeof(*index));
+    index->key_offset = key_offset;
+}
+
+void mxf_hash_index_clear(MXFHashIndex *index)
+{
+    SAFE_FREE(index->slots);
+    index->num_slots = 0;
+    index->num_elements = 0;
+    index->num_used_slots = 0;
+}
+
+int mxf_hash_index_insert(MXFHashIndex *index, void *data)
+{
+    const uint8_t *key;
+    size_t mask;
+    size_t i;
+    size_t removed_slot;
+
+    /* keep the load, including removed slots, at or below 3/4 */
+    if ((index->num_used_slots + 1) * 4 > index->num_slots * 3) {
+        size_t num_slots = MIN_NUM_SLOTS;
+        while ((index->num_elements + 1) * 2 > num_slots)
+            num_slots *= 2;
+        CHK_ORET(resize(index, num_slots));
+    }
+
+    /* the element is inserted in the first removed slot in the probe sequence if the key is not found */
+    key = ELEMENT_KEY(index, data);
+    mask = index->num_slots - 1;
+    i = hash_key(key) & mask;
+    removed_slot = (size_t)(-1);
+    while (index->slots[i] != NULL) {
+        if (index->slots[i] == REMOVED_SLOT) {
+            if (removed_slot == (size_t)(-1))
+                removed_slot = i;
+        } else if (memcmp(ELEMENT_KEY(index, index->slots[i]), key, KEY_SIZE) == 0) {
+            return 2;
+        }
+        i = (i + 1) & mask;
+    }
+
+    if (removed_slot != (size_t)(-1)) {
+        i = removed_slot;
+    } else {
+        index->num_used_slots++;
+    }
+    index->slots[i] = data;
+    index->num_elements++;
+
+    return 1;
+}
+
+int mxf_hash_index_remove(MXFHashIndex *index, void *data)
+{
+    size_t i;
+
+    if (index->num_elements == 0)
+        return 0;
+
+    i = find_slot(index, ELEMENT_KEY(index, data));
+    if (i == (size_t)(-1) || index->slots[i] != data)
+        return 0;
+
+    index->slots[i] = REMOVED_SLOT;
+    index->num_elements--;
+
+    return 1;
+}
+
+void* mxf_hash_index_find(MXFHashIndex *index, const void *key)
+{
+    size_t i;
+
+    if (index->num_elements == 0)
+        return NULL;
+
+    i = find_slot(index, key);
+    if (i == (size_t)(-1))
+        return NULL;
+
+    return index->slots[i];
+}
+
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef MXF_HASH_INDEX_H_
+#define MXF_HASH_INDEX_H_
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/* An open addressed hash index of data elements identified by a 16 byte key (a UUID, UL or key)
+   located at key_offset in the element. The index does not own the data elements and holds at
+   most 1 element per key. mxf_hash_index_insert returns 2 and leaves the index unchanged if an
+   element with the same key is already present */
+
+typedef struct
+{
+    void **slots;
+    size_t num_slots;
+    size_t num_elements;
+    size_t num_used_slots;
+    size_t key_offset;
+} MXFHashIndex;
+
+
+
+void mxf_hash_index_init(MXFHashIndex *index, size_t key_offset);
+void mxf_hash_index_clear(MXFHashIndex *index);
+
+int mxf_hash_index_insert(MXFHashIndex *index, void *data);
+int mxf_hash_index_remove(MXFHashIndex *index, void *data);
+void* mxf_hash_index_find(MXFHashIndex *index, const void *key);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
+
@@ -39,15 +39,36 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <limits.h>
 
 #include <mxf/mxf.h>
 #include <mxf/mxf_macros.h>
 
 
+/* the item index is only worth building for sets with more items than this */
+#define ITEM_INDEX_MIN_COUNT    8
+
+
+typedef struct
+{
+    mxfKey key;
+    MXFList sets;
+} SetKeyGroup;
+
+
+
 static void free_metadata_item_value(MXFMetadataItem *item)
 {
-    SAFE_FREE(item->value);
+    if (item->isArenaValue)
+    {
+        item->value = NULL;
+        item->isArenaValue = 0;
+    }
+    else
+    {
+        SAFE_FREE(item->value);
+    }
     item->length = 0;
 }
 
@@ -77,13 +98,6 @@ static void free_metadata_item_in_list(void *data)
     mxf_free_item(&item);
 }
 
-static int set_eq_instanceuid(void *data, void *info)
-{
-    assert(data != NULL && info != NULL);
-
-    return mxf_equals_uuid((mxfUUID*)info, &((MXFMetadataSet*)data)->instanceUID);
-}
-
 static int item_eq_key(void *data, void *info)
 {
     assert(data != NULL && info != NULL);
@@ -98,6 +112,154 @@ static int eq_pointer(void *data, void *info)
     return data == info;
 }
 
+static int create_set_key_group(const mxfKey *key, SetKeyGroup **group)
+{
+    SetKeyGroup *newGroup;
+
+    CHK_MALLOC_ORET(newGroup, SetKeyGroup);
+    memset(newGroup, 0, sizeof(SetKeyGroup));
+    newGroup->key = *key;
+    mxf_initialise_list(&newGroup->sets, NULL); /* free func == NULL because the group doesn't own the sets */
+
+    *group = newGroup;
+    return 1;
+}
+
+static void free_set_key_group(SetKeyGroup **group)
+{
+    if (*group == NULL)
+    {
+        return;
+    }
+
+    mxf_clear_list(&(*group)->sets);
+    SAFE_FREE(*group);
+}
+
+static int index_set(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
+{
+    SetKeyGroup *group;
+
+    /* the first set added is returned if multiple sets have the same instanceUID */
+    CHK_ORET(mxf_hash_index_insert(&headerMetadata->setsByInstanceUID, set));
+
+    group = (SetKeyGroup*)mxf_hash_index_find(&headerMetadata->setsByKey, &set->key);
+    if (group == NULL)
+    {
+        CHK_ORET(create_set_key_group(&set->key, &group));
+        if (!mxf_hash_index_insert(&headerMetadata->setsByKey, group))
+        {
+            free_set_key_group(&group);
+            return 0;
+        }
+    }
+    CHK_ORET(mxf_append_list_element(&group->sets, (void*)set));
+
+    return 1;
+}
+
+static void unindex_set(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
+{
+    MXFListIterator iter;
+    SetKeyGroup *group;
+
+    if (mxf_hash_index_remove(&headerMetadata->setsByInstanceUID, set))
+    {
+        /* index the next set in the list that has the same instanceUID */
+        mxf_initialise_list_iter(&iter, &headerMetadata->sets);
+        while (mxf_next_list_iter_element(&iter))
+        {
+            MXFMetadataSet *setInList = (MXFMetadataSet*)mxf_get_iter_element(&iter);
+            if (setInList != set && mxf_equals_uuid(&setInList->instanceUID, &set->instanceUID))
+            {
+                mxf_hash_index_insert(&headerMetadata->setsByInstanceUID, setInList);
+                break;
+            }
+        }
+    }
+
+    group = (SetKeyGroup*)mxf_hash_index_find(&headerMetadata->setsByKey, &set->key);
+    if (group != NULL)
+    {
+        mxf_remove_list_element(&group->sets, (void*)set, eq_pointer);
+        if (mxf_get_list_length(&group->sets) == 0)
+        {
+            mxf_hash_index_remove(&headerMetadata->setsByKey, group);
+            free_set_key_group(&group);
+        }
+    }
+}
+
+static void clear_set_indexes(MXFHeaderMetadata *headerMetadata)
+{
+    MXFListIterator iter;
+    SetKeyGroup *group;
+
+    /* the index doesn't own the groups and so they are found and freed through the sets */
+    mxf_initialise_list_iter(&iter, &headerMetadata->sets);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        MXFMetadataSet *set = (MXFMetadataSet*)mxf_get_iter_element(&iter);
+
+        group = (SetKeyGroup*)mxf_hash_index_find(&headerMetadata->setsByKey, &set->key);
+        if (group != NULL)
+        {
+            mxf_hash_index_remove(&headerMetadata->setsByKey, group);
+            free_set_key_group(&group);
+        }
+    }
+
+    mxf_hash_index_clear(&headerMetadata->setsByKey);
+    mxf_hash_index_clear(&headerMetadata->setsByInstanceUID);
+}
+
+static int index_item(MXFMetadataSet *set, MXFMetadataItem *item)
+{
+    MXFListIterator iter;
+
+    if (set->itemIndex.num_slots == 0)
+    {
+        if (mxf_get_list_length(&set->items) < ITEM_INDEX_MIN_COUNT)
+        {
+            return 1;
+        }
+
+        /* build the index from all items in the set, which includes the new item */
+        mxf_initialise_list_iter(&iter, &set->items);
+        while (mxf_next_list_iter_element(&iter))
+        {
+            CHK_ORET(mxf_hash_index_insert(&set->itemIndex, mxf_get_iter_element(&iter)));
+        }
+
+        return 1;
+    }
+
+    /* the first item added is returned if multiple items have the same key */
+    CHK_ORET(mxf_hash_index_insert(&set->itemIndex, item));
+
+    return 1;
+}
+
+static void unindex_item(MXFMetadataSet *set, MXFMetadataItem *item)
+{
+    MXFListIterator iter;
+
+    if (mxf_hash_index_remove(&set->itemIndex, item))
+    {
+        /* index the next item in the list that has the same key */
+        mxf_initialise_list_iter(&iter, &set->items);
+        while (mxf_next_list_iter_element(&iter))
+        {
+            MXFMetadataItem *itemInList = (MXFMetadataItem*)mxf_get_iter_element(&iter);
+            if (itemInList != item && mxf_equals_key(&itemInList->key, &item->key))
+            {
+                mxf_hash_index_insert(&set->itemIndex, itemInList);
+                break;
+            }
+        }
+    }
+}
+
 static int get_or_create_set_item(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set,
                                   const mxfKey *itemKey, MXFMetadataItem **item)
 {
@@ -124,15 +286,25 @@ static int get_or_create_set_item(MXFHeaderMetadata *headerMetadata, MXFMetadata
     return 1;
 }
 
-static int create_empty_set(const mxfKey *key, MXFMetadataSet **set)
+static int create_empty_set(const mxfKey *key, MXFArena *arena, MXFMetadataSet **set)
 {
     MXFMetadataSet *newSet;
 
-    CHK_MALLOC_ORET(newSet, MXFMetadataSet);
+    if (arena)
+    {
+        CHK_ORET((newSet = (MXFMetadataSet*)mxf_arena_alloc(arena, sizeof(MXFMetadataSet))) != NULL);
+    }
+    else
+    {
+        CHK_MALLOC_ORET(newSet, MXFMetadataSet);
+    }
     memset(newSet, 0, sizeof(MXFMetadataSet));
     newSet->key = *key;
     newSet->instanceUID = g_Null_UUID;
+    newSet->arena = mxf_ref_arena(arena);
     mxf_initialise_list(&newSet->items, free_metadata_item_in_list);
+    mxf_set_list_arena(&newSet->items, arena);
+    mxf_hash_index_init(&newSet->itemIndex, offsetof(MXFMetadataItem, key));
 
     *set = newSet;
     return 1;
@@ -149,7 +321,13 @@ static int add_item(MXFMetadataSet *set, MXFMetadataItem *item)
     }
 
     CHK_ORET(mxf_append_list_element(&set->items, (void*)item));
+    if (!index_item(set, item))
+    {
+        mxf_remove_list_element(&set->items, (void*)item, eq_pointer);
+        return 0;
+    }
     item->set = set;
+    set->encodingGeneration = 0;
 
     return 1;
 }
@@ -404,7 +582,11 @@ int mxf_create_header_metadata(MXFHeaderMetadata **headerMetadata, MXFDataModel
     CHK_MALLOC_ORET(newHeaderMetadata, MXFHeaderMetadata);
     memset(newHeaderMetadata, 0, sizeof(MXFHeaderMetadata));
     newHeaderMetadata->dataModel = dataModel;
+    CHK_OFAIL(mxf_create_arena(&newHeaderMetadata->arena));
     mxf_initialise_list(&newHeaderMetadata->sets, free_metadata_set_in_list);
+    mxf_set_list_arena(&newHeaderMetadata->sets, newHeaderMetadata->arena);
+    mxf_hash_index_init(&newHeaderMetadata->setsByInstanceUID, offsetof(MXFMetadataSet, instanceUID));
+    mxf_hash_index_init(&newHeaderMetadata->setsByKey, offsetof(SetKeyGroup, key));
     CHK_OFAIL(mxf_create_primer_pack(&newHeaderMetadata->primerPack));
 
     *headerMetadata = newHeaderMetadata;
@@ -420,7 +602,7 @@ int mxf_create_set(MXFHeaderMetadata *headerMetadata, const mxfKey *key, MXFMeta
     MXFMetadataSet *newSet;
     mxfUUID uuid;
 
-    CHK_ORET(create_empty_set(key, &newSet));
+    CHK_ORET(create_empty_set(key, headerMetadata->arena, &newSet));
 
     mxf_generate_uuid(&uuid);
     newSet->instanceUID = uuid;
@@ -433,6 +615,10 @@ int mxf_create_set(MXFHeaderMetadata *headerMetadata, const mxfKey *key, MXFMeta
     return 1;
 
 fail:
+    if (newSet->headerMetadata != NULL)
+    {
+        mxf_remove_set(newSet->headerMetadata, newSet);
+    }
     mxf_free_set(&newSet);
     return 0;
 }
@@ -441,8 +627,16 @@ int mxf_create_item(MXFMetadataSet *set, const mxfKey *key, mxfLocalTag tag, MXF
 {
     MXFMetadataItem *newItem;
 
-    CHK_MALLOC_ORET(newItem, MXFMetadataItem);
+    if (set->arena)
+    {
+        CHK_ORET((newItem = (MXFMetadataItem*)mxf_arena_alloc(set->arena, sizeof(MXFMetadataItem))) != NULL);
+    }
+    else
+    {
+        CHK_MALLOC_ORET(newItem, MXFMetadataItem);
+    }
     memset(newItem, 0, sizeof(MXFMetadataItem));
+    newItem->arena = mxf_ref_arena(set->arena);
     newItem->tag = tag;
     newItem->isPersistent = 0;
     newItem->key = *key;
@@ -464,8 +658,13 @@ void mxf_free_header_metadata(MXFHeaderMetadata **headerMetadata)
         return;
     }
 
+    clear_set_indexes(*headerMetadata);
     mxf_clear_list(&(*headerMetadata)->sets);
     mxf_free_primer_pack(&(*headerMetadata)->primerPack);
+    SAFE_FREE((*headerMetadata)->encodings[0].data);
+    SAFE_FREE((*headerMetadata)->encodings[1].data);
+    /* the arena is only released here if none of its sets or items are still in use elsewhere */
+    mxf_unref_arena(&(*headerMetadata)->arena);
     SAFE_FREE(*headerMetadata);
 }
 
@@ -477,7 +676,18 @@ void mxf_free_set(MXFMetadataSet **set)
     }
 
     mxf_clear_list(&(*set)->items);
-    SAFE_FREE(*set);
+    mxf_hash_index_clear(&(*set)->itemIndex);
+    if ((*set)->arena)
+    {
+        /* the set is in the arena and so its arena pointer can't be passed in */
+        MXFArena *arena = (*set)->arena;
+        mxf_unref_arena(&arena);
+        *set = NULL;
+    }
+    else
+    {
+        SAFE_FREE(*set);
+    }
 }
 
 void mxf_free_item(MXFMetadataItem **item)
@@ -488,7 +698,17 @@ void mxf_free_item(MXFMetadataItem **item)
     }
 
     free_metadata_item_value(*item);
-    SAFE_FREE(*item);
+    if ((*item)->arena)
+    {
+        /* the item is in the arena and so its arena pointer can't be passed in */
+        MXFArena *arena = (*item)->arena;
+        mxf_unref_arena(&arena);
+        *item = NULL;
+    }
+    else
+    {
+        SAFE_FREE(*item);
+    }
 }
 
 
@@ -506,7 +726,14 @@ int mxf_add_set(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
     }
 
     CHK_ORET(mxf_append_list_element(&headerMetadata->sets, (void*)set));
+    if (!index_set(headerMetadata, set))
+    {
+        unindex_set(headerMetadata, set);
+        mxf_remove_list_element(&headerMetadata->sets, (void*)set, eq_pointer);
+        return 0;
+    }
     set->headerMetadata = headerMetadata;
+    set->encodingGeneration = 0;
 
     return 1;
 }
@@ -515,6 +742,7 @@ int mxf_add_set(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
 void mxf_set_fixed_set_space_allocation(MXFMetadataSet *set, uint64_t size)
 {
     set->fixedSpaceAllocation = size;
+    set->encodingGeneration = 0;
 }
 
 
@@ -564,7 +792,9 @@ int mxf_remove_set(MXFHeaderMetadata *headerMetadata, MXFMetadataSet *set)
 
     if ((result = mxf_remove_list_element(&headerMetadata->sets, (void*)set, eq_pointer)) != NULL)
     {
+        unindex_set(headerMetadata, set);
         set->headerMetadata = NULL;
+        set->encodingGeneration = 0;
         return 1;
     }
 
@@ -578,7 +808,9 @@ int mxf_remove_item(MXFMetadataSet *set, const mxfKey *itemKey, MXFMetadataItem
     if ((result = mxf_remove_list_element(&set->items, (void*)itemKey, item_eq_key)) != NULL)
     {
         *item = (MXFMetadataItem*)result;
+        unindex_item(set, *item);
         (*item)->set = NULL;
+        set->encodingGeneration = 0;
         return 1;
     }
 
@@ -589,16 +821,17 @@ int mxf_find_set_by_key(MXFHeaderMetadata *headerMetadata, const mxfKey *key, MX
 {
     MXFListIterator iter;
     MXFList *newList = NULL;
+    SetKeyGroup *group;
 
     CHK_ORET(mxf_create_list(&newList, NULL)); /* free func == NULL because newList doesn't own the data */
 
-    mxf_initialise_list_iter(&iter, &headerMetadata->sets);
-    while (mxf_next_list_iter_element(&iter))
+    group = (SetKeyGroup*)mxf_hash_index_find(&headerMetadata->setsByKey, key);
+    if (group != NULL)
     {
-        MXFMetadataSet *set = (MXFMetadataSet*)mxf_get_iter_element(&iter);
-        if (mxf_equals_key(key, &set->key))
+        mxf_initialise_list_iter(&iter, &group->sets);
+        while (mxf_next_list_iter_element(&iter))
         {
-            CHK_OFAIL(mxf_append_list_element(newList, (void*)set));
+            CHK_OFAIL(mxf_append_list_element(newList, mxf_get_iter_element(&iter)));
         }
     }
 
@@ -612,35 +845,33 @@ fail:
 
 int mxf_find_singular_set_by_key(MXFHeaderMetadata *headerMetadata, const mxfKey *key, MXFMetadataSet **set)
 {
-    MXFList *setList = NULL;
+    SetKeyGroup *group;
 
-    if (!mxf_find_set_by_key(headerMetadata, key, &setList))
+    group = (SetKeyGroup*)mxf_hash_index_find(&headerMetadata->setsByKey, key);
+    if (group == NULL)
     {
         return 0;
     }
-    if (mxf_get_list_length(setList) == 0)
-    {
-        mxf_free_list(&setList);
-        return 0;
-    }
-
-    CHK_OFAIL(mxf_get_list_length(setList) == 1);
 
-    *set = (MXFMetadataSet*)mxf_get_first_list_element(setList);
+    CHK_ORET(mxf_get_list_length(&group->sets) == 1);
 
-    mxf_free_list(&setList);
+    *set = (MXFMetadataSet*)mxf_get_first_list_element(&group->sets);
     return 1;
-
-fail:
-    mxf_free_list(&setList);
-    return 0;
 }
 
 int mxf_get_item(MXFMetadataSet *set, const mxfKey *key, MXFMetadataItem **resultItem)
 {
     void *result;
 
-    if ((result = mxf_find_list_element(&set->items, (void*)key, item_eq_key)) != NULL)
+    if (set->itemIndex.num_slots > 0)
+    {
+        result = mxf_hash_index_find(&set->itemIndex, key);
+    }
+    else
+    {
+        result = mxf_find_list_element(&set->items, (void*)key, item_eq_key);
+    }
+    if (result != NULL)
     {
         *resultItem = (MXFMetadataItem*)result;
         return 1;
@@ -875,7 +1106,7 @@ int mxf_read_and_return_set(MXFFile *mxfFile, const mxfKey *key, uint64_t len,
     /* only read sets with known definitions */
     if (mxf_find_set_def(headerMetadata->dataModel, key, &setDef))
     {
-        CHK_ORET(create_empty_set(key, &newSet));
+        CHK_ORET(create_empty_set(key, headerMetadata->arena, &newSet));
 
         /* read each item in the set*/
         haveInstanceUID = 0;
@@ -956,101 +1187,314 @@ int mxf_read_item_tl(MXFFile *mxfFile, mxfLocalTag *itemTag, uint16_t *itemLen)
 
 int mxf_read_item(MXFFile *mxfFile, MXFMetadataItem *item, uint16_t len)
 {
-    uint8_t buffer[65536];
-
-    CHK_ORET(mxf_file_read(mxfFile, buffer, len) == len);
+    free_metadata_item_value(item);
 
-    CHK_MALLOC_ARRAY_ORET(item->value, uint8_t, len);
-    memcpy(item->value, buffer, len);
+    /* the values of items read from file are allocated from the arena because they are rarely changed */
+    if (item->arena)
+    {
+        CHK_ORET((item->value = (uint8_t*)mxf_arena_alloc(item->arena, len > 0 ? len : 1)) != NULL);
+        item->isArenaValue = 1;
+    }
+    else
+    {
+        CHK_MALLOC_ARRAY_ORET(item->value, uint8_t, len > 0 ? len : 1);
+    }
+    if (mxf_file_read(mxfFile, item->value, len) != len)
+    {
+        mxf_log_error("Failed to read item value" LOG_LOC_FORMAT, LOG_LOC_PARAMS);
+        free_metadata_item_value(item);
+        return 0;
+    }
     item->length = len;
 
     return 1;
 }
 
-int mxf_write_header_metadata(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+static int have_set_encoding(MXFFile *mxfFile, MXFMetadataSet *set)
+{
+    MXFHeaderMetadata *headerMetadata = set->headerMetadata;
+
+    /* the set encoding is in the last serialization if it hasn't changed since then. The encoding also depends
+       on the file's minimum llen and the filler key */
+    return mxfFile != NULL &&
+           headerMetadata != NULL &&
+           set->encodingGeneration != 0 &&
+           set->encodingGeneration == headerMetadata->encodingGeneration &&
+           headerMetadata->encodingMinLLen == mxf_get_min_llen(mxfFile) &&
+           mxf_equals_key(&headerMetadata->encodingFillKey, &g_KLVFill_key);
+}
+
+static uint64_t get_set_len(MXFMetadataSet *set)
 {
-    CHK_ORET(mxf_write_header_primer_pack(mxfFile, headerMetadata));
-    CHK_ORET(mxf_write_header_sets(mxfFile, headerMetadata));
+    MXFListIterator iter;
+    uint64_t setLen = 0;
 
+    mxf_initialise_list_iter(&iter, &set->items);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        setLen += ((MXFMetadataItem*)mxf_get_iter_element(&iter))->length + 4;
+    }
+
+    return setLen;
+}
+
+static uint8_t get_set_llen(MXFFile *mxfFile, uint64_t setLen)
+{
+    uint8_t llen = mxf_get_llen(mxfFile, setLen);
+
+    /* spec says preferred 4-byte BER encoded len for sets */
+    if (llen < 4)
+    {
+        llen = 4;
+    }
+
+    return llen;
+}
+
+static int get_encoded_set_size(MXFFile *mxfFile, MXFMetadataSet *set, uint64_t setLen, uint64_t *size)
+{
+    uint64_t setSize = mxfKey_extlen + get_set_llen(mxfFile, setLen) + setLen;
+
+    if (set->fixedSpaceAllocation > 0)
+    {
+        /* check that we can achieve the fixed size, possibly using a filler */
+        CHK_ORET(setSize == set->fixedSpaceAllocation ||
+                 (setSize < set->fixedSpaceAllocation &&
+                     setSize + mxf_get_min_llen(mxfFile) + mxfKey_extlen <= set->fixedSpaceAllocation));
+        setSize = set->fixedSpaceAllocation;
+    }
+
+    *size = setSize;
     return 1;
 }
 
-int mxf_write_header_primer_pack(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+/* note: keep in sync with mxf_allocate_space */
+static int encode_fill(MXFFile *mxfFile, uint64_t size, uint8_t *buffer)
 {
-    CHK_ORET(mxf_write_primer_pack(mxfFile, headerMetadata->primerPack));
+    uint64_t fillSize;
+    uint8_t llen;
+
+    CHK_ORET(size >= (uint64_t)(mxf_get_min_llen(mxfFile) + mxfKey_extlen));
+
+    memcpy(buffer, &g_KLVFill_key, mxfKey_extlen);
+
+    fillSize = size - mxfKey_extlen;
+    llen = mxf_get_llen(mxfFile, fillSize);
+    assert(fillSize >= llen);
+    fillSize -= llen;
+
+    CHK_ORET(mxf_encode_fixed_l(llen, fillSize, &buffer[mxfKey_extlen]));
+    memset(&buffer[mxfKey_extlen + llen], 0, (size_t)fillSize);
 
     return 1;
 }
 
-int mxf_write_header_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+/* note: the buffer size must be at least the size returned by get_encoded_set_size */
+static int encode_set(MXFFile *mxfFile, MXFMetadataSet *set, uint64_t setLen, uint8_t *buffer)
 {
     MXFListIterator iter;
-    MXFMetadataSet *prefaceSet;
+    uint8_t llen = get_set_llen(mxfFile, setLen);
+    uint8_t *bufferPtr = buffer;
 
-    /* must write the Preface set first (and there must be a Preface set) */
-    CHK_ORET(mxf_find_singular_set_by_key(headerMetadata, &MXF_SET_K(Preface), &prefaceSet));
-    CHK_ORET(mxf_write_set(mxfFile, prefaceSet));
+    memcpy(bufferPtr, &set->key, mxfKey_extlen);
+    bufferPtr += mxfKey_extlen;
+    CHK_ORET(mxf_encode_fixed_l(llen, setLen, bufferPtr));
+    bufferPtr += llen;
 
-    mxf_initialise_list_iter(&iter, &headerMetadata->sets);
+    mxf_initialise_list_iter(&iter, &set->items);
     while (mxf_next_list_iter_element(&iter))
     {
-        MXFMetadataSet *set = (MXFMetadataSet*)mxf_get_iter_element(&iter);
+        MXFMetadataItem *item = (MXFMetadataItem*)mxf_get_iter_element(&iter);
 
-        if (!mxf_equals_key(&set->key, &MXF_SET_K(Preface)))
+        mxf_set_uint16(item->tag, bufferPtr);
+        mxf_set_uint16(item->length, &bufferPtr[2]);
+        if (item->length > 0)
         {
-            CHK_ORET(mxf_write_set(mxfFile, set));
+            memcpy(&bufferPtr[4], item->value, item->length);
         }
+        bufferPtr += 4 + item->length;
+        item->isPersistent = 1;
+    }
+
+    if (set->fixedSpaceAllocation > 0 && (uint64_t)(bufferPtr - buffer) < set->fixedSpaceAllocation)
+    {
+        /* add filler */
+        CHK_ORET(encode_fill(mxfFile, set->fixedSpaceAllocation - (uint64_t)(bufferPtr - buffer), bufferPtr));
     }
 
     return 1;
 }
 
-/* note: keep in sync with mxf_get_set_len */
-int mxf_write_set(MXFFile *mxfFile, MXFMetadataSet *set)
+static int reserve_encoding(MXFHeaderEncoding *encoding, uint64_t size)
 {
-    MXFListIterator iter;
-    uint64_t setLen = 0;
-    uint64_t setSize = 0;
+    uint8_t *newData;
+    uint64_t newAllocSize;
 
-    mxf_initialise_list_iter(&iter, &set->items);
-    while (mxf_next_list_iter_element(&iter))
+    if (size <= encoding->allocSize)
     {
-        setLen += ((MXFMetadataItem*)mxf_get_iter_element(&iter))->length + 4;
+        return 1;
     }
 
-    if (mxf_get_llen(mxfFile, setLen) <= 4)
+    newAllocSize = encoding->allocSize > 0 ? encoding->allocSize : 8192;
+    while (newAllocSize < size)
     {
-        /* spec says preferred 4-byte BER encoded len for sets */
-        CHK_ORET(mxf_write_fixed_kl(mxfFile, &set->key, 4, setLen));
-        setSize = mxfKey_extlen + 4 + setLen;
+        newAllocSize *= 2;
+    }
+
+    CHK_ORET((newData = (uint8_t*)realloc(encoding->data, (size_t)newAllocSize)) != NULL);
+    encoding->data = newData;
+    encoding->allocSize = newAllocSize;
+
+    return 1;
+}
+
+static int serialize_set(MXFFile *mxfFile, MXFMetadataSet *set, const MXFHeaderEncoding *prevEncoding,
+                         MXFHeaderEncoding *encoding, uint32_t generation)
+{
+    uint64_t setLen;
+    uint64_t setSize;
+
+    if (have_set_encoding(mxfFile, set))
+    {
+        setSize = set->encodingSize;
+        CHK_ORET(reserve_encoding(encoding, encoding->size + setSize));
+        memcpy(&encoding->data[encoding->size], &prevEncoding->data[set->encodingOffset], (size_t)setSize);
     }
     else
     {
-        CHK_ORET(mxf_write_kl(mxfFile, &set->key, setLen));
-        setSize = mxfKey_extlen + mxf_get_llen(mxfFile, setLen) + setLen;
+        setLen = get_set_len(set);
+        CHK_ORET(get_encoded_set_size(mxfFile, set, setLen, &setSize));
+        CHK_ORET(reserve_encoding(encoding, encoding->size + setSize));
+        CHK_ORET(encode_set(mxfFile, set, setLen, &encoding->data[encoding->size]));
     }
 
-    mxf_initialise_list_iter(&iter, &set->items);
-    while (mxf_next_list_iter_element(&iter))
+    set->encodingOffset = encoding->size;
+    set->encodingSize = setSize;
+    set->encodingGeneration = generation;
+    encoding->size += setSize;
+
+    return 1;
+}
+
+/* Serializes the (optional) primer pack followed by the sets into one buffer. Sets that haven't changed since
+   the last serialization are copied from the previous buffer rather than encoded again */
+static int serialize_header_metadata(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata, int includePrimerPack,
+                                     MXFHeaderEncoding **result)
+{
+    const MXFHeaderEncoding *prevEncoding = &headerMetadata->encodings[headerMetadata->currentEncoding];
+    MXFHeaderEncoding *encoding = &headerMetadata->encodings[!headerMetadata->currentEncoding];
+    MXFListIterator iter;
+    MXFMetadataSet *prefaceSet;
+    uint32_t generation;
+    uint64_t primerSize;
+
+    generation = headerMetadata->encodingGeneration + 1;
+    if (generation == 0)
     {
-        CHK_ORET(mxf_write_item(mxfFile, (MXFMetadataItem*)mxf_get_iter_element(&iter)));
+        generation = 1;
     }
 
-    if (set->fixedSpaceAllocation > 0)
+    encoding->size = 0;
+    if (includePrimerPack)
     {
-        /* check that we can achieve the fixed size, possibly using a filler */
-        CHK_ORET(setSize == set->fixedSpaceAllocation ||
-                 (setSize < set->fixedSpaceAllocation &&
-                     setSize + mxf_get_min_llen(mxfFile) + mxfKey_extlen <= set->fixedSpaceAllocation));
+        mxf_get_primer_pack_size(mxfFile, headerMetadata->primerPack, &primerSize);
+        CHK_ORET(reserve_encoding(encoding, primerSize));
+        CHK_ORET(mxf_encode_primer_pack(mxfFile, headerMetadata->primerPack, encoding->data));
+        encoding->size = primerSize;
+    }
+
+    /* must write the Preface set first (and there must be a Preface set) */
+    CHK_ORET(mxf_find_singular_set_by_key(headerMetadata, &MXF_SET_K(Preface), &prefaceSet));
+    CHK_ORET(serialize_set(mxfFile, prefaceSet, prevEncoding, encoding, generation));
 
-        if (setSize < set->fixedSpaceAllocation)
+    mxf_initialise_list_iter(&iter, &headerMetadata->sets);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        MXFMetadataSet *set = (MXFMetadataSet*)mxf_get_iter_element(&iter);
+
+        if (!mxf_equals_key(&set->key, &MXF_SET_K(Preface)))
         {
-            /* add filler */
-            CHK_ORET(mxf_write_fill(mxfFile, (uint32_t)(set->fixedSpaceAllocation - setSize)));
+            CHK_ORET(serialize_set(mxfFile, set, prevEncoding, encoding, generation));
         }
     }
 
+    headerMetadata->currentEncoding = !headerMetadata->currentEncoding;
+    headerMetadata->encodingGeneration = generation;
+    headerMetadata->encodingMinLLen = mxf_get_min_llen(mxfFile);
+    headerMetadata->encodingFillKey = g_KLVFill_key;
+
+    *result = encoding;
+    return 1;
+}
+
+int mxf_write_header_metadata(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+{
+    MXFHeaderEncoding *encoding;
+
+    CHK_ORET(serialize_header_metadata(mxfFile, headerMetadata, 1, &encoding));
+    CHK_ORET(encoding->size <= UINT32_MAX);
+    CHK_ORET(mxf_file_write(mxfFile, encoding->data, (uint32_t)encoding->size) == encoding->size);
+
+    return 1;
+}
+
+int mxf_write_header_primer_pack(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+{
+    CHK_ORET(mxf_write_primer_pack(mxfFile, headerMetadata->primerPack));
+
+    return 1;
+}
+
+int mxf_write_header_sets(MXFFile *mxfFile, MXFHeaderMetadata *headerMetadata)
+{
+    MXFHeaderEncoding *encoding;
+
+    CHK_ORET(serialize_header_metadata(mxfFile, headerMetadata, 0, &encoding));
+    CHK_ORET(encoding->size <= UINT32_MAX);
+    CHK_ORET(mxf_file_write(mxfFile, encoding->data, (uint32_t)encoding->size) == encoding->size);
+
+    return 1;
+}
+
+int mxf_write_set(MXFFile *mxfFile, MXFMetadataSet *set)
+{
+    uint8_t stackBuffer[1024];
+    uint8_t *buffer = stackBuffer;
+    uint64_t setLen;
+    uint64_t setSize;
+
+    if (have_set_encoding(mxfFile, set))
+    {
+        MXFHeaderMetadata *headerMetadata = set->headerMetadata;
+        const uint8_t *encodedSet = &headerMetadata->encodings[headerMetadata->currentEncoding].data[set->encodingOffset];
+
+        CHK_ORET(mxf_file_write(mxfFile, encodedSet, (uint32_t)set->encodingSize) == set->encodingSize);
+        return 1;
+    }
+
+    setLen = get_set_len(set);
+    CHK_ORET(get_encoded_set_size(mxfFile, set, setLen, &setSize));
+    CHK_ORET(setSize <= UINT32_MAX);
+    if (setSize > sizeof(stackBuffer))
+    {
+        CHK_MALLOC_ARRAY_ORET(buffer, uint8_t, (size_t)setSize);
+    }
+
+    CHK_OFAIL(encode_set(mxfFile, set, setLen, buffer));
+    CHK_OFAIL(mxf_file_write(mxfFile, buffer, (uint32_t)setSize) == setSize);
+
+    if (buffer != stackBuffer)
+    {
+        SAFE_FREE(buffer);
+    }
     return 1;
+
+fail:
+    if (buffer != stackBuffer)
+    {
+        SAFE_FREE(buffer);
+    }
+    return 0;
 }
 
 int mxf_write_item(MXFFile *mxfFile, MXFMetadataItem *item)
@@ -1078,32 +1522,22 @@ void mxf_get_header_metadata_size(MXFFile *mxfFile, MXFHeaderMetadata *headerMet
     }
 }
 
-/* note: keep in sync with mxf_write_set */
 uint64_t mxf_get_set_size(MXFFile *mxfFile, MXFMetadataSet *set)
 {
-    MXFListIterator iter;
-    uint64_t len;
-    uint8_t llen;
+    uint64_t setLen;
 
     if (set->fixedSpaceAllocation > 0)
     {
         return set->fixedSpaceAllocation;
     }
 
-    len = 0;
-    mxf_initialise_list_iter(&iter, &set->items);
-    while (mxf_next_list_iter_element(&iter))
+    if (have_set_encoding(mxfFile, set))
     {
-        len += ((MXFMetadataItem*)mxf_get_iter_element(&iter))->length + 4;
-    }
-    llen = mxf_get_llen(mxfFile, len);
-    if (llen < 4)
-    {
-        /* spec says preferred 4-byte BER encoded len for sets */
-        llen = 4;
+        return set->encodingSize;
     }
 
-    return mxfKey_extlen + len + llen;
+    setLen = get_set_len(set);
+    return mxfKey_extlen + get_set_llen(mxfFile, setLen) + setLen;
 }
 
 
@@ -1415,7 +1849,7 @@ int mxf_dereference(MXFHeaderMetadata *headerMetadata, const mxfUUID *uuid, MXFM
 {
     void *result;
 
-    if ((result = mxf_find_list_element(&headerMetadata->sets, (void*)uuid, set_eq_instanceuid)) == NULL)
+    if ((result = mxf_hash_index_find(&headerMetadata->setsByInstanceUID, uuid)) == NULL)
     {
         return 0;
     }
@@ -1448,56 +1882,14 @@ int mxf_get_weakref_s(MXFHeaderMetadata *headerMetadata, MXFListIterator *setsIt
     return mxf_dereference_s(headerMetadata, setsIter, &uuid, set);
 }
 
-/* this will be faster is we de-reference multiple sets in the same order as they were written */
+/* the sets iterator is no longer used for the search because mxf_dereference() uses the instanceUID index.
+   The function is kept for compatibility and the iterator is left unchanged */
 int mxf_dereference_s(MXFHeaderMetadata *headerMetadata, MXFListIterator *setsIter, const mxfUUID *uuid,
                       MXFMetadataSet **set)
 {
-    MXFMetadataSet *setInList;
-    size_t startIndex = mxf_get_list_iter_index(setsIter);
-    MXFListIterator origSetsIter;
-
-    mxf_copy_list_iter(setsIter, &origSetsIter);
-
-    /* try find it at the previous position in the list */
-    if (startIndex != MXF_LIST_NPOS)
-    {
-        setInList = (MXFMetadataSet*)mxf_get_iter_element(setsIter);
-        if (mxf_equals_uuid(uuid, &setInList->instanceUID))
-        {
-            *set = setInList;
-            return 1;
-        }
-    }
+    (void)setsIter;
 
-    /* try find it starting from the previous position in the list */
-    while (mxf_next_list_iter_element(setsIter))
-    {
-        setInList = (MXFMetadataSet*)mxf_get_iter_element(setsIter);
-
-        if (mxf_equals_uuid(uuid, &setInList->instanceUID))
-        {
-            *set = setInList;
-            return 1;
-        }
-    }
-
-    /* go back to beginning and try find it before the previous position in the list */
-    mxf_initialise_sets_iter(headerMetadata, setsIter);
-    while (mxf_next_list_iter_element(setsIter) &&
-           (startIndex == MXF_LIST_NPOS || mxf_get_list_iter_index(setsIter) < startIndex))
-    {
-        setInList = (MXFMetadataSet*)mxf_get_iter_element(setsIter);
-
-        if (mxf_equals_uuid(uuid, &setInList->instanceUID))
-        {
-            *set = setInList;
-            return 1;
-        }
-    }
-
-    mxf_copy_list_iter(&origSetsIter, setsIter);
-
-    return 0;
+    return mxf_dereference(headerMetadata, uuid, set);
 }
 
 
@@ -1815,6 +2207,10 @@ int mxf_alloc_item_value(MXFMetadataItem *item, uint16_t len, uint8_t **value)
     }
     item->isPersistent = 0;
     item->length = len;
+    if (item->set)
+    {
+        item->set->encodingGeneration = 0;
+    }
 
     *value = item->value;
     return 1;
@@ -1824,6 +2220,10 @@ int mxf_complete_item_value(MXFMetadataItem *item, uint16_t len)
 {
     CHK_ORET(len <= item->length);
     item->length = len;
+    if (item->set)
+    {
+        item->set->encodingGeneration = 0;
+    }
 
     return 1;
 }
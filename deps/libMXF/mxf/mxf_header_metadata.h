@@ -94,7 +94,9 @@ typedef struct
     int isPersistent;
     uint16_t length;
     uint8_t *value;
+    int isArenaValue;
     struct MXFMetadataSet *set;
+    MXFArena *arena;
 } MXFMetadataItem;
 
 typedef struct MXFMetadataSet
@@ -102,15 +104,35 @@ typedef struct MXFMetadataSet
     mxfKey key;
     mxfUUID instanceUID;
     MXFList items;
+    MXFHashIndex itemIndex;     /* only used once the set has a minimum number of items */
     struct MXFHeaderMetadata *headerMetadata;
     uint64_t fixedSpaceAllocation;
+    MXFArena *arena;
+    uint64_t encodingOffset;    /* position of the set in the header metadata's last serialization */
+    uint64_t encodingSize;
+    uint32_t encodingGeneration; /* 0 if the set has changed since it was last serialized */
 } MXFMetadataSet;
 
+typedef struct
+{
+    uint8_t *data;
+    uint64_t size;
+    uint64_t allocSize;
+} MXFHeaderEncoding;
+
 typedef struct MXFHeaderMetadata
 {
     MXFDataModel *dataModel;
     MXFPrimerPack *primerPack;
     MXFList sets;
+    MXFHashIndex setsByInstanceUID;
+    MXFHashIndex setsByKey;
+    MXFArena *arena;            /* sets, items, read item values and list elements are allocated from the arena */
+    MXFHeaderEncoding encodings[2]; /* the last serialization and the buffer for the next one */
+    int currentEncoding;
+    uint32_t encodingGeneration;
+    uint8_t encodingMinLLen;
+    mxfKey encodingFillKey;
 } MXFHeaderMetadata;
 
 typedef struct
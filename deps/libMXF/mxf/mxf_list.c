@@ -37,12 +37,38 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <assert.h>
 
 #include <mxf/mxf.h>
 #include <mxf/mxf_macros.h>
 
 
 
+static MXFListElement* alloc_element(MXFList *list, void *data)
+{
+    MXFListElement *element;
+
+    if (list->arena) {
+        element = (MXFListElement*)mxf_arena_alloc(list->arena, sizeof(MXFListElement));
+        if (!element)
+            return NULL;
+    } else {
+        CHK_MALLOC_ORET(element, MXFListElement);
+    }
+    memset(element, 0, sizeof(MXFListElement));
+    element->data = data;
+
+    return element;
+}
+
+static void free_element(MXFList *list, MXFListElement **element)
+{
+    /* elements allocated from an arena are released with the arena */
+    if (!list->arena)
+        free(*element);
+    *element = NULL;
+}
+
 static void* remove_list_element(MXFList *list, MXFListElement *element, MXFListElement *prevElement)
 {
     void *data = element->data;
@@ -57,7 +83,7 @@ static void* remove_list_element(MXFList *list, MXFListElement *element, MXFList
             list->lastElement = prevElement;
     }
 
-    SAFE_FREE(element); /* must free the wrapper element because we only return the data */
+    free_element(list, &element); /* must free the wrapper element because we only return the data */
     list->len--;
 
     return data;
@@ -91,6 +117,13 @@ void mxf_initialise_list(MXFList *list, free_func_type freeFunc)
     list->freeFunc = freeFunc;
 }
 
+void mxf_set_list_arena(MXFList *list, MXFArena *arena)
+{
+    /* the owner of the list must hold a reference to the arena for as long as the list exists */
+    assert(list->len == 0);
+    list->arena = arena;
+}
+
 void mxf_clear_list(MXFList *list)
 {
     MXFListElement *element;
@@ -105,7 +138,7 @@ void mxf_clear_list(MXFList *list)
 
         if (list->freeFunc)
             list->freeFunc(element->data);
-        SAFE_FREE(element);
+        free_element(list, &element);
 
         element = nextElement;
     }
@@ -121,9 +154,7 @@ int mxf_append_list_element(MXFList *list, void *data)
 
     CHK_ORET(list->len + 1 != MXF_LIST_NPOS);
 
-    CHK_MALLOC_ORET(newElement, MXFListElement);
-    memset(newElement, 0, sizeof(MXFListElement));
-    newElement->data = data;
+    CHK_ORET((newElement = alloc_element(list, data)) != NULL);
 
     if (!list->elements)
         list->elements = newElement;
@@ -141,9 +172,7 @@ int mxf_prepend_list_element(MXFList *list, void *data)
 
     CHK_ORET(list->len + 1 != MXF_LIST_NPOS);
 
-    CHK_MALLOC_ORET(newElement, MXFListElement);
-    memset(newElement, 0, sizeof(MXFListElement));
-    newElement->data = data;
+    CHK_ORET((newElement = alloc_element(list, data)) != NULL);
 
     if (!list->elements) {
         list->elements = newElement;
@@ -169,9 +198,7 @@ int mxf_insert_list_element(MXFList *list, size_t index, int before, void *data)
         return 0;
 
     /* create new element */
-    CHK_MALLOC_ORET(newElement, MXFListElement);
-    memset(newElement, 0, sizeof(MXFListElement));
-    newElement->data = data;
+    CHK_ORET((newElement = alloc_element(list, data)) != NULL);
 
     /* special case when list is empty */
     if (!list->elements) {
@@ -217,7 +244,7 @@ int mxf_insert_list_element(MXFList *list, size_t index, int before, void *data)
     return 1;
 
 fail:
-    SAFE_FREE(newElement);
+    free_element(list, &newElement);
     return 0;
 }
 
@@ -56,6 +56,7 @@ typedef struct
     MXFListElement *lastElement;
     size_t len;
     free_func_type freeFunc;
+    struct MXFArena *arena;
 } MXFList;
 
 typedef struct
@@ -72,6 +73,7 @@ static const size_t MXF_LIST_NPOS = (size_t)(-1);
 int mxf_create_list(MXFList **list, free_func_type freeFunc);
 void mxf_free_list(MXFList **list);
 void mxf_initialise_list(MXFList *list, free_func_type freeFunc);
+void mxf_set_list_arena(MXFList *list, struct MXFArena *arena);
 void mxf_clear_list(MXFList *list);
 
 int mxf_append_list_element(MXFList *list, void *data);
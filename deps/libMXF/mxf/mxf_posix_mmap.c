@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_posix_mmap.h>
+#include <mxf/mxf_macros.h>
+
+
+/* the view size is limited on 32-bit systems to avoid exhausting the address space */
+#define DEFAULT_VIEW_SIZE_64    (256 * 1024 * 1024)   // 256 MB
+#define DEFAULT_VIEW_SIZE_32    (32 * 1024 * 1024)    // 32 MB
+
+
+struct MXFFileSysData
+{
+    int fd;
+    int advice;
+
+    uint64_t pageSize;
+    uint64_t defaultViewSize;
+
+    uint64_t fileSize;  // last known size of the file on disk
+
+    uint64_t offset;    // location of pData in file
+    uint8_t *pData;     // pointer to memory mapped data
+    uint64_t size;      // number of bytes in pData
+
+    uint64_t position;  // read position in file
+    int eof;
+};
+
+
+static int update_file_size(MXFFileSysData *sysData)
+{
+    struct stat statBuf;
+    char errorBuf[128];
+
+    if (fstat(sysData->fd, &statBuf) != 0) {
+        mxf_log_error("fstat failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        return 0;
+    }
+
+    sysData->fileSize = statBuf.st_size;
+    return 1;
+}
+
+static void unmap_view(MXFFileSysData *sysData)
+{
+    if (sysData->pData) {
+        munmap(sysData->pData, (size_t)sysData->size);
+        sysData->pData = NULL;
+    }
+    sysData->offset = 0;
+    sysData->size = 0;
+}
+
+static int map_view(MXFFileSysData *sysData)
+{
+    uint64_t newOffset;
+    uint64_t viewSize;
+    void *pData;
+    char errorBuf[128];
+
+    unmap_view(sysData);
+
+    // the file may have grown since the size was last checked
+    if (sysData->position >= sysData->fileSize) {
+        if (!update_file_size(sysData) || sysData->position >= sysData->fileSize)
+            return 0;
+    }
+
+    newOffset = sysData->position - sysData->position % sysData->pageSize;
+    viewSize = sysData->defaultViewSize;
+    if (newOffset + viewSize > sysData->fileSize)
+        viewSize = sysData->fileSize - newOffset;
+
+    pData = mmap(NULL, (size_t)viewSize, PROT_READ, MAP_SHARED, sysData->fd, (off_t)newOffset);
+    if (pData == MAP_FAILED) {
+        mxf_log_error("mmap failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        return 0;
+    }
+    if (sysData->advice != POSIX_MADV_NORMAL)
+        posix_madvise(pData, (size_t)viewSize, sysData->advice);
+
+    sysData->pData = (uint8_t*)pData;
+    sysData->offset = newOffset;
+    sysData->size = viewSize;
+
+    return 1;
+}
+
+static int in_view(MXFFileSysData *sysData)
+{
+    return sysData->pData &&
+           sysData->position >= sysData->offset &&
+           sysData->position < sysData->offset + sysData->size;
+}
+
+
+static void mxf_posix_mmap_close(MXFFileSysData *sysData)
+{
+    unmap_view(sysData);
+    if (sysData->fd >= 0) {
+        close(sysData->fd);
+        sysData->fd = -1;
+    }
+}
+
+static uint32_t mxf_posix_mmap_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    uint32_t total_read = 0;
+    uint64_t avail;
+
+    while (total_read < count) {
+        if (!in_view(sysData) && !map_view(sysData))
+            break;
+
+        avail = sysData->offset + sysData->size - sysData->position;
+        if (avail > count - total_read)
+            avail = count - total_read;
+
+        memcpy(data + total_read, sysData->pData + (sysData->position - sysData->offset), (size_t)avail);
+        sysData->position += avail;
+        total_read += (uint32_t)avail;
+    }
+
+    if (total_read < count)
+        sysData->eof = 1;
+
+    return total_read;
+}
+
+static uint32_t mxf_posix_mmap_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    (void)sysData;
+    (void)data;
+    (void)count;
+
+    mxf_log_error("Memory mapped file is opened read-only\n");
+    return 0;
+}
+
+static int mxf_posix_mmap_getchar(MXFFileSysData *sysData)
+{
+    int c;
+
+    if (!in_view(sysData) && !map_view(sysData)) {
+        sysData->eof = 1;
+        return EOF;
+    }
+
+    c = sysData->pData[sysData->position - sysData->offset];
+    sysData->position++;
+
+    return c;
+}
+
+static int mxf_posix_mmap_putchar(MXFFileSysData *sysData, int c)
+{
+    (void)sysData;
+    (void)c;
+
+    mxf_log_error("Memory mapped file is opened read-only\n");
+    return EOF;
+}
+
+static int mxf_posix_mmap_eof(MXFFileSysData *sysData)
+{
+    return sysData->eof;
+}
+
+static int mxf_posix_mmap_seek(MXFFileSysData *sysData, int64_t offset, int whence)
+{
+    int64_t newPosition;
+
+    switch (whence)
+    {
+        case SEEK_SET:
+            newPosition = offset;
+            break;
+        case SEEK_CUR:
+            newPosition = (int64_t)sysData->position + offset;
+            break;
+        case SEEK_END:
+            if (!update_file_size(sysData))
+                return 0;
+            newPosition = (int64_t)sysData->fileSize + offset;
+            break;
+        default:
+            return 0;
+    }
+    if (newPosition < 0)
+        return 0;
+
+    // the view is remapped on the next read if the new position is outside of it
+    sysData->position = newPosition;
+    sysData->eof = 0;
+
+    return 1;
+}
+
+static int64_t mxf_posix_mmap_tell(MXFFileSysData *sysData)
+{
+    return sysData->position;
+}
+
+static int mxf_posix_mmap_is_seekable(MXFFileSysData *sysData)
+{
+    (void)sysData;
+    return 1;
+}
+
+static int64_t mxf_posix_mmap_size(MXFFileSysData *sysData)
+{
+    if (!update_file_size(sysData))
+        return -1;
+
+    return sysData->fileSize;
+}
+
+static void free_posix_mmap(MXFFileSysData *sysData)
+{
+    SAFE_FREE(sysData);
+}
+
+
+int mxf_posix_mmap_open_read(const char *filename, int flags, MXFFile **mxfFile)
+{
+    MXFFile *newMXFFile = NULL;
+    MXFFileSysData *newMMapFile = NULL;
+    struct stat statBuf;
+    char errorBuf[128];
+
+    CHK_MALLOC_OFAIL(newMXFFile, MXFFile);
+    memset(newMXFFile, 0, sizeof(MXFFile));
+    CHK_MALLOC_OFAIL(newMMapFile, MXFFileSysData);
+    memset(newMMapFile, 0, sizeof(MXFFileSysData));
+    newMMapFile->fd = -1;
+
+    newMMapFile->fd = open(filename, O_RDONLY);
+    if (newMMapFile->fd < 0) {
+        mxf_log_error("Failed to open '%s': %s\n", filename, mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        goto fail;
+    }
+
+    if (fstat(newMMapFile->fd, &statBuf) != 0) {
+        mxf_log_error("fstat failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        goto fail;
+    }
+    if (!S_ISREG(statBuf.st_mode)) {
+        mxf_log_error("Memory mapped file I/O requires a regular file\n");
+        goto fail;
+    }
+    newMMapFile->fileSize = statBuf.st_size;
+
+    newMMapFile->pageSize = mxf_get_system_page_size();
+    if (sizeof(void*) >= 8)
+        newMMapFile->defaultViewSize = DEFAULT_VIEW_SIZE_64;
+    else
+        newMMapFile->defaultViewSize = DEFAULT_VIEW_SIZE_32;
+    if (newMMapFile->defaultViewSize % newMMapFile->pageSize)
+        newMMapFile->defaultViewSize += newMMapFile->pageSize - newMMapFile->defaultViewSize % newMMapFile->pageSize;
+
+    if (flags & MXF_POSIX_FLAG_SEQUENTIAL_SCAN)
+        newMMapFile->advice = POSIX_MADV_SEQUENTIAL;
+    else if (flags & MXF_POSIX_FLAG_RANDOM_ACCESS)
+        newMMapFile->advice = POSIX_MADV_RANDOM;
+    else
+        newMMapFile->advice = POSIX_MADV_NORMAL;
+
+    newMXFFile->close         = mxf_posix_mmap_close;
+    newMXFFile->read          = mxf_posix_mmap_read;
+    newMXFFile->write         = mxf_posix_mmap_write;
+    newMXFFile->get_char      = mxf_posix_mmap_getchar;
+    newMXFFile->put_char      = mxf_posix_mmap_putchar;
+    newMXFFile->eof           = mxf_posix_mmap_eof;
+    newMXFFile->seek          = mxf_posix_mmap_seek;
+    newMXFFile->tell          = mxf_posix_mmap_tell;
+    newMXFFile->is_seekable   = mxf_posix_mmap_is_seekable;
+    newMXFFile->size          = mxf_posix_mmap_size;
+
+    newMXFFile->free_sys_data = free_posix_mmap;
+    newMXFFile->sysData       = newMMapFile;
+
+    *mxfFile = newMXFFile;
+    return 1;
+
+fail:
+    if (newMMapFile && newMMapFile->fd >= 0)
+        close(newMMapFile->fd);
+    SAFE_FREE(newMMapFile);
+    SAFE_FREE(newMXFFile);
+    return 0;
+}
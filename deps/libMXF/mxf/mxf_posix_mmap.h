@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef MXF_POSIX_MMAP_H_
+#define MXF_POSIX_MMAP_H_
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+#include <mxf/mxf_file.h>
+
+
+#define MXF_POSIX_FLAG_DEFAULT              0x00
+#define MXF_POSIX_FLAG_SEQUENTIAL_SCAN      0x01
+#define MXF_POSIX_FLAG_RANDOM_ACCESS        0x02
+
+
+/* Open a regular file for reading using a memory mapped view.
+   The view is remapped when the read position moves outside of it and the file size is re-checked
+   when reading beyond the last known end of file, allowing files that are still growing to be read.
+   Note that the process will receive a SIGBUS if the file is truncated whilst it is mapped */
+int mxf_posix_mmap_open_read(const char *filename, int flags, MXFFile **mxfFile);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
@@ -0,0 +1,842 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#if defined(HAVE_LINUX_IO_URING_H)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define HAVE_IO_URING
+#endif
+#endif
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_prefetch_file.h>
+#include <mxf/mxf_macros.h>
+
+
+#define READ_BUFFER_SIZE    (64 * 1024)
+#define MAX_THREADS         4
+
+
+typedef enum
+{
+    SLOT_IDLE = 0,
+    SLOT_QUEUED,
+    SLOT_READING,
+    SLOT_DONE,
+} SlotState;
+
+typedef struct
+{
+    /* owned by the reader */
+    int inUse;
+    int64_t offset;
+    uint32_t size;
+    uint8_t *data;
+    uint32_t allocSize;
+    struct iovec iov;
+
+    /* shared with the threads and protected by the mutex */
+    SlotState state;
+    uint32_t result;
+} PrefetchSlot;
+
+#if defined(HAVE_IO_URING)
+typedef struct
+{
+    int fd;
+    unsigned numEntries;
+    unsigned *sqHead;
+    unsigned *sqTail;
+    unsigned *sqMask;
+    unsigned *sqArray;
+    unsigned *cqHead;
+    unsigned *cqTail;
+    unsigned *cqMask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *sqRing;
+    size_t sqRingSize;
+    void *cqRing;
+    size_t cqRingSize;
+    size_t sqesSize;
+    unsigned numUnsubmitted;
+} IOURing;
+#endif
+
+struct MXFFileSysData
+{
+    int fd;
+    int64_t position;
+    int eof;
+
+    uint8_t *readBuffer;
+    int64_t readBufferStart;
+    uint32_t readBufferFill;
+
+    PrefetchSlot *slots;
+    uint32_t numSlots;
+
+#if defined(HAVE_IO_URING)
+    int useIOUring;
+    IOURing ring;
+#endif
+
+    int haveSync;
+    pthread_mutex_t mutex;
+    pthread_cond_t queuedCond;
+    pthread_cond_t doneCond;
+    pthread_t threads[MAX_THREADS];
+    uint32_t numThreads;
+    int stopThreads;
+};
+
+
+
+static uint32_t pread_all(int fd, uint8_t *data, uint32_t count, int64_t offset)
+{
+    char errorBuf[128];
+    uint32_t total = 0;
+    ssize_t numRead;
+
+    while (total < count) {
+        numRead = pread(fd, &data[total], count - total, (off_t)(offset + total));
+        if (numRead < 0) {
+            if (errno == EINTR)
+                continue;
+            mxf_log_error("pread failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+            break;
+        }
+        if (numRead == 0)
+            break;
+        total += (uint32_t)numRead;
+    }
+
+    return total;
+}
+
+
+#if defined(HAVE_IO_URING)
+
+static int ring_setup(IOURing *ring, unsigned entries)
+{
+    struct io_uring_params params;
+    void *ptr;
+
+    memset(ring, 0, sizeof(*ring));
+    memset(&params, 0, sizeof(params));
+
+    ring->fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0)
+        return 0;
+    ring->numEntries = params.sq_entries;
+
+    ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cqRingSize > ring->sqRingSize)
+            ring->sqRingSize = ring->cqRingSize;
+        ring->cqRingSize = ring->sqRingSize;
+    }
+
+    ptr = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+               ring->fd, IORING_OFF_SQ_RING);
+    if (ptr == MAP_FAILED)
+        goto fail;
+    ring->sqRing = ptr;
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->cqRing = ring->sqRing;
+    } else {
+        ptr = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                   ring->fd, IORING_OFF_CQ_RING);
+        if (ptr == MAP_FAILED)
+            goto fail;
+        ring->cqRing = ptr;
+    }
+
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ptr = mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+               ring->fd, IORING_OFF_SQES);
+    if (ptr == MAP_FAILED)
+        goto fail;
+    ring->sqes = (struct io_uring_sqe*)ptr;
+
+    ring->sqHead  = (unsigned*)((uint8_t*)ring->sqRing + params.sq_off.head);
+    ring->sqTail  = (unsigned*)((uint8_t*)ring->sqRing + params.sq_off.tail);
+    ring->sqMask  = (unsigned*)((uint8_t*)ring->sqRing + params.sq_off.ring_mask);
+    ring->sqArray = (unsigned*)((uint8_t*)ring->sqRing + params.sq_off.array);
+    ring->cqHead  = (unsigned*)((uint8_t*)ring->cqRing + params.cq_off.head);
+    ring->cqTail  = (unsigned*)((uint8_t*)ring->cqRing + params.cq_off.tail);
+    ring->cqMask  = (unsigned*)((uint8_t*)ring->cqRing + params.cq_off.ring_mask);
+    ring->cqes    = (struct io_uring_cqe*)((uint8_t*)ring->cqRing + params.cq_off.cqes);
+
+    return 1;
+
+fail:
+    if (ring->sqRing)
+        munmap(ring->sqRing, ring->sqRingSize);
+    if (ring->cqRing && ring->cqRing != ring->sqRing)
+        munmap(ring->cqRing, ring->cqRingSize);
+    close(ring->fd);
+    memset(ring, 0, sizeof(*ring));
+    return 0;
+}
+
+static void ring_close(IOURing *ring)
+{
+    if (ring->sqes)
+        munmap(ring->sqes, ring->sqesSize);
+    if (ring->cqRing && ring->cqRing != ring->sqRing)
+        munmap(ring->cqRing, ring->cqRingSize);
+    if (ring->sqRing)
+        munmap(ring->sqRing, ring->sqRingSize);
+    close(ring->fd);
+    memset(ring, 0, sizeof(*ring));
+}
+
+static int ring_enter(IOURing *ring, unsigned minComplete)
+{
+    char errorBuf[128];
+    int result;
+
+    for (;;) {
+        result = (int)syscall(__NR_io_uring_enter, ring->fd, ring->numUnsubmitted, minComplete,
+                              minComplete > 0 ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+        if (result >= 0)
+            break;
+        if (errno == EINTR)
+            continue;
+        /* entries that could not be submitted stay in the queue and are submitted by the next call */
+        if (errno == EAGAIN || errno == EBUSY)
+            return minComplete == 0;
+        mxf_log_error("io_uring_enter failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        return 0;
+    }
+
+    ring->numUnsubmitted -= (unsigned)result;
+    return 1;
+}
+
+static int ring_queue_read(IOURing *ring, int fd, PrefetchSlot *slot, uint64_t userData)
+{
+    struct io_uring_sqe *sqe;
+    unsigned tail = *ring->sqTail;
+    unsigned head = __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    unsigned index;
+
+    if (tail - head >= ring->numEntries)
+        return 0;
+
+    index = tail & *ring->sqMask;
+    sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode    = IORING_OP_READV;
+    sqe->fd        = fd;
+    sqe->addr      = (uint64_t)(uintptr_t)&slot->iov;
+    sqe->len       = 1;
+    sqe->off       = (uint64_t)slot->offset;
+    sqe->user_data = userData;
+    ring->sqArray[index] = index;
+
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+    ring->numUnsubmitted++;
+
+    return 1;
+}
+
+static void ring_reap(MXFFileSysData *sysData)
+{
+    IOURing *ring = &sysData->ring;
+    struct io_uring_cqe *cqe;
+    PrefetchSlot *slot;
+    unsigned head = *ring->cqHead;
+    unsigned tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+
+    while (head != tail) {
+        cqe = &ring->cqes[head & *ring->cqMask];
+        slot = &sysData->slots[cqe->user_data];
+        if (cqe->res < 0) {
+            mxf_log_debug("Prefetch read at 0x%" PRIx64 " failed: %d\n", slot->offset, -cqe->res);
+            slot->result = 0;
+        } else {
+            slot->result = (uint32_t)cqe->res;
+        }
+        slot->state = SLOT_DONE;
+        head++;
+    }
+
+    __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+}
+
+#endif
+
+
+static void* prefetch_thread(void *arg)
+{
+    MXFFileSysData *sysData = (MXFFileSysData*)arg;
+    PrefetchSlot *slot;
+    uint32_t result;
+    uint32_t i;
+
+    pthread_mutex_lock(&sysData->mutex);
+    for (;;) {
+        slot = NULL;
+        for (i = 0; i < sysData->numSlots; i++) {
+            if (sysData->slots[i].state == SLOT_QUEUED) {
+                slot = &sysData->slots[i];
+                break;
+            }
+        }
+        if (!slot) {
+            if (sysData->stopThreads)
+                break;
+            pthread_cond_wait(&sysData->queuedCond, &sysData->mutex);
+            continue;
+        }
+
+        slot->state = SLOT_READING;
+        pthread_mutex_unlock(&sysData->mutex);
+
+        result = pread_all(sysData->fd, slot->data, slot->size, slot->offset);
+
+        pthread_mutex_lock(&sysData->mutex);
+        slot->result = result;
+        slot->state = SLOT_DONE;
+        pthread_cond_broadcast(&sysData->doneCond);
+    }
+    pthread_mutex_unlock(&sysData->mutex);
+
+    return NULL;
+}
+
+static int start_threads(MXFFileSysData *sysData)
+{
+    char errorBuf[128];
+    uint32_t numThreads;
+    int result;
+
+    numThreads = (sysData->numSlots < MAX_THREADS ? sysData->numSlots : MAX_THREADS);
+    while (sysData->numThreads < numThreads) {
+        result = pthread_create(&sysData->threads[sysData->numThreads], NULL, prefetch_thread, sysData);
+        if (result != 0) {
+            mxf_log_error("Failed to create prefetch thread: %s\n", mxf_strerror(result, errorBuf, sizeof(errorBuf)));
+            return 0;
+        }
+        sysData->numThreads++;
+    }
+
+    return 1;
+}
+
+static void stop_threads(MXFFileSysData *sysData)
+{
+    uint32_t i;
+
+    if (sysData->numThreads == 0)
+        return;
+
+    pthread_mutex_lock(&sysData->mutex);
+    sysData->stopThreads = 1;
+    for (i = 0; i < sysData->numSlots; i++) {
+        /* slots that have not started are not read */
+        if (sysData->slots[i].state == SLOT_QUEUED)
+            sysData->slots[i].state = SLOT_DONE;
+    }
+    pthread_cond_broadcast(&sysData->queuedCond);
+    pthread_mutex_unlock(&sysData->mutex);
+
+    for (i = 0; i < sysData->numThreads; i++)
+        pthread_join(sysData->threads[i], NULL);
+    sysData->numThreads = 0;
+}
+
+
+static int submit_slot(MXFFileSysData *sysData, PrefetchSlot *slot)
+{
+    slot->result   = 0;
+    slot->iov.iov_base = slot->data;
+    slot->iov.iov_len  = slot->size;
+
+#if defined(HAVE_IO_URING)
+    if (sysData->useIOUring) {
+        if (!ring_queue_read(&sysData->ring, sysData->fd, slot, (uint64_t)(slot - sysData->slots)))
+            return 0;
+        slot->state = SLOT_QUEUED;
+        /* a failure is reported when waiting for the slot if the entry is still not submitted */
+        ring_enter(&sysData->ring, 0);
+        return 1;
+    }
+#endif
+
+    pthread_mutex_lock(&sysData->mutex);
+    slot->state = SLOT_QUEUED;
+    pthread_cond_signal(&sysData->queuedCond);
+    pthread_mutex_unlock(&sysData->mutex);
+
+    return 1;
+}
+
+static int is_slot_done(MXFFileSysData *sysData, PrefetchSlot *slot)
+{
+    int done;
+
+#if defined(HAVE_IO_URING)
+    if (sysData->useIOUring) {
+        ring_reap(sysData);
+        return slot->state == SLOT_DONE;
+    }
+#endif
+
+    pthread_mutex_lock(&sysData->mutex);
+    done = (slot->state == SLOT_DONE);
+    pthread_mutex_unlock(&sysData->mutex);
+
+    return done;
+}
+
+static int wait_for_slot(MXFFileSysData *sysData, PrefetchSlot *slot)
+{
+#if defined(HAVE_IO_URING)
+    if (sysData->useIOUring) {
+        ring_reap(sysData);
+        while (slot->state != SLOT_DONE) {
+            if (!ring_enter(&sysData->ring, 1))
+                return 0;
+            ring_reap(sysData);
+        }
+        return 1;
+    }
+#endif
+
+    pthread_mutex_lock(&sysData->mutex);
+    while (slot->state != SLOT_DONE)
+        pthread_cond_wait(&sysData->doneCond, &sysData->mutex);
+    pthread_mutex_unlock(&sysData->mutex);
+
+    return 1;
+}
+
+static PrefetchSlot* find_slot(MXFFileSysData *sysData, int64_t position)
+{
+    uint32_t i;
+    for (i = 0; i < sysData->numSlots; i++) {
+        if (sysData->slots[i].inUse &&
+            position >= sysData->slots[i].offset &&
+            position < sysData->slots[i].offset + sysData->slots[i].size)
+        {
+            return &sysData->slots[i];
+        }
+    }
+
+    return NULL;
+}
+
+static int64_t find_next_slot_offset(MXFFileSysData *sysData, int64_t position)
+{
+    int64_t nextOffset = -1;
+    uint32_t i;
+    for (i = 0; i < sysData->numSlots; i++) {
+        if (sysData->slots[i].inUse &&
+            sysData->slots[i].offset > position &&
+            (nextOffset < 0 || sysData->slots[i].offset < nextOffset))
+        {
+            nextOffset = sysData->slots[i].offset;
+        }
+    }
+
+    return nextOffset;
+}
+
+static uint32_t read_buffered(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    uint32_t numRead;
+
+    if (sysData->position >= sysData->readBufferStart &&
+        sysData->position < sysData->readBufferStart + sysData->readBufferFill)
+    {
+        numRead = (uint32_t)(sysData->readBufferStart + sysData->readBufferFill - sysData->position);
+        if (numRead > count)
+            numRead = count;
+        memcpy(data, &sysData->readBuffer[sysData->position - sysData->readBufferStart], numRead);
+        return numRead;
+    }
+
+    if (count >= READ_BUFFER_SIZE)
+        return pread_all(sysData->fd, data, count, sysData->position);
+
+    sysData->readBufferStart = sysData->position;
+    sysData->readBufferFill  = pread_all(sysData->fd, sysData->readBuffer, READ_BUFFER_SIZE, sysData->position);
+
+    numRead = (sysData->readBufferFill < count ? sysData->readBufferFill : count);
+    memcpy(data, sysData->readBuffer, numRead);
+    return numRead;
+}
+
+
+static void prefetch_file_close(MXFFileSysData *sysData)
+{
+    uint32_t i;
+
+    if (sysData->fd < 0)
+        return;
+
+#if defined(HAVE_IO_URING)
+    if (sysData->useIOUring) {
+        /* the kernel may write to the slot buffers until the reads have completed */
+        for (i = 0; i < sysData->numSlots; i++) {
+            if (sysData->slots[i].inUse && !wait_for_slot(sysData, &sysData->slots[i])) {
+                mxf_log_error("Failed to wait for prefetch reads to complete\n");
+                sysData->slots = NULL; /* leak the slots rather than free buffers that may be written */
+                break;
+            }
+        }
+        ring_close(&sysData->ring);
+        sysData->useIOUring = 0;
+    }
+#endif
+    stop_threads(sysData);
+
+    if (sysData->slots) {
+        for (i = 0; i < sysData->numSlots; i++)
+            sysData->slots[i].inUse = 0;
+    }
+
+    close(sysData->fd);
+    sysData->fd = -1;
+}
+
+static uint32_t prefetch_file_read(MXFFileSysData *sysData, uint8_t *data, uint32_t count)
+{
+    PrefetchSlot *slot;
+    uint32_t remCount = count;
+    uint32_t numRead;
+    int64_t available;
+    int64_t nextOffset;
+
+    while (remCount > 0) {
+        slot = find_slot(sysData, sysData->position);
+        if (slot) {
+            if (!wait_for_slot(sysData, slot))
+                break;
+
+            available = slot->offset + slot->result - sysData->position;
+            if (available <= 0) {
+                /* the prefetch read was short or failed and so read directly */
+                slot->inUse = 0;
+                continue;
+            }
+            numRead = (available < remCount ? (uint32_t)available : remCount);
+            memcpy(&data[count - remCount], &slot->data[sysData->position - slot->offset], numRead);
+
+            if (sysData->position + numRead >= slot->offset + slot->size)
+                slot->inUse = 0;
+        } else {
+            numRead = remCount;
+            nextOffset = find_next_slot_offset(sysData, sysData->position);
+            if (nextOffset >= 0 && nextOffset - sysData->position < numRead)
+                numRead = (uint32_t)(nextOffset - sysData->position);
+
+            numRead = read_buffered(sysData, &data[count - remCount], numRead);
+            if (numRead == 0) {
+                sysData->eof = 1;
+                break;
+            }
+        }
+
+        sysData->position += numRead;
+        remCount          -= numRead;
+    }
+
+    return count - remCount;
+}
+
+static uint32_t prefetch_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    (void)sysData;
+    (void)data;
+    (void)count;
+
+    mxf_log_error("Prefetch file is read-only\n");
+    return 0;
+}
+
+static int prefetch_file_getchar(MXFFileSysData *sysData)
+{
+    uint8_t c;
+    if (prefetch_file_read(sysData, &c, 1) != 1)
+        return EOF;
+
+    return c;
+}
+
+static int prefetch_file_putchar(MXFFileSysData *sysData, int c)
+{
+    (void)sysData;
+    (void)c;
+
+    return EOF;
+}
+
+static int prefetch_file_eof(MXFFileSysData *sysData)
+{
+    return sysData->eof;
+}
+
+static int64_t prefetch_file_size(MXFFileSysData *sysData)
+{
+    struct stat statBuf;
+    char errorBuf[128];
+
+    if (fstat(sysData->fd, &statBuf) != 0) {
+        mxf_log_error("fstat failed: %s\n", mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        return -1;
+    }
+
+    return statBuf.st_size;
+}
+
+static int prefetch_file_seek(MXFFileSysData *sysData, int64_t offset, int whence)
+{
+    int64_t newPosition;
+    int64_t size;
+
+    if (whence == SEEK_SET) {
+        newPosition = offset;
+    } else if (whence == SEEK_CUR) {
+        newPosition = sysData->position + offset;
+    } else {
+        size = prefetch_file_size(sysData);
+        if (size < 0)
+            return 0;
+        newPosition = size + offset;
+    }
+    if (newPosition < 0)
+        return 0;
+
+    sysData->position = newPosition;
+    sysData->eof = 0;
+    return 1;
+}
+
+static int64_t prefetch_file_tell(MXFFileSysData *sysData)
+{
+    return sysData->position;
+}
+
+static int prefetch_file_is_seekable(MXFFileSysData *sysData)
+{
+    (void)sysData;
+    return 1;
+}
+
+static int prefetch_file_prefetch(MXFFileSysData *sysData, int64_t offset, uint32_t size)
+{
+    PrefetchSlot *slot = NULL;
+    uint8_t *newData;
+    uint32_t i;
+
+    if (offset < 0 || size == 0 || size > MXF_PREFETCH_MAX_SIZE || sysData->fd < 0)
+        return 0;
+
+    for (i = 0; i < sysData->numSlots; i++) {
+        if (!sysData->slots[i].inUse) {
+            if (!slot)
+                slot = &sysData->slots[i];
+        } else if (offset >= sysData->slots[i].offset &&
+                   offset + size <= sysData->slots[i].offset + sysData->slots[i].size)
+        {
+            return 1;
+        }
+    }
+
+    /* re-use a completed slot that is behind the read position or that follows the requested range,
+       e.g. after seeking backwards */
+    for (i = 0; i < sysData->numSlots && !slot; i++) {
+        if ((sysData->slots[i].offset + sysData->slots[i].size <= sysData->position ||
+                sysData->slots[i].offset >= offset + size) &&
+            is_slot_done(sysData, &sysData->slots[i]))
+        {
+            sysData->slots[i].inUse = 0;
+            slot = &sysData->slots[i];
+        }
+    }
+    if (!slot)
+        return 0;
+
+    if (slot->allocSize < size) {
+        newData = (uint8_t*)realloc(slot->data, size);
+        if (!newData) {
+            mxf_log_error("Failed to allocate prefetch buffer" LOG_LOC_FORMAT, LOG_LOC_PARAMS);
+            return 0;
+        }
+        slot->data      = newData;
+        slot->allocSize = size;
+    }
+
+    slot->offset = offset;
+    slot->size   = size;
+    slot->inUse  = 1;
+    if (!submit_slot(sysData, slot)) {
+        slot->inUse = 0;
+        return 0;
+    }
+
+    return 1;
+}
+
+static void free_prefetch_file(MXFFileSysData *sysData)
+{
+    uint32_t i;
+
+    if (!sysData)
+        return;
+
+    if (sysData->slots) {
+        for (i = 0; i < sysData->numSlots; i++)
+            free(sysData->slots[i].data);
+        free(sysData->slots);
+    }
+    free(sysData->readBuffer);
+    if (sysData->haveSync) {
+        pthread_cond_destroy(&sysData->doneCond);
+        pthread_cond_destroy(&sysData->queuedCond);
+        pthread_mutex_destroy(&sysData->mutex);
+    }
+
+    free(sysData);
+}
+
+
+
+int mxf_prefetch_file_open_read(const char *filename, uint32_t numSlots, int flags, MXFFile **mxfFile)
+{
+    MXFFile *newMXFFile = NULL;
+    MXFFileSysData *newPrefetchFile = NULL;
+    char errorBuf[128];
+
+    if (numSlots == 0 || numSlots > MXF_PREFETCH_MAX_SLOTS) {
+        mxf_log_error("Invalid number of prefetch slots %u" LOG_LOC_FORMAT, numSlots, LOG_LOC_PARAMS);
+        return 0;
+    }
+
+    CHK_MALLOC_ORET(newMXFFile, MXFFile);
+    memset(newMXFFile, 0, sizeof(MXFFile));
+    CHK_MALLOC_OFAIL(newPrefetchFile, MXFFileSysData);
+    memset(newPrefetchFile, 0, sizeof(MXFFileSysData));
+    newPrefetchFile->fd = -1;
+
+    if (pthread_mutex_init(&newPrefetchFile->mutex, NULL) != 0) {
+        SAFE_FREE(newPrefetchFile);
+        goto fail;
+    }
+    if (pthread_cond_init(&newPrefetchFile->queuedCond, NULL) != 0) {
+        pthread_mutex_destroy(&newPrefetchFile->mutex);
+        SAFE_FREE(newPrefetchFile);
+        goto fail;
+    }
+    if (pthread_cond_init(&newPrefetchFile->doneCond, NULL) != 0) {
+        pthread_cond_destroy(&newPrefetchFile->queuedCond);
+        pthread_mutex_destroy(&newPrefetchFile->mutex);
+        SAFE_FREE(newPrefetchFile);
+        goto fail;
+    }
+    newPrefetchFile->haveSync = 1;
+
+    CHK_MALLOC_ARRAY_OFAIL(newPrefetchFile->readBuffer, uint8_t, READ_BUFFER_SIZE);
+    CHK_MALLOC_ARRAY_OFAIL(newPrefetchFile->slots, PrefetchSlot, numSlots);
+    memset(newPrefetchFile->slots, 0, numSlots * sizeof(PrefetchSlot));
+    newPrefetchFile->numSlots = numSlots;
+
+    newPrefetchFile->fd = open(filename, O_RDONLY);
+    if (newPrefetchFile->fd < 0) {
+        mxf_log_error("Failed to open '%s': %s\n", filename, mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+        goto fail;
+    }
+
+#if defined(HAVE_IO_URING)
+    if (!(flags & MXF_PREFETCH_FLAG_NO_IO_URING)) {
+        newPrefetchFile->useIOUring = ring_setup(&newPrefetchFile->ring, numSlots);
+        if (!newPrefetchFile->useIOUring)
+            mxf_log_debug("io_uring is not available (%s); using prefetch threads\n",
+                          mxf_strerror(errno, errorBuf, sizeof(errorBuf)));
+    }
+    if (!newPrefetchFile->useIOUring)
+#else
+    (void)flags;
+#endif
+    {
+        CHK_OFAIL(start_threads(newPrefetchFile));
+    }
+
+    newMXFFile->close         = prefetch_file_close;
+    newMXFFile->read          = prefetch_file_read;
+    newMXFFile->write         = prefetch_file_write;
+    newMXFFile->get_char      = prefetch_file_getchar;
+    newMXFFile->put_char      = prefetch_file_putchar;
+    newMXFFile->eof           = prefetch_file_eof;
+    newMXFFile->seek          = prefetch_file_seek;
+    newMXFFile->tell          = prefetch_file_tell;
+    newMXFFile->is_seekable   = prefetch_file_is_seekable;
+    newMXFFile->size          = prefetch_file_size;
+    newMXFFile->prefetch      = prefetch_file_prefetch;
+    newMXFFile->free_sys_data = free_prefetch_file;
+    newMXFFile->sysData       = newPrefetchFile;
+
+    *mxfFile = newMXFFile;
+    return 1;
+
+fail:
+    if (newPrefetchFile) {
+        stop_threads(newPrefetchFile);
+        if (newPrefetchFile->fd >= 0)
+            close(newPrefetchFile->fd);
+    }
+    SAFE_FREE(newMXFFile);
+    free_prefetch_file(newPrefetchFile);
+    return 0;
+}
+
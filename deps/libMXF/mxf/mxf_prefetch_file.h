@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef MXF_PREFETCH_FILE_H_
+#define MXF_PREFETCH_FILE_H_
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+#include <mxf/mxf_file.h>
+
+
+#define MXF_PREFETCH_FLAG_DEFAULT           0x00
+#define MXF_PREFETCH_FLAG_NO_IO_URING       0x01
+
+#define MXF_PREFETCH_MAX_SLOTS              256
+#define MXF_PREFETCH_MAX_SIZE               (64 * 1024 * 1024)
+
+
+/* Open a file for reading that accepts prefetch requests (see mxf_file_prefetch) for up to numSlots ranges.
+   The ranges are read asynchronously using Linux io_uring if it is available and not disabled by the flags,
+   or otherwise by a small pool of threads. A read that starts in a prefetched range waits for the range
+   to complete and copies from it. A range is released once it has been read to the end and a completed
+   range is re-used for a new request if it is behind the read position or after the requested range.
+   Other reads go through a small read buffer */
+int mxf_prefetch_file_open_read(const char *filename, uint32_t numSlots, int flags, MXFFile **mxfFile);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif
+
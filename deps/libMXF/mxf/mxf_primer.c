@@ -184,6 +184,21 @@ int mxf_register_primer_entry(MXFPrimerPack *primerPack, const mxfUID *itemUID,
     return 1;
 }
 
+int mxf_append_primer_entries(MXFPrimerPack *primerPack, const MXFPrimerPackEntry *entries, size_t numEntries)
+{
+    MXFPrimerPackEntry *newEntry;
+    size_t i;
+
+    /* the caller must ensure that the item keys and local tags are not already registered */
+    for (i = 0; i < numEntries; i++)
+    {
+        CHK_ORET(create_primer_pack_entry(primerPack, &newEntry));
+        *newEntry = entries[i];
+    }
+
+    return 1;
+}
+
 
 int mxf_get_item_key(MXFPrimerPack *primerPack, mxfLocalTag localTag, mxfKey *key)
 {
@@ -268,27 +283,53 @@ fail:
 }
 
 /* Note: keep this in sync with mxf_get_primer_pack_size */
-int mxf_write_primer_pack(MXFFile *mxfFile, MXFPrimerPack *primerPack)
+/* Note: the buffer size must be at least the size returned by mxf_get_primer_pack_size */
+int mxf_encode_primer_pack(MXFFile *mxfFile, MXFPrimerPack *primerPack, uint8_t *buffer)
 {
     MXFListIterator iter;
     uint32_t numberOfItems = (uint32_t)mxf_get_list_length(&primerPack->entries);
+    uint8_t llen = mxf_get_llen(mxfFile, 8 + 18 * numberOfItems);
+    uint8_t *bufferPtr = buffer;
 
-    CHK_ORET(mxf_write_kl(mxfFile, &g_PrimerPack_key, 8 + 18 * numberOfItems));
+    memcpy(bufferPtr, &g_PrimerPack_key, mxfKey_extlen);
+    bufferPtr += mxfKey_extlen;
+    CHK_ORET(mxf_encode_fixed_l(llen, 8 + 18 * numberOfItems, bufferPtr));
+    bufferPtr += llen;
 
-    CHK_ORET(mxf_write_array_header(mxfFile, numberOfItems, 18));
+    mxf_set_array_header(numberOfItems, 18, bufferPtr);
+    bufferPtr += 8;
 
     mxf_initialise_list_iter(&iter, &primerPack->entries);
     while (mxf_next_list_iter_element(&iter))
     {
         MXFPrimerPackEntry *entry = (MXFPrimerPackEntry*)mxf_get_iter_element(&iter);
 
-        CHK_ORET(mxf_write_local_tag(mxfFile, entry->localTag));
-        CHK_ORET(mxf_write_uid(mxfFile, &entry->uid));
+        mxf_set_uint16(entry->localTag, bufferPtr);
+        memcpy(&bufferPtr[2], &entry->uid, mxfUID_extlen);
+        bufferPtr += 18;
     }
 
     return 1;
 }
 
+int mxf_write_primer_pack(MXFFile *mxfFile, MXFPrimerPack *primerPack)
+{
+    uint8_t *buffer = NULL;
+    uint64_t size;
+
+    mxf_get_primer_pack_size(mxfFile, primerPack, &size);
+    CHK_MALLOC_ARRAY_OFAIL(buffer, uint8_t, size);
+    CHK_OFAIL(mxf_encode_primer_pack(mxfFile, primerPack, buffer));
+    CHK_OFAIL(mxf_file_write(mxfFile, buffer, (uint32_t)size) == size);
+
+    SAFE_FREE(buffer);
+    return 1;
+
+fail:
+    SAFE_FREE(buffer);
+    return 0;
+}
+
 /* Note: keep this in sync with mxf_write_primer_pack */
 void mxf_get_primer_pack_size(MXFFile *mxfFile, MXFPrimerPack *primerPack, uint64_t *size)
 {
@@ -63,12 +63,14 @@ void mxf_free_primer_pack(MXFPrimerPack **primerPack);
 
 int mxf_register_primer_entry(MXFPrimerPack *primerPack, const mxfUID *itemKey, mxfLocalTag newTag,
                               mxfLocalTag *assignedTag);
+int mxf_append_primer_entries(MXFPrimerPack *primerPack, const MXFPrimerPackEntry *entries, size_t numEntries);
 
 int mxf_get_item_key(MXFPrimerPack *primerPack, mxfLocalTag localTag, mxfKey *key);
 int mxf_get_item_tag(MXFPrimerPack *primerPack, const mxfKey *key, mxfLocalTag *localTag);
 
 int mxf_create_item_tag(MXFPrimerPack *primerPack, mxfLocalTag *localTag);
 
+int mxf_encode_primer_pack(MXFFile *mxfFile, MXFPrimerPack *primerPack, uint8_t *buffer);
 int mxf_write_primer_pack(MXFFile *mxfFile, MXFPrimerPack *primerPack);
 int mxf_read_primer_pack(MXFFile *mxfFile, MXFPrimerPack **primerPack);
 
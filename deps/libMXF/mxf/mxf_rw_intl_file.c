@@ -226,6 +226,16 @@ static int64_t intl_file_size(MXFFileSysData *sysData)
     return mxf_file_size(sysData->target);
 }
 
+static int intl_file_prefetch(MXFFileSysData *sysData, int64_t offset, uint32_t size)
+{
+    return mxf_file_prefetch(sysData->target, offset, size);
+}
+
+static int intl_file_flush(MXFFileSysData *sysData)
+{
+    return mxf_file_flush(sysData->target);
+}
+
 static void free_intl_file(MXFFileSysData *sysData)
 {
     free(sysData);
@@ -285,6 +295,9 @@ int mxf_rw_intl_open(MXFRWInterleaver *interleaver, MXFFile *target, int isWrite
     newMXFFile->tell          = intl_file_tell;
     newMXFFile->is_seekable   = intl_file_is_seekable;
     newMXFFile->size          = intl_file_size;
+    if (mxf_file_supports_prefetch(newIntlFile->target))
+        newMXFFile->prefetch  = intl_file_prefetch;
+    newMXFFile->flush         = intl_file_flush;
     newMXFFile->free_sys_data = free_intl_file;
     newMXFFile->sysData       = newIntlFile;
     newMXFFile->minLLen       = target->minLLen;
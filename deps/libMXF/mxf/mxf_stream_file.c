@@ -199,6 +199,11 @@ static int64_t stream_file_size(MXFFileSysData *sysData)
     return 0;
 }
 
+static int stream_file_flush(MXFFileSysData *sysData)
+{
+    return mxf_file_flush(sysData->target);
+}
+
 static void free_stream_file(MXFFileSysData *sysData)
 {
     free(sysData);
@@ -229,6 +234,7 @@ int mxf_stream_file_wrap(MXFFile *target, int readOnly, MXFFile **streamMXFFile)
     newMXFFile->tell          = stream_file_tell;
     newMXFFile->is_seekable   = stream_file_is_seekable;
     newMXFFile->size          = stream_file_size;
+    newMXFFile->flush         = stream_file_flush;
     newMXFFile->free_sys_data = free_stream_file;
     newMXFFile->sysData       = newStreamFile;
     newMXFFile->minLLen       = target->minLLen;
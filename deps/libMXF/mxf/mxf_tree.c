@@ -197,10 +197,9 @@ static int traverse_node(MXFTreeNode *root, mxf_tree_process_node_f process_f, v
     if (!root)
         return 1;
 
-    if (!process_f(root->data, process_data))
-        return 0;
-
+    /* in-order so that the nodes are processed in sort order */
     return traverse_node(root->left, process_f, process_data) &&
+           process_f(root->data, process_data) &&
            traverse_node(root->right, process_f, process_data);
 }
 
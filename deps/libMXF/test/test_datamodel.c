@@ -39,6 +39,7 @@
 #include <assert.h>
 
 #include <mxf/mxf.h>
+#include <mxf/mxf_avid.h>
 #include <mxf/mxf_macros.h>
 
 
@@ -82,6 +83,14 @@ MXF_SET_DEFINITION(TestSet1, TestSet4, \
         0 \
     );
 
+#define EXT_DATA_MODEL_3 \
+    MXF_ITEM_DEFINITION(GenericPackage, TestItem4, \
+        MXF_LABEL(0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00), \
+        0x0000, \
+        MXF_UINT8_TYPE, \
+        0 \
+    );
+
 #define EXT_TYPES \
 MXF_ARRAY_TYPE_DEF(0, "TimestampArray", MXF_TIMESTAMP_TYPE, 0); \
 \
@@ -104,6 +113,7 @@ MXF_INTERPRETED_TYPE_DEF(0, "NewInt", MXF_UINT8_TYPE, 0);
 
 EXT_DATA_MODEL
 EXT_DATA_MODEL_2
+EXT_DATA_MODEL_3
 
 #undef MXF_LABEL
 #undef MXF_SET_DEFINITION
@@ -134,6 +144,216 @@ static int test_model(MXFDataModel *dataModel)
     return 1;
 }
 
+static int count_set_def(void *nodeData, void *processData)
+{
+    (void)nodeData;
+
+    (*(size_t*)processData)++;
+    return 1;
+}
+
+typedef struct
+{
+    MXFDataModel *dataModel;
+    size_t numSetDefs;
+} CompareSetDefsData;
+
+static int compare_set_def(void *nodeData, void *processData)
+{
+    MXFSetDef *setDef = (MXFSetDef*)nodeData;
+    CompareSetDefsData *data = (CompareSetDefsData*)processData;
+    MXFSetDef *otherSetDef;
+    size_t numItemDefs;
+
+    CHK_ORET(mxf_find_set_def(data->dataModel, &setDef->key, &otherSetDef));
+    CHK_ORET(strcmp(setDef->name, otherSetDef->name) == 0);
+    CHK_ORET(mxf_equals_key(&setDef->parentSetDefKey, &otherSetDef->parentSetDefKey));
+
+    /* the other model has the additional test item def */
+    numItemDefs = mxf_get_list_length(&setDef->itemDefs);
+    if (mxf_equals_key(&setDef->key, &MXF_SET_K(GenericPackage)))
+        numItemDefs++;
+    CHK_ORET(mxf_get_list_length(&otherSetDef->itemDefs) == numItemDefs);
+
+    data->numSetDefs++;
+    return 1;
+}
+
+static int test_static_model(int avidExtensions)
+{
+    MXFDataModel *dataModel = NULL;
+    MXFSetDef *setDef;
+    MXFItemDef *itemDef;
+    MXFItemType *type;
+    size_t numSetDefs = 0;
+    size_t numItemDefs = 0;
+    size_t modelNumSetDefs = 0;
+    int memberIndex = 0;
+
+    /* check that the static tables match the baseline and extensions data model definitions */
+    CHK_ORET(mxf_load_data_model(&dataModel));
+    if (avidExtensions) {
+        CHK_OFAIL(mxf_avid_load_extensions(dataModel));
+        /* the Avid extensions are in the static tables and so nothing is registered */
+        CHK_OFAIL(mxf_get_list_length(&dataModel->itemDefs) == 0);
+    }
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_check_data_model(dataModel));
+
+
+#define MXF_BASIC_TYPE_DEF(pid, pname, psize) \
+    CHK_OFAIL((type = mxf_get_item_def_type(dataModel, pid)) != NULL); \
+    CHK_OFAIL(type->category == MXF_BASIC_TYPE_CAT && strcmp(type->name, pname) == 0); \
+    CHK_OFAIL(type->info.basic.size == psize);
+
+#define MXF_ARRAY_TYPE_DEF(pid, pname, pelementTypeId, pfixedSize) \
+    CHK_OFAIL((type = mxf_get_item_def_type(dataModel, pid)) != NULL); \
+    CHK_OFAIL(type->category == MXF_ARRAY_TYPE_CAT && strcmp(type->name, pname) == 0); \
+    CHK_OFAIL(type->info.array.elementTypeId == pelementTypeId); \
+    CHK_OFAIL(type->info.array.fixedSize == pfixedSize);
+
+#define MXF_COMPOUND_TYPE_DEF(pid, pname) \
+    CHK_OFAIL((type = mxf_get_item_def_type(dataModel, pid)) != NULL); \
+    CHK_OFAIL(type->category == MXF_COMPOUND_TYPE_CAT && strcmp(type->name, pname) == 0); \
+    memberIndex = 0;
+
+#define MXF_COMPOUND_TYPE_MEMBER(pname, ptypeId) \
+    CHK_OFAIL(type->info.compound.members[memberIndex].typeId == ptypeId); \
+    CHK_OFAIL(strcmp(type->info.compound.members[memberIndex].name, pname) == 0); \
+    memberIndex++;
+
+#define MXF_INTERPRETED_TYPE_DEF(pid, pname, ptypeId, pfixedSize) \
+    CHK_OFAIL((type = mxf_get_item_def_type(dataModel, pid)) != NULL); \
+    CHK_OFAIL(type->category == MXF_INTERPRET_TYPE_CAT && strcmp(type->name, pname) == 0); \
+    CHK_OFAIL(type->info.interpret.typeId == ptypeId); \
+    CHK_OFAIL(type->info.interpret.fixedArraySize == pfixedSize);
+
+#define MXF_SET_DEFINITION(pparentName, pname, plabel) \
+    CHK_OFAIL(mxf_find_set_def(dataModel, &MXF_SET_K(pname), &setDef)); \
+    CHK_OFAIL(strcmp(setDef->name, #pname) == 0); \
+    CHK_OFAIL(mxf_equals_key(&setDef->parentSetDefKey, &MXF_SET_K(pparentName))); \
+    CHK_OFAIL(mxf_equals_key(&MXF_SET_K(pparentName), &g_Null_Key) ? \
+                  setDef->parentSetDef == NULL : \
+                  setDef->parentSetDef && mxf_equals_key(&setDef->parentSetDef->key, &MXF_SET_K(pparentName))); \
+    numSetDefs++;
+
+#define MXF_ITEM_DEFINITION(psetName, pname, plabel, ptag, ptypeId, pisRequired) \
+    CHK_OFAIL(mxf_find_item_def(dataModel, &MXF_ITEM_K(psetName, pname), &itemDef)); \
+    CHK_OFAIL(mxf_find_set_def(dataModel, &MXF_SET_K(psetName), &setDef)); \
+    CHK_OFAIL(mxf_find_item_def_in_set_def(&MXF_ITEM_K(psetName, pname), setDef, &itemDef)); \
+    CHK_OFAIL(strcmp(itemDef->name, #pname) == 0); \
+    CHK_OFAIL(mxf_equals_key(&itemDef->setDefKey, &MXF_SET_K(psetName))); \
+    CHK_OFAIL(itemDef->localTag == ptag && itemDef->typeId == ptypeId && itemDef->isRequired == pisRequired); \
+    numItemDefs++;
+
+#define KEEP_DATA_MODEL_DEFS 1
+#include <mxf/mxf_baseline_data_model.h>
+#include <mxf/mxf_extensions_data_model.h>
+
+    if (avidExtensions) {
+#undef KEEP_DATA_MODEL_DEFS
+#include <mxf/mxf_avid_extensions_data_model.h>
+    }
+
+#undef KEEP_DATA_MODEL_DEFS
+#undef MXF_BASIC_TYPE_DEF
+#undef MXF_ARRAY_TYPE_DEF
+#undef MXF_COMPOUND_TYPE_DEF
+#undef MXF_COMPOUND_TYPE_MEMBER
+#undef MXF_INTERPRETED_TYPE_DEF
+#undef MXF_LABEL
+#undef MXF_SET_DEFINITION
+#undef MXF_ITEM_DEFINITION
+
+
+    /* check there are no additional set defs */
+    CHK_OFAIL(mxf_traverse_set_defs(dataModel, count_set_def, &modelNumSetDefs));
+    CHK_OFAIL(modelNumSetDefs == numSetDefs);
+    CHK_OFAIL(numItemDefs > 0);
+
+    mxf_free_data_model(&dataModel);
+    return 1;
+
+fail:
+    mxf_free_data_model(&dataModel);
+    return 0;
+}
+
+static int test_extend_static_set_def()
+{
+    MXFDataModel *dataModel = NULL;
+    MXFDataModel *clonedDataModel = NULL;
+    MXFSetDef *setDef;
+    MXFSetDef *clonedSetDef;
+    MXFItemDef *itemDef;
+    size_t numStaticSetDefs = 0;
+    size_t numSetDefs = 0;
+
+    CHK_ORET(mxf_load_data_model(&dataModel));
+    CHK_OFAIL(mxf_traverse_set_defs(dataModel, count_set_def, &numStaticSetDefs));
+
+    /* the static set defs can't be replaced */
+    CHK_OFAIL(!mxf_register_set_def(dataModel, "GenericPackage", &MXF_SET_K(GenericPackage),
+                                    &MXF_SET_K(GenericPackage)));
+
+
+#define MXF_LABEL(d0, d1, d2, d3, d4, d5, d6, d7, d8, d9, d10, d11, d12, d13, d14, d15) \
+    {d0, d1, d2, d3, d4, d5, d6, d7, d8, d9, d10, d11, d12, d13, d14, d15}
+
+#define MXF_ITEM_DEFINITION(setName, name, label, tag, typeId, isRequired) \
+    CHK_OFAIL(mxf_register_item_def(dataModel, #name, &MXF_SET_K(setName), &MXF_ITEM_K(setName, name), tag, typeId, isRequired));
+
+    EXT_DATA_MODEL_3
+
+#undef MXF_LABEL
+#undef MXF_ITEM_DEFINITION
+
+
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_check_data_model(dataModel));
+
+    /* the extended item def is inherited and the static item defs are retained */
+    CHK_OFAIL(mxf_find_set_def(dataModel, &MXF_SET_K(SourcePackage), &setDef));
+    CHK_OFAIL(mxf_find_item_def_in_set_def(&MXF_ITEM_K(GenericPackage, TestItem4), setDef, &itemDef));
+    CHK_OFAIL(mxf_find_item_def_in_set_def(&MXF_ITEM_K(GenericPackage, PackageUID), setDef, &itemDef));
+    CHK_OFAIL(mxf_find_item_def_in_set_def(&MXF_ITEM_K(SourcePackage, Descriptor), setDef, &itemDef));
+    CHK_OFAIL(mxf_find_item_def_in_set_def(&MXF_ITEM_K(InterchangeObject, InstanceUID), setDef, &itemDef));
+    CHK_OFAIL(mxf_find_set_def(dataModel, &MXF_SET_K(GenericPackage), &setDef));
+    CHK_OFAIL(mxf_get_list_length(&setDef->itemDefs) == 7);
+
+    /* a copied set def replaces the static set def */
+    CHK_OFAIL(mxf_traverse_set_defs(dataModel, count_set_def, &numSetDefs));
+    CHK_OFAIL(numSetDefs == numStaticSetDefs);
+    CHK_OFAIL(mxf_find_set_def(dataModel, &MXF_SET_K(SourcePackage), &setDef));
+    CHK_OFAIL(setDef->parentSetDef && mxf_find_set_def(dataModel, &MXF_SET_K(GenericPackage), &clonedSetDef));
+    CHK_OFAIL(setDef->parentSetDef == clonedSetDef);
+
+    /* finalising again doesn't change the data model */
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_find_set_def(dataModel, &MXF_SET_K(GenericPackage), &setDef));
+    CHK_OFAIL(mxf_get_list_length(&setDef->itemDefs) == 7);
+
+    /* cloning the extended set def extends the static set def in the cloned data model */
+    CHK_OFAIL(mxf_load_data_model(&clonedDataModel));
+    CHK_OFAIL(mxf_finalise_data_model(clonedDataModel));
+    CHK_OFAIL(mxf_find_set_def(dataModel, &MXF_SET_K(GenericPackage), &setDef));
+    CHK_OFAIL(mxf_clone_set_def(dataModel, setDef, clonedDataModel, &clonedSetDef));
+    CHK_OFAIL(mxf_find_item_def_in_set_def(&MXF_ITEM_K(GenericPackage, TestItem4), clonedSetDef, &itemDef));
+    CHK_OFAIL(mxf_find_item_def(clonedDataModel, &MXF_ITEM_K(GenericPackage, TestItem4), &itemDef));
+    CHK_OFAIL(mxf_find_set_def(clonedDataModel, &MXF_SET_K(SourcePackage), &setDef));
+    CHK_OFAIL(mxf_find_item_def_in_set_def(&MXF_ITEM_K(GenericPackage, TestItem4), setDef, &itemDef));
+    CHK_OFAIL(mxf_check_data_model(clonedDataModel));
+
+    mxf_free_data_model(&dataModel);
+    mxf_free_data_model(&clonedDataModel);
+    return 1;
+
+fail:
+    mxf_free_data_model(&dataModel);
+    mxf_free_data_model(&clonedDataModel);
+    return 0;
+}
+
 
 int test()
 {
@@ -260,6 +480,56 @@ fail:
     return 0;
 }
 
+static int test_register_avid_extensions()
+{
+    MXFDataModel *staticDataModel = NULL;
+    MXFDataModel *dataModel = NULL;
+    CompareSetDefsData data;
+    size_t numSetDefs = 0;
+
+    CHK_ORET(mxf_load_data_model(&staticDataModel));
+    CHK_OFAIL(mxf_avid_load_extensions(staticDataModel));
+    CHK_OFAIL(mxf_finalise_data_model(staticDataModel));
+
+    /* the Avid extensions are registered if the data model has already been extended */
+    CHK_OFAIL(mxf_load_data_model(&dataModel));
+
+
+#define MXF_LABEL(d0, d1, d2, d3, d4, d5, d6, d7, d8, d9, d10, d11, d12, d13, d14, d15) \
+    {d0, d1, d2, d3, d4, d5, d6, d7, d8, d9, d10, d11, d12, d13, d14, d15}
+
+#define MXF_ITEM_DEFINITION(setName, name, label, tag, typeId, isRequired) \
+    CHK_OFAIL(mxf_register_item_def(dataModel, #name, &MXF_SET_K(setName), &MXF_ITEM_K(setName, name), tag, typeId, isRequired));
+
+    EXT_DATA_MODEL_3
+
+#undef MXF_LABEL
+#undef MXF_ITEM_DEFINITION
+
+
+    CHK_OFAIL(!mxf_load_static_avid_extensions(dataModel));
+    CHK_OFAIL(mxf_avid_load_extensions(dataModel));
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_check_data_model(dataModel));
+
+    /* the registered extensions match the static tables */
+    data.dataModel = dataModel;
+    data.numSetDefs = 0;
+    CHK_OFAIL(mxf_traverse_set_defs(staticDataModel, compare_set_def, &data));
+    CHK_OFAIL(mxf_traverse_set_defs(dataModel, count_set_def, &numSetDefs));
+    CHK_OFAIL(numSetDefs == data.numSetDefs);
+    CHK_OFAIL(mxf_get_item_def_type(dataModel, MXF_RGB_COLOR_TYPE) != NULL);
+
+    mxf_free_data_model(&staticDataModel);
+    mxf_free_data_model(&dataModel);
+    return 1;
+
+fail:
+    mxf_free_data_model(&staticDataModel);
+    mxf_free_data_model(&dataModel);
+    return 0;
+}
+
 
 void usage(const char *cmd)
 {
@@ -278,6 +548,22 @@ int main(int argc, const char *argv[])
     {
         return 1;
     }
+    if (!test_static_model(0))
+    {
+        return 1;
+    }
+    if (!test_static_model(1))
+    {
+        return 1;
+    }
+    if (!test_extend_static_set_def())
+    {
+        return 1;
+    }
+    if (!test_register_avid_extensions())
+    {
+        return 1;
+    }
 
     return 0;
 }
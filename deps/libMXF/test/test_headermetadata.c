@@ -9,6 +9,7 @@
 
 #include <mxf/mxf.h>
 #include <mxf/mxf_avid.h>
+#include <mxf/mxf_memory_file.h>
 #include <mxf/mxf_macros.h>
 
 
@@ -611,11 +612,387 @@ fail:
 }
 
 
+static int test_set_index()
+{
+    MXFDataModel *dataModel = NULL;
+    MXFHeaderMetadata *headerMetadata = NULL;
+    MXFMetadataSet *sets[1000];
+    MXFMetadataSet *set;
+    MXFMetadataSet *dupSet;
+    MXFMetadataItem *item;
+    MXFMetadataItem *dupItem;
+    MXFList *setList = NULL;
+    uint32_t i;
+
+
+    CHK_OFAIL(mxf_load_data_model(&dataModel));
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_create_header_metadata(&headerMetadata, dataModel));
+
+    /* create enough sets to resize the indexes several times */
+    for (i = 0; i < 1000; i++)
+    {
+        CHK_OFAIL(mxf_create_set(headerMetadata, (i % 2 == 0 ? &MXF_SET_K(Sequence) : &MXF_SET_K(SourceClip)),
+                                 &sets[i]));
+    }
+    for (i = 0; i < 1000; i++)
+    {
+        CHK_OFAIL(mxf_dereference(headerMetadata, &sets[i]->instanceUID, &set) && set == sets[i]);
+    }
+    CHK_OFAIL(mxf_find_set_by_key(headerMetadata, &MXF_SET_K(Sequence), &setList));
+    CHK_OFAIL(mxf_get_list_length(setList) == 500);
+    CHK_OFAIL(mxf_get_first_list_element(setList) == sets[0]);
+    CHK_OFAIL(mxf_get_last_list_element(setList) == sets[998]);
+    mxf_free_list(&setList);
+
+    /* remove every other SourceClip set */
+    for (i = 1; i < 1000; i += 4)
+    {
+        CHK_OFAIL(mxf_remove_set(headerMetadata, sets[i]));
+        CHK_OFAIL(!mxf_dereference(headerMetadata, &sets[i]->instanceUID, &set));
+        mxf_free_set(&sets[i]);
+    }
+    for (i = 3; i < 1000; i += 4)
+    {
+        CHK_OFAIL(mxf_dereference(headerMetadata, &sets[i]->instanceUID, &set) && set == sets[i]);
+    }
+    CHK_OFAIL(mxf_find_set_by_key(headerMetadata, &MXF_SET_K(SourceClip), &setList));
+    CHK_OFAIL(mxf_get_list_length(setList) == 250);
+    CHK_OFAIL(mxf_get_first_list_element(setList) == sets[3]);
+    mxf_free_list(&setList);
+
+    /* the first set added is returned for a duplicate instanceUID until it is removed */
+    CHK_OFAIL(mxf_create_set(headerMetadata, &MXF_SET_K(Preface), &dupSet));
+    CHK_OFAIL(mxf_find_singular_set_by_key(headerMetadata, &MXF_SET_K(Preface), &set) && set == dupSet);
+    CHK_OFAIL(mxf_remove_set(headerMetadata, dupSet));
+    CHK_OFAIL(!mxf_find_singular_set_by_key(headerMetadata, &MXF_SET_K(Preface), &set));
+    dupSet->instanceUID = sets[0]->instanceUID;
+    CHK_OFAIL(mxf_add_set(headerMetadata, dupSet));
+    CHK_OFAIL(mxf_dereference(headerMetadata, &sets[0]->instanceUID, &set) && set == sets[0]);
+    CHK_OFAIL(mxf_remove_set(headerMetadata, sets[0]));
+    CHK_OFAIL(mxf_dereference(headerMetadata, &sets[0]->instanceUID, &set) && set == dupSet);
+    mxf_free_set(&sets[0]);
+
+    /* the first item added is returned for a duplicate item key until it is removed */
+    set = sets[2];
+    for (i = 0; i < 10; i++)
+    {
+        CHK_OFAIL(mxf_set_length_item(set, &MXF_ITEM_K(StructuralComponent, Duration), i));
+        CHK_OFAIL(mxf_set_ul_item(set, &MXF_ITEM_K(StructuralComponent, DataDefinition), &someUL));
+    }
+    CHK_OFAIL(set->itemIndex.num_slots == 0);
+    for (i = 0; i < 8; i++)
+    {
+        CHK_OFAIL(mxf_create_item(set, &MXF_ITEM_K(Sequence, StructuralComponents), 0, &item));
+    }
+    CHK_OFAIL(set->itemIndex.num_slots > 0);
+    CHK_OFAIL(mxf_get_item(set, &MXF_ITEM_K(Sequence, StructuralComponents), &dupItem));
+    CHK_OFAIL(mxf_remove_item(set, &MXF_ITEM_K(Sequence, StructuralComponents), &item));
+    CHK_OFAIL(item == dupItem);
+    mxf_free_item(&item);
+    CHK_OFAIL(mxf_get_item(set, &MXF_ITEM_K(Sequence, StructuralComponents), &item));
+    CHK_OFAIL(item != dupItem);
+    CHK_OFAIL(mxf_get_item(set, &MXF_ITEM_K(StructuralComponent, Duration), &item));
+    CHK_OFAIL(mxf_get_item(set, &MXF_ITEM_K(InterchangeObject, InstanceUID), &item));
+
+
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 1;
+
+fail:
+    mxf_free_list(&setList);
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 0;
+}
+
+
+static int test_set_lifetime()
+{
+    MXFDataModel *dataModel = NULL;
+    MXFHeaderMetadata *headerMetadata = NULL;
+    MXFHeaderMetadata *cloneHeaderMetadata = NULL;
+    MXFMetadataSet *set = NULL;
+    MXFMetadataSet *cloneSet;
+    MXFMetadataItem *item = NULL;
+    int64_t duration;
+
+
+    CHK_OFAIL(mxf_load_data_model(&dataModel));
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_create_header_metadata(&headerMetadata, dataModel));
+    CHK_OFAIL(mxf_create_header_metadata(&cloneHeaderMetadata, dataModel));
+
+    CHK_OFAIL(mxf_create_set(headerMetadata, &MXF_SET_K(Sequence), &set));
+    CHK_OFAIL(mxf_set_length_item(set, &MXF_ITEM_K(StructuralComponent, Duration), 100));
+    CHK_OFAIL(mxf_set_ul_item(set, &MXF_ITEM_K(StructuralComponent, DataDefinition), &someUL));
+    CHK_OFAIL(mxf_clone_set(set, cloneHeaderMetadata, &cloneSet));
+
+    /* a removed set and item remain valid after the header metadata they were allocated from is freed */
+    CHK_OFAIL(mxf_remove_set(headerMetadata, set));
+    CHK_OFAIL(mxf_remove_item(set, &MXF_ITEM_K(StructuralComponent, DataDefinition), &item));
+    mxf_free_header_metadata(&headerMetadata);
+    CHK_OFAIL(mxf_get_length_item(set, &MXF_ITEM_K(StructuralComponent, Duration), &duration) && duration == 100);
+    CHK_OFAIL(item->length == mxfUL_extlen && memcmp(item->value, &someUL, mxfUL_extlen) == 0);
+    mxf_free_set(&set);
+    CHK_OFAIL(mxf_set_item_value(item, (const uint8_t*)&someUUID, mxfUUID_extlen));
+    mxf_free_item(&item);
+
+    CHK_OFAIL(mxf_get_length_item(cloneSet, &MXF_ITEM_K(StructuralComponent, Duration), &duration) && duration == 100);
+
+
+    mxf_free_header_metadata(&cloneHeaderMetadata);
+    mxf_free_data_model(&dataModel);
+    return 1;
+
+fail:
+    mxf_free_item(&item);
+    mxf_free_set(&set);
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_header_metadata(&cloneHeaderMetadata);
+    mxf_free_data_model(&dataModel);
+    return 0;
+}
+
+
 void usage(const char *cmd)
 {
     fprintf(stderr, "Usage: %s filename\n", cmd);
 }
 
+static int write_header_sets(MXFHeaderMetadata *headerMetadata, MXFMemoryFile **memFile)
+{
+    CHK_ORET(mxf_mem_file_open_new(1024 * 1024, 0, memFile));
+    CHK_ORET(mxf_write_header_sets(mxf_mem_file_get_file(*memFile), headerMetadata));
+    CHK_ORET(mxf_mem_file_get_num_chunks(*memFile) == 1);
+
+    return 1;
+}
+
+static void close_mem_file(MXFMemoryFile **memFile)
+{
+    MXFFile *mxfFile;
+
+    if (*memFile != NULL)
+    {
+        mxfFile = mxf_mem_file_get_file(*memFile);
+        mxf_file_close(&mxfFile);
+        *memFile = NULL;
+    }
+}
+
+/* writes the set item by item, as it was written before sets were serialized into a buffer */
+static int write_set_items(MXFFile *mxfFile, MXFMetadataSet *set)
+{
+    MXFListIterator iter;
+    uint64_t setLen = 0;
+    uint64_t setSize;
+
+    mxf_initialise_list_iter(&iter, &set->items);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        setLen += ((MXFMetadataItem*)mxf_get_iter_element(&iter))->length + 4;
+    }
+    CHK_ORET(mxf_write_fixed_kl(mxfFile, &set->key, 4, setLen));
+    setSize = mxfKey_extlen + 4 + setLen;
+
+    mxf_initialise_list_iter(&iter, &set->items);
+    while (mxf_next_list_iter_element(&iter))
+    {
+        CHK_ORET(mxf_write_item(mxfFile, (MXFMetadataItem*)mxf_get_iter_element(&iter)));
+    }
+
+    if (setSize < set->fixedSpaceAllocation)
+    {
+        CHK_ORET(mxf_write_fill(mxfFile, (uint32_t)(set->fixedSpaceAllocation - setSize)));
+    }
+
+    return 1;
+}
+
+static int equals_mem_files(MXFMemoryFile *memFileA, MXFMemoryFile *memFileB)
+{
+    return mxf_mem_file_get_size(memFileA) == mxf_mem_file_get_size(memFileB) &&
+           memcmp(mxf_mem_file_get_chunk_data(memFileA, 0), mxf_mem_file_get_chunk_data(memFileB, 0),
+                  (size_t)mxf_mem_file_get_size(memFileA)) == 0;
+}
+
+static int test_serialize_sets()
+{
+    MXFDataModel *dataModel = NULL;
+    MXFHeaderMetadata *headerMetadata = NULL;
+    MXFMemoryFile *firstMemFile = NULL;
+    MXFMemoryFile *secondMemFile = NULL;
+    MXFMemoryFile *itemsMemFile = NULL;
+    MXFMetadataSet *prefaceSet;
+    MXFMetadataSet *sequenceSet;
+    uint64_t primerSize;
+    uint64_t size;
+
+
+    CHK_OFAIL(mxf_load_data_model(&dataModel));
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_create_header_metadata(&headerMetadata, dataModel));
+
+    CHK_OFAIL(mxf_create_set(headerMetadata, &MXF_SET_K(Sequence), &sequenceSet));
+    CHK_OFAIL(mxf_set_length_item(sequenceSet, &MXF_ITEM_K(StructuralComponent, Duration), 100));
+    CHK_OFAIL(mxf_create_set(headerMetadata, &MXF_SET_K(Preface), &prefaceSet));
+    CHK_OFAIL(mxf_set_timestamp_item(prefaceSet, &MXF_ITEM_K(Preface, LastModifiedDate), &someTimestamp));
+    mxf_set_fixed_set_space_allocation(prefaceSet, 256);
+
+    /* the second serialization re-uses the unchanged Preface and encodes the changed Sequence */
+    CHK_OFAIL(write_header_sets(headerMetadata, &firstMemFile));
+    CHK_OFAIL(mxf_set_length_item(sequenceSet, &MXF_ITEM_K(StructuralComponent, Duration), 200));
+    CHK_OFAIL(write_header_sets(headerMetadata, &secondMemFile));
+    CHK_OFAIL(!equals_mem_files(firstMemFile, secondMemFile));
+    mxf_get_primer_pack_size(mxf_mem_file_get_file(secondMemFile), headerMetadata->primerPack, &primerSize);
+    mxf_get_header_metadata_size(mxf_mem_file_get_file(secondMemFile), headerMetadata, &size);
+    CHK_OFAIL(size == primerSize + mxf_mem_file_get_size(secondMemFile));
+
+    /* the result is the same as writing the sets item by item */
+    CHK_OFAIL(mxf_mem_file_open_new(1024 * 1024, 0, &itemsMemFile));
+    CHK_OFAIL(write_set_items(mxf_mem_file_get_file(itemsMemFile), prefaceSet));
+    CHK_OFAIL(write_set_items(mxf_mem_file_get_file(itemsMemFile), sequenceSet));
+    CHK_OFAIL(equals_mem_files(secondMemFile, itemsMemFile));
+
+
+    close_mem_file(&firstMemFile);
+    close_mem_file(&secondMemFile);
+    close_mem_file(&itemsMemFile);
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 1;
+
+fail:
+    close_mem_file(&firstMemFile);
+    close_mem_file(&secondMemFile);
+    close_mem_file(&itemsMemFile);
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 0;
+}
+
+static uint32_t g_testUUIDCount = 0;
+
+static void test_generate_uuid(mxfUUID *uuid)
+{
+    memset(uuid, 0, sizeof(*uuid));
+    mxf_set_uint32(g_testUUIDCount, (uint8_t*)uuid);
+    g_testUUIDCount++;
+}
+
+/* writes Avid header metadata with the default meta-dictionary and dictionary, created using the cache if set */
+static int write_avid_header_metadata(MXFAvidDictionaryCache *cache, uint32_t uuidStart, uint8_t minLLen,
+                                      MXFMemoryFile **memFile)
+{
+    MXFDataModel *dataModel = NULL;
+    MXFHeaderMetadata *headerMetadata = NULL;
+    MXFAvidCachedDictionaries *cachedDicts = NULL;
+    MXFPartition *partition = NULL;
+    MXFMetadataSet *metaDictSet;
+    MXFMetadataSet *prefaceSet;
+    MXFMetadataSet *dictSet;
+
+
+    g_testUUIDCount = uuidStart;
+
+    CHK_OFAIL(mxf_load_data_model(&dataModel));
+    CHK_OFAIL(mxf_avid_load_extensions(dataModel));
+    CHK_OFAIL(mxf_finalise_data_model(dataModel));
+    CHK_OFAIL(mxf_create_header_metadata(&headerMetadata, dataModel));
+    CHK_OFAIL(mxf_create_partition(&partition));
+
+    if (cache != NULL)
+    {
+        CHK_OFAIL(mxf_avid_create_cached_dictionaries(cache, &cachedDicts));
+        CHK_OFAIL(mxf_avid_create_cached_default_metadictionary(cachedDicts, headerMetadata, &metaDictSet));
+    }
+    else
+    {
+        CHK_OFAIL(mxf_avid_create_default_metadictionary(headerMetadata, &metaDictSet));
+    }
+
+    CHK_OFAIL(mxf_create_set(headerMetadata, &MXF_SET_K(Preface), &prefaceSet));
+    CHK_OFAIL(mxf_set_timestamp_item(prefaceSet, &MXF_ITEM_K(Preface, LastModifiedDate), &someTimestamp));
+
+    if (cache != NULL)
+    {
+        CHK_OFAIL(mxf_avid_create_cached_default_dictionary(cachedDicts, headerMetadata, &dictSet));
+    }
+    else
+    {
+        CHK_OFAIL(mxf_avid_create_default_dictionary(headerMetadata, &dictSet));
+    }
+    CHK_OFAIL(mxf_set_strongref_item(prefaceSet, &MXF_ITEM_K(Preface, Dictionary), dictSet));
+
+    CHK_OFAIL(mxf_mem_file_open_new(1024 * 1024, 0, memFile));
+    mxf_file_set_min_llen(mxf_mem_file_get_file(*memFile), minLLen);
+    CHK_OFAIL(mxf_avid_write_header_metadata_2(mxf_mem_file_get_file(*memFile), headerMetadata, partition,
+                                               cachedDicts));
+    CHK_OFAIL(mxf_mem_file_get_num_chunks(*memFile) == 1);
+
+
+    mxf_free_partition(&partition);
+    mxf_avid_free_cached_dictionaries(&cachedDicts);
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 1;
+
+fail:
+    mxf_free_partition(&partition);
+    mxf_avid_free_cached_dictionaries(&cachedDicts);
+    mxf_free_header_metadata(&headerMetadata);
+    mxf_free_data_model(&dataModel);
+    return 0;
+}
+
+static int test_avid_dictionary_cache()
+{
+    mxf_generate_uuid_func generateUUIDFunc = mxf_generate_uuid;
+    MXFAvidDictionaryCache *cache = NULL;
+    MXFMemoryFile *memFile = NULL;
+    MXFMemoryFile *cachedMemFile = NULL;
+
+
+    mxf_generate_uuid = test_generate_uuid;
+
+    CHK_OFAIL(mxf_avid_create_dictionary_cache(&cache));
+
+    /* the first header metadata captures the sets */
+    CHK_OFAIL(write_avid_header_metadata(NULL, 1, 4, &memFile));
+    CHK_OFAIL(write_avid_header_metadata(cache, 1, 4, &cachedMemFile));
+    CHK_OFAIL(equals_mem_files(memFile, cachedMemFile));
+    close_mem_file(&memFile);
+    close_mem_file(&cachedMemFile);
+
+    /* the next header metadata write copies of the sets with different instance UIDs */
+    CHK_OFAIL(write_avid_header_metadata(NULL, 10000, 4, &memFile));
+    CHK_OFAIL(write_avid_header_metadata(cache, 10000, 4, &cachedMemFile));
+    CHK_OFAIL(equals_mem_files(memFile, cachedMemFile));
+    close_mem_file(&memFile);
+    close_mem_file(&cachedMemFile);
+
+    /* the set lengths depend on the file's minimum llen */
+    CHK_OFAIL(write_avid_header_metadata(NULL, 20000, 8, &memFile));
+    CHK_OFAIL(write_avid_header_metadata(cache, 20000, 8, &cachedMemFile));
+    CHK_OFAIL(equals_mem_files(memFile, cachedMemFile));
+
+
+    close_mem_file(&memFile);
+    close_mem_file(&cachedMemFile);
+    mxf_avid_free_dictionary_cache(&cache);
+    mxf_generate_uuid = generateUUIDFunc;
+    return 1;
+
+fail:
+    close_mem_file(&memFile);
+    close_mem_file(&cachedMemFile);
+    mxf_avid_free_dictionary_cache(&cache);
+    mxf_generate_uuid = generateUUIDFunc;
+    return 0;
+}
+
 int main(int argc, const char *argv[])
 {
     if (argc != 2)
@@ -639,6 +1016,26 @@ int main(int argc, const char *argv[])
         return 1;
     }
 
+    if (!test_set_index())
+    {
+        return 1;
+    }
+
+    if (!test_serialize_sets())
+    {
+        return 1;
+    }
+
+    if (!test_set_lifetime())
+    {
+        return 1;
+    }
+
+    if (!test_avid_dictionary_cache())
+    {
+        return 1;
+    }
+
     return 0;
 }
 
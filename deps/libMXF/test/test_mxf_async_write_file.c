@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_async_write_file.h>
+#include <mxf/mxf_memory_file.h>
+
+
+#define BUFFER_SIZE         (64 * 1024)
+#define NUM_BUFFERS         3
+#define DATA_SIZE           (10 * BUFFER_SIZE + 100)
+#define HEADER_SIZE         200
+#define MEM_CHUNK_SIZE      (4 * BUFFER_SIZE)
+
+
+
+#define CHECK(cmd) \
+    if (!(cmd)) \
+    { \
+        fprintf(stderr, "'%s' failed in %s:%d\n", #cmd, __FILENAME__, __LINE__); \
+        exit(1); \
+    }
+
+
+/* a target file that fails all writes after failPosition */
+struct MXFFileSysData
+{
+    int64_t position;
+    int64_t failPosition;
+};
+
+static void failing_file_close(MXFFileSysData *sysData)
+{
+    (void)sysData;
+}
+
+static uint32_t failing_file_write(MXFFileSysData *sysData, const uint8_t *data, uint32_t count)
+{
+    (void)data;
+    if (sysData->position + count > sysData->failPosition)
+        return 0;
+
+    sysData->position += count;
+    return count;
+}
+
+static int failing_file_seek(MXFFileSysData *sysData, int64_t offset, int whence)
+{
+    if (whence != SEEK_SET)
+        return 0;
+
+    sysData->position = offset;
+    return 1;
+}
+
+static int64_t failing_file_tell(MXFFileSysData *sysData)
+{
+    return sysData->position;
+}
+
+static int failing_file_is_seekable(MXFFileSysData *sysData)
+{
+    (void)sysData;
+    return 1;
+}
+
+static void free_failing_file(MXFFileSysData *sysData)
+{
+    free(sysData);
+}
+
+static MXFFile* open_failing_file(int64_t failPosition)
+{
+    MXFFile *newMXFFile;
+
+    newMXFFile = malloc(sizeof(MXFFile));
+    CHECK(newMXFFile);
+    memset(newMXFFile, 0, sizeof(MXFFile));
+    newMXFFile->sysData = malloc(sizeof(MXFFileSysData));
+    CHECK(newMXFFile->sysData);
+    memset(newMXFFile->sysData, 0, sizeof(MXFFileSysData));
+    newMXFFile->sysData->failPosition = failPosition;
+
+    newMXFFile->close         = failing_file_close;
+    newMXFFile->write         = failing_file_write;
+    newMXFFile->seek          = failing_file_seek;
+    newMXFFile->tell          = failing_file_tell;
+    newMXFFile->is_seekable   = failing_file_is_seekable;
+    newMXFFile->free_sys_data = free_failing_file;
+
+    return newMXFFile;
+}
+
+
+
+int main()
+{
+    MXFMemoryFile *memoryFile;
+    MXFFile *writer;
+    MXFFileIOVec iov[2];
+    unsigned char *data;
+    unsigned char *readData;
+    uint32_t i;
+
+    data = malloc(DATA_SIZE);
+    for (i = 0; i < DATA_SIZE; i++)
+        data[i] = (unsigned char)(i % 251);
+    readData = malloc(DATA_SIZE);
+
+
+    CHECK(mxf_mem_file_open_new(MEM_CHUNK_SIZE, 0, &memoryFile));
+    CHECK(mxf_async_write_file_open(mxf_mem_file_get_file(memoryFile), BUFFER_SIZE, NUM_BUFFERS, &writer));
+
+    /* write a placeholder header followed by the body in a mix of sizes */
+    memset(readData, 0, HEADER_SIZE);
+    CHECK(mxf_file_write(writer, readData, HEADER_SIZE) == HEADER_SIZE);
+    CHECK(mxf_file_write(writer, &data[HEADER_SIZE], 1000) == 1000);
+    iov[0].data = &data[HEADER_SIZE + 1000];
+    iov[0].size = 3 * BUFFER_SIZE;
+    iov[1].data = &data[HEADER_SIZE + 1000 + 3 * BUFFER_SIZE];
+    iov[1].size = 10;
+    CHECK(mxf_file_writev(writer, iov, 2) == 3 * BUFFER_SIZE + 10);
+    for (i = HEADER_SIZE + 1010 + 3 * BUFFER_SIZE; i < DATA_SIZE; i++)
+        CHECK(mxf_file_putc(writer, data[i]) == data[i]);
+    CHECK(mxf_file_tell(writer) == DATA_SIZE);
+
+    /* rewrite the header and return to the end */
+    CHECK(mxf_file_seek(writer, 0, SEEK_SET));
+    CHECK(mxf_file_tell(writer) == 0);
+    CHECK(mxf_file_write(writer, data, HEADER_SIZE) == HEADER_SIZE);
+    CHECK(mxf_file_seek(writer, 0, SEEK_END));
+    CHECK(mxf_file_tell(writer) == DATA_SIZE);
+    CHECK(mxf_file_size(writer) == DATA_SIZE);
+
+    /* read back through the async file */
+    CHECK(mxf_file_seek(writer, 0, SEEK_SET));
+    CHECK(mxf_file_read(writer, readData, DATA_SIZE) == DATA_SIZE);
+    CHECK(memcmp(readData, data, DATA_SIZE) == 0);
+    CHECK(mxf_file_tell(writer) == DATA_SIZE);
+
+    /* overwrite in the middle after a relative seek and read it back */
+    CHECK(mxf_file_seek(writer, -2 * BUFFER_SIZE, SEEK_CUR));
+    CHECK(mxf_file_write(writer, data, BUFFER_SIZE) == BUFFER_SIZE);
+    CHECK(mxf_file_seek(writer, DATA_SIZE - 2 * BUFFER_SIZE, SEEK_SET));
+    CHECK(mxf_file_read(writer, readData, BUFFER_SIZE) == BUFFER_SIZE);
+    CHECK(memcmp(readData, data, BUFFER_SIZE) == 0);
+    CHECK(mxf_file_size(writer) == DATA_SIZE);
+
+    /* the data is in the target after a flush */
+    CHECK(mxf_file_write(writer, data, 10) == 10);
+    CHECK(mxf_file_flush(writer));
+    CHECK(mxf_file_size(mxf_mem_file_get_file(memoryFile)) == DATA_SIZE);
+
+    mxf_file_close(&writer);
+
+
+    /* a write to the target that fails after the writer has returned is reported by the flush */
+    CHECK(mxf_async_write_file_open(open_failing_file(BUFFER_SIZE + 100), BUFFER_SIZE, NUM_BUFFERS, &writer));
+    CHECK(mxf_file_write(writer, data, 2 * BUFFER_SIZE) == 2 * BUFFER_SIZE);
+    CHECK(!mxf_file_flush(writer));
+    mxf_file_close(&writer);
+
+
+    free(readData);
+    free(data);
+
+    return 0;
+}
+
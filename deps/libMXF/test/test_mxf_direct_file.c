@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_direct_file.h>
+
+
+#define BUFFER_SIZE     (3 * MXF_DIRECT_FILE_ALIGNMENT)
+#define DATA_SIZE       (10 * MXF_DIRECT_FILE_ALIGNMENT + 123)
+#define HEADER_SIZE     200
+
+
+
+#define CHECK(cmd) \
+    if (!(cmd)) \
+    { \
+        fprintf(stderr, "'%s' failed in %s:%d\n", #cmd, __FILENAME__, __LINE__); \
+        exit(1); \
+    }
+
+
+
+static void usage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s filename\n", cmd);
+}
+
+int main(int argc, const char *argv[])
+{
+    MXFFile *mxfFile;
+    unsigned char *writeData;
+    unsigned char *readData;
+    uint32_t i;
+
+    if (argc != 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    writeData = malloc(DATA_SIZE);
+    for (i = 0; i < DATA_SIZE; i++)
+        writeData[i] = (unsigned char)(i % 251);
+    readData = malloc(DATA_SIZE);
+
+
+    CHECK(mxf_direct_file_open_new(argv[1], BUFFER_SIZE, &mxfFile));
+
+    /* write a placeholder header and then the body in unaligned pieces */
+    memset(readData, 0, HEADER_SIZE);
+    CHECK(mxf_file_write(mxfFile, readData, HEADER_SIZE) == HEADER_SIZE);
+    CHECK(mxf_file_write(mxfFile, &writeData[HEADER_SIZE], 1001) == 1001);
+    CHECK(mxf_file_write(mxfFile, &writeData[HEADER_SIZE + 1001], DATA_SIZE - HEADER_SIZE - 1001 - 7) ==
+              DATA_SIZE - HEADER_SIZE - 1001 - 7);
+    for (i = DATA_SIZE - 7; i < DATA_SIZE; i++)
+        CHECK(mxf_file_putc(mxfFile, writeData[i]) == writeData[i]);
+    CHECK(mxf_file_tell(mxfFile) == DATA_SIZE);
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE);
+
+    /* rewrite the header and a range that crosses a block boundary in the middle */
+    CHECK(mxf_file_seek(mxfFile, 0, SEEK_SET));
+    CHECK(mxf_file_write(mxfFile, writeData, HEADER_SIZE) == HEADER_SIZE);
+    CHECK(mxf_file_seek(mxfFile, 5 * MXF_DIRECT_FILE_ALIGNMENT - 10, SEEK_SET));
+    memset(&writeData[5 * MXF_DIRECT_FILE_ALIGNMENT - 10], 7, 20);
+    CHECK(mxf_file_write(mxfFile, &writeData[5 * MXF_DIRECT_FILE_ALIGNMENT - 10], 20) == 20);
+    CHECK(mxf_file_seek(mxfFile, 0, SEEK_END));
+    CHECK(mxf_file_tell(mxfFile) == DATA_SIZE);
+
+    /* read back through the direct file */
+    CHECK(mxf_file_seek(mxfFile, 0, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE) == DATA_SIZE);
+    CHECK(memcmp(readData, writeData, DATA_SIZE) == 0);
+    CHECK(mxf_file_eof(mxfFile));
+
+    mxf_file_close(&mxfFile);
+
+
+    /* the padding in the last block is removed */
+    CHECK(mxf_disk_file_open_read(argv[1], &mxfFile));
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE);
+    CHECK(mxf_file_read(mxfFile, readData, DATA_SIZE) == DATA_SIZE);
+    CHECK(memcmp(readData, writeData, DATA_SIZE) == 0);
+    mxf_file_close(&mxfFile);
+
+
+    free(readData);
+    free(writeData);
+
+    return 0;
+}
+
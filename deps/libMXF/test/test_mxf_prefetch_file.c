@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_prefetch_file.h>
+#include <mxf/mxf_rw_intl_file.h>
+
+
+#define DATA_SIZE       (1024 * 1024 + 33)
+#define CHUNK_SIZE      (100 * 1000)
+#define NUM_SLOTS       4
+
+
+
+#define CHECK(cmd) \
+    if (!(cmd)) \
+    { \
+        fprintf(stderr, "'%s' failed in %s:%d\n", #cmd, __FILENAME__, __LINE__); \
+        exit(1); \
+    }
+
+
+
+static void usage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s filename\n", cmd);
+}
+
+static void test_read(const char *filename, int flags, const unsigned char *writeData, unsigned char *readData)
+{
+    MXFFile *mxfFile;
+    int64_t offset;
+    uint32_t i;
+
+    CHECK(mxf_prefetch_file_open_read(filename, NUM_SLOTS, flags, &mxfFile));
+    CHECK(mxf_file_supports_prefetch(mxfFile));
+    CHECK(mxf_file_size(mxfFile) == DATA_SIZE);
+
+    /* read chunks sequentially whilst keeping prefetch requests for the following chunks in flight */
+    offset = 0;
+    while (offset < DATA_SIZE) {
+        for (i = 1; i <= NUM_SLOTS; i++) {
+            if (offset + i * CHUNK_SIZE < DATA_SIZE && !mxf_file_prefetch(mxfFile, offset + i * CHUNK_SIZE, CHUNK_SIZE))
+                break;
+        }
+        if (offset + CHUNK_SIZE <= DATA_SIZE) {
+            CHECK(mxf_file_read(mxfFile, &readData[offset], CHUNK_SIZE) == CHUNK_SIZE);
+        } else {
+            /* the last prefetched range extends beyond the end of the file */
+            CHECK(mxf_file_read(mxfFile, &readData[offset], CHUNK_SIZE) == DATA_SIZE - offset);
+            CHECK(mxf_file_eof(mxfFile));
+        }
+        offset += CHUNK_SIZE;
+    }
+    CHECK(memcmp(readData, writeData, DATA_SIZE) == 0);
+
+    /* read across prefetched ranges and unprefetched data after seeking backwards */
+    memset(readData, 0, DATA_SIZE);
+    CHECK(mxf_file_prefetch(mxfFile, 1000, 5000));
+    CHECK(mxf_file_prefetch(mxfFile, 10000, 5000));
+    CHECK(mxf_file_prefetch(mxfFile, 12000, 1000)); /* already covered */
+    CHECK(!mxf_file_prefetch(mxfFile, 0, MXF_PREFETCH_MAX_SIZE + 1));
+    CHECK(mxf_file_seek(mxfFile, 500, SEEK_SET));
+    CHECK(mxf_file_read(mxfFile, &readData[500], 20000) == 20000);
+    CHECK(memcmp(&readData[500], &writeData[500], 20000) == 0);
+    CHECK(mxf_file_tell(mxfFile) == 20500);
+
+    /* getc and a small read at the start of the file */
+    CHECK(mxf_file_seek(mxfFile, 0, SEEK_SET));
+    CHECK(mxf_file_getc(mxfFile) == writeData[0]);
+    CHECK(mxf_file_read(mxfFile, readData, 16) == 16);
+    CHECK(memcmp(readData, &writeData[1], 16) == 0);
+
+    /* leave requests in flight when closing */
+    CHECK(mxf_file_prefetch(mxfFile, DATA_SIZE - CHUNK_SIZE, CHUNK_SIZE));
+    mxf_file_close(&mxfFile);
+}
+
+static void test_rw_intl_read(const char *filename, const unsigned char *writeData, unsigned char *readData)
+{
+    MXFRWInterleaver *interleaver;
+    MXFFile *targetFile;
+    MXFFile *mxfFile;
+
+    /* the interleaved reader passes prefetch requests through to the prefetch file */
+    CHECK(mxf_create_rw_intl(CHUNK_SIZE, 4 * CHUNK_SIZE, &interleaver));
+    CHECK(mxf_prefetch_file_open_read(filename, NUM_SLOTS, MXF_PREFETCH_FLAG_DEFAULT, &targetFile));
+    CHECK(mxf_rw_intl_open(interleaver, targetFile, 0, &mxfFile));
+    CHECK(mxf_file_supports_prefetch(mxfFile));
+    CHECK(mxf_file_prefetch(mxfFile, 0, CHUNK_SIZE));
+    CHECK(mxf_file_prefetch(mxfFile, CHUNK_SIZE, CHUNK_SIZE));
+    CHECK(mxf_file_read(mxfFile, readData, 2 * CHUNK_SIZE) == 2 * CHUNK_SIZE);
+    CHECK(memcmp(readData, writeData, 2 * CHUNK_SIZE) == 0);
+    mxf_file_close(&mxfFile);
+
+    /* and doesn't claim support if the target file has none */
+    CHECK(mxf_disk_file_open_read(filename, &targetFile));
+    CHECK(mxf_rw_intl_open(interleaver, targetFile, 0, &mxfFile));
+    CHECK(!mxf_file_supports_prefetch(mxfFile));
+    mxf_file_close(&mxfFile);
+
+    mxf_free_rw_intl(&interleaver);
+}
+
+int main(int argc, const char *argv[])
+{
+    MXFFile *mxfFile;
+    unsigned char *writeData;
+    unsigned char *readData;
+    uint32_t i;
+
+    if (argc != 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    writeData = malloc(DATA_SIZE);
+    for (i = 0; i < DATA_SIZE; i++)
+        writeData[i] = (unsigned char)(i % 251);
+    readData = malloc(DATA_SIZE);
+
+    CHECK(mxf_disk_file_open_new(argv[1], &mxfFile));
+    CHECK(mxf_file_write(mxfFile, writeData, DATA_SIZE) == DATA_SIZE);
+    mxf_file_close(&mxfFile);
+
+    test_read(argv[1], MXF_PREFETCH_FLAG_DEFAULT, writeData, readData);
+    test_read(argv[1], MXF_PREFETCH_FLAG_NO_IO_URING, writeData, readData);
+    test_rw_intl_read(argv[1], writeData, readData);
+
+    free(readData);
+    free(writeData);
+
+    return 0;
+}
+
@@ -0,0 +1,580 @@
+/*
+ * Generates the static data model tables included by mxf_data_model.c
+ *
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+    Usage: gen_data_model_tables > mxf/mxf_data_model_tables.h
+
+    Two models are generated: the baseline model from mxf_baseline_data_model.h and
+    mxf_extensions_data_model.h, and the Avid model that adds mxf_avid_extensions_data_model.h. The
+    set and item definitions are sorted by key so that they can be binary searched and the item
+    definitions of each set are linked in a static list in the order they are defined.
+
+    Re-generate the tables whenever the data model definitions change. The libMXF_test_datamodel
+    test fails if the tables are out of date.
+*/
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <mxf/mxf.h>
+#include <mxf/mxf_avid.h>
+
+
+#define CHECK(cmd) \
+    if (!(cmd)) \
+    { \
+        fprintf(stderr, "'%s' failed in line %d\n", #cmd, __LINE__); \
+        exit(1); \
+    }
+
+#define MAX_SET_DEFS        512
+#define MAX_ITEM_DEFS       2048
+#define MAX_TYPES           128
+#define MAX_TYPE_MEMBERS    16
+
+
+typedef struct
+{
+    const char *name;
+    const char *typeIdName;
+} TypeMember;
+
+typedef struct
+{
+    int isDefined;
+    MXFItemTypeCategory category;
+    const char *typeIdName;
+    const char *name;
+    unsigned int size;
+    const char *refTypeIdName;
+    unsigned int fixedSize;
+    TypeMember members[MAX_TYPE_MEMBERS];
+    int numMembers;
+} TypeDef;
+
+typedef struct
+{
+    const char *name;
+    mxfKey parentKey;
+    mxfKey key;
+    int parentIndex;
+    int firstElement;
+    int numElements;
+} SetDef;
+
+typedef struct
+{
+    size_t defIndex;
+    const char *setName;
+    const char *name;
+    mxfKey setKey;
+    mxfKey key;
+    mxfLocalTag localTag;
+    const char *typeIdName;
+    int isRequired;
+    int sortedIndex;
+} ItemDef;
+
+
+static TypeDef g_types[MAX_TYPES];
+static unsigned int g_typeOrder[MAX_TYPES];
+static size_t g_numTypes = 0;
+static TypeDef *g_compoundType = NULL;
+
+static SetDef g_setDefs[MAX_SET_DEFS];
+static size_t g_numSetDefs = 0;
+
+static ItemDef g_itemDefs[MAX_ITEM_DEFS];
+static size_t g_numItemDefs = 0;
+
+
+
+static int equals_key(const mxfKey *left, const mxfKey *right)
+{
+    return memcmp(left, right, sizeof(*left)) == 0;
+}
+
+static TypeDef* add_type(unsigned int typeId, const char *typeIdName, const char *name, MXFItemTypeCategory category)
+{
+    TypeDef *type;
+
+    CHECK(typeId > 0 && typeId < MAX_TYPES);
+    CHECK(typeId < MXF_EXTENSION_TYPE || category != MXF_BASIC_TYPE_CAT);
+    CHECK(!g_types[typeId].isDefined);
+
+    type = &g_types[typeId];
+    type->isDefined = 1;
+    type->category = category;
+    type->typeIdName = typeIdName;
+    type->name = name;
+    g_typeOrder[g_numTypes++] = typeId;
+
+    return type;
+}
+
+static void add_basic_type(unsigned int typeId, const char *typeIdName, const char *name, unsigned int size)
+{
+    TypeDef *type = add_type(typeId, typeIdName, name, MXF_BASIC_TYPE_CAT);
+    type->size = size;
+}
+
+static void add_array_type(unsigned int typeId, const char *typeIdName, const char *name,
+                           const char *elementTypeIdName, unsigned int fixedSize)
+{
+    TypeDef *type = add_type(typeId, typeIdName, name, MXF_ARRAY_TYPE_CAT);
+    type->refTypeIdName = elementTypeIdName;
+    type->fixedSize = fixedSize;
+}
+
+static void add_compound_type(unsigned int typeId, const char *typeIdName, const char *name)
+{
+    g_compoundType = add_type(typeId, typeIdName, name, MXF_COMPOUND_TYPE_CAT);
+}
+
+static void add_compound_type_member(const char *name, const char *typeIdName)
+{
+    CHECK(g_compoundType != NULL);
+    /* the last member is the terminator */
+    CHECK(g_compoundType->numMembers + 1 < MAX_TYPE_MEMBERS);
+
+    g_compoundType->members[g_compoundType->numMembers].name = name;
+    g_compoundType->members[g_compoundType->numMembers].typeIdName = typeIdName;
+    g_compoundType->numMembers++;
+}
+
+static void add_interpret_type(unsigned int typeId, const char *typeIdName, const char *name,
+                               const char *interpretedTypeIdName, unsigned int fixedArraySize)
+{
+    TypeDef *type = add_type(typeId, typeIdName, name, MXF_INTERPRET_TYPE_CAT);
+    type->refTypeIdName = interpretedTypeIdName;
+    type->fixedSize = fixedArraySize;
+}
+
+static void add_set_def(const char *name, const mxfKey *parentKey, const mxfKey *key)
+{
+    CHECK(g_numSetDefs < MAX_SET_DEFS);
+
+    g_setDefs[g_numSetDefs].name = name;
+    g_setDefs[g_numSetDefs].parentKey = *parentKey;
+    g_setDefs[g_numSetDefs].key = *key;
+    g_numSetDefs++;
+}
+
+static void add_item_def(const char *setName, const char *name, const mxfKey *setKey, const mxfKey *key,
+                         mxfLocalTag localTag, const char *typeIdName, int isRequired)
+{
+    CHECK(g_numItemDefs < MAX_ITEM_DEFS);
+
+    g_itemDefs[g_numItemDefs].defIndex = g_numItemDefs;
+    g_itemDefs[g_numItemDefs].setName = setName;
+    g_itemDefs[g_numItemDefs].name = name;
+    g_itemDefs[g_numItemDefs].setKey = *setKey;
+    g_itemDefs[g_numItemDefs].key = *key;
+    g_itemDefs[g_numItemDefs].localTag = localTag;
+    g_itemDefs[g_numItemDefs].typeIdName = typeIdName;
+    g_itemDefs[g_numItemDefs].isRequired = isRequired;
+    g_numItemDefs++;
+}
+
+static void load_definitions(int avidExtensions)
+{
+    memset(g_types, 0, sizeof(g_types));
+    g_numTypes = 0;
+    g_compoundType = NULL;
+    memset(g_setDefs, 0, sizeof(g_setDefs));
+    g_numSetDefs = 0;
+    memset(g_itemDefs, 0, sizeof(g_itemDefs));
+    g_numItemDefs = 0;
+
+#define MXF_BASIC_TYPE_DEF(typeId, name, size) \
+    add_basic_type(typeId, #typeId, name, size)
+
+#define MXF_ARRAY_TYPE_DEF(typeId, name, elementTypeId, fixedSize) \
+    add_array_type(typeId, #typeId, name, #elementTypeId, fixedSize)
+
+#define MXF_COMPOUND_TYPE_DEF(typeId, name) \
+    add_compound_type(typeId, #typeId, name)
+
+#define MXF_COMPOUND_TYPE_MEMBER(name, typeId) \
+    add_compound_type_member(name, #typeId)
+
+#define MXF_INTERPRETED_TYPE_DEF(typeId, name, interpretedTypeId, fixedSize) \
+    add_interpret_type(typeId, #typeId, name, #interpretedTypeId, fixedSize)
+
+#define MXF_SET_DEFINITION(parentName, name, label) \
+    add_set_def(#name, &MXF_SET_K(parentName), &MXF_SET_K(name))
+
+#define MXF_ITEM_DEFINITION(setName, name, label, tag, typeId, isRequired) \
+    add_item_def(#setName, #name, &MXF_SET_K(setName), &MXF_ITEM_K(setName, name), tag, #typeId, isRequired)
+
+#define KEEP_DATA_MODEL_DEFS 1
+#include <mxf/mxf_baseline_data_model.h>
+#include <mxf/mxf_extensions_data_model.h>
+
+    if (avidExtensions)
+    {
+#include <mxf/mxf_avid_extensions_data_model.h>
+    }
+
+#undef KEEP_DATA_MODEL_DEFS
+#undef MXF_BASIC_TYPE_DEF
+#undef MXF_ARRAY_TYPE_DEF
+#undef MXF_COMPOUND_TYPE_DEF
+#undef MXF_COMPOUND_TYPE_MEMBER
+#undef MXF_INTERPRETED_TYPE_DEF
+#undef MXF_LABEL
+#undef MXF_SET_DEFINITION
+#undef MXF_ITEM_DEFINITION
+}
+
+
+static int compare_set_defs(const void *left_in, const void *right_in)
+{
+    const SetDef *left = (const SetDef*)left_in;
+    const SetDef *right = (const SetDef*)right_in;
+
+    return memcmp(&left->key, &right->key, sizeof(left->key));
+}
+
+static int compare_item_defs(const void *left_in, const void *right_in)
+{
+    const ItemDef *left = (const ItemDef*)left_in;
+    const ItemDef *right = (const ItemDef*)right_in;
+    int result;
+
+    /* items with the same key are kept in definition order so that the first definition is found */
+    result = memcmp(&left->key, &right->key, sizeof(left->key));
+    if (result == 0)
+        result = (left->defIndex < right->defIndex ? -1 : 1);
+
+    return result;
+}
+
+static int find_set_def(const mxfKey *key)
+{
+    SetDef keySetDef;
+    SetDef *result;
+
+    keySetDef.key = *key;
+    result = (SetDef*)bsearch(&keySetDef, g_setDefs, g_numSetDefs, sizeof(g_setDefs[0]), compare_set_defs);
+    if (!result)
+        return -1;
+
+    return (int)(result - g_setDefs);
+}
+
+static void link_definitions(ItemDef **itemDefsInDefOrder)
+{
+    size_t i, j;
+    int elementIndex = 0;
+
+    qsort(g_setDefs, g_numSetDefs, sizeof(g_setDefs[0]), compare_set_defs);
+    for (i = 1; i < g_numSetDefs; i++)
+    {
+        if (compare_set_defs(&g_setDefs[i - 1], &g_setDefs[i]) == 0)
+        {
+            fprintf(stderr, "Duplicate set definition '%s'\n", g_setDefs[i].name);
+            exit(1);
+        }
+    }
+
+    qsort(g_itemDefs, g_numItemDefs, sizeof(g_itemDefs[0]), compare_item_defs);
+    for (i = 0; i < g_numItemDefs; i++)
+    {
+        g_itemDefs[i].sortedIndex = (int)i;
+        itemDefsInDefOrder[g_itemDefs[i].defIndex] = &g_itemDefs[i];
+        if (find_set_def(&g_itemDefs[i].setKey) < 0)
+        {
+            fprintf(stderr, "Unknown set definition '%s' for item definition '%s'\n",
+                    g_itemDefs[i].setName, g_itemDefs[i].name);
+            exit(1);
+        }
+    }
+
+    for (i = 0; i < g_numSetDefs; i++)
+    {
+        if (equals_key(&g_setDefs[i].parentKey, &g_Null_Key))
+        {
+            g_setDefs[i].parentIndex = -1;
+        }
+        else
+        {
+            g_setDefs[i].parentIndex = find_set_def(&g_setDefs[i].parentKey);
+            if (g_setDefs[i].parentIndex < 0)
+            {
+                fprintf(stderr, "Unknown parent set definition for set definition '%s'\n", g_setDefs[i].name);
+                exit(1);
+            }
+        }
+
+        /* the set's items are linked in definition order */
+        g_setDefs[i].firstElement = elementIndex;
+        for (j = 0; j < g_numItemDefs; j++)
+        {
+            if (equals_key(&itemDefsInDefOrder[j]->setKey, &g_setDefs[i].key))
+            {
+                g_setDefs[i].numElements++;
+                elementIndex++;
+            }
+        }
+    }
+}
+
+
+static void print_key(const mxfKey *key)
+{
+    const uint8_t *bytes = (const uint8_t*)key;
+    int i;
+
+    printf("{");
+    for (i = 0; i < 16; i++)
+    {
+        if (i > 0)
+            printf(", ");
+        printf("0x%02x", bytes[i]);
+    }
+    printf("}");
+}
+
+static void print_types(const char *prefix)
+{
+    unsigned int numTypes = MXF_EXTENSION_TYPE;
+    size_t i;
+    int j;
+
+    for (i = 0; i < g_numTypes; i++)
+    {
+        if (g_typeOrder[i] >= numTypes)
+            numTypes = g_typeOrder[i] + 1;
+    }
+
+    if (numTypes > MXF_EXTENSION_TYPE)
+    {
+        printf("static const MXFItemType g_%sItemTypes[MXF_EXTENSION_TYPE + %u] =\n{\n", prefix,
+               numTypes - MXF_EXTENSION_TYPE);
+    }
+    else
+    {
+        printf("static const MXFItemType g_%sItemTypes[MXF_EXTENSION_TYPE] =\n{\n", prefix);
+    }
+    for (i = 0; i < g_numTypes; i++)
+    {
+        const TypeDef *type = &g_types[g_typeOrder[i]];
+
+        printf("    [%s] = {", type->typeIdName);
+        switch (type->category)
+        {
+            case MXF_BASIC_TYPE_CAT:
+                printf("MXF_BASIC_TYPE_CAT, %s, (char*)\"%s\", {.basic = {%u}}", type->typeIdName, type->name,
+                       type->size);
+                break;
+            case MXF_ARRAY_TYPE_CAT:
+                printf("MXF_ARRAY_TYPE_CAT, %s, (char*)\"%s\", {.array = {%s, %u}}", type->typeIdName, type->name,
+                       type->refTypeIdName, type->fixedSize);
+                break;
+            case MXF_COMPOUND_TYPE_CAT:
+                printf("MXF_COMPOUND_TYPE_CAT, %s, (char*)\"%s\", {.compound = {{\n", type->typeIdName, type->name);
+                for (j = 0; j < type->numMembers; j++)
+                    printf("        {(char*)\"%s\", %s},\n", type->members[j].name, type->members[j].typeIdName);
+                printf("    }}}");
+                break;
+            case MXF_INTERPRET_TYPE_CAT:
+                printf("MXF_INTERPRET_TYPE_CAT, %s, (char*)\"%s\", {.interpret = {%s, %u}}", type->typeIdName,
+                       type->name, type->refTypeIdName, type->fixedSize);
+                break;
+        }
+        printf("},\n");
+    }
+    printf("};\n\n");
+}
+
+static void print_item_defs(const char *prefix)
+{
+    size_t i;
+
+    printf("static const MXFItemDef g_%sItemDefs[%d] =\n{\n", prefix, (int)g_numItemDefs);
+    for (i = 0; i < g_numItemDefs; i++)
+    {
+        const ItemDef *itemDef = &g_itemDefs[i];
+
+        printf("    /* %s::%s */\n", itemDef->setName, itemDef->name);
+        printf("    {(char*)\"%s\",\n        ", itemDef->name);
+        print_key(&itemDef->setKey);
+        printf(",\n        ");
+        print_key(&itemDef->key);
+        printf(",\n        0x%04x, %s, %d},\n", itemDef->localTag, itemDef->typeIdName, itemDef->isRequired);
+    }
+    printf("};\n\n");
+}
+
+static void print_item_def_elements(const char *prefix, ItemDef **itemDefsInDefOrder)
+{
+    size_t i, j;
+    int elementIndex = 0;
+    int setElementIndex;
+
+    printf("static const MXFListElement g_%sItemDefElements[%d] =\n{\n", prefix, (int)g_numItemDefs);
+    for (i = 0; i < g_numSetDefs; i++)
+    {
+        if (g_setDefs[i].numElements == 0)
+            continue;
+
+        printf("    /* %s */\n", g_setDefs[i].name);
+        setElementIndex = 0;
+        for (j = 0; j < g_numItemDefs; j++)
+        {
+            if (!equals_key(&itemDefsInDefOrder[j]->setKey, &g_setDefs[i].key))
+                continue;
+
+            setElementIndex++;
+            if (setElementIndex < g_setDefs[i].numElements)
+                printf("    {(MXFListElement*)&g_%sItemDefElements[%d], ", prefix, elementIndex + 1);
+            else
+                printf("    {NULL, ");
+            printf("(void*)&g_%sItemDefs[%d]},\n", prefix, itemDefsInDefOrder[j]->sortedIndex);
+            elementIndex++;
+        }
+    }
+    printf("};\n\n");
+}
+
+static void print_set_defs(const char *prefix)
+{
+    size_t i;
+
+    printf("static const MXFSetDef g_%sSetDefs[%d] =\n{\n", prefix, (int)g_numSetDefs);
+    for (i = 0; i < g_numSetDefs; i++)
+    {
+        const SetDef *setDef = &g_setDefs[i];
+
+        printf("    {(char*)\"%s\",\n        ", setDef->name);
+        print_key(&setDef->parentKey);
+        printf(",\n        ");
+        print_key(&setDef->key);
+        if (setDef->numElements > 0)
+        {
+            printf(",\n        {(MXFListElement*)&g_%sItemDefElements[%d], "
+                   "(MXFListElement*)&g_%sItemDefElements[%d], %d, NULL, NULL}",
+                   prefix, setDef->firstElement, prefix, setDef->firstElement + setDef->numElements - 1,
+                   setDef->numElements);
+        }
+        else
+        {
+            printf(",\n        {NULL, NULL, 0, NULL, NULL}");
+        }
+        if (setDef->parentIndex >= 0)
+            printf(",\n        (MXFSetDef*)&g_%sSetDefs[%d]},\n", prefix, setDef->parentIndex);
+        else
+            printf(",\n        NULL},\n");
+    }
+    printf("};\n\n");
+}
+
+static void print_model(const char *prefix, int avidExtensions)
+{
+    ItemDef **itemDefsInDefOrder;
+
+    load_definitions(avidExtensions);
+
+    CHECK((itemDefsInDefOrder = (ItemDef**)malloc(sizeof(*itemDefsInDefOrder) * (g_numItemDefs + 1))) != NULL);
+    link_definitions(itemDefsInDefOrder);
+
+    print_types(prefix);
+    print_item_defs(prefix);
+    print_item_def_elements(prefix, itemDefsInDefOrder);
+    print_set_defs(prefix);
+    printf("static const MXFStaticDataModel g_%sStaticDataModel =\n{\n"
+           "    g_%sItemTypes, ARRAY_SIZE(g_%sItemTypes),\n"
+           "    g_%sItemDefs, ARRAY_SIZE(g_%sItemDefs),\n"
+           "    g_%sSetDefs, ARRAY_SIZE(g_%sSetDefs),\n"
+           "};\n",
+           prefix, prefix, prefix, prefix, prefix, prefix, prefix);
+
+    free(itemDefsInDefOrder);
+}
+
+
+int main(int argc, const char **argv)
+{
+    if (argc != 1)
+    {
+        fprintf(stderr, "Usage: %s > mxf_data_model_tables.h\n", argv[0]);
+        return 1;
+    }
+
+    printf("/*\n"
+           " * Static data model tables\n"
+           " *\n"
+           " * Copyright (C) 2026, British Broadcasting Corporation\n"
+           " * All Rights Reserved.\n"
+           " *\n"
+           " * Redistribution and use in source and binary forms, with or without\n"
+           " * modification, are permitted provided that the following conditions are met:\n"
+           " *\n"
+           " *     * Redistributions of source code must retain the above copyright notice,\n"
+           " *       this list of conditions and the following disclaimer.\n"
+           " *     * Redistributions in binary form must reproduce the above copyright\n"
+           " *       notice, this list of conditions and the following disclaimer in the\n"
+           " *       documentation and/or other materials provided with the distribution.\n"
+           " *     * Neither the name of the British Broadcasting Corporation nor the names\n"
+           " *       of its contributors may be used to endorse or promote products derived\n"
+           " *       from this software without specific prior written permission.\n"
+           " *\n"
+           " * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS \"AS IS\"\n"
+           " * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE\n"
+           " * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE\n"
+           " * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE\n"
+           " * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR\n"
+           " * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF\n"
+           " * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS\n"
+           " * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN\n"
+           " * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)\n"
+           " * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE\n"
+           " * POSSIBILITY OF SUCH DAMAGE.\n"
+           " */\n"
+           "\n\n"
+           "/*\n"
+           "    Static data model tables generated using libMXF/tools/gen_data_model_tables/gen_data_model_tables\n"
+           "    from mxf_baseline_data_model.h and mxf_extensions_data_model.h, and for the Avid model\n"
+           "    mxf_avid_extensions_data_model.h\n"
+           "*/\n\n\n");
+    print_model("baseline", 0);
+    printf("\n\n");
+    print_model("avid", 1);
+
+    return 0;
+}
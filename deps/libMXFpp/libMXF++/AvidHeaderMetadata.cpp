@@ -45,24 +45,57 @@ using namespace mxfpp;
 AvidHeaderMetadata::AvidHeaderMetadata(DataModel *dataModel)
 : HeaderMetadata(dataModel)
 {
+    mDictionaryCache = 0;
+    mCachedDictionaries = 0;
+
     MXFPP_CHECK(mxf_avid_load_extensions(dataModel->getCDataModel()));
     dataModel->finalise();
 }
 
 AvidHeaderMetadata::~AvidHeaderMetadata()
 {
+    mxf_avid_free_cached_dictionaries(&mCachedDictionaries);
+}
+
+void AvidHeaderMetadata::setDictionaryCache(::MXFAvidDictionaryCache *cache)
+{
+    MXFPP_CHECK(!mCachedDictionaries);
+    mDictionaryCache = cache;
 }
 
 void AvidHeaderMetadata::createDefaultMetaDictionary()
 {
     ::MXFMetadataSet *metaDictSet;
-    MXFPP_CHECK(mxf_avid_create_default_metadictionary(getCHeaderMetadata(), &metaDictSet));
+    if (mDictionaryCache)
+    {
+        if (!mCachedDictionaries)
+        {
+            MXFPP_CHECK(mxf_avid_create_cached_dictionaries(mDictionaryCache, &mCachedDictionaries));
+        }
+        MXFPP_CHECK(mxf_avid_create_cached_default_metadictionary(mCachedDictionaries, getCHeaderMetadata(),
+                                                                  &metaDictSet));
+    }
+    else
+    {
+        MXFPP_CHECK(mxf_avid_create_default_metadictionary(getCHeaderMetadata(), &metaDictSet));
+    }
 }
 
 void AvidHeaderMetadata::createDefaultDictionary(Preface *preface)
 {
     ::MXFMetadataSet *dictSet;
-    MXFPP_CHECK(mxf_avid_create_default_dictionary(getCHeaderMetadata(), &dictSet));
+    if (mDictionaryCache)
+    {
+        if (!mCachedDictionaries)
+        {
+            MXFPP_CHECK(mxf_avid_create_cached_dictionaries(mDictionaryCache, &mCachedDictionaries));
+        }
+        MXFPP_CHECK(mxf_avid_create_cached_default_dictionary(mCachedDictionaries, getCHeaderMetadata(), &dictSet));
+    }
+    else
+    {
+        MXFPP_CHECK(mxf_avid_create_default_dictionary(getCHeaderMetadata(), &dictSet));
+    }
 
     MXFPP_CHECK(mxf_set_strongref_item(preface->getCMetadataSet(), &MXF_ITEM_K(Preface, Dictionary), dictSet));
 }
@@ -77,7 +110,8 @@ void AvidHeaderMetadata::write(File *file, Partition *partition, FillerWriter *f
 {
     partition->markHeaderStart(file);
 
-    MXFPP_CHECK(mxf_avid_write_header_metadata(file->getCFile(), getCHeaderMetadata(), partition->getCPartition()));
+    MXFPP_CHECK(mxf_avid_write_header_metadata_2(file->getCFile(), getCHeaderMetadata(), partition->getCPartition(),
+                                                 mCachedDictionaries));
     if (filler)
     {
         filler->write(file);
@@ -34,6 +34,7 @@
 
 
 #include <mxf/mxf.h>
+#include <mxf/mxf_avid_dictionary_cache.h>
 
 #include <libMXF++/HeaderMetadata.h>
 
@@ -50,6 +51,9 @@ public:
     virtual ~AvidHeaderMetadata();
 
 
+    // the default meta-dictionary and dictionary are created using the cache if set
+    void setDictionaryCache(::MXFAvidDictionaryCache *cache);
+
     void createDefaultMetaDictionary();
 
     void createDefaultDictionary(Preface *preface);
@@ -59,6 +63,9 @@ public:
 
     virtual void write(File *file, Partition *partition, FillerWriter *filler);
 
+private:
+    ::MXFAvidDictionaryCache *mDictionaryCache;
+    ::MXFAvidCachedDictionaries *mCachedDictionaries;
 };
 
 
@@ -457,6 +457,11 @@ void File::readNextPartition(const mxfKey *key, uint64_t len)
     _partitions.push_back(Partition::read(this, key, len));
 }
 
+void File::appendPartition(Partition *partition)
+{
+    _partitions.push_back(partition);
+}
+
 uint8_t File::readUInt8()
 {
     uint8_t value;
@@ -578,11 +583,31 @@ bool File::isSeekable()
     return mxf_file_is_seekable(_cFile) == 1;
 }
 
+bool File::supportsPrefetch()
+{
+    return mxf_file_supports_prefetch(_cFile) == 1;
+}
+
+bool File::prefetch(int64_t offset, uint32_t size)
+{
+    return mxf_file_prefetch(_cFile, offset, size) == 1;
+}
+
 uint32_t File::write(const unsigned char *data, uint32_t count)
 {
     return mxf_file_write(_cFile, data, count);
 }
 
+uint64_t File::writev(const MXFFileIOVec *iov, uint32_t iovcnt)
+{
+    return mxf_file_writev(_cFile, iov, iovcnt);
+}
+
+void File::flush()
+{
+    MXFPP_CHECK(mxf_file_flush(_cFile));
+}
+
 void File::writeUInt8(uint8_t value)
 {
     MXFPP_CHECK(mxf_write_uint8(_cFile, value));
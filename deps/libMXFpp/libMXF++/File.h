@@ -74,6 +74,7 @@ public:
     Partition* readFooterPartition();  // Caller takes ownership
     bool readPartitions();
     void readNextPartition(const mxfKey *key, uint64_t len);
+    void appendPartition(Partition *partition);  // takes ownership
 
     uint8_t readUInt8();
     uint16_t readUInt16();
@@ -98,9 +99,13 @@ public:
     int64_t size();
     bool eof();
     bool isSeekable();
+    bool supportsPrefetch();
+    bool prefetch(int64_t offset, uint32_t size);
 
 
     uint32_t write(const unsigned char *data, uint32_t count);
+    uint64_t writev(const MXFFileIOVec *iov, uint32_t iovcnt);
+    void flush();
 
     void writeUInt8(uint8_t value);
     void writeUInt16(uint16_t value);
@@ -2093,7 +2093,7 @@ int main(int argc, const char** argv)
     setDefsData.baseHeaderFile = baseHeaderFile;
     setDefsData.directory = directory;
     setDefsData.dataModel = dataModel;
-    mxf_tree_traverse(&dataModel->setDefs, process_set_defs, &setDefsData);
+    mxf_traverse_set_defs(dataModel, process_set_defs, &setDefsData);
 
 
     /* footer */
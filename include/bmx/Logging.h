@@ -35,6 +35,7 @@
 #include <cstdarg>
 
 #include <string>
+#include <vector>
 
 
 
@@ -50,6 +51,12 @@ typedef enum
     ERROR_LOG,
 } LogLevel;
 
+typedef struct
+{
+    LogLevel level;
+    std::string message;
+} LogRecord;
+
 typedef void (*log_func)(LogLevel level, const char *format, ...);
 typedef void (*vlog_func)(LogLevel level, const char *format, va_list p_arg);
 typedef void (*vlog2_func)(LogLevel level, const char *source, const char *format, va_list p_arg);
@@ -77,6 +84,11 @@ void log_error(const char *format, ...);
 
 void log_error_nl(const char *format, ...);
 
+// whilst set, the log_debug/info/warn/error messages from the calling thread are added to 'records'
+// instead of being logged, e.g. to report a worker thread's messages once it has finished
+void set_thread_log_records(std::vector<LogRecord> *records);
+void log_records(const std::vector<LogRecord> &records);
+
 
 };
 
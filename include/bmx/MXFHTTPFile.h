@@ -41,11 +41,32 @@ namespace bmx
 {
 
 
+typedef struct
+{
+    int64_t cache_hits;             // block reads from a completed block in the cache
+    int64_t cache_misses;           // block reads that required a new range request
+    int64_t prefetch_hits;          // block reads from a prefetched block, including those still in flight
+    int64_t num_requests;           // range requests, including prefetch requests
+    int64_t num_prefetch_requests;
+    int64_t bytes_received;
+    double request_time;            // total time in seconds from issuing requests to their completion
+    double max_request_time;
+    double wait_time;               // time in seconds that reads waited for requests to complete
+} MXFHTTPFileStats;
+
+
 bool mxf_http_is_supported();
 
 bool mxf_http_is_url(const std::string &url_str);
 
-MXFFile* mxf_http_file_open_read(const std::string &url_str, uint32_t min_read_size, bool enable_seek);
+// The file is read in blocks of min_read_size bytes that are held in a least recently used cache of
+// cache_blocks blocks. If prefetch_blocks is non-zero then up to that number of blocks following the
+// read position are requested concurrently when the file is being read sequentially
+MXFFile* mxf_http_file_open_read(const std::string &url_str, uint32_t min_read_size, bool enable_seek,
+                                 uint32_t cache_blocks = 1, uint32_t prefetch_blocks = 0, bool log_stats = false);
+
+// Returns false if the file was not opened using mxf_http_file_open_read or if seeking was disabled
+bool mxf_http_file_get_stats(MXFFile *mxf_file, MXFHTTPFileStats *stats);
 
 
 };
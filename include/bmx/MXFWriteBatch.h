@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef BMX_MXF_WRITE_BATCH_H_
+#define BMX_MXF_WRITE_BATCH_H_
+
+
+#include <vector>
+
+#include <libMXF++/MXF.h>
+
+#include <bmx/ByteArray.h>
+
+
+
+namespace bmx
+{
+
+
+// Collects the KLVs and fill for a content package and writes them to the file in one vectored write.
+// Small items such as keys and lengths are copied; essence data is referenced and must remain valid until
+// Write is called.
+class MXFWriteBatch
+{
+public:
+    MXFWriteBatch();
+    ~MXFWriteBatch();
+
+    void Clear();
+
+    void AppendFixedKL(const mxfKey *key, uint8_t llen, uint64_t len);
+    void AppendUInt8(uint8_t value);
+    void AppendUInt16(uint16_t value);
+    void AppendUL(const mxfUL *label);
+    void AppendCopy(const unsigned char *data, uint32_t size);
+    void AppendData(const unsigned char *data, uint32_t size);
+    void AppendFill(mxfpp::File *mxf_file, uint32_t size);
+
+    uint64_t GetSize() const { return mSize; }
+
+    void Write(mxfpp::File *mxf_file);
+
+private:
+    typedef struct
+    {
+        const unsigned char *data;  // 0 if the bytes are in mCopyBytes
+        uint32_t offset;
+        uint32_t size;
+    } Buffer;
+
+    void AppendZeros(uint32_t size);
+
+private:
+    ByteArray mCopyBytes;
+    ByteArray mZeros;
+    std::vector<Buffer> mBuffers;
+    std::vector<MXFFileIOVec> mIOVecs;
+    uint64_t mSize;
+};
+
+
+};
+
+
+
+#endif
@@ -35,18 +35,24 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <mutex>
 
 #include <bmx/mxf_helper/MXFFileFactory.h>
 #include <bmx/MXFChecksumFile.h>
 #include <bmx/URI.h>
 
 #include <mxf/mxf_rw_intl_file.h>
+#include <mxf/mxf_async_write_file.h>
 
 #if defined(_WIN32)
 #include <mxf/mxf_win32_file.h>
 #if !defined(__MINGW32__)
 #include <mxf/mxf_win32_mmap.h>
 #endif
+#else
+#include <mxf/mxf_posix_mmap.h>
+#include <mxf/mxf_direct_file.h>
+#include <mxf/mxf_prefetch_file.h>
 #endif
 
 
@@ -64,10 +70,21 @@ public:
     void SetInputChecksumTypes(const std::set<ChecksumType> &types);
     void AddInputChecksumType(ChecksumType type);
     void SetInputFlags(int flags);
+#if !defined(_WIN32)
+    void SetReadAheadSize(uint32_t size);  // Default 0, i.e. disabled
+    void SetPrefetch(uint32_t num_slots);  // Default 0, i.e. disabled
+#endif
     void SetRWInterleave(uint32_t rw_interleave_size);
+    void SetAsyncWrite(uint32_t buffer_size, uint32_t num_buffers);  // Default 0 buffers, i.e. disabled
+#if !defined(_WIN32)
+    void SetDirectIO(bool enable);  // Default false
+#endif
     void SetHTTPMinReadSize(uint32_t size);
     void SetHTTPEnableSeek(bool enable);  // Default true
-#if defined(_WIN32) && !defined(__MINGW32__)
+    void SetHTTPCacheBlocks(uint32_t num_blocks);  // Default 1
+    void SetHTTPPrefetch(uint32_t num_blocks);  // Default 0, i.e. disabled
+    void SetHTTPLogStats(bool enable);  // Default false
+#if !defined(__MINGW32__)
     void SetUseMMapFile(bool enable);
 #endif
 
@@ -75,6 +92,7 @@ public:
     virtual mxfpp::File* OpenNew(std::string filename);
     virtual mxfpp::File* OpenRead(std::string filename);
     virtual mxfpp::File* OpenModify(std::string filename);
+    virtual mxfpp::File* OpenReadAdditional(std::string filename);
 
 public:
     void ForceInputChecksumUpdate();
@@ -90,6 +108,7 @@ public:
     std::string GetInputChecksumDigestString(size_t file_index, ChecksumType type) const;
 
 private:
+    MXFFile* OpenReadFile(const std::string &filename);
     MXFChecksumFile* GetChecksumFile(size_t file_index, ChecksumType type) const;
 
 private:
@@ -103,13 +122,26 @@ private:
 private:
     std::set<ChecksumType> mInputChecksumTypes;
     int mInputFlags;
+#if !defined(_WIN32)
+    uint32_t mReadAheadSize;
+    uint32_t mPrefetchSlots;
+#endif
     std::vector<InputChecksumFile> mInputChecksumFiles;
     MXFRWInterleaver *mRWInterleaver;
+    uint32_t mAsyncWriteSize;
+    uint32_t mAsyncWriteBuffers;
+#if !defined(_WIN32)
+    bool mDirectIO;
+#endif
     uint32_t mHTTPMinReadSize;
     bool mHTTPEnableSeek;
-#if defined(_WIN32) && !defined(__MINGW32__)
+    uint32_t mHTTPCacheBlocks;
+    uint32_t mHTTPPrefetch;
+    bool mHTTPLogStats;
+#if !defined(__MINGW32__)
     bool mUseMMapFile;
 #endif
+    std::mutex mOpenReadMutex;  // readers may resolve external files whilst being opened concurrently
 };
 
 
@@ -159,6 +159,7 @@ private:
 
     mxfpp::DataModel *mDataModel;
     mxfpp::AvidHeaderMetadata *mHeaderMetadata;
+    ::MXFAvidDictionaryCache *mDictionaryCache;
     bool mHavePreparedHeaderMetadata;
     mxfpp::ContentStorage *mContentStorage;
     mxfpp::MaterialPackage *mMaterialPackage;
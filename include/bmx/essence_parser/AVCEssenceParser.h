@@ -398,6 +398,9 @@ public:
     void SetSPS(const unsigned char *data, uint32_t size);
     void SetPPS(const unsigned char *data, uint32_t size);
 
+    // note that the parameter sets set using SetSPS and SetPPS are not copied to the new instance
+    virtual EssenceParser* CreateInstance() const { return new AVCEssenceParser(); }
+
     virtual uint32_t ParseFrameStart(const unsigned char *data, uint32_t data_size);
 
     virtual void ResetParseFrameSize();
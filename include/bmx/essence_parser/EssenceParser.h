@@ -94,6 +94,9 @@ class EssenceParser
 public:
     virtual ~EssenceParser() {}
 
+    // returns a new parser of the same type and settings without any parse state, or 0 if not supported
+    virtual EssenceParser* CreateInstance() const { return 0; }
+
     virtual uint32_t ParseFrameStart(const unsigned char *data, uint32_t data_size) = 0;
 
     virtual void ResetParseFrameSize() = 0;
@@ -49,6 +49,8 @@ public:
     J2CEssenceParser();
     virtual ~J2CEssenceParser();
 
+    virtual EssenceParser* CreateInstance() const { return new J2CEssenceParser(); }
+
     virtual uint32_t ParseFrameStart(const unsigned char *data, uint32_t data_size);
 
     virtual void ResetParseFrameSize();
@@ -47,6 +47,8 @@ public:
     MPEG2EssenceParser();
     virtual ~MPEG2EssenceParser();
 
+    virtual EssenceParser* CreateInstance() const { return new MPEG2EssenceParser(); }
+
     virtual uint32_t ParseFrameStart(const unsigned char *data, uint32_t data_size);
 
     virtual void ResetParseFrameSize();
@@ -33,6 +33,8 @@
 #define BMX_RAW_ESSENCE_READER_H_
 
 
+#include <vector>
+
 #include <bmx/essence_parser/EssenceParser.h>
 #include <bmx/essence_parser/EssenceSource.h>
 #include <bmx/ByteArray.h>
@@ -59,6 +61,15 @@ public:
     virtual void SetEssenceParser(EssenceParser *essence_parser);
     void SetCheckMaxSampleSize(uint32_t size);
 
+    // frame start offsets relative to the essence start followed by the end offset of the last frame,
+    // e.g. from RawFrameScanner. The frames are read without parsing and parsing continues after the
+    // last frame if the offsets are not complete
+    void SetFrameOffsets(const std::vector<int64_t> &offsets, bool complete);
+
+    int64_t GetMaxReadLength() const        { return mMaxReadLength; }
+    uint32_t GetFrameStartSize() const      { return mFrameStartSize; }
+    uint32_t GetReadBlockSize() const       { return mReadBlockSize; }
+    uint32_t GetCheckMaxSampleSize() const  { return mMaxSampleSize; }
     uint32_t GetFixedSampleSize() const     { return mFixedSampleSize; }
     EssenceParser* GetEssenceParser() const { return mEssenceParser; }
     EssenceSource* GetEssenceSource() const { return mEssenceSource; }
@@ -66,20 +77,31 @@ public:
 public:
     virtual uint32_t ReadSamples(uint32_t num_samples);
 
-    virtual unsigned char* GetSampleData() const        { return mSampleBuffer.GetBytes(); }
+    virtual unsigned char* GetSampleData() const        { return GetBufferData(); }
     uint32_t GetSampleDataSize() const                  { return mSampleDataSize; }
     uint32_t GetNumSamples() const                      { return mNumSamples; }
     uint32_t GetSampleSize() const;
+    int64_t GetSamplePosition() const;
 
     virtual void Reset();
 
 protected:
     bool ReadAndParseSample();
+    bool ReadIndexedSample();
+    uint32_t GetReadSize(uint32_t sample_num_read) const;
     uint32_t ReadBytes(uint32_t size);
     void ShiftSampleData(uint32_t to_offset, uint32_t from_offset);
+    void ConsumeSampleData();
 
     uint32_t AppendBytes(const unsigned char *bytes, uint32_t size);
 
+    // the buffered data starts at the first byte that has not been consumed
+    unsigned char* GetBufferData() const    { return mSampleBuffer.GetBytes() + mSampleBufferOffset; }
+    uint32_t GetBufferDataSize() const      { return mSampleBuffer.GetSize() - mSampleBufferOffset; }
+
+private:
+    void ReserveBytes(uint32_t size);
+
 protected:
     EssenceSource *mEssenceSource;
 
@@ -93,10 +115,16 @@ protected:
     EssenceParser *mEssenceParser;
 
     ByteArray mSampleBuffer;
+    uint32_t mSampleBufferOffset;
+    uint32_t mPrevSampleSize;
     uint32_t mSampleDataSize;
     uint32_t mNumSamples;
     bool mReadFirstSample;
     bool mLastSampleRead;
+
+    std::vector<int64_t> mFrameOffsets;
+    bool mFrameOffsetsComplete;
+    size_t mFrameOffsetIndex;
 };
 
 
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef BMX_RAW_FRAME_SCANNER_H_
+#define BMX_RAW_FRAME_SCANNER_H_
+
+
+#include <string>
+#include <vector>
+
+#include <bmx/essence_parser/RawEssenceReader.h>
+
+
+
+namespace bmx
+{
+
+
+// Finds the frame boundaries in a raw essence file by parsing chunks of the file in parallel.
+// The workers for all but the first chunk start at a candidate frame start found by the essence parser.
+// A worker's frames are only used once the frames parsed from the preceding chunks reach one of its
+// frame start offsets, with the frames across the chunk seam parsed on the calling thread otherwise.
+// The resulting frame offsets are therefore the same as when parsing sequentially.
+class RawFrameScanner
+{
+public:
+    RawFrameScanner();
+    ~RawFrameScanner();
+
+    void SetNumThreads(uint32_t num_threads);
+    void SetMinChunkSize(int64_t size);
+
+    // the essence parser and read settings are taken from the reader, which must not have a fixed sample size
+    // returns false if the file can't be scanned, e.g. it is not seekable, or too small to be split up
+    bool Scan(RawEssenceReader *reader, const std::string &filename, int64_t start_offset);
+
+    // frame start offsets relative to the start offset followed by the end offset of the last frame
+    const std::vector<int64_t>& GetFrameOffsets() const { return mFrameOffsets; }
+    bool IsComplete() const                             { return mComplete; }
+
+    uint32_t GetNumChunks() const       { return mNumChunks; }
+    uint32_t GetNumSeamFrames() const   { return mNumSeamFrames; }
+
+private:
+    uint32_t mNumThreads;
+    int64_t mMinChunkSize;
+
+    std::vector<int64_t> mFrameOffsets;
+    bool mComplete;
+    uint32_t mNumChunks;
+    uint32_t mNumSeamFrames;
+};
+
+
+};
+
+
+
+#endif
@@ -52,14 +52,34 @@ uint32_t convert_aes3_to_mc_pcm(const unsigned char *aes3_data, uint32_t aes3_da
                                 uint32_t bits_per_sample, uint8_t channel_count,
                                 unsigned char *pcm_data, uint32_t pcm_data_size);
 
+uint32_t convert_aes3_to_pcm_channels(const unsigned char *aes3_data, uint32_t aes3_data_size, bool ignore_valid_flags,
+                                      uint32_t bits_per_sample, uint8_t channel_count,
+                                      unsigned char **pcm_data, uint32_t pcm_data_size);
+
 void deinterleave_audio(const unsigned char *input_data, uint32_t input_data_size,
                         uint32_t bits_per_sample, uint16_t channel_count, uint16_t channel_num,
                         unsigned char *output_data, uint32_t output_data_size);
 
+// split all channels in one pass; output_data has channel_count entries, each output_data_size bytes or null to skip
+void deinterleave_audio_channels(const unsigned char *input_data, uint32_t input_data_size,
+                                 uint32_t bits_per_sample, uint16_t channel_count,
+                                 unsigned char **output_data, uint32_t output_data_size);
+
 void interleave_audio(const unsigned char *input_data, uint32_t input_data_size,
                       uint32_t bits_per_sample, uint16_t channel_count, uint16_t channel_num,
                       unsigned char *output_data, uint32_t output_data_size);
 
+// pack channel_count interleaved PCM channels into the AES3 channel words starting at aes3_samples, which points to
+// the first word of channel channel_index. Only channels set in copy_flags (bit = channel_index + c) are written
+void convert_pcm_to_aes3(const unsigned char *pcm_data, uint32_t sample_count, uint32_t bits_per_sample,
+                         uint8_t channel_index, uint8_t channel_count, uint8_t copy_flags,
+                         unsigned char *aes3_samples);
+
+// the conversions use SSE2/AVX2 or NEON code when supported by the CPU; disabling selects the scalar code
+void enable_sound_conversion_simd(bool enable);
+// returns "avx2", "sse2", "neon" or "scalar"
+const char* get_sound_conversion_simd_name();
+
 
 
 };
@@ -50,6 +50,8 @@ public:
     VC3EssenceParser();
     virtual ~VC3EssenceParser();
 
+    virtual EssenceParser* CreateInstance() const { return new VC3EssenceParser(); }
+
     virtual uint32_t ParseFrameStart(const unsigned char *data, uint32_t data_size);
 
     virtual void ResetParseFrameSize();
@@ -82,6 +82,8 @@ public:
 
     virtual Frame* Clone() = 0;
 
+    virtual void Reset();
+
 public:
     bool IsEmpty() const    { return num_samples == 0; }
     bool IsComplete() const { return num_samples == request_num_samples; }
@@ -125,6 +127,7 @@ public:
     virtual ~FrameFactory() {};
 
     virtual Frame* CreateFrame() = 0;
+    virtual void DeleteFrame(Frame *frame) { delete frame; }
 };
 
 
@@ -145,6 +148,8 @@ public:
 
     virtual Frame* Clone();
 
+    virtual void Reset();
+
 private:
     ByteArray mData;
 };
@@ -159,6 +164,30 @@ public:
 };
 
 
+class PooledFrameFactory : public FrameFactory
+{
+public:
+    PooledFrameFactory(size_t max_pool_size = 64);
+    PooledFrameFactory(FrameFactory *frame_factory, bool take_ownership, size_t max_pool_size = 64);
+    virtual ~PooledFrameFactory();
+
+    virtual Frame* CreateFrame();
+    virtual void DeleteFrame(Frame *frame);
+
+    size_t GetPoolSize() const   { return mFreeFrames.size(); }
+    uint64_t GetHitCount() const  { return mHitCount; }
+    uint64_t GetMissCount() const { return mMissCount; }
+
+private:
+    FrameFactory *mFrameFactory;
+    bool mOwnFrameFactory;
+    size_t mMaxPoolSize;
+    std::vector<Frame*> mFreeFrames;
+    uint64_t mHitCount;
+    uint64_t mMissCount;
+};
+
+
 };
 
 
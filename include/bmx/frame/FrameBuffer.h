@@ -54,6 +54,7 @@ public:
     virtual void AbortRead() = 0;
 
     virtual Frame* CreateFrame() = 0;
+    virtual void DeleteFrame(Frame *frame) { delete frame; }
 
     virtual void PushFrame(Frame *frame) = 0;
     virtual void PopFrame(bool del_frame) = 0;
@@ -79,6 +80,7 @@ public:
     virtual void AbortRead();
 
     virtual Frame* CreateFrame();
+    virtual void DeleteFrame(Frame *frame);
 
     virtual void PushFrame(Frame *frame);
     virtual void PopFrame(bool del_frame);
@@ -49,6 +49,9 @@ public:
     virtual mxfpp::File* OpenNew(std::string filename) = 0;
     virtual mxfpp::File* OpenRead(std::string filename) = 0;
     virtual mxfpp::File* OpenModify(std::string filename) = 0;
+
+    // opens another handle to a file already opened with OpenRead, eg. for reading on a background thread
+    virtual mxfpp::File* OpenReadAdditional(std::string filename) { return OpenRead(filename); }
 };
 
 
@@ -39,6 +39,7 @@
 #include <libMXF++/MXF.h>
 
 #include <bmx/ByteArray.h>
+#include <bmx/MXFWriteBatch.h>
 #include <bmx/frame/DataBufferArray.h>
 #include <bmx/mxf_op1a/OP1AIndexTable.h>
 
@@ -106,21 +107,28 @@ public:
 
     uint32_t WriteSamples(const unsigned char *data, uint32_t size, uint32_t num_samples);
     void WriteSample(const CDataBuffer *data_array, uint32_t array_size);
+    void RetainData();
 
     bool IsReady() const;
 
     uint32_t GetWriteSize() const;
     uint32_t GetNumSamplesWritten() const { return mNumSamplesWritten; }
-    uint32_t Write();
+    uint32_t Write(MXFWriteBatch *write_batch);
     void CompleteWrite();
 
     void Reset(int64_t new_position);
 
+private:
+    void AppendDataRef(const unsigned char *data, uint32_t size);
+    uint32_t GetDataSize() const { return mData.GetSize() + mDataRefsSize; }
+
 private:
     mxfpp::File *mMXFFile;
     OP1AIndexTable *mIndexTable;
     OP1AContentPackageElement *mElement;
     ByteArray mData;
+    std::vector<CDataBuffer> mDataRefs;
+    uint32_t mDataRefsSize;
     uint32_t mNumSamples;
     uint32_t mNumSamplesWritten;
     int64_t mTotalWriteSize;
@@ -144,6 +152,7 @@ public:
     void WriteUserTimecode(Timecode user_timecode);
     uint32_t WriteSamples(uint32_t track_index, const unsigned char *data, uint32_t size, uint32_t num_samples);
     void WriteSample(uint32_t track_index, const CDataBuffer *data_array, uint32_t array_size);
+    void RetainSampleData();
 
 public:
     bool IsReady();
@@ -170,6 +179,7 @@ private:
     Timecode mUserTimecode;
     bool mUserTimecodeSet;
     bool mFieldMark;
+    MXFWriteBatch mWriteBatch;
 };
 
 
@@ -202,6 +212,7 @@ public:
     void WriteUserTimecode(Timecode user_timecode);
     void WriteSamples(uint32_t track_index, const unsigned char *data, uint32_t size, uint32_t num_samples);
     void WriteSample(uint32_t track_index, const CDataBuffer *data_array, uint32_t array_size);
+    void RetainSampleData();
 
 public:
     int64_t GetPosition() const { return mPosition; }
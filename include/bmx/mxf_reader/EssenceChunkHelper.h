@@ -34,6 +34,8 @@
 
 #include <vector>
 
+#include <libMXF++/MXF.h>
+
 #include <bmx/BMXTypes.h>
 
 
@@ -75,6 +77,9 @@ public:
 
     size_t GetNumIndexedPartitions() const { return mNumIndexedPartitions; }
 
+    void WriteCache(mxfpp::File *cache_file) const;
+    void ReadCache(mxfpp::File *cache_file);
+
 public:
     bool IsComplete() const { return mIsComplete; }
 
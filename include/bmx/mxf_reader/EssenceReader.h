@@ -35,8 +35,14 @@
 
 #include <vector>
 #include <deque>
+#include <map>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <bmx/frame/Frame.h>
+#include <bmx/frame/SharedBufferFrame.h>
 #include <bmx/mxf_reader/FrameMetadataReader.h>
 #include <bmx/mxf_reader/EssenceChunkHelper.h>
 #include <bmx/mxf_reader/IndexTableHelper.h>
@@ -48,6 +54,7 @@ namespace bmx
 
 
 class MXFFileReader;
+class MXFTrackReader;
 
 
 class EssenceReaderBuffer
@@ -86,14 +93,71 @@ private:
 };
 
 
+// Reads the content packages of upcoming edit units on a background thread into pooled shared buffers
+class EssenceReadQueue
+{
+public:
+    EssenceReadQueue(mxfpp::File *file, uint32_t max_edit_units, uint64_t max_bytes);  // takes ownership of file
+    ~EssenceReadQueue();
+
+    bool IsEmpty();
+    int64_t GetNextPosition();
+    bool CanRequest(uint32_t size);
+    void Request(int64_t position, int64_t file_position, uint32_t size);
+
+    SharedBuffer* Take(int64_t position, int64_t file_position, uint32_t size);
+
+    void Invalidate(int64_t position);
+    void Clear();
+
+private:
+    typedef enum
+    {
+        EDIT_UNIT_PENDING,
+        EDIT_UNIT_READING,
+        EDIT_UNIT_DONE,
+        EDIT_UNIT_FAILED,
+    } EditUnitState;
+
+    typedef struct
+    {
+        int64_t position;
+        int64_t file_position;
+        uint32_t size;
+        SharedBuffer *buffer;
+        EditUnitState state;
+    } QueuedEditUnit;
+
+    void Run();
+    SharedBuffer* GetFreeBuffer();
+    void ClearLocked(std::unique_lock<std::mutex> &lock);
+
+private:
+    mxfpp::File *mFile;
+    uint32_t mMaxEditUnits;
+    uint64_t mMaxBytes;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStop;
+    std::deque<QueuedEditUnit> mEditUnits;
+    uint64_t mQueuedBytes;
+    std::vector<SharedBuffer*> mBufferPool;
+
+    std::thread mThread;
+};
+
+
 class EssenceReader
 {
 public:
-    EssenceReader(MXFFileReader *file_reader, bool file_is_complete, bool parse_only);
+    EssenceReader(MXFFileReader *file_reader, bool file_is_complete, bool parse_only,
+                  mxfpp::File *index_cache_file = 0);
     ~EssenceReader();
 
     void SetReadLimits(int64_t start_position, int64_t duration);
     void SetBufferFrames(bool enable);
+    void SetReadQueue(const std::string &filename, uint32_t max_edit_units, uint64_t max_bytes);
 
     uint32_t Read(uint32_t num_samples);
     void Seek(int64_t position);
@@ -108,9 +172,19 @@ public:
 
     bool IsComplete() const;
 
+    bool CanWriteIndexCache() const;
+    void WriteIndexCache(mxfpp::File *cache_file) const;
+
 private:
+    void ReadIndexCache(mxfpp::File *cache_file);
+
     uint32_t ReadClipWrappedSamples(uint32_t num_samples);
     uint32_t ReadFrameWrappedSamples(uint32_t num_samples);
+    void ReadContentPackage(int64_t start_position, int64_t cp_file_position, uint32_t size,
+                            std::map<uint32_t, MXFTrackReader*> *enabled_track_readers);
+    Frame* GetElementFrame(int64_t start_position, int64_t cp_file_position, int64_t kl_offset,
+                           const mxfKey *key, uint8_t llen,
+                           std::map<uint32_t, MXFTrackReader*> *enabled_track_readers);
 
     void GetEditUnit(int64_t position, mxfKey *element_key, int64_t *file_position, int64_t *size);
     void GetEditUnitGroup(int64_t position, uint32_t max_samples, mxfKey *element_key, int64_t *file_position,
@@ -118,6 +192,9 @@ private:
 
     uint32_t GetConstantEditUnitSize();
 
+    void PrefetchEditUnits(int64_t position);
+    void QueueEditUnits(int64_t position);
+
 private:
     bool SeekEssence(int64_t base_position);
     bool ReadEssenceKL(bool first_element, mxfKey *key, uint8_t *llen, uint64_t *len);
@@ -170,6 +247,13 @@ private:
     int64_t mLastKnownBasePosition;
     bool mHaveFooter;
     bool mBaseReadError;
+
+    SharedBuffer *mCPBuffer;
+
+    bool mCanPrefetch;
+    int64_t mPrefetchPosition;
+
+    EssenceReadQueue *mReadQueue;
 };
 
 
@@ -55,6 +55,7 @@ public:
     virtual ~FrameMetadataChildReader() {}
 
     virtual void Reset() = 0;
+    virtual bool IsFrameMetadata(const mxfKey *key) = 0;
     virtual bool ProcessFrameMetadata(const mxfKey *key, uint64_t len) = 0;
     virtual void InsertFrameMetadata(Frame *frame, uint32_t track_number) = 0;
 };
@@ -67,6 +68,7 @@ public:
     virtual ~SystemScheme1Reader();
 
     virtual void Reset();
+    virtual bool IsFrameMetadata(const mxfKey *key);
     virtual bool ProcessFrameMetadata(const mxfKey *key, uint64_t len);
     virtual void InsertFrameMetadata(Frame *frame, uint32_t track_number);
 
@@ -89,6 +91,7 @@ public:
     virtual ~SDTICPSystemMetadataReader();
 
     virtual void Reset();
+    virtual bool IsFrameMetadata(const mxfKey *key);
     virtual bool ProcessFrameMetadata(const mxfKey *key, uint64_t len);
     virtual void InsertFrameMetadata(Frame *frame, uint32_t track_number);
 
@@ -105,6 +108,7 @@ public:
     virtual ~SDTICPPackageMetadataReader();
 
     virtual void Reset();
+    virtual bool IsFrameMetadata(const mxfKey *key);
     virtual bool ProcessFrameMetadata(const mxfKey *key, uint64_t len);
     virtual void InsertFrameMetadata(Frame *frame, uint32_t track_number);
 
@@ -121,6 +125,7 @@ public:
     ~FrameMetadataReader();
 
     void Reset();
+    bool IsFrameMetadata(const mxfKey *key);
     bool ProcessFrameMetadata(const mxfKey *key, uint64_t len);
     void InsertFrameMetadata(Frame *frame, uint32_t track_number);
 
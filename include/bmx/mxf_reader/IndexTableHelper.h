@@ -84,8 +84,19 @@ public:
 
     void CopyIndexEntries(const IndexTableHelperSegment *segment, uint32_t duration);
 
+    void WriteCache(mxfpp::File *cache_file) const;
+    void ReadCache(mxfpp::File *cache_file);
+
+private:
+    void AllocIndexEntries(uint32_t num_entries);
+
 private:
+    // the index entries are stored as separate arrays in a single allocation
     unsigned char *mIndexEntries;
+    int64_t *mStreamOffsets;
+    int8_t *mTemporalOffsets;
+    int8_t *mKeyFrameOffsets;
+    uint8_t *mFlags;
     uint32_t mAllocIndexEntries;
     uint32_t mNumIndexEntries;
     uint32_t mEntriesStart;
@@ -138,12 +149,18 @@ public:
 
     bool GetIndexEntry(MXFIndexEntryExt *entry, int64_t position);
 
+    void WriteCache(mxfpp::File *cache_file) const;
+    void ReadCache(mxfpp::File *cache_file);
+
 private:
     void InsertCBEIndexSegment(std::unique_ptr<IndexTableHelperSegment> &new_segment_up);
     void InsertVBEIndexSegment(std::unique_ptr<IndexTableHelperSegment> &new_segment_up);
 
     IndexTableHelperSegment* CreateStartSegment(IndexTableHelperSegment *segment, uint32_t duration);
 
+    size_t FindSegment(int64_t position);
+    void UpdateSegmentStarts();
+
 private:
     MXFFileReader *mFileReader;
     mxfpp::File *mFile;
@@ -151,6 +168,8 @@ private:
     bool mIsComplete;
 
     std::vector<IndexTableHelperSegment*> mSegments;
+    std::vector<int64_t> mSegmentStarts;
+    bool mSegmentStartsValid;
     size_t mLastEditUnitSegment;
 
     uint32_t mEditUnitSize;
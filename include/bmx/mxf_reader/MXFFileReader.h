@@ -89,6 +89,13 @@ public:
 public:
     static std::string ResultToString(OpenResult result);
 
+    // Open the files using up to num_threads concurrent threads. The files are opened using each reader's
+    // file factory in the given order and the results are returned in the same order.
+    // No more readers are started after a failure and the result for those readers is MXF_RESULT_OPEN_FAIL
+    static std::vector<OpenResult> OpenMultiple(const std::vector<MXFFileReader*> &readers,
+                                                const std::vector<std::string> &filenames,
+                                                uint32_t num_threads, int mode_flags=0);
+
 public:
     MXFFileReader();
     virtual ~MXFFileReader();
@@ -100,6 +107,8 @@ public:
     virtual void SetFileIndex(MXFFileIndex *file_index, bool take_ownership);
     virtual void SetMCALabelIndex(MXFMCALabelIndex *label_index, bool take_ownership);
     void SetEnableIndexFile(bool enable);  // Default true
+    void SetIndexCache(bool enable, const std::string &cache_dir = "");  // Default false. Empty dir: next to file
+    void SetReadQueue(uint32_t max_edit_units, uint64_t max_bytes = 0);  // Default 0 (disabled). 0: no limit
 
     OpenResult Open(std::string filename, int mode_flags=0);
     OpenResult Open(mxfpp::File *file, std::string filename, int mode_flags=0);
@@ -265,6 +274,10 @@ private:
     std::vector<MXFTextObject*> mInternalTextObjects;
 
     bool mEnableIndexFile;
+    bool mEnableIndexCache;
+    std::string mIndexCacheDir;
+    uint32_t mReadQueueMaxEditUnits;
+    uint64_t mReadQueueMaxBytes;
     EssenceReader *mEssenceReader;
 
     uint32_t mRequireFrameInfoCount;
@@ -61,6 +61,7 @@ public:
     virtual void CompleteRead();
     virtual void AbortRead();
     virtual Frame* CreateFrame();
+    virtual void DeleteFrame(Frame *frame);
     virtual void PushFrame(Frame *frame);
     virtual void PopFrame(bool del_frame);
     virtual Frame* GetLastFrame(bool pop);
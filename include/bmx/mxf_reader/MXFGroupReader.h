@@ -42,6 +42,8 @@ namespace bmx
 {
 
 
+class MXFGroupMemberReadWorker;
+
 class MXFGroupReader : public MXFReader
 {
 public:
@@ -54,6 +56,9 @@ public:
     void AddReader(MXFReader *reader);
     bool Finalize();
 
+    // read each member on its own worker thread
+    void SetParallelRead(bool enable);
+
 public:
     virtual MXFFileReader* GetFileReader(size_t file_id);
     virtual std::vector<size_t> GetFileIds(bool internal_ess_only) const;
@@ -104,6 +109,10 @@ private:
     void CompleteRead();
     void AbortRead();
 
+    uint32_t ReadMembers(uint32_t num_samples, int64_t current_position);
+    uint32_t ParallelReadMembers(uint32_t num_samples, int64_t current_position);
+    void StopReadWorkers();
+
 private:
     bool mEmptyFrames;
     bool mEmptyFramesSet;
@@ -118,6 +127,9 @@ private:
 
     std::vector<std::vector<uint32_t> > mSampleSequences;
     std::vector<int64_t> mSampleSequenceSizes;
+
+    bool mParallelRead;
+    std::vector<MXFGroupMemberReadWorker*> mReadWorkers;
 };
 
 
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef BMX_MXF_INDEX_CACHE_H_
+#define BMX_MXF_INDEX_CACHE_H_
+
+
+#include <string>
+
+#include <libMXF++/MXF.h>
+
+
+
+namespace bmx
+{
+
+
+class EssenceReader;
+
+
+class MXFIndexCache
+{
+public:
+    static std::string GetCacheFilename(const std::string &cache_dir, const std::string &filename);
+
+public:
+    MXFIndexCache(const std::string &cache_filename, const std::string &filename);
+    ~MXFIndexCache();
+
+    bool Read(mxfpp::File *mxf_file);
+    mxfpp::File* GetReadFile() const { return mCacheFile; }
+    void CloseRead();
+
+    bool Write(mxfpp::File *mxf_file, const EssenceReader *essence_reader);
+
+private:
+    void CalcFileKey(mxfpp::File *mxf_file);
+
+private:
+    std::string mCacheFilename;
+    std::string mFilename;
+    mxfpp::File *mCacheFile;
+
+    int64_t mFileSize;
+    int64_t mFileModTime;
+    unsigned char mFileDigest[16];
+};
+
+
+};
+
+
+
+#endif
@@ -39,6 +39,8 @@
 #include <libMXF++/MXF.h>
 
 #include <bmx/ByteArray.h>
+#include <bmx/MXFWriteBatch.h>
+#include <bmx/frame/DataBufferArray.h>
 #include <bmx/rdd9_mxf/RDD9IndexTable.h>
 
 
@@ -75,7 +77,8 @@ public:
 
     uint32_t GetElementSize(uint32_t data_size) const;
 
-    void Write(mxfpp::File *mxf_file, unsigned char *data, uint32_t size);
+    void AppendKL(MXFWriteBatch *write_batch, uint32_t data_size);
+    void AppendFill(MXFWriteBatch *write_batch, mxfpp::File *mxf_file, uint32_t data_size);
 
     uint32_t GetTrackIndex() const                         { return mTrackIndex; }
     ElementType GetElementType() const                     { return mElementType; }
@@ -107,22 +110,29 @@ public:
                                   RDD9ContentPackageElement *element, int64_t position);
 
     uint32_t WriteSamples(const unsigned char *data, uint32_t size, uint32_t num_samples);
+    void RetainData();
 
     RDD9ContentPackageElement::ElementType GetElementType() const { return mElement->GetElementType(); }
     bool IsComplete() const;
 
     uint32_t GetElementSize() const;
     uint32_t GetNumSamplesWritten() const { return mNumSamplesWritten; }
-    void Write();
+    void Write(MXFWriteBatch *write_batch);
 
     void Reset(int64_t new_position);
 
+private:
+    void AppendDataRef(const unsigned char *data, uint32_t size);
+    uint32_t GetDataSize() const { return mData.GetSize() + mDataRefsSize; }
+
 private:
     mxfpp::File *mMXFFile;
     RDD9IndexTable *mIndexTable;
     RDD9ContentPackageElement *mElement;
     int64_t mPosition;
     ByteArray mData;
+    std::vector<CDataBuffer> mDataRefs;
+    uint32_t mDataRefsSize;
     uint32_t mNumSamples;
     uint32_t mNumSamplesWritten;
 };
@@ -143,6 +153,7 @@ public:
 
     void WriteUserTimecode(Timecode user_timecode);
     uint32_t WriteSamples(uint32_t track_index, const unsigned char *data, uint32_t size, uint32_t num_samples);
+    void RetainSampleData();
 
     uint32_t GetSoundSampleCount() const;
 
@@ -165,6 +176,7 @@ private:
     bool mHaveUpdatedIndexTable;
     Timecode mUserTimecode;
     bool mUserTimecodeSet;
+    MXFWriteBatch mWriteBatch;
 };
 
 
@@ -189,6 +201,7 @@ public:
 public:
     void WriteUserTimecode(Timecode user_timecode);
     void WriteSamples(uint32_t track_index, const unsigned char *data, uint32_t size, uint32_t num_samples);
+    void RetainSampleData();
 
 public:
     int64_t GetPosition() const             { return mPosition; }
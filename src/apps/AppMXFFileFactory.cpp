@@ -48,14 +48,29 @@ using namespace bmx;
 using namespace mxfpp;
 
 
+#define DIRECT_IO_BUFFER_SIZE   (8 * 1024 * 1024)
+
+
 
 AppMXFFileFactory::AppMXFFileFactory()
 {
     mInputFlags = 0;
+#if !defined(_WIN32)
+    mReadAheadSize = 0;
+    mPrefetchSlots = 0;
+#endif
     mRWInterleaver = 0;
+    mAsyncWriteSize = 0;
+    mAsyncWriteBuffers = 0;
+#if !defined(_WIN32)
+    mDirectIO = false;
+#endif
     mHTTPMinReadSize = 1024 * 1024;
     mHTTPEnableSeek = true;
-#if defined(_WIN32) && !defined(__MINGW32__)
+    mHTTPCacheBlocks = 1;
+    mHTTPPrefetch = 0;
+    mHTTPLogStats = false;
+#if !defined(__MINGW32__)
     mUseMMapFile = false;
 #endif
 }
@@ -81,6 +96,20 @@ void AppMXFFileFactory::SetInputFlags(int flags)
     mInputFlags = flags;
 }
 
+#if !defined(_WIN32)
+void AppMXFFileFactory::SetReadAheadSize(uint32_t size)
+{
+    mReadAheadSize = size;
+}
+
+void AppMXFFileFactory::SetPrefetch(uint32_t num_slots)
+{
+    BMX_CHECK(num_slots <= MXF_PREFETCH_MAX_SLOTS);
+
+    mPrefetchSlots = num_slots;
+}
+#endif
+
 void AppMXFFileFactory::SetRWInterleave(uint32_t rw_interleave_size)
 {
     if (mRWInterleaver)
@@ -94,6 +123,21 @@ void AppMXFFileFactory::SetRWInterleave(uint32_t rw_interleave_size)
     BMX_CHECK(mxf_create_rw_intl(rw_interleave_size, cache_size, &mRWInterleaver));
 }
 
+void AppMXFFileFactory::SetAsyncWrite(uint32_t buffer_size, uint32_t num_buffers)
+{
+    BMX_CHECK(num_buffers == 0 || (buffer_size > 0 && num_buffers >= MXF_ASYNC_WRITE_MIN_BUFFERS));
+
+    mAsyncWriteSize = buffer_size;
+    mAsyncWriteBuffers = num_buffers;
+}
+
+#if !defined(_WIN32)
+void AppMXFFileFactory::SetDirectIO(bool enable)
+{
+    mDirectIO = enable;
+}
+#endif
+
 void AppMXFFileFactory::SetHTTPMinReadSize(uint32_t size)
 {
     mHTTPMinReadSize = size;
@@ -104,7 +148,22 @@ void AppMXFFileFactory::SetHTTPEnableSeek(bool enable)
     mHTTPEnableSeek = enable;
 }
 
-#if defined(_WIN32) && !defined(__MINGW32__)
+void AppMXFFileFactory::SetHTTPCacheBlocks(uint32_t num_blocks)
+{
+    mHTTPCacheBlocks = num_blocks;
+}
+
+void AppMXFFileFactory::SetHTTPPrefetch(uint32_t num_blocks)
+{
+    mHTTPPrefetch = num_blocks;
+}
+
+void AppMXFFileFactory::SetHTTPLogStats(bool enable)
+{
+    mHTTPLogStats = enable;
+}
+
+#if !defined(__MINGW32__)
 void AppMXFFileFactory::SetUseMMapFile(bool enable)
 {
     mUseMMapFile = enable;
@@ -128,9 +187,18 @@ File* AppMXFFileFactory::OpenNew(string filename)
 #endif
             BMX_CHECK(mxf_win32_file_open_new(filename.c_str(), 0, &mxf_file));
 #else
-        BMX_CHECK(mxf_disk_file_open_new(filename.c_str(), &mxf_file));
+        if (mDirectIO)
+            BMX_CHECK(mxf_direct_file_open_new(filename.c_str(), DIRECT_IO_BUFFER_SIZE, &mxf_file));
+        else
+            BMX_CHECK(mxf_disk_file_open_new(filename.c_str(), &mxf_file));
 #endif
 
+        if (mAsyncWriteBuffers > 0) {
+            MXFFile *async_mxf_file;
+            BMX_CHECK(mxf_async_write_file_open(mxf_file, mAsyncWriteSize, mAsyncWriteBuffers, &async_mxf_file));
+            mxf_file = async_mxf_file;
+        }
+
         if (mRWInterleaver) {
             MXFFile *intl_mxf_file;
             BMX_CHECK(mxf_rw_intl_open(mRWInterleaver, mxf_file, 1, &intl_mxf_file));
@@ -148,6 +216,8 @@ File* AppMXFFileFactory::OpenNew(string filename)
 
 File* AppMXFFileFactory::OpenRead(string filename)
 {
+    lock_guard<mutex> lock(mOpenReadMutex);
+
     MXFFile *mxf_file = 0;
 
     try
@@ -158,19 +228,11 @@ File* AppMXFFileFactory::OpenRead(string filename)
             uri_str = "stdin:";
         } else {
             if (mxf_http_is_url(filename)) {
-                mxf_file = mxf_http_file_open_read(filename, mHTTPMinReadSize, mHTTPEnableSeek);
+                mxf_file = mxf_http_file_open_read(filename, mHTTPMinReadSize, mHTTPEnableSeek,
+                                                   mHTTPCacheBlocks, mHTTPPrefetch, mHTTPLogStats);
                 uri_str = filename;
             } else {
-#if defined(_WIN32)
-#if !defined(__MINGW32__)
-                if (mUseMMapFile)
-                    BMX_CHECK(mxf_win32_mmap_open_read(filename.c_str(), mInputFlags, &mxf_file));
-                else
-#endif
-                    BMX_CHECK(mxf_win32_file_open_read(filename.c_str(), mInputFlags, &mxf_file));
-#else
-                BMX_CHECK(mxf_disk_file_open_read(filename.c_str(), &mxf_file));
-#endif
+                mxf_file = OpenReadFile(filename);
             }
         }
 
@@ -251,6 +313,20 @@ File* AppMXFFileFactory::OpenModify(string filename)
     }
 }
 
+File* AppMXFFileFactory::OpenReadAdditional(string filename)
+{
+    // the handle is read independently of the one returned by OpenRead and so it is not included in the input
+    // checksums or read/write interleaving
+    BMX_CHECK(!filename.empty());
+
+    if (mxf_http_is_url(filename)) {
+        return new File(mxf_http_file_open_read(filename, mHTTPMinReadSize, mHTTPEnableSeek,
+                                                mHTTPCacheBlocks, mHTTPPrefetch, mHTTPLogStats));
+    } else {
+        return new File(OpenReadFile(filename));
+    }
+}
+
 void AppMXFFileFactory::ForceInputChecksumUpdate()
 {
     size_t i;
@@ -306,6 +382,29 @@ string AppMXFFileFactory::GetInputChecksumDigestString(size_t file_index, Checks
     return mxf_checksum_file_digest_str(GetChecksumFile(file_index, type));
 }
 
+MXFFile* AppMXFFileFactory::OpenReadFile(const string &filename)
+{
+    MXFFile *mxf_file = 0;
+
+#if defined(_WIN32)
+#if !defined(__MINGW32__)
+    if (mUseMMapFile)
+        BMX_CHECK(mxf_win32_mmap_open_read(filename.c_str(), mInputFlags, &mxf_file));
+    else
+#endif
+        BMX_CHECK(mxf_win32_file_open_read(filename.c_str(), mInputFlags, &mxf_file));
+#else
+    if (mUseMMapFile)
+        BMX_CHECK(mxf_posix_mmap_open_read(filename.c_str(), mInputFlags, &mxf_file));
+    else if (mPrefetchSlots > 0)
+        BMX_CHECK(mxf_prefetch_file_open_read(filename.c_str(), mPrefetchSlots, MXF_PREFETCH_FLAG_DEFAULT, &mxf_file));
+    else
+        BMX_CHECK(mxf_disk_file_open_read_2(filename.c_str(), mInputFlags, mReadAheadSize, &mxf_file));
+#endif
+
+    return mxf_file;
+}
+
 MXFChecksumFile* AppMXFFileFactory::GetChecksumFile(size_t file_index, ChecksumType type) const
 {
     BMX_ASSERT(file_index < mInputChecksumFiles.size());
@@ -417,6 +417,11 @@ void AS02Track::CompleteWrite()
     mMXFFile->updateBodyPartitions(&MXF_PP_K(ClosedComplete, Body));
 
 
+    // flush buffered writes
+
+    mMXFFile->flush();
+
+
     // done with the file
     delete mMXFFile;
     mMXFFile = 0;
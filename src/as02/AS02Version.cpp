@@ -186,6 +186,11 @@ void AS02Version::CompleteWrite()
     mMXFFile->closeMemoryFile();
 
 
+    // flush buffered writes
+
+    mMXFFile->flush();
+
+
     // done with the file
     delete mMXFFile;
     mMXFFile = 0;
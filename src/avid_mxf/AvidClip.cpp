@@ -99,6 +99,7 @@ AvidClip::AvidClip(int flavour, mxfRational frame_rate, MXFFileFactory *file_fac
     mMaterialPackageCreationDateSet = false;
     mDataModel = 0;
     mHeaderMetadata = 0;
+    mDictionaryCache = 0;
     mHavePreparedHeaderMetadata = false;
     mContentStorage = 0;
     mMaterialPackage = 0;
@@ -123,6 +124,8 @@ AvidClip::~AvidClip()
     size_t i;
     for (i = 0; i < mTracks.size(); i++)
         delete mTracks[i];
+
+    mxf_avid_free_dictionary_cache(&mDictionaryCache);
 }
 
 void AvidClip::SetProjectName(string name)
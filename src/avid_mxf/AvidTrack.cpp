@@ -477,6 +477,11 @@ void AvidTrack::CompleteWrite()
     mMXFFile->updateBodyPartitions(&MXF_PP_K(ClosedComplete, Body));
 
 
+    // flush buffered writes
+
+    mMXFFile->flush();
+
+
     // done with the file
     delete mMXFFile;
     mMXFFile = 0;
@@ -575,6 +580,10 @@ void AvidTrack::CreateHeaderMetadata()
 
 
     // Meta-dictionary
+    // the meta-dictionary and dictionary sets are the same in each track file and are cached by the clip
+    if (!mClip->mDictionaryCache)
+        BMX_CHECK(mxf_avid_create_dictionary_cache(&mClip->mDictionaryCache));
+    mHeaderMetadata->setDictionaryCache(mClip->mDictionaryCache);
     mHeaderMetadata->createDefaultMetaDictionary();
 
     // Preface
@@ -59,10 +59,19 @@ LogLevel bmx::LOG_LEVEL = INFO_LOG;
 
 static FILE *LOG_FILE = 0;
 
+static thread_local vector<LogRecord> *THREAD_LOG_RECORDS = 0;
+
 
 
 static void log_message(FILE *file, LogLevel level, const char *source, const char *format, va_list p_arg)
 {
+    // keep the parts of the message together when logging from multiple threads
+#if defined(_WIN32)
+    _lock_file(file);
+#else
+    flockfile(file);
+#endif
+
     switch (level)
     {
         case DEBUG_LOG:
@@ -85,6 +94,12 @@ static void log_message(FILE *file, LogLevel level, const char *source, const ch
         fprintf(file, ": ");
 
     vfprintf(file, format, p_arg);
+
+#if defined(_WIN32)
+    _unlock_file(file);
+#else
+    funlockfile(file);
+#endif
 }
 
 static void stdio_vlog2(LogLevel level, const char *source, const char *format, va_list p_arg)
@@ -149,6 +164,33 @@ static void file_log(LogLevel level, const char* format, ...)
 
 
 
+static void level_vlog(LogLevel level, const char *format, va_list p_arg)
+{
+    if (THREAD_LOG_RECORDS) {
+        if (level >= LOG_LEVEL) {
+            char buffer[1024];
+            bmx_vsnprintf(buffer, sizeof(buffer), format, p_arg);
+            LogRecord record;
+            record.level = level;
+            record.message = buffer;
+            THREAD_LOG_RECORDS->push_back(record);
+        }
+    } else {
+        vlog2(level, 0, format, p_arg);
+    }
+}
+
+static void level_log(LogLevel level, const char *format, ...)
+{
+    va_list p_arg;
+
+    va_start(p_arg, format);
+    vlog2(level, 0, format, p_arg);
+    va_end(p_arg);
+}
+
+
+
 bool bmx::open_log_file(string filename)
 {
     close_log_file();
@@ -218,7 +260,7 @@ void bmx::log_debug(const char *format, ...)
     va_list p_arg;
 
     va_start(p_arg, format);
-    vlog2(DEBUG_LOG, 0, format, p_arg);
+    level_vlog(DEBUG_LOG, format, p_arg);
     va_end(p_arg);
 }
 
@@ -227,7 +269,7 @@ void bmx::log_info(const char *format, ...)
     va_list p_arg;
 
     va_start(p_arg, format);
-    vlog2(INFO_LOG, 0, format, p_arg);
+    level_vlog(INFO_LOG, format, p_arg);
     va_end(p_arg);
 }
 
@@ -236,7 +278,7 @@ void bmx::log_warn(const char *format, ...)
     va_list p_arg;
 
     va_start(p_arg, format);
-    vlog2(WARN_LOG, 0, format, p_arg);
+    level_vlog(WARN_LOG, format, p_arg);
     va_end(p_arg);
 }
 
@@ -245,7 +287,7 @@ void bmx::log_error(const char *format, ...)
     va_list p_arg;
 
     va_start(p_arg, format);
-    vlog2(ERROR_LOG, 0, format, p_arg);
+    level_vlog(ERROR_LOG, format, p_arg);
     va_end(p_arg);
 }
 
@@ -254,12 +296,26 @@ void bmx::log_error_nl(const char *format, ...)
     va_list p_arg;
 
     va_start(p_arg, format);
-    vlog2(ERROR_LOG, 0, format, p_arg);
+    level_vlog(ERROR_LOG, format, p_arg);
     va_end(p_arg);
 
     // add newline
-    if (LOG_FILE)
+    if (THREAD_LOG_RECORDS)
+        THREAD_LOG_RECORDS->back().message += "\n";
+    else if (LOG_FILE)
         fprintf(LOG_FILE, "\n");
     else
         fprintf(stderr, "\n");
 }
+
+void bmx::set_thread_log_records(vector<LogRecord> *records)
+{
+    THREAD_LOG_RECORDS = records;
+}
+
+void bmx::log_records(const vector<LogRecord> &records)
+{
+    size_t i;
+    for (i = 0; i < records.size(); i++)
+        level_log(records[i].level, "%s", records[i].message.c_str());
+}
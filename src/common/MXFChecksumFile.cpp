@@ -291,6 +291,16 @@ static int64_t checksum_file_size(MXFFileSysData *sys_data)
 }
 
 
+static int checksum_file_prefetch(MXFFileSysData *sys_data, int64_t offset, uint32_t size)
+{
+    return mxf_file_prefetch(sys_data->target, offset, size);
+}
+
+static int checksum_file_flush(MXFFileSysData *sys_data)
+{
+    return mxf_file_flush(sys_data->target);
+}
+
 static void free_checksum_file(MXFFileSysData *sys_data)
 {
     if (sys_data) {
@@ -330,6 +340,9 @@ MXFChecksumFile* bmx::mxf_checksum_file_open(MXFFile *target, ChecksumType type)
         checksum_file->tell          = checksum_file_tell;
         checksum_file->is_seekable   = checksum_file_is_seekable;
         checksum_file->size          = checksum_file_size;
+        if (mxf_file_supports_prefetch(target))
+            checksum_file->prefetch  = checksum_file_prefetch;
+        checksum_file->flush         = checksum_file_flush;
         checksum_file->free_sys_data = free_checksum_file;
 
         checksum_file->minLLen       = target->minLLen;
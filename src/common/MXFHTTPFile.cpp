@@ -41,6 +41,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#include <vector>
+#include <chrono>
+
 #include <curl/curl.h>
 
 #include <mxf/mxf.h>
@@ -55,6 +58,45 @@ using namespace std;
 using namespace bmx;
 
 
+#define MIN_BLOCK_SIZE      4096
+
+
+typedef chrono::steady_clock HTTPClock;
+
+typedef enum
+{
+    BLOCK_EMPTY = 0,
+    BLOCK_PENDING,
+    BLOCK_READY,
+    BLOCK_FAILED,
+} BlockState;
+
+typedef struct
+{
+    int64_t index;          // file offset / block size
+    BlockState state;
+    unsigned char *data;
+    uint32_t size;          // less than the block size if the block contains the end of the file
+    uint64_t last_used;
+    bool prefetched;
+} CacheBlock;
+
+typedef struct
+{
+    MXFFileSysData *sys_data;
+    CURL *curl;
+    vector<CacheBlock*> blocks;
+    int64_t range_first;
+    int64_t range_last;
+    int64_t receive_count;
+    int64_t content_total;  // file size in the Content-Range header, or -1 if not known
+    bool prefetch;
+    bool accept_range_recv;
+    bool accept_bytes_range;
+    HTTPClock::time_point start_time;
+    char error_buf[CURL_ERROR_SIZE];
+} RangeRequest;
+
 typedef struct
 {
     MXFFile *mxf_file;
@@ -65,27 +107,23 @@ struct MXFFileSysData
     MXFHTTPFile http_file;
     string url_str;
     CURL *curl;
+    CURLM *multi;
     int64_t position;
     int eof;
-    unsigned char *buffer;
-    uint32_t buffer_pos;
-    uint32_t buffer_size;
-    uint32_t buffer_alloc_size;
+    uint32_t block_size;
+    vector<CacheBlock> blocks;
+    uint64_t use_count;
+    uint32_t prefetch_blocks;
+    int64_t last_block_index;
+    int64_t known_end;
+    vector<RangeRequest*> requests;
+    vector<CURL*> idle_curls;
+    CURLcode last_error;
     bool disable_response_code_warn;
+    bool log_stats;
+    MXFHTTPFileStats stats;
 };
 
-typedef struct
-{
-    MXFFileSysData *sys_data;
-    int64_t range_first;
-    int64_t range_last;
-    uint8_t *client_data;
-    uint32_t client_rem_count;
-    uint32_t read_count;
-    bool accept_range_recv;
-    bool accept_bytes_range;
-} CURLReceiveInfo;
-
 
 static size_t get_http_field_value_pos(const string &header_str, const string &field_name)
 {
@@ -116,26 +154,30 @@ static size_t curl_file_size_header_cb(char *buffer, size_t size, size_t nmemb,
 
 static size_t curl_header_cb(char *buffer, size_t size, size_t nmemb, void *priv)
 {
-  CURLReceiveInfo *info = (CURLReceiveInfo*)priv;
+  RangeRequest *request = (RangeRequest*)priv;
 
   string header_str = lowercase(string(buffer, size * nmemb));
 
   size_t fidx = get_http_field_value_pos(header_str, "accept-ranges");
   if (fidx != string::npos) {
-      info->accept_range_recv = true;
+      request->accept_range_recv = true;
       if (header_str.compare(fidx, 5, "bytes"))
-          info->accept_bytes_range = true;
+          request->accept_bytes_range = true;
   }
 
   fidx = get_http_field_value_pos(header_str, "content-range");
   if (fidx != string::npos) {
-      int64_t first;
-      if (sscanf(&header_str.c_str()[fidx], "%" PRId64, &first) == 1) {
-          if (first != info->range_first) {
+      int64_t first, last, total;
+      int num_values = sscanf(&header_str.c_str()[fidx], "bytes %" PRId64 "-%" PRId64 "/%" PRId64,
+                              &first, &last, &total);
+      if (num_values >= 1) {
+          if (first != request->range_first) {
               log_warn("HTTP content range start byte at %" PRId64 " does not match requested start byte at %" PRId64 "\n",
-                       first, info->range_first);
+                       first, request->range_first);
           }
       }
+      if (num_values == 3 && total >= 0)
+          request->content_total = total;
   }
 
   return size * nmemb;
@@ -153,164 +195,452 @@ static size_t curl_abort_write_cb(void* ptr, size_t size, size_t nmemb, void *pr
 
 static size_t curl_data_cb(void* ptr, size_t size, size_t nmemb, void *priv)
 {
-  CURLReceiveInfo *info = (CURLReceiveInfo*)priv;
+  RangeRequest *request = (RangeRequest*)priv;
+  uint32_t block_size = request->sys_data->block_size;
 
+  // Copy the received data into the blocks covered by the range. Returning less than the received
+  // count results in a CURLE_WRITE_ERROR if the server returns more data than requested
   size_t rec_count = size * nmemb;
-
-  uint32_t client_copy_count = 0;
-  if (info->client_rem_count > 0) {
-      client_copy_count = info->client_rem_count;
-      if (client_copy_count > rec_count)
-          client_copy_count = (uint32_t)(rec_count);
-      memcpy(&info->client_data[info->read_count], ptr, client_copy_count);
-      info->client_rem_count   -= client_copy_count;
-      info->sys_data->position += client_copy_count;
-      info->read_count         += client_copy_count;
+  size_t copy_count = 0;
+  while (copy_count < rec_count && request->range_first + request->receive_count <= request->range_last) {
+      CacheBlock *block = request->blocks[(size_t)(request->receive_count / block_size)];
+      uint32_t block_copy_count = block_size - block->size;
+      if (block_copy_count > rec_count - copy_count)
+          block_copy_count = (uint32_t)(rec_count - copy_count);
+      memcpy(&block->data[block->size], &((unsigned char*)ptr)[copy_count], block_copy_count);
+      block->size             += block_copy_count;
+      copy_count              += block_copy_count;
+      request->receive_count  += block_copy_count;
   }
 
-  uint32_t buf_copy_count = 0;
-  if (client_copy_count < rec_count) {
-      buf_copy_count = info->sys_data->buffer_alloc_size - info->sys_data->buffer_size;
-      if (buf_copy_count > rec_count - client_copy_count)
-          buf_copy_count = (uint32_t)(rec_count - client_copy_count);
-      memcpy(&info->sys_data->buffer[info->sys_data->buffer_size], &((unsigned char*)ptr)[client_copy_count], buf_copy_count);
-      info->sys_data->buffer_size += buf_copy_count;
-      info->read_count            += buf_copy_count;
-  }
+  return copy_count;
+}
 
-  return (size_t)client_copy_count + (size_t)buf_copy_count;
+
+static double elapsed_seconds(HTTPClock::time_point start_time)
+{
+    return chrono::duration<double>(HTTPClock::now() - start_time).count();
 }
 
+static CacheBlock* find_block(MXFFileSysData *sys_data, int64_t index)
+{
+    size_t i;
+    for (i = 0; i < sys_data->blocks.size(); i++) {
+        if (sys_data->blocks[i].state != BLOCK_EMPTY && sys_data->blocks[i].index == index)
+            return &sys_data->blocks[i];
+    }
 
-static void http_file_close(MXFFileSysData *sys_data)
+    return 0;
+}
+
+static CacheBlock* get_free_block(MXFFileSysData *sys_data, int64_t keep_first, int64_t keep_last)
 {
-    if (sys_data->curl)
-        curl_easy_cleanup(sys_data->curl);
-    delete [] sys_data->buffer;
+    // Select the least recently used block that is not pending and not in the keep range
+    CacheBlock *free_block = 0;
+    size_t i;
+    for (i = 0; i < sys_data->blocks.size(); i++) {
+        CacheBlock *block = &sys_data->blocks[i];
+        if (block->state == BLOCK_EMPTY)
+            return block;
+        if (block->state == BLOCK_PENDING || (block->index >= keep_first && block->index <= keep_last))
+            continue;
+        if (!free_block || block->last_used < free_block->last_used)
+            free_block = block;
+    }
+
+    return free_block;
+}
+
+static void complete_request(MXFFileSysData *sys_data, RangeRequest *request, CURLcode result)
+{
+    bool success = (result == CURLE_OK);
+    bool complete_response = false;
+
+    if (result != CURLE_OK) {
+        LogLevel log_level = (request->prefetch ? DEBUG_LOG : ERROR_LOG);
+        if (result == CURLE_WRITE_ERROR) {
+            if (!request->accept_range_recv || !request->accept_bytes_range) {
+                // The data at the start of the file is usable if the server returned the whole file
+                success = (request->range_first == 0);
+                bmx::log((request->range_first == 0 ? WARN_LOG : log_level),
+                         "HTTP server does not support byte range requests\n");
+            } else {
+                bmx::log(log_level, "HTTP server returned more data than requested\n");
+            }
+        } else if (result == CURLE_PARTIAL_FILE) {
+            // The response was cut short, e.g. because the connection was dropped. The incomplete blocks
+            // are fetched again when they are read
+            bmx::log(DEBUG_LOG, "HTTP request failed: %s (curl result %d)\n", request->error_buf, result);
+        } else {
+            bmx::log(log_level, "HTTP request failed: %s (curl result %d)\n", request->error_buf, result);
+        }
+    } else {
+        long code;
+        curl_easy_getinfo(request->curl, CURLINFO_RESPONSE_CODE, &code);
+        // The whole file returned by a server that ignores the range is complete for a range at the start
+        complete_response = (code == 206 || request->range_first == 0);
+        if (code != 206) { // 206 = partial content
+            if (!sys_data->disable_response_code_warn) {
+                if (request->accept_range_recv && !request->accept_bytes_range)
+                    log_warn("HTTP server does not support byte range requests\n");
+                else if (!request->accept_range_recv)
+                    log_warn("HTTP server does not indicate support for byte range requests\n");
+                else
+                    log_warn("Unexpected HTTP response code %ld\n", code);
+                sys_data->disable_response_code_warn = true;
+            }
+        } else {
+            sys_data->disable_response_code_warn = false;
+        }
+    }
+
+    // The file size in the Content-Range header is the end of the file. Otherwise a short block in a
+    // complete response contains the end of the file
+    if (request->content_total >= 0 && (result == CURLE_OK || result == CURLE_PARTIAL_FILE))
+        sys_data->known_end = request->content_total;
+
+    size_t i;
+    for (i = 0; i < request->blocks.size(); i++) {
+        CacheBlock *block = request->blocks[i];
+        if (success) {
+            block->state = BLOCK_READY;
+            if (block->size < sys_data->block_size && complete_response && request->content_total < 0) {
+                int64_t end = block->index * sys_data->block_size + block->size;
+                if (sys_data->known_end < 0 || end < sys_data->known_end)
+                    sys_data->known_end = end;
+            }
+        } else if (result == CURLE_PARTIAL_FILE && block->size == sys_data->block_size) {
+            // The blocks received in full before the transfer was cut short are usable
+            block->state = BLOCK_READY;
+        } else {
+            block->state = BLOCK_FAILED;
+        }
+    }
+    if (!success)
+        sys_data->last_error = result;
+
+    double request_time = elapsed_seconds(request->start_time);
+    sys_data->stats.request_time   += request_time;
+    sys_data->stats.bytes_received += request->receive_count;
+    if (request_time > sys_data->stats.max_request_time)
+        sys_data->stats.max_request_time = request_time;
+
+    sys_data->idle_curls.push_back(request->curl);
+    for (i = 0; i < sys_data->requests.size(); i++) {
+        if (sys_data->requests[i] == request) {
+            sys_data->requests.erase(sys_data->requests.begin() + i);
+            break;
+        }
+    }
+    delete request;
+}
+
+static void progress_requests(MXFFileSysData *sys_data)
+{
+    if (sys_data->requests.empty())
+        return;
+
+    int running_handles;
+    curl_multi_perform(sys_data->multi, &running_handles);
+
+    CURLMsg *msg;
+    int msgs_in_queue;
+    while ((msg = curl_multi_info_read(sys_data->multi, &msgs_in_queue))) {
+        if (msg->msg != CURLMSG_DONE)
+            continue;
+
+        RangeRequest *request = 0;
+        curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char**)&request);
+        CURLcode result = msg->data.result;
+        curl_multi_remove_handle(sys_data->multi, msg->easy_handle);
+        complete_request(sys_data, request, result);
+    }
 }
 
-static uint32_t _http_file_read(MXFFileSysData *sys_data, uint8_t *data, uint32_t count,
-                                bool close_connections, CURLcode *error_code)
+static void wait_requests(MXFFileSysData *sys_data)
 {
-    uint8_t *data_ptr  = data;
-    uint32_t rem_count = count;
+    progress_requests(sys_data);
+    if (!sys_data->requests.empty()) {
+        int numfds;
+        curl_multi_wait(sys_data->multi, 0, 0, 100, &numfds);
+        progress_requests(sys_data);
+    }
+}
 
-    *error_code = CURLE_OK;
+static void wait_block(MXFFileSysData *sys_data, CacheBlock *block)
+{
+    if (block->state != BLOCK_PENDING)
+        return;
 
-    sys_data->eof = 0;
+    HTTPClock::time_point start_time = HTTPClock::now();
+    while (block->state == BLOCK_PENDING)
+        wait_requests(sys_data);
+    sys_data->stats.wait_time += elapsed_seconds(start_time);
+}
 
-    uint32_t buffer_copy_size = 0;
-    if (sys_data->buffer_pos < sys_data->buffer_size) {
-        buffer_copy_size = sys_data->buffer_size - sys_data->buffer_pos;
-        if (buffer_copy_size > rem_count)
-            buffer_copy_size = rem_count;
-        if (buffer_copy_size > 0) {
-            memcpy(data_ptr, &sys_data->buffer[sys_data->buffer_pos], buffer_copy_size);
-            sys_data->buffer_pos += buffer_copy_size;
-            sys_data->position   += buffer_copy_size;
-            data_ptr             += buffer_copy_size;
-            rem_count            -= buffer_copy_size;
+static bool start_request(MXFFileSysData *sys_data, CacheBlock **blocks, size_t num_blocks, bool prefetch,
+                          bool close_connections)
+{
+    RangeRequest *request = new RangeRequest;
+    request->sys_data           = sys_data;
+    request->curl               = 0;
+    request->blocks.assign(blocks, blocks + num_blocks);
+    request->range_first        = blocks[0]->index * sys_data->block_size;
+    request->range_last         = request->range_first + (int64_t)num_blocks * sys_data->block_size - 1;
+    request->receive_count      = 0;
+    request->content_total      = -1;
+    request->prefetch           = prefetch;
+    request->accept_range_recv  = false;
+    request->accept_bytes_range = false;
+    request->start_time         = HTTPClock::now();
+    request->error_buf[0]       = 0;
+
+    if (!sys_data->idle_curls.empty()) {
+        request->curl = sys_data->idle_curls.back();
+        sys_data->idle_curls.pop_back();
+    } else {
+        request->curl = curl_easy_init();
+        if (!request->curl) {
+            log_error("Failed to initialise curl handle for HTTP request\n");
+            delete request;
+            return false;
         }
     }
 
-    if (rem_count > 0) {
-        char error_buf[CURL_ERROR_SIZE];
+    char range_buf[64];
+    bmx_snprintf(range_buf, sizeof(range_buf), "%" PRId64 "-%" PRId64,
+                 request->range_first, request->range_last);
+
+    curl_easy_reset(request->curl);
+    curl_easy_setopt(request->curl, CURLOPT_ERRORBUFFER, request->error_buf);
+    curl_easy_setopt(request->curl, CURLOPT_NOPROGRESS, 1);
+    curl_easy_setopt(request->curl, CURLOPT_URL, sys_data->url_str.c_str());
+    curl_easy_setopt(request->curl, CURLOPT_RANGE, range_buf);
+    curl_easy_setopt(request->curl, CURLOPT_WRITEFUNCTION, curl_data_cb);
+    curl_easy_setopt(request->curl, CURLOPT_WRITEDATA, (void*)request);
+    curl_easy_setopt(request->curl, CURLOPT_HEADERFUNCTION, curl_header_cb);
+    curl_easy_setopt(request->curl, CURLOPT_HEADERDATA, (void*)request);
+    curl_easy_setopt(request->curl, CURLOPT_FAILONERROR, 1);
+    curl_easy_setopt(request->curl, CURLOPT_PRIVATE, (void*)request);
+
+    if (close_connections) {
+        // This closes the connections and opens a new connection
+        curl_easy_setopt(request->curl, CURLOPT_FRESH_CONNECT, 1L);
+    }
 
-        sys_data->buffer_pos  = 0;
-        sys_data->buffer_size = 0;
+    CURLMcode result = curl_multi_add_handle(sys_data->multi, request->curl);
+    if (result != CURLM_OK) {
+        log_error("Failed to add HTTP request: %s\n", curl_multi_strerror(result));
+        sys_data->idle_curls.push_back(request->curl);
+        delete request;
+        return false;
+    }
 
-        CURLReceiveInfo info;
-        memset(&info, 0, sizeof(info));
-        info.sys_data         = sys_data;
-        info.client_data      = data_ptr;
-        info.client_rem_count = rem_count;
-        info.range_first      = sys_data->position;
-        info.range_last       = sys_data->position;
-        if (rem_count > sys_data->buffer_alloc_size)
-            info.range_last += rem_count - 1;
-        else
-            info.range_last += sys_data->buffer_alloc_size - 1;
+    size_t i;
+    for (i = 0; i < num_blocks; i++) {
+        blocks[i]->state      = BLOCK_PENDING;
+        blocks[i]->size       = 0;
+        blocks[i]->last_used  = sys_data->use_count;
+        blocks[i]->prefetched = prefetch;
+    }
+    sys_data->requests.push_back(request);
 
-        char range_buf[64];
-        bmx_snprintf(range_buf, sizeof(range_buf), "%" PRId64 "-%" PRId64,
-                     info.range_first, info.range_last);
+    sys_data->stats.num_requests++;
+    if (prefetch)
+        sys_data->stats.num_prefetch_requests++;
 
-        curl_easy_reset(sys_data->curl);
-        curl_easy_setopt(sys_data->curl, CURLOPT_ERRORBUFFER, error_buf);
-        curl_easy_setopt(sys_data->curl, CURLOPT_NOPROGRESS, 1);
-        curl_easy_setopt(sys_data->curl, CURLOPT_URL, sys_data->url_str.c_str());
-        curl_easy_setopt(sys_data->curl, CURLOPT_RANGE, range_buf);
-        curl_easy_setopt(sys_data->curl, CURLOPT_WRITEFUNCTION, curl_data_cb);
-        curl_easy_setopt(sys_data->curl, CURLOPT_WRITEDATA, (void*)&info);
-        curl_easy_setopt(sys_data->curl, CURLOPT_HEADERFUNCTION, curl_header_cb);
-        curl_easy_setopt(sys_data->curl, CURLOPT_HEADERDATA, (void*)&info);
-        curl_easy_setopt(sys_data->curl, CURLOPT_FAILONERROR, 1);
+    return true;
+}
 
-        if (close_connections) {
-            // This closes the connections and opens a new connection
-            curl_easy_setopt(sys_data->curl, CURLOPT_MAXCONNECTS, 1L);
-            curl_easy_setopt(sys_data->curl, CURLOPT_FRESH_CONNECT, 1L);
+static CacheBlock* fetch_blocks(MXFFileSysData *sys_data, int64_t index, uint32_t count, bool close_connections)
+{
+    // Fetch the run of blocks starting at index that are not in the cache and are needed to read count bytes
+    // using a single range request
+    CacheBlock *block = 0;
+    while (!(block = get_free_block(sys_data, index, index)))
+        wait_requests(sys_data);
+
+    vector<CacheBlock*> blocks;
+    block->index = index;
+    block->state = BLOCK_FAILED;
+    blocks.push_back(block);
+
+    int64_t offset = sys_data->position - index * sys_data->block_size;
+    while (offset + count > (int64_t)blocks.size() * sys_data->block_size) {
+        int64_t next_index = index + (int64_t)blocks.size();
+        if (find_block(sys_data, next_index) ||
+            (sys_data->known_end >= 0 && next_index * sys_data->block_size >= sys_data->known_end))
+        {
+            break;
         }
+        CacheBlock *next_block = get_free_block(sys_data, index, next_index);
+        if (!next_block)
+            break;
+        next_block->index = next_index;
+        next_block->state = BLOCK_FAILED;
+        blocks.push_back(next_block);
+    }
 
-        CURLcode result = curl_easy_perform(sys_data->curl);
-        rem_count = info.client_rem_count;
-
-        if (result != 0) {
-            if (result != CURLE_PARTIAL_FILE) {
-                if (result == CURLE_WRITE_ERROR) {
-                    if (!info.accept_range_recv || !info.accept_bytes_range) {
-                        if (info.range_first != 0)
-                            rem_count = count;
-                        bmx::log((info.range_first == 0 ? WARN_LOG: ERROR_LOG),
-                                 "HTTP server does not support byte range requests\n");
-                    } else {
-                        log_error("HTTP server returned more data than requested\n");
-                    }
-                } else {
-                    log_error("HTTP request failed: %s (curl result %d)\n", error_buf, result);
-                }
-            }
-        } else {
-            long code;
-            curl_easy_getinfo(sys_data->curl, CURLINFO_RESPONSE_CODE, &code);
-            if (code != 206) { // 206 = partial content
-                if (!sys_data->disable_response_code_warn) {
-                    if (info.accept_range_recv && !info.accept_bytes_range)
-                        log_warn("HTTP server does not support byte range requests\n");
-                    else if (!info.accept_range_recv)
-                        log_warn("HTTP server does not indicate support for byte range requests\n");
-                    else
-                        log_warn("Unexpected HTTP response code %ld\n", code);
-                    sys_data->disable_response_code_warn = true;
-                }
-            } else {
-                sys_data->disable_response_code_warn = false;
-            }
+    if (!start_request(sys_data, &blocks[0], blocks.size(), false, close_connections)) {
+        size_t i;
+        for (i = 0; i < blocks.size(); i++)
+            blocks[i]->state = BLOCK_EMPTY;
+        return 0;
+    }
+
+    return block;
+}
+
+static void prefetch_blocks(MXFFileSysData *sys_data, int64_t index)
+{
+    // Start a request for each of the blocks following the read position that is not yet in the cache
+    int64_t last_index = index + sys_data->prefetch_blocks;
+    int64_t prefetch_index;
+    for (prefetch_index = index + 1; prefetch_index <= last_index; prefetch_index++) {
+        if (sys_data->known_end >= 0 && prefetch_index * sys_data->block_size >= sys_data->known_end)
+            break;
+        if (find_block(sys_data, prefetch_index))
+            continue;
+
+        CacheBlock *block = get_free_block(sys_data, index, last_index);
+        if (!block)
+            break;
+        block->index = prefetch_index;
+        if (!start_request(sys_data, &block, 1, true, false)) {
+            block->state = BLOCK_EMPTY;
+            break;
         }
+    }
 
-        *error_code = result;
+    progress_requests(sys_data);
+}
+
+
+static void http_file_close(MXFFileSysData *sys_data)
+{
+    if (sys_data->log_stats) {
+        const MXFHTTPFileStats &stats = sys_data->stats;
+        log_info("HTTP file stats: hits=%" PRId64 ", misses=%" PRId64 ", prefetch hits=%" PRId64 ", "
+                 "requests=%" PRId64 ", prefetch requests=%" PRId64 ", received=%" PRId64 " bytes, "
+                 "avg request=%.3fs, max request=%.3fs, wait=%.3fs\n",
+                 stats.cache_hits, stats.cache_misses, stats.prefetch_hits,
+                 stats.num_requests, stats.num_prefetch_requests, stats.bytes_received,
+                 (stats.num_requests > 0 ? stats.request_time / stats.num_requests : 0.0),
+                 stats.max_request_time, stats.wait_time);
     }
 
-    return count - rem_count;
+    size_t i;
+    for (i = 0; i < sys_data->requests.size(); i++) {
+        curl_multi_remove_handle(sys_data->multi, sys_data->requests[i]->curl);
+        curl_easy_cleanup(sys_data->requests[i]->curl);
+        delete sys_data->requests[i];
+    }
+    sys_data->requests.clear();
+    for (i = 0; i < sys_data->idle_curls.size(); i++)
+        curl_easy_cleanup(sys_data->idle_curls[i]);
+    sys_data->idle_curls.clear();
+    if (sys_data->multi) {
+        curl_multi_cleanup(sys_data->multi);
+        sys_data->multi = 0;
+    }
+    if (sys_data->curl) {
+        curl_easy_cleanup(sys_data->curl);
+        sys_data->curl = 0;
+    }
+    for (i = 0; i < sys_data->blocks.size(); i++)
+        delete [] sys_data->blocks[i].data;
+    sys_data->blocks.clear();
 }
 
 static uint32_t http_file_read(MXFFileSysData *sys_data, uint8_t *data, uint32_t count)
 {
-    CURLcode error_code;
-    uint32_t result = _http_file_read(sys_data, data, count, false, &error_code);
-
-    // It was found that the google storage api would cause curl to return a CURLE_HTTP2
-    // error after around an hour. The workaround implemented here is to close the connection
-    // and open a new one. The issue appears similar to https://github.com/curl/curl/issues/5389
-    // and https://github.com/curl/curl/pull/5643. The fix
-    // https://github.com/curl/curl/commit/ef86daf4d39e99b227d42bb712000c9adfdbdf76 didn't
-    // solve the issue (version 7.74.0).
-    if (result < count && error_code == CURLE_HTTP2) {
-        log_warn("Closing curl connections and retrying a read after a CURLE_HTTP2 error\n");
-        result += _http_file_read(sys_data, data, count - result, true, &error_code);
+    sys_data->eof = 0;
+
+    progress_requests(sys_data);
+
+    int64_t start_index = sys_data->position / sys_data->block_size;
+    uint32_t total_read = 0;
+    while (total_read < count) {
+        if (sys_data->known_end >= 0 && sys_data->position >= sys_data->known_end) {
+            sys_data->eof = 1;
+            break;
+        }
+
+        int64_t index = sys_data->position / sys_data->block_size;
+        CacheBlock *block = find_block(sys_data, index);
+        if (block && block->state != BLOCK_FAILED) {
+            if (block->prefetched)
+                sys_data->stats.prefetch_hits++;
+            else
+                sys_data->stats.cache_hits++;
+            wait_block(sys_data, block);
+        } else {
+            sys_data->stats.cache_misses++;
+        }
+
+        // A request that failed while the read was waiting on it is fetched again in the same way as a miss
+        if (!block || block->state == BLOCK_FAILED) {
+            if (block)
+                block->state = BLOCK_EMPTY;
+            block = fetch_blocks(sys_data, index, count - total_read, false);
+            if (!block)
+                break;
+            wait_block(sys_data, block);
+
+            // It was found that the google storage api would cause curl to return a CURLE_HTTP2
+            // error after around an hour. The workaround implemented here is to close the connection
+            // and open a new one. The issue appears similar to https://github.com/curl/curl/issues/5389
+            // and https://github.com/curl/curl/pull/5643. The fix
+            // https://github.com/curl/curl/commit/ef86daf4d39e99b227d42bb712000c9adfdbdf76 didn't
+            // solve the issue (version 7.74.0).
+            if (block->state == BLOCK_FAILED && sys_data->last_error == CURLE_HTTP2) {
+                log_warn("Closing curl connections and retrying a read after a CURLE_HTTP2 error\n");
+                block->state = BLOCK_EMPTY;
+                block = fetch_blocks(sys_data, index, count - total_read, true);
+                if (!block)
+                    break;
+                wait_block(sys_data, block);
+            } else if (block->state == BLOCK_FAILED && sys_data->last_error == CURLE_PARTIAL_FILE) {
+                block->state = BLOCK_EMPTY;
+                block = fetch_blocks(sys_data, index, count - total_read, false);
+                if (!block)
+                    break;
+                wait_block(sys_data, block);
+                if (block->state == BLOCK_FAILED && sys_data->last_error == CURLE_PARTIAL_FILE)
+                    log_error("HTTP read failed after retrying an incomplete response\n");
+            }
+        }
+        if (block->state != BLOCK_READY)
+            break;
+
+        block->last_used = ++sys_data->use_count;
+        block->prefetched = false;
+
+        uint32_t offset = (uint32_t)(sys_data->position - index * sys_data->block_size);
+        if (offset >= block->size) {
+            sys_data->eof = 1;
+            break;
+        }
+        uint32_t copy_count = block->size - offset;
+        if (copy_count > count - total_read)
+            copy_count = count - total_read;
+        memcpy(&data[total_read], &block->data[offset], copy_count);
+        total_read         += copy_count;
+        sys_data->position += copy_count;
     }
 
-    return result;
+    // Prefetch if the read started in or just after the block where the previous read ended
+    if (sys_data->prefetch_blocks > 0) {
+        int64_t index = sys_data->position / sys_data->block_size;
+        if (sys_data->last_block_index >= 0 &&
+            (start_index == sys_data->last_block_index || start_index == sys_data->last_block_index + 1))
+        {
+            prefetch_blocks(sys_data, index);
+        }
+        sys_data->last_block_index = index;
+    }
+
+    return total_read;
 }
 
 static uint32_t http_file_write(MXFFileSysData *sys_data, const uint8_t *data, uint32_t count)
@@ -398,6 +728,7 @@ static int64_t http_file_size(MXFFileSysData *sys_data)
     return file_size;
 }
 
+
 static int http_file_seek(MXFFileSysData *sys_data, int64_t offset, int whence)
 {
     int64_t new_position = 0;
@@ -415,22 +746,7 @@ static int http_file_seek(MXFFileSysData *sys_data, int64_t offset, int whence)
         return 0;
     }
 
-    if (sys_data->position != new_position) {
-        int64_t pos_diff = new_position - sys_data->position;
-        if (sys_data->buffer_size > 0 &&
-            pos_diff >= - (int64_t)sys_data->buffer_pos &&
-            pos_diff < (int64_t)(sys_data->buffer_size - sys_data->buffer_pos))
-        {
-            sys_data->buffer_pos = (uint32_t)(sys_data->buffer_pos + pos_diff);
-        }
-        else
-        {
-            sys_data->buffer_size = 0;
-            sys_data->buffer_pos  = 0;
-        }
-        sys_data->position = new_position;
-    }
-
+    sys_data->position = new_position;
     sys_data->eof = false;
 
     return 1;
@@ -453,7 +769,8 @@ bool bmx::mxf_http_is_url(const string &url_str)
            url_str.compare(0, 8, "https://") == 0;
 }
 
-MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_size, bool enable_seek)
+MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_size, bool enable_seek,
+                                      uint32_t cache_blocks, uint32_t prefetch_blocks, bool log_stats)
 {
     MXFFile *http_file = 0;
     try
@@ -466,18 +783,18 @@ MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_s
         http_file->sysData->http_file.mxf_file = http_file;
         http_file->sysData->url_str = url_str;
         http_file->sysData->curl = 0;
+        http_file->sysData->multi = 0;
         http_file->sysData->position = 0;
         http_file->sysData->eof = false;
-        http_file->sysData->buffer = 0;
-        http_file->sysData->buffer_pos = 0;
-        http_file->sysData->buffer_size = 0;
-        http_file->sysData->buffer_alloc_size = 0;
-
-        BMX_CHECK((http_file->sysData->curl = curl_easy_init()) != 0);
-        if (min_read_size > 0) {
-            http_file->sysData->buffer            = new unsigned char[min_read_size];
-            http_file->sysData->buffer_alloc_size = min_read_size;
-        }
+        http_file->sysData->block_size = (min_read_size < MIN_BLOCK_SIZE ? MIN_BLOCK_SIZE : min_read_size);
+        http_file->sysData->use_count = 0;
+        http_file->sysData->prefetch_blocks = prefetch_blocks;
+        http_file->sysData->last_block_index = -1;
+        http_file->sysData->known_end = -1;
+        http_file->sysData->last_error = CURLE_OK;
+        http_file->sysData->disable_response_code_warn = false;
+        http_file->sysData->log_stats = log_stats;
+        memset(&http_file->sysData->stats, 0, sizeof(http_file->sysData->stats));
 
         http_file->close         = http_file_close;
         http_file->read          = http_file_read;
@@ -491,6 +808,27 @@ MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_s
         http_file->size          = http_file_size;
         http_file->free_sys_data = free_http_file;
 
+        BMX_CHECK((http_file->sysData->curl = curl_easy_init()) != 0);
+        BMX_CHECK((http_file->sysData->multi = curl_multi_init()) != 0);
+
+        // the cache holds the block at the read position, the prefetched blocks and at least one other block
+        uint32_t num_blocks = cache_blocks;
+        if (num_blocks < prefetch_blocks + 2)
+            num_blocks = prefetch_blocks + 2;
+        http_file->sysData->blocks.resize(num_blocks);
+        uint32_t i;
+        for (i = 0; i < num_blocks; i++) {
+            CacheBlock &block = http_file->sysData->blocks[i];
+            block.index      = -1;
+            block.state      = BLOCK_EMPTY;
+            block.data       = 0;
+            block.size       = 0;
+            block.last_used  = 0;
+            block.prefetched = false;
+        }
+        for (i = 0; i < num_blocks; i++)
+            http_file->sysData->blocks[i].data = new unsigned char[http_file->sysData->block_size];
+
         if (enable_seek) {
             return http_file;
         } else {
@@ -507,6 +845,15 @@ MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_s
     }
 }
 
+bool bmx::mxf_http_file_get_stats(MXFFile *mxf_file, MXFHTTPFileStats *stats)
+{
+    if (mxf_file->close != http_file_close)
+        return false;
+
+    *stats = mxf_file->sysData->stats;
+    return true;
+}
+
 
 #else // ifdef HAVE_LIBCURL
 
@@ -532,13 +879,24 @@ bool bmx::mxf_http_is_url(const string &url_str)
            url_str.compare(0, 8, "https://") == 0;
 }
 
-MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_size, bool enable_seek)
+MXFFile* bmx::mxf_http_file_open_read(const string &url_str, uint32_t min_read_size, bool enable_seek,
+                                      uint32_t cache_blocks, uint32_t prefetch_blocks, bool log_stats)
 {
     (void)url_str;
     (void)min_read_size;
     (void)enable_seek;
+    (void)cache_blocks;
+    (void)prefetch_blocks;
+    (void)log_stats;
     BMX_EXCEPTION(("HTTP file access is not supported in this build"));
 }
 
+bool bmx::mxf_http_file_get_stats(MXFFile *mxf_file, MXFHTTPFileStats *stats)
+{
+    (void)mxf_file;
+    (void)stats;
+    return false;
+}
+
 
 #endif
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#define __STDC_FORMAT_MACROS
+
+#include <cstring>
+
+#include <bmx/MXFWriteBatch.h>
+#include <bmx/BMXException.h>
+#include <bmx/Logging.h>
+
+using namespace std;
+using namespace bmx;
+using namespace mxfpp;
+
+
+#define MAX_ZEROS_SIZE  16384
+
+
+
+MXFWriteBatch::MXFWriteBatch()
+{
+    mSize = 0;
+}
+
+MXFWriteBatch::~MXFWriteBatch()
+{
+}
+
+void MXFWriteBatch::Clear()
+{
+    mCopyBytes.SetSize(0);
+    mBuffers.clear();
+    mSize = 0;
+}
+
+void MXFWriteBatch::AppendFixedKL(const mxfKey *key, uint8_t llen, uint64_t len)
+{
+    BMX_ASSERT(llen > 0 && llen <= 9);
+
+    unsigned char bytes[mxfKey_extlen + 9];
+    memcpy(bytes, key, mxfKey_extlen);
+    if (llen == 1) {
+        BMX_CHECK_M(len < 0x80, ("Could not write BER length %" PRIu64 " for llen equal 1", len));
+        bytes[mxfKey_extlen] = (unsigned char)len;
+    } else {
+        BMX_CHECK_M(llen == 9 || (len >> ((llen - 1) * 8)) == 0,
+                    ("Could not write BER length %" PRIu64 " for llen equal %u", len, llen));
+        bytes[mxfKey_extlen] = 0x80 + llen - 1;
+        uint8_t i;
+        for (i = 0; i < llen - 1; i++)
+            bytes[mxfKey_extlen + llen - 1 - i] = (unsigned char)((len >> (i * 8)) & 0xff);
+    }
+
+    AppendCopy(bytes, mxfKey_extlen + llen);
+}
+
+void MXFWriteBatch::AppendUInt8(uint8_t value)
+{
+    AppendCopy(&value, 1);
+}
+
+void MXFWriteBatch::AppendUInt16(uint16_t value)
+{
+    unsigned char bytes[2];
+    bytes[0] = (unsigned char)((value >> 8) & 0xff);
+    bytes[1] = (unsigned char)(value & 0xff);
+    AppendCopy(bytes, sizeof(bytes));
+}
+
+void MXFWriteBatch::AppendUL(const mxfUL *label)
+{
+    AppendCopy((const unsigned char*)label, mxfUL_extlen);
+}
+
+void MXFWriteBatch::AppendCopy(const unsigned char *data, uint32_t size)
+{
+    if (size == 0)
+        return;
+
+    // extend the previous buffer if it is also copied
+    if (!mBuffers.empty() && !mBuffers.back().data &&
+        mBuffers.back().offset + mBuffers.back().size == mCopyBytes.GetSize())
+    {
+        mBuffers.back().size += size;
+    } else {
+        Buffer buffer;
+        buffer.data   = 0;
+        buffer.offset = mCopyBytes.GetSize();
+        buffer.size   = size;
+        mBuffers.push_back(buffer);
+    }
+    mCopyBytes.Append(data, size);
+    mSize += size;
+}
+
+void MXFWriteBatch::AppendData(const unsigned char *data, uint32_t size)
+{
+    if (size == 0)
+        return;
+
+    Buffer buffer;
+    buffer.data   = data;
+    buffer.offset = 0;
+    buffer.size   = size;
+    mBuffers.push_back(buffer);
+    mSize += size;
+}
+
+void MXFWriteBatch::AppendFill(File *mxf_file, uint32_t size)
+{
+    // see mxf_allocate_space in libMXF
+    BMX_CHECK(size >= (uint32_t)(mxf_get_min_llen(mxf_file->getCFile()) + mxfKey_extlen));
+
+    uint64_t fill_size = size - mxfKey_extlen;
+    uint8_t llen = mxf_get_llen(mxf_file->getCFile(), fill_size);
+    BMX_ASSERT(fill_size >= llen);
+    fill_size -= llen;
+
+    AppendFixedKL(&g_KLVFill_key, llen, fill_size);
+    AppendZeros((uint32_t)fill_size);
+}
+
+void MXFWriteBatch::Write(File *mxf_file)
+{
+    if (mBuffers.empty())
+        return;
+
+    mIOVecs.resize(mBuffers.size());
+    size_t i;
+    for (i = 0; i < mBuffers.size(); i++) {
+        if (mBuffers[i].data)
+            mIOVecs[i].data = mBuffers[i].data;
+        else
+            mIOVecs[i].data = mCopyBytes.GetBytes() + mBuffers[i].offset;
+        mIOVecs[i].size = mBuffers[i].size;
+    }
+
+    BMX_CHECK(mxf_file->writev(&mIOVecs[0], (uint32_t)mIOVecs.size()) == mSize);
+
+    Clear();
+}
+
+void MXFWriteBatch::AppendZeros(uint32_t size)
+{
+    if (size == 0)
+        return;
+
+    // allocate once only because earlier buffers in the batch may reference the zeros
+    if (mZeros.GetAllocatedSize() == 0)
+        mZeros.Allocate(MAX_ZEROS_SIZE); // will clear data
+
+    uint32_t zeros_size = mZeros.GetAllocatedSize();
+    uint32_t rem_size = size;
+    while (rem_size > 0) {
+        uint32_t append_size = (rem_size < zeros_size ? rem_size : zeros_size);
+        AppendData(mZeros.GetBytes(), append_size);
+        rem_size -= append_size;
+    }
+}
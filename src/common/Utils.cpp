@@ -743,6 +743,20 @@ int64_t bmx::get_file_size(FILE *file)
     return (int64_t)stat_buf.st_size;
 }
 
+int64_t bmx::get_file_mod_time(const string &filename)
+{
+#if defined(_WIN32)
+    struct _stati64 stat_buf;
+    if (_stati64(filename.c_str(), &stat_buf) != 0)
+#else
+    struct stat stat_buf;
+    if (stat(filename.c_str(), &stat_buf) != 0)
+#endif
+        throw BMXIOException("Failed to get file modification time: %s", bmx_strerror(errno).c_str());
+
+    return (int64_t)stat_buf.st_mtime;
+}
+
 string bmx::trim_string(string value)
 {
     size_t start;
@@ -36,6 +36,7 @@
 #include <cstring>
 
 #include <bmx/d10_mxf/D10ContentPackage.h>
+#include <bmx/essence_parser/SoundConversion.h>
 #include <bmx/Utils.h>
 #include <bmx/BMXException.h>
 #include <bmx/Logging.h>
@@ -268,7 +269,6 @@ void D10ContentPackage::Write(File *mxf_file)
 void D10ContentPackage::CopySoundSamples(const unsigned char *data, uint32_t num_samples,
                                          const D10SoundChannelInfo &channel_info, uint32_t output_start_sample)
 {
-    const unsigned char *input = data;
     unsigned char *output = mSoundData.GetBytes();
 
     uint8_t copy_flags = 0;
@@ -283,40 +283,8 @@ void D10ContentPackage::CopySoundSamples(const unsigned char *data, uint32_t num
 
     output += 4 + output_start_sample * 4 * 8 + channel_info.index * 4;
 
-    uint32_t s;
-    if (mInfo->sound_ch_sample_size == 3) { // 24-bit
-        for (s = 0; s < num_samples; s++) {
-            uint8_t c;
-            for (c = 0; c < channel_info.count; c++) {
-                if ((copy_flags & (1 << (channel_info.index + c)))) {
-                    output[0] = (channel_info.index + c) | ((input[0] << 4) & 0xf0);
-                    output[1] = ((input[0] >> 4) & 0x0f) | ((input[1] << 4) & 0xf0);
-                    output[2] = ((input[1] >> 4) & 0x0f) | ((input[2] << 4) & 0xf0);
-                    output[3] = ((input[2] >> 4) & 0x0f);
-                }
-                input += 3;
-                output += 4;
-            }
-
-            output += 4 * (8 - channel_info.count);
-        }
-    } else { // 16-bit
-        for (s = 0; s < num_samples; s++) {
-            uint8_t c;
-            for (c = 0; c < channel_info.count; c++) {
-                if ((copy_flags & (1 << (channel_info.index + c)))) {
-                    output[0] = channel_info.index + c;
-                    output[1] =                            ((input[0] << 4) & 0xf0);
-                    output[2] = ((input[0] >> 4) & 0x0f) | ((input[1] << 4) & 0xf0);
-                    output[3] = ((input[1] >> 4) & 0x0f);
-                }
-                input += 2;
-                output += 4;
-            }
-
-            output += 4 * (8 - channel_info.count);
-        }
-    }
+    convert_pcm_to_aes3(data, num_samples, mInfo->sound_ch_sample_size * 8, channel_info.index, channel_info.count,
+                        copy_flags, output);
 }
 
 uint32_t D10ContentPackage::WriteSystemItem(File *mxf_file)
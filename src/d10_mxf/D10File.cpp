@@ -435,6 +435,11 @@ void D10File::CompleteWrite()
     }
 
 
+    // flush buffered writes
+
+    mMXFFile->flush();
+
+
     // done with the file
     delete mMXFFile;
     mMXFFile = 0;
@@ -41,6 +41,7 @@
 #include <set>
 
 #include <bmx/essence_parser/AVCEssenceParser.h>
+#include "EssenceParserUtils.h"
 #include <bmx/mxf_helper/AVCIMXFDescriptorHelper.h>
 #include <bmx/BitBuffer.h>
 #include <bmx/Utils.h>
@@ -1056,24 +1057,7 @@ EssenceType AVCCodedPictureEssenceParser::GetAVCIEssenceType(uint32_t data_size,
 
 uint32_t AVCCodedPictureEssenceParser::NextStartCodePrefix(const unsigned char *data, uint32_t size)
 {
-    const unsigned char *datap3 = data + 3;
-    const unsigned char *end    = data + size;
-
-    // loop logic is based on FFmpeg's avpriv_find_start_code in libavcodec/utils.c
-    while (datap3 < end) {
-        if (datap3[-1] > 1)
-            datap3 += 3;
-        else if (datap3[-2])
-            datap3 += 2;
-        else if (datap3[-3] | (datap3[-1] - 1))
-            datap3++;
-        else
-            break;
-    }
-    if (datap3 < end)
-        return (uint32_t)(datap3 - data) - 3;
-    else
-        return ESSENCE_PARSER_NULL_OFFSET;
+    return find_start_code_prefix(data, size);
 }
 
 uint32_t AVCCodedPictureEssenceParser::CompletePSSize(const unsigned char *ps_start, const unsigned char *ps_max_end)
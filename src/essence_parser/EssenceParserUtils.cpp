@@ -35,7 +35,10 @@
 
 #define __STDC_LIMIT_MACROS
 
+#include <cstring>
+
 #include "EssenceParserUtils.h"
+#include <bmx/essence_parser/EssenceParser.h>
 #include <bmx/BMXException.h>
 #include <bmx/Logging.h>
 
@@ -63,3 +66,45 @@ uint32_t bmx::get_bits(const unsigned char *data, uint32_t data_size, uint32_t b
     return (uint32_t)buffer;
 }
 
+uint32_t bmx::find_start_code_prefix(const unsigned char *data, uint32_t data_size)
+{
+    if (data_size < 3)
+        return ESSENCE_PARSER_NULL_OFFSET;
+
+    // search for the 0x01 byte using memchr, which is vectorised in the C libraries, and then check the 2 zero bytes
+    // before it. The next 0x01 that could complete a start code is at least 3 bytes further on
+    const unsigned char *one_ptr = data + 2;
+    const unsigned char *end = data + data_size;
+    while (one_ptr < end) {
+        one_ptr = (const unsigned char*)memchr(one_ptr, 0x01, end - one_ptr);
+        if (!one_ptr)
+            break;
+        if (one_ptr[-1] == 0x00 && one_ptr[-2] == 0x00)
+            return (uint32_t)(one_ptr - data) - 2;
+        one_ptr += 3;
+    }
+
+    return ESSENCE_PARSER_NULL_OFFSET;
+}
+
+uint32_t bmx::find_byte_sequence(const unsigned char *data, uint32_t data_size, const unsigned char *seq,
+                                 uint32_t seq_size)
+{
+    BMX_ASSERT(seq_size > 0);
+
+    if (data_size < seq_size)
+        return ESSENCE_PARSER_NULL_OFFSET;
+
+    const unsigned char *first_ptr = data;
+    const unsigned char *last_start = data + (data_size - seq_size);
+    while (first_ptr <= last_start) {
+        first_ptr = (const unsigned char*)memchr(first_ptr, seq[0], last_start + 1 - first_ptr);
+        if (!first_ptr)
+            break;
+        if (memcmp(first_ptr + 1, seq + 1, seq_size - 1) == 0)
+            return (uint32_t)(first_ptr - data);
+        first_ptr++;
+    }
+
+    return ESSENCE_PARSER_NULL_OFFSET;
+}
@@ -43,6 +43,12 @@ namespace bmx
 
 uint32_t get_bits(const unsigned char *data, uint32_t data_size, uint32_t bit_offset, uint8_t num_bits);
 
+// returns the offset of the first 0x00 0x00 0x01 start code prefix or ESSENCE_PARSER_NULL_OFFSET if not found
+uint32_t find_start_code_prefix(const unsigned char *data, uint32_t data_size);
+
+// returns the offset of the first occurrence of seq or ESSENCE_PARSER_NULL_OFFSET if not found
+uint32_t find_byte_sequence(const unsigned char *data, uint32_t data_size, const unsigned char *seq, uint32_t seq_size);
+
 
 
 };
@@ -33,6 +33,8 @@
 #include "config.h"
 #endif
 
+#include <cstring>
+
 #include <bmx/essence_parser/MJPEGEssenceParser.h>
 #include <bmx/BMXException.h>
 #include <bmx/Logging.h>
@@ -107,9 +109,17 @@ uint32_t MJPEGEssenceParser::ParseFrameSize(const unsigned char *data, uint32_t
                     mState = 0;
                 break;
             case 2:
-                if (data[mOffset] == 0xff)
+            {
+                // skip the entropy-coded data to the next 0xff
+                const unsigned char *marker = (const unsigned char*)memchr(&data[mOffset], 0xff, data_size - mOffset);
+                if (marker) {
+                    mOffset = (uint32_t)(marker - data);
                     mState = 3;
+                } else {
+                    mOffset = data_size - 1;
+                }
                 break;
+            }
             case 3:
                 if (data[mOffset] == 0xd9) // end of image
                 {
@@ -145,6 +155,13 @@ uint32_t MJPEGEssenceParser::ParseFrameSize(const unsigned char *data, uint32_t
                     mHaveLenByte2 = true;
                     mSkipCount += data[mOffset];
                     mSkipCount -= 1; // length includes the 2 length bytes, one subtracted here and one below
+                } else if (mSkipCount > 1) {
+                    // skip all but the last available byte of the segment data, which is counted below
+                    uint32_t skip_count = mSkipCount - 1;
+                    if (skip_count > data_size - mOffset - 1)
+                        skip_count = data_size - mOffset - 1;
+                    mSkipCount -= skip_count;
+                    mOffset += skip_count;
                 }
 
                 if (mHaveLenByte1 && mHaveLenByte2) {
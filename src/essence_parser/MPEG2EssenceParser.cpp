@@ -85,6 +85,24 @@ static const FrameRateMap FRAME_RATE_MAP[] =
 
 
 
+// returns the offset of the last byte of the next start code ending at or after offset and sets it in state
+static uint32_t next_start_code(const unsigned char *data, uint32_t data_size, uint32_t offset, uint32_t *state)
+{
+    uint32_t search_offset = (offset >= 3 ? offset - 3 : 0);
+    if (search_offset >= data_size)
+        return ESSENCE_PARSER_NULL_OFFSET;
+
+    uint32_t prefix_offset = find_start_code_prefix(&data[search_offset], data_size - search_offset);
+    if (prefix_offset == ESSENCE_PARSER_NULL_OFFSET || search_offset + prefix_offset + 3 >= data_size)
+        return ESSENCE_PARSER_NULL_OFFSET;
+
+    offset = search_offset + prefix_offset + 3;
+    *state = 0x00000100 | data[offset];
+    return offset;
+}
+
+
+
 MPEG2EssenceParser::MPEG2EssenceParser()
 {
     ResetParseFrameSize();
@@ -120,10 +138,9 @@ uint32_t MPEG2EssenceParser::ParseFrameStart(const unsigned char *data, uint32_t
 {
     BMX_CHECK(data_size != ESSENCE_PARSER_NULL_OFFSET);
 
-    uint32_t state = 0xffffffff;
+    uint32_t state;
     uint32_t offset = 0;
-    while (offset < data_size) {
-        state = (state << 8) | data[offset];
+    while ((offset = next_start_code(data, data_size, offset, &state)) != ESSENCE_PARSER_NULL_OFFSET) {
         if (state == SEQUENCE_HEADER_CODE ||
             state == GROUP_HEADER_CODE ||
             state == PICTURE_START_CODE)
@@ -155,7 +172,18 @@ uint32_t MPEG2EssenceParser::ParseFrameSize(const unsigned char *data, uint32_t
         return ESSENCE_PARSER_NULL_OFFSET;
 
     while (mOffset < data_size) {
-        mState = (mState << 8) | data[mOffset];
+        if (mOffset > 3) {
+            // skip to the next start code after checking the frame start
+            uint32_t offset = next_start_code(data, data_size, mOffset, &mState);
+            if (offset == ESSENCE_PARSER_NULL_OFFSET) {
+                // a start code could begin in the last 3 bytes
+                mOffset = data_size;
+                break;
+            }
+            mOffset = offset;
+        } else {
+            mState = (mState << 8) | data[mOffset];
+        }
         if (mState == SEQUENCE_HEADER_CODE ||
             mState == GROUP_HEADER_CODE ||
             mState == PICTURE_START_CODE)
@@ -193,10 +221,9 @@ void MPEG2EssenceParser::ParseFrameInfo(const unsigned char *data, uint32_t data
     ResetFrameInfo();
 
     size_t i;
-    uint32_t state = 0xffffffff;
+    uint32_t state;
     uint32_t offset = 0;
-    while (offset < data_size) {
-        state = (state << 8) | data[offset];
+    while ((offset = next_start_code(data, data_size, offset, &state)) != ESSENCE_PARSER_NULL_OFFSET) {
         if (state == SEQUENCE_HEADER_CODE) {
             mHaveSequenceHeader = true;
             mHorizontalSize = get_bits(data, data_size, (offset - 3) * 8 + 32, 12);
@@ -286,11 +313,9 @@ void MPEG2EssenceParser::ParseFrameAllInfo(const unsigned char *data, uint32_t d
     ResetFrameInfo();
 
     size_t i;
-    uint32_t state = 0xffffffff;
+    uint32_t state;
     uint32_t offset = 0;
-
-    while (offset < data_size) {
-        state = (state << 8) | data[offset];
+    while ((offset = next_start_code(data, data_size, offset, &state)) != ESSENCE_PARSER_NULL_OFFSET) {
         if (state == SEQUENCE_HEADER_CODE) {
             mHaveSequenceHeader = true;
 
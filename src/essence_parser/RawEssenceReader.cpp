@@ -69,12 +69,16 @@ RawEssenceReader::RawEssenceReader(EssenceSource *essence_source)
     mMaxSampleSize = 0;
     mFixedSampleSize = 0;
     mEssenceParser = 0;
+    mSampleBufferOffset = 0;
+    mPrevSampleSize = 0;
     mSampleDataSize = 0;
     mNumSamples = 0;
     mFrameStartSize = PARSE_FRAME_START_SIZE;
     mReadBlockSize = READ_BLOCK_SIZE;
     mReadFirstSample = false;
     mLastSampleRead = false;
+    mFrameOffsetsComplete = false;
+    mFrameOffsetIndex = 0;
 
     mSampleBuffer.SetAllocBlockSize(READ_BLOCK_SIZE);
 }
@@ -118,32 +122,45 @@ void RawEssenceReader::SetCheckMaxSampleSize(uint32_t size)
     mMaxSampleSize = size;
 }
 
+void RawEssenceReader::SetFrameOffsets(const vector<int64_t> &offsets, bool complete)
+{
+    BMX_CHECK(offsets.size() != 1);
+
+    mFrameOffsets = offsets;
+    mFrameOffsetsComplete = complete;
+    mFrameOffsetIndex = 0;
+}
+
 uint32_t RawEssenceReader::ReadSamples(uint32_t num_samples)
 {
     if (mLastSampleRead)
         return 0;
 
-    // shift data from previous read to start of sample data
+    // move past the data from the previous read
     // note that this is needed even if mFixedSampleSize > 0 because the previous read could have occurred
     // when mFixedSampleSize == 0
-    ShiftSampleData(0, mSampleDataSize);
-    mSampleDataSize = 0;
-    mNumSamples = 0;
+    ConsumeSampleData();
 
 
     if (mFixedSampleSize == 0) {
         uint32_t i;
         for (i = 0; i < num_samples; i++) {
-            if (!ReadAndParseSample())
-                break;
+            if (mFrameOffsetIndex + 1 < mFrameOffsets.size()) {
+                if (!ReadIndexedSample() || mLastSampleRead)
+                    break;
+            } else {
+                if (!ReadAndParseSample())
+                    break;
+            }
         }
     } else {
-        ReadBytes(mFixedSampleSize * num_samples - mSampleBuffer.GetSize());
-        if (mSampleBuffer.GetSize() < mFixedSampleSize * num_samples)
+        if (GetBufferDataSize() < mFixedSampleSize * num_samples)
+            ReadBytes(mFixedSampleSize * num_samples - GetBufferDataSize());
+        if (GetBufferDataSize() < mFixedSampleSize * num_samples)
             mLastSampleRead = true;
 
-        mNumSamples = mSampleBuffer.GetSize() / mFixedSampleSize;
-        mSampleBuffer.SetSize(mNumSamples * mFixedSampleSize);
+        mNumSamples = GetBufferDataSize() / mFixedSampleSize;
+        mSampleBuffer.SetSize(mSampleBufferOffset + mNumSamples * mFixedSampleSize);
         mSampleDataSize = mNumSamples * mFixedSampleSize;
     }
 
@@ -156,6 +173,12 @@ uint32_t RawEssenceReader::GetSampleSize() const
     return mSampleDataSize / mNumSamples;
 }
 
+int64_t RawEssenceReader::GetSamplePosition() const
+{
+    // the sample data starts at the window start
+    return mTotalReadLength - GetBufferDataSize();
+}
+
 void RawEssenceReader::Reset()
 {
     if (!mEssenceSource->SeekStart())
@@ -163,10 +186,12 @@ void RawEssenceReader::Reset()
 
     mTotalReadLength = 0;
     mSampleBuffer.SetSize(0);
+    mSampleBufferOffset = 0;
     mSampleDataSize = 0;
     mNumSamples = 0;
     mReadFirstSample = false;
     mLastSampleRead = false;
+    mFrameOffsetIndex = 0;
 }
 
 bool RawEssenceReader::ReadAndParseSample()
@@ -174,14 +199,14 @@ bool RawEssenceReader::ReadAndParseSample()
     BMX_CHECK(mEssenceParser);
 
     uint32_t sample_start_offset = mSampleDataSize;
-    uint32_t sample_num_read = mSampleBuffer.GetSize() - sample_start_offset;
+    uint32_t sample_num_read = GetBufferDataSize() - sample_start_offset;
     uint32_t num_read;
 
     if (!mReadFirstSample) {
         // find the start of the first sample
 
         sample_num_read += ReadBytes(mFrameStartSize);
-        uint32_t offset = mEssenceParser->ParseFrameStart(mSampleBuffer.GetBytes() + sample_start_offset, sample_num_read);
+        uint32_t offset = mEssenceParser->ParseFrameStart(GetBufferData() + sample_start_offset, sample_num_read);
         if (offset == ESSENCE_PARSER_NULL_OFFSET) {
             log_warn("Failed to find start of raw essence sample\n");
             mLastSampleRead = true;
@@ -196,23 +221,24 @@ bool RawEssenceReader::ReadAndParseSample()
 
         mReadFirstSample = true;
     } else {
-        sample_num_read += ReadBytes(mReadBlockSize);
+        sample_num_read += ReadBytes(GetReadSize(sample_num_read));
     }
 
     mEssenceParser->ResetParseFrameSize();
 
     ParsedFrameSize sample_size;
     while (true) {
-        sample_size = mEssenceParser->ParseFrameSize2(mSampleBuffer.GetBytes() + sample_start_offset, sample_num_read);
+        sample_size = mEssenceParser->ParseFrameSize2(GetBufferData() + sample_start_offset, sample_num_read);
 
         // Break if size is known complete or null / invalid
-        if (!sample_size.IsUnknown())
+        // Note that a null first field is unknown because the second field size is not set
+        if (!sample_size.IsUnknown() || sample_size.IsNull())
             break;
 
-        BMX_CHECK_M(mMaxSampleSize == 0 || mSampleBuffer.GetSize() - sample_start_offset <= mMaxSampleSize,
+        BMX_CHECK_M(mMaxSampleSize == 0 || GetBufferDataSize() - sample_start_offset <= mMaxSampleSize,
                    ("Max raw sample size (%u) exceeded", mMaxSampleSize));
 
-        num_read = ReadBytes(mReadBlockSize);
+        num_read = ReadBytes(GetReadSize(sample_num_read));
         if (num_read == 0)
             break;
 
@@ -245,9 +271,76 @@ bool RawEssenceReader::ReadAndParseSample()
 
     mSampleDataSize += sample_size.GetSize();
     mNumSamples++;
+    mPrevSampleSize = sample_size.GetSize();
+    return true;
+}
+
+bool RawEssenceReader::ReadIndexedSample()
+{
+    int64_t position = GetSamplePosition() + mSampleDataSize;
+    int64_t frame_start = mFrameOffsets[mFrameOffsetIndex];
+    int64_t frame_end = mFrameOffsets[mFrameOffsetIndex + 1];
+    BMX_CHECK(frame_start >= position && frame_end > frame_start);
+    BMX_CHECK(frame_start - position <= UINT32_MAX && frame_end - frame_start <= UINT32_MAX);
+
+    // skip data preceding the first frame
+    uint32_t sample_start_offset = mSampleDataSize;
+    uint32_t skip_size = (uint32_t)(frame_start - position);
+    if (skip_size > 0) {
+        uint32_t num_read = GetBufferDataSize() - sample_start_offset;
+        if (num_read < skip_size)
+            num_read += ReadBytes(skip_size - num_read);
+        if (num_read < skip_size) {
+            log_warn("Failed to read raw essence up to indexed frame start\n");
+            mLastSampleRead = true;
+            return false;
+        }
+        ShiftSampleData(sample_start_offset, sample_start_offset + skip_size);
+    }
+
+    uint32_t sample_size = (uint32_t)(frame_end - frame_start);
+    uint32_t sample_num_read = GetBufferDataSize() - sample_start_offset;
+    if (sample_num_read < sample_size) {
+        sample_num_read += ReadBytes(sample_size - sample_num_read);
+        if (sample_num_read < sample_size) {
+            log_warn("Failed to read last remaining bytes %u in frame\n", sample_size - sample_num_read);
+            mLastSampleRead = true;
+            return false;
+        }
+    }
+
+    mSampleDataSize += sample_size;
+    mNumSamples++;
+    mPrevSampleSize = sample_size;
+    mReadFirstSample = true;
+
+    mFrameOffsetIndex++;
+    if (mFrameOffsetIndex + 1 == mFrameOffsets.size() && mFrameOffsetsComplete)
+        mLastSampleRead = true;
+
     return true;
 }
 
+uint32_t RawEssenceReader::GetReadSize(uint32_t sample_num_read) const
+{
+    // adapt to the previous sample size so that a sample is read in a few large reads rather than many blocks
+    uint32_t read_size = mReadBlockSize;
+    if (mPrevSampleSize / 8 > read_size)
+        read_size = mPrevSampleSize / 8;
+    if (mPrevSampleSize > sample_num_read && mPrevSampleSize - sample_num_read > read_size)
+        read_size = mPrevSampleSize - sample_num_read;
+
+    // don't read further beyond the max sample size than the block based reads would
+    if (mMaxSampleSize > 0 && read_size > mReadBlockSize) {
+        if (sample_num_read >= mMaxSampleSize)
+            read_size = mReadBlockSize;
+        else if (read_size > mMaxSampleSize - sample_num_read + mReadBlockSize)
+            read_size = mMaxSampleSize - sample_num_read + mReadBlockSize;
+    }
+
+    return read_size;
+}
+
 uint32_t RawEssenceReader::ReadBytes(uint32_t size)
 {
     BMX_ASSERT(mMaxReadLength == 0 || mTotalReadLength <= mMaxReadLength);
@@ -258,7 +351,7 @@ uint32_t RawEssenceReader::ReadBytes(uint32_t size)
     if (actual_size == 0)
         return 0;
 
-    mSampleBuffer.Grow(actual_size);
+    ReserveBytes(actual_size);
     uint32_t num_read = mEssenceSource->Read(mSampleBuffer.GetBytesAvailable(), actual_size);
     if (num_read < actual_size && mEssenceSource->HaveError())
         log_error("Failed to read from raw essence source: %s\n", mEssenceSource->GetStrError().c_str());
@@ -272,12 +365,47 @@ uint32_t RawEssenceReader::ReadBytes(uint32_t size)
 void RawEssenceReader::ShiftSampleData(uint32_t to_offset, uint32_t from_offset)
 {
     BMX_ASSERT(to_offset <= from_offset);
-    BMX_ASSERT(from_offset <= mSampleBuffer.GetSize());
+    BMX_ASSERT(from_offset <= GetBufferDataSize());
 
-    uint32_t size = mSampleBuffer.GetSize() - from_offset;
+    uint32_t size = GetBufferDataSize() - from_offset;
     if (size > 0)
-        memmove(mSampleBuffer.GetBytes() + to_offset, mSampleBuffer.GetBytes() + from_offset, size);
-    mSampleBuffer.SetSize(to_offset + size);
+        memmove(GetBufferData() + to_offset, GetBufferData() + from_offset, size);
+    mSampleBuffer.SetSize(mSampleBufferOffset + to_offset + size);
+}
+
+void RawEssenceReader::ConsumeSampleData()
+{
+    // the sample data is consumed by moving the buffer offset rather than shifting the remaining data,
+    // which only happens in ReserveBytes when the buffer is full
+    mSampleBufferOffset += mSampleDataSize;
+    if (mSampleBufferOffset == mSampleBuffer.GetSize()) {
+        mSampleBuffer.SetSize(0);
+        mSampleBufferOffset = 0;
+    }
+    mSampleDataSize = 0;
+    mNumSamples = 0;
+}
+
+void RawEssenceReader::ReserveBytes(uint32_t size)
+{
+    if (mSampleBuffer.GetSize() + size <= mSampleBuffer.GetAllocatedSize())
+        return;
+
+    if (mSampleBufferOffset > 0) {
+        uint32_t data_size = GetBufferDataSize();
+        if (data_size > 0)
+            memmove(mSampleBuffer.GetBytes(), GetBufferData(), data_size);
+        mSampleBuffer.SetSize(data_size);
+        mSampleBufferOffset = 0;
+    }
+
+    // allocate space for multiple reads so that the remaining data is shifted less often
+    if (mSampleBuffer.GetSize() + size > mSampleBuffer.GetAllocatedSize()) {
+        uint64_t alloc_size = 2 * ((uint64_t)mSampleBuffer.GetSize() + size);
+        if (alloc_size > UINT32_MAX - READ_BLOCK_SIZE)
+            alloc_size = mSampleBuffer.GetSize() + size;
+        mSampleBuffer.Reallocate((uint32_t)alloc_size);
+    }
 }
 
 uint32_t RawEssenceReader::AppendBytes(const unsigned char *bytes, uint32_t size)
@@ -290,7 +418,7 @@ uint32_t RawEssenceReader::AppendBytes(const unsigned char *bytes, uint32_t size
     if (actual_size == 0)
         return 0;
 
-    mSampleBuffer.Grow(actual_size);
+    ReserveBytes(actual_size);
     memcpy(mSampleBuffer.GetBytesAvailable(), bytes, actual_size);
 
     mTotalReadLength += actual_size;
@@ -0,0 +1,414 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#define __STDC_LIMIT_MACROS
+
+#include <algorithm>
+#include <thread>
+#include <mutex>
+
+#include <bmx/essence_parser/RawFrameScanner.h>
+#include <bmx/essence_parser/FileEssenceSource.h>
+#include <bmx/Utils.h>
+#include <bmx/BMXException.h>
+#include <bmx/Logging.h>
+
+using namespace std;
+using namespace bmx;
+
+
+#define DEFAULT_MIN_CHUNK_SIZE  (16 * 1024 * 1024)
+#define START_SEARCH_OVERLAP    16
+
+
+typedef struct
+{
+    int64_t start;
+    int64_t end;
+    RawEssenceReader *reader;
+    int64_t reader_offset;
+    vector<int64_t> frame_starts;
+    int64_t frames_end;
+    bool stopped;
+    bool failed;
+    string error;
+    vector<LogRecord> log_records;
+} ScanChunk;
+
+typedef struct
+{
+    const RawEssenceReader *reader;
+    const string *filename;
+    int64_t start_offset;
+    int64_t data_end;
+    vector<ScanChunk> *chunks;
+    size_t next_index;
+    mutex next_index_mutex;
+} ScanData;
+
+
+
+
+static RawEssenceReader* open_reader(const ScanData *data, ScanChunk *chunk, int64_t offset, uint32_t max_sample_size)
+{
+    FileEssenceSource *file_source = new FileEssenceSource();
+    if (!file_source->Open(*data->filename, data->start_offset + offset)) {
+        chunk->error = "failed to open raw essence file '" + *data->filename + "': " + file_source->GetStrError();
+        delete file_source;
+        return 0;
+    }
+
+    RawEssenceReader *reader = new RawEssenceReader(file_source);
+    reader->SetEssenceParser(data->reader->GetEssenceParser()->CreateInstance());
+    reader->SetFrameStartSize(data->reader->GetFrameStartSize());
+    reader->SetReadBlockSize(data->reader->GetReadBlockSize());
+    reader->SetCheckMaxSampleSize(max_sample_size);
+    reader->SetMaxReadLength(data->data_end - offset);
+
+    return reader;
+}
+
+static int64_t find_frame_start(const ScanData *data, EssenceParser *parser, int64_t offset, int64_t end)
+{
+    FileEssenceSource file_source;
+    if (!file_source.Open(*data->filename, data->start_offset + offset))
+        return -1;
+
+    uint32_t window_size = data->reader->GetFrameStartSize();
+    if (window_size < 2 * START_SEARCH_OVERLAP)
+        window_size = 2 * START_SEARCH_OVERLAP;
+    ByteArray buffer(window_size);
+
+    while (offset < end) {
+        uint32_t num_read = file_source.Read(buffer.GetBytes(), window_size);
+        if (num_read <= START_SEARCH_OVERLAP)
+            break;
+
+        uint32_t start = parser->ParseFrameStart(buffer.GetBytes(), num_read);
+        if (start != ESSENCE_PARSER_NULL_OFFSET)
+            return offset + start;
+        if (num_read < window_size)
+            break;
+
+        // the windows overlap in case a start code crosses the window boundary
+        if (!file_source.Skip(- START_SEARCH_OVERLAP))
+            break;
+        offset += num_read - START_SEARCH_OVERLAP;
+    }
+
+    return -1;
+}
+
+static bool read_chunk_frame(ScanChunk *chunk)
+{
+    if (chunk->reader->ReadSamples(1) != 1) {
+        chunk->stopped = true;
+        return false;
+    }
+
+    int64_t frame_start = chunk->reader_offset + chunk->reader->GetSamplePosition();
+    chunk->frame_starts.push_back(frame_start);
+    chunk->frames_end = frame_start + chunk->reader->GetSampleDataSize();
+    return true;
+}
+
+static void scan_chunk(ScanData *data, size_t index)
+{
+    ScanChunk *chunk = &(*data->chunks)[index];
+
+    if (index == 0) {
+        // the first chunk is parsed in the same way as a sequential read
+        chunk->reader = open_reader(data, chunk, 0, data->reader->GetCheckMaxSampleSize());
+        if (!chunk->reader) {
+            chunk->failed = true;
+            return;
+        }
+        chunk->reader_offset = 0;
+        if (!read_chunk_frame(chunk))
+            return;
+    } else {
+        // try candidate frame starts until 2 frames can be parsed. A single frame is not enough because a false
+        // candidate could result in a frame that extends to the data end. The frame size is limited to the chunk
+        // size to stop a worker reading far beyond the chunk when a candidate isn't a frame start
+        int64_t max_sample_size = data->reader->GetCheckMaxSampleSize();
+        if (max_sample_size == 0)
+            max_sample_size = UINT32_MAX;
+        if (chunk->end - chunk->start < max_sample_size)
+            max_sample_size = chunk->end - chunk->start;
+
+        EssenceParser *start_parser = data->reader->GetEssenceParser()->CreateInstance();
+        int64_t offset = chunk->start;
+        while (offset < chunk->end) {
+            int64_t frame_start = find_frame_start(data, start_parser, offset, chunk->end);
+            if (frame_start < 0 || frame_start >= chunk->end)
+                break;
+
+            chunk->reader = open_reader(data, chunk, frame_start, (uint32_t)max_sample_size);
+            if (!chunk->reader) {
+                chunk->failed = true;
+                break;
+            }
+            chunk->reader_offset = frame_start;
+            try
+            {
+                if (read_chunk_frame(chunk) && chunk->frame_starts[0] == frame_start && read_chunk_frame(chunk))
+                    break;
+            }
+            catch (...)
+            {
+            }
+
+            delete chunk->reader;
+            chunk->reader = 0;
+            chunk->frame_starts.clear();
+            chunk->stopped = false;
+
+            offset = frame_start + 1;
+        }
+        delete start_parser;
+
+        if (chunk->frame_starts.empty())
+            return;
+    }
+
+    // the frames are read up to the chunk end; the last chunk ends at the data end
+    while (chunk->frames_end < chunk->end) {
+        if (!read_chunk_frame(chunk))
+            break;
+    }
+}
+
+static void scan_worker(ScanData *data)
+{
+    while (true) {
+        size_t index;
+        {
+            lock_guard<mutex> lock(data->next_index_mutex);
+            if (data->next_index >= data->chunks->size())
+                break;
+            index = data->next_index++;
+        }
+
+        // the messages are reported by Scan once the workers have finished
+        ScanChunk *chunk = &(*data->chunks)[index];
+        set_thread_log_records(&chunk->log_records);
+        try
+        {
+            scan_chunk(data, index);
+        }
+        catch (const exception &ex)
+        {
+            chunk->error = ex.what();
+            chunk->failed = true;
+        }
+        catch (...)
+        {
+            chunk->error = "unknown exception";
+            chunk->failed = true;
+        }
+        set_thread_log_records(0);
+    }
+}
+
+
+
+RawFrameScanner::RawFrameScanner()
+{
+    mNumThreads = 1;
+    mMinChunkSize = DEFAULT_MIN_CHUNK_SIZE;
+    mComplete = false;
+    mNumChunks = 0;
+    mNumSeamFrames = 0;
+}
+
+RawFrameScanner::~RawFrameScanner()
+{
+}
+
+void RawFrameScanner::SetNumThreads(uint32_t num_threads)
+{
+    mNumThreads = (num_threads > 0 ? num_threads : 1);
+}
+
+void RawFrameScanner::SetMinChunkSize(int64_t size)
+{
+    mMinChunkSize = (size > 0 ? size : 1);
+}
+
+bool RawFrameScanner::Scan(RawEssenceReader *reader, const string &filename, int64_t start_offset)
+{
+    BMX_CHECK(reader->GetFixedSampleSize() == 0);
+
+    mFrameOffsets.clear();
+    mComplete = false;
+    mNumChunks = 0;
+    mNumSeamFrames = 0;
+
+    if (!reader->GetEssenceParser())
+        return false;
+    EssenceParser *test_parser = reader->GetEssenceParser()->CreateInstance();
+    if (!test_parser)
+        return false;
+    delete test_parser;
+
+    // named pipes and other non-regular files have size 0
+    int64_t data_end;
+    try
+    {
+        data_end = get_file_size(filename) - start_offset;
+    }
+    catch (...)
+    {
+        return false;
+    }
+    if (reader->GetMaxReadLength() > 0 && reader->GetMaxReadLength() < data_end)
+        data_end = reader->GetMaxReadLength();
+
+    int64_t num_chunks = data_end / mMinChunkSize;
+    if (num_chunks > mNumThreads)
+        num_chunks = mNumThreads;
+    if (num_chunks < 2)
+        return false;
+
+    vector<ScanChunk> chunks((size_t)num_chunks);
+    size_t i;
+    for (i = 0; i < chunks.size(); i++) {
+        chunks[i].start         = data_end * i / num_chunks;
+        chunks[i].end           = data_end * (i + 1) / num_chunks;
+        chunks[i].reader        = 0;
+        chunks[i].reader_offset = 0;
+        chunks[i].frames_end    = chunks[i].start;
+        chunks[i].stopped       = false;
+        chunks[i].failed        = false;
+    }
+    mNumChunks = (uint32_t)num_chunks;
+
+    ScanData data;
+    data.reader       = reader;
+    data.filename     = &filename;
+    data.start_offset = start_offset;
+    data.data_end     = data_end;
+    data.chunks       = &chunks;
+    data.next_index   = 0;
+
+    {
+        vector<thread> workers;
+        for (i = 0; i < chunks.size(); i++)
+            workers.push_back(thread(scan_worker, &data));
+        for (i = 0; i < workers.size(); i++)
+            workers[i].join();
+    }
+
+    // warnings and errors are expected when a worker starts part way through a frame and so only the first chunk,
+    // which is parsed sequentially, has its messages reported. The main reader parses from the end of the frame
+    // offsets if a worker stopped early and reports any issues then
+    log_records(chunks[0].log_records);
+    for (i = 0; i < chunks.size(); i++) {
+        if (chunks[i].error.empty())
+            continue;
+        if (i == 0)
+            log_warn("Raw frame scan of chunk %u failed: %s\n", (unsigned)i, chunks[i].error.c_str());
+        else
+            log_debug("Raw frame scan of chunk %u failed: %s\n", (unsigned)i, chunks[i].error.c_str());
+    }
+
+
+    // join up the chunk frames, starting with the frames of the first chunk which are parsed sequentially
+
+    bool result = false;
+    if (!chunks[0].failed && !chunks[0].frame_starts.empty()) {
+        mFrameOffsets = chunks[0].frame_starts;
+        int64_t frames_end = chunks[0].frames_end;
+        size_t seq_index = 0;
+        bool stopped = chunks[0].stopped;
+        bool failed = false;
+
+        size_t next_index = 1;
+        while (!stopped) {
+            // use the next chunk's frames if the frames so far end at one of its frame starts
+            if (next_index < chunks.size()) {
+                ScanChunk *next_chunk = &chunks[next_index];
+                if (next_chunk->frame_starts.empty() || frames_end >= next_chunk->frames_end) {
+                    next_index++;
+                    continue;
+                }
+
+                vector<int64_t>::iterator iter = lower_bound(next_chunk->frame_starts.begin(),
+                                                             next_chunk->frame_starts.end(),
+                                                             frames_end);
+                if (iter != next_chunk->frame_starts.end() && *iter == frames_end) {
+                    mFrameOffsets.insert(mFrameOffsets.end(), iter, next_chunk->frame_starts.end());
+                    frames_end = next_chunk->frames_end;
+                    stopped = next_chunk->stopped || next_chunk->failed;
+                    failed = next_chunk->failed;
+                    seq_index = next_index;
+                    next_index++;
+                    continue;
+                }
+            }
+
+            // otherwise parse the next frame across the seam
+            RawEssenceReader *seq_reader = chunks[seq_index].reader;
+            BMX_ASSERT(seq_reader);
+            try
+            {
+                if (seq_reader->ReadSamples(1) != 1) {
+                    stopped = true;
+                    break;
+                }
+            }
+            catch (...)
+            {
+                failed = true;
+                break;
+            }
+            BMX_CHECK(chunks[seq_index].reader_offset + seq_reader->GetSamplePosition() == frames_end);
+            mFrameOffsets.push_back(frames_end);
+            frames_end += seq_reader->GetSampleDataSize();
+            mNumSeamFrames++;
+        }
+        mFrameOffsets.push_back(frames_end);
+
+        // a worker for a later chunk could have stopped because it didn't have the parse state from earlier
+        // in the stream, e.g. AVC parameter sets, and so only a stop in the sequential first chunk or at the
+        // data end is known to be the end of the frames
+        mComplete = !failed && (seq_index == 0 || frames_end == data_end);
+        result = true;
+    }
+
+    for (i = 0; i < chunks.size(); i++)
+        delete chunks[i].reader;
+
+    return result;
+}
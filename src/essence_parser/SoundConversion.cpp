@@ -38,6 +38,128 @@
 #include <bmx/essence_parser/SoundConversion.h>
 #include <bmx/BMXException.h>
 #include <bmx/Logging.h>
+#include "SoundConversionSIMD.h"
+
+using namespace bmx;
+
+
+// the vector kernels convert a block of samples at a time, sized to keep the interleaved input in the L1 cache
+// whilst it is read once for each channel
+#define KERNEL_BLOCK_SIZE   16384
+
+
+static bool SIMD_ENABLED = true;
+
+
+static const SoundConversionKernels* get_kernels()
+{
+    static const SoundConversionKernels *kernels = select_sound_conversion_kernels();
+    return SIMD_ENABLED ? kernels : 0;
+}
+
+static uint32_t get_kernel_block_samples(uint32_t input_block_align)
+{
+    uint32_t block_samples = (KERNEL_BLOCK_SIZE / input_block_align) & ~15U;
+    return block_samples < 64 ? 64 : block_samples;
+}
+
+static void convert_aes3_to_pcm_channels_scalar(const unsigned char *aes3_samples, uint32_t first_sample,
+                                                uint32_t end_sample, uint32_t block_align, uint8_t channel_count,
+                                                uint8_t read_flags, unsigned char **pcm_data)
+{
+    const unsigned char *aes_data_ptr = &aes3_samples[first_sample * 4 * 8];
+    uint32_t sample_num;
+    uint8_t channel_num;
+
+    if (block_align == 2) {
+        for (sample_num = first_sample; sample_num < end_sample; sample_num++) {
+            for (channel_num = 0; channel_num < channel_count; channel_num++) {
+                if (read_flags & (1 << channel_num)) {
+                    const unsigned char *aes_sample_ptr = aes_data_ptr + channel_num * 4;
+                    unsigned char *pcm_data_ptr = &pcm_data[channel_num][sample_num * 2];
+                    pcm_data_ptr[0] = (aes_sample_ptr[1] >> 4) |
+                                      (aes_sample_ptr[2] << 4);
+                    pcm_data_ptr[1] = (aes_sample_ptr[2] >> 4) |
+                                      (aes_sample_ptr[3] << 4);
+                }
+            }
+            aes_data_ptr += 8 * 4;
+        }
+    } else {
+        for (sample_num = first_sample; sample_num < end_sample; sample_num++) {
+            for (channel_num = 0; channel_num < channel_count; channel_num++) {
+                if (read_flags & (1 << channel_num)) {
+                    const unsigned char *aes_sample_ptr = aes_data_ptr + channel_num * 4;
+                    unsigned char *pcm_data_ptr = &pcm_data[channel_num][sample_num * 3];
+                    pcm_data_ptr[0] = (aes_sample_ptr[0] >> 4) |
+                                      (aes_sample_ptr[1] << 4);
+                    pcm_data_ptr[1] = (aes_sample_ptr[1] >> 4) |
+                                      (aes_sample_ptr[2] << 4);
+                    pcm_data_ptr[2] = (aes_sample_ptr[2] >> 4) |
+                                      (aes_sample_ptr[3] << 4);
+                }
+            }
+            aes_data_ptr += 8 * 4;
+        }
+    }
+}
+
+static void deinterleave_audio_channels_scalar(const unsigned char *input_data, uint32_t first_sample,
+                                               uint32_t end_sample, uint32_t output_block_align,
+                                               uint16_t channel_count, unsigned char **output_data)
+{
+    uint32_t input_block_align = channel_count * output_block_align;
+    const unsigned char *input_ptr = &input_data[first_sample * input_block_align];
+    uint32_t i, j;
+    uint16_t c;
+
+    switch (output_block_align)
+    {
+        case 2:
+            for (i = first_sample; i < end_sample; i++) {
+                for (c = 0; c < channel_count; c++) {
+                    if (output_data[c]) {
+                        output_data[c][i * 2]     = input_ptr[0];
+                        output_data[c][i * 2 + 1] = input_ptr[1];
+                    }
+                    input_ptr += 2;
+                }
+            }
+            break;
+        case 3:
+            for (i = first_sample; i < end_sample; i++) {
+                for (c = 0; c < channel_count; c++) {
+                    if (output_data[c]) {
+                        output_data[c][i * 3]     = input_ptr[0];
+                        output_data[c][i * 3 + 1] = input_ptr[1];
+                        output_data[c][i * 3 + 2] = input_ptr[2];
+                    }
+                    input_ptr += 3;
+                }
+            }
+            break;
+        case 4:
+            for (i = first_sample; i < end_sample; i++) {
+                for (c = 0; c < channel_count; c++) {
+                    if (output_data[c])
+                        memcpy(&output_data[c][i * 4], input_ptr, 4);
+                    input_ptr += 4;
+                }
+            }
+            break;
+        default:
+            for (i = first_sample; i < end_sample; i++) {
+                for (c = 0; c < channel_count; c++) {
+                    if (output_data[c]) {
+                        for (j = 0; j < output_block_align; j++)
+                            output_data[c][i * output_block_align + j] = input_ptr[j];
+                    }
+                    input_ptr += output_block_align;
+                }
+            }
+            break;
+    }
+}
 
 
 
@@ -71,12 +193,16 @@ uint32_t bmx::convert_aes3_to_pcm(const unsigned char *aes3_data, uint32_t aes3_
         return 4 + sample_count * 4 * 8;
     }
 
-    const unsigned char *aes_data_ptr = &aes3_data[4];
-    unsigned char *pcm_data_ptr = &pcm_data[0];
-    uint16_t sample_num;
+    uint16_t sample_num = 0;
+    const SoundConversionKernels *kernels = get_kernels();
+    if (kernels && kernels->aes3_to_pcm)
+        sample_num = (uint16_t)kernels->aes3_to_pcm(&aes3_data[4], sample_count, block_align, channel_num, pcm_data);
+
+    const unsigned char *aes_data_ptr = &aes3_data[4 + sample_num * 4 * 8];
+    unsigned char *pcm_data_ptr = &pcm_data[sample_num * block_align];
 
     if (block_align == 2) {
-        for (sample_num = 0; sample_num < sample_count; sample_num++) {
+        for (; sample_num < sample_count; sample_num++) {
             aes_data_ptr += channel_num * 4;
             pcm_data_ptr[0] = (aes_data_ptr[1] >> 4) |
                               (aes_data_ptr[2] << 4);
@@ -86,7 +212,7 @@ uint32_t bmx::convert_aes3_to_pcm(const unsigned char *aes3_data, uint32_t aes3_
             aes_data_ptr += (8 - channel_num) * 4;
         }
     } else {
-        for (sample_num = 0; sample_num < sample_count; sample_num++) {
+        for (; sample_num < sample_count; sample_num++) {
             aes_data_ptr += channel_num * 4;
             pcm_data_ptr[0] = (aes_data_ptr[0] >> 4) |
                               (aes_data_ptr[1] << 4);
@@ -115,12 +241,17 @@ uint32_t bmx::convert_aes3_to_mc_pcm(const unsigned char *aes3_data, uint32_t ae
     BMX_CHECK(channel_count <= 8);
     BMX_CHECK(pcm_data_size >= channel_count * bytes_per_sample * sample_count);
 
-    const unsigned char *aes_data_ptr = &aes3_data[4];
-    unsigned char *pcm_data_ptr = &pcm_data[0];
-    uint16_t sample_num, channel_num;
+    uint16_t sample_num = 0;
+    uint16_t channel_num;
+    const SoundConversionKernels *kernels = get_kernels();
+    if (kernels && kernels->aes3_to_mc_pcm && channel_count == 8 && valid_flags == 0xff)
+        sample_num = (uint16_t)kernels->aes3_to_mc_pcm(&aes3_data[4], sample_count, bytes_per_sample, pcm_data);
+
+    const unsigned char *aes_data_ptr = &aes3_data[4 + sample_num * 4 * 8];
+    unsigned char *pcm_data_ptr = &pcm_data[sample_num * channel_count * bytes_per_sample];
 
     if (bytes_per_sample == 2) {
-        for (sample_num = 0; sample_num < sample_count; sample_num++) {
+        for (; sample_num < sample_count; sample_num++) {
             for (channel_num = 0; channel_num < channel_count; channel_num++) {
                 if (valid_flags & (1 << channel_num)) {
                     pcm_data_ptr[0] = (aes_data_ptr[1] >> 4) |
@@ -137,7 +268,7 @@ uint32_t bmx::convert_aes3_to_mc_pcm(const unsigned char *aes3_data, uint32_t ae
             aes_data_ptr += (8 - channel_count) * 4;
         }
     } else {
-        for (sample_num = 0; sample_num < sample_count; sample_num++) {
+        for (; sample_num < sample_count; sample_num++) {
             for (channel_num = 0; channel_num < channel_count; channel_num++) {
                 if (valid_flags & (1 << channel_num)) {
                     pcm_data_ptr[0] = (aes_data_ptr[0] >> 4) |
@@ -161,6 +292,65 @@ uint32_t bmx::convert_aes3_to_mc_pcm(const unsigned char *aes3_data, uint32_t ae
     return 4 + sample_count * 4 * 8;
 }
 
+uint32_t bmx::convert_aes3_to_pcm_channels(const unsigned char *aes3_data, uint32_t aes3_data_size,
+                                          bool ignore_valid_flags, uint32_t bits_per_sample, uint8_t channel_count,
+                                          unsigned char **pcm_data, uint32_t pcm_data_size)
+{
+    uint16_t sample_count   = get_aes3_sample_count(aes3_data, aes3_data_size);
+    uint8_t valid_flags     = (ignore_valid_flags ? 0xff : get_aes3_channel_valid_flags(aes3_data, aes3_data_size));
+    uint32_t block_align    = (bits_per_sample + 7) / 8;
+
+    BMX_CHECK(sample_count <= (aes3_data_size - 4) / (8 * 4)); // 4 bytes per sample, 8 channels
+    BMX_CHECK(block_align == 2 || block_align == 3); // only 16-bit to 24-bit sample size allowed
+    BMX_CHECK(channel_count <= 8);
+    BMX_CHECK(pcm_data_size >= block_align * sample_count);
+
+    // invalid channels are silent and skipped channels are not written
+    uint8_t read_flags = 0;
+    uint8_t channel_num;
+    for (channel_num = 0; channel_num < channel_count; channel_num++) {
+        if (!pcm_data[channel_num])
+            continue;
+        if (valid_flags & (1 << channel_num))
+            read_flags |= 1 << channel_num;
+        else
+            memset(pcm_data[channel_num], 0, sample_count * block_align);
+    }
+    if (!read_flags)
+        return 4 + sample_count * 4 * 8;
+
+    // the vector kernels convert each block a channel at a time and the scalar pass completes the block
+    const SoundConversionKernels *kernels = get_kernels();
+    if (kernels && kernels->aes3_to_pcm) {
+        uint32_t block_samples = get_kernel_block_samples(4 * 8);
+        uint32_t block_count;
+        uint32_t sample_num;
+        for (sample_num = 0; sample_num < sample_count; sample_num += block_count) {
+            block_count = sample_count - sample_num;
+            if (block_count > block_samples)
+                block_count = block_samples;
+
+            uint32_t num_converted = block_count;
+            for (channel_num = 0; channel_num < channel_count && num_converted > 0; channel_num++) {
+                if (read_flags & (1 << channel_num)) {
+                    uint32_t count = kernels->aes3_to_pcm(&aes3_data[4 + sample_num * 4 * 8], block_count,
+                                                          block_align, channel_num,
+                                                          &pcm_data[channel_num][sample_num * block_align]);
+                    if (count < num_converted)
+                        num_converted = count;
+                }
+            }
+            convert_aes3_to_pcm_channels_scalar(&aes3_data[4], sample_num + num_converted, sample_num + block_count,
+                                                block_align, channel_count, read_flags, pcm_data);
+        }
+    } else {
+        convert_aes3_to_pcm_channels_scalar(&aes3_data[4], 0, sample_count, block_align, channel_count, read_flags,
+                                            pcm_data);
+    }
+
+    return 4 + sample_count * 4 * 8;
+}
+
 void bmx::deinterleave_audio(const unsigned char *input_data, uint32_t input_data_size,
                             uint32_t bits_per_sample, uint16_t channel_count, uint16_t channel_num,
                             unsigned char *output_data, uint32_t output_data_size)
@@ -169,11 +359,17 @@ void bmx::deinterleave_audio(const unsigned char *input_data, uint32_t input_dat
     uint32_t output_block_align = (bits_per_sample + 7) / 8;
     uint32_t channel_offset = channel_num * output_block_align;
     uint32_t sample_count = input_data_size / input_block_align;
-    uint32_t i, j;
+    uint32_t i = 0, j;
 
     BMX_CHECK(output_data_size >= sample_count * output_block_align);
 
-    for (i = 0; i < sample_count; i++) {
+    const SoundConversionKernels *kernels = get_kernels();
+    if (kernels && kernels->deinterleave && channel_num < channel_count) {
+        i = kernels->deinterleave(input_data, sample_count, output_block_align, channel_count, channel_num,
+                                  output_data);
+    }
+
+    for (; i < sample_count; i++) {
         for (j = 0; j < output_block_align; j++)
             output_data[i * output_block_align + j] = input_data[i * input_block_align + channel_offset + j];
     }
@@ -187,12 +383,123 @@ void bmx::interleave_audio(const unsigned char *input_data, uint32_t input_data_
     uint32_t output_block_align = channel_count * input_block_align;
     uint32_t channel_offset = channel_num * input_block_align;
     uint32_t sample_count = input_data_size / input_block_align;
-    uint32_t i, j;
+    uint32_t i = 0, j;
 
     BMX_CHECK(output_data_size >= sample_count * output_block_align);
 
-    for (i = 0; i < sample_count; i++) {
+    const SoundConversionKernels *kernels = get_kernels();
+    if (kernels && kernels->interleave && channel_num < channel_count)
+        i = kernels->interleave(input_data, sample_count, input_block_align, channel_count, channel_num, output_data);
+
+    for (; i < sample_count; i++) {
         for (j = 0; j < input_block_align; j++)
             output_data[i * output_block_align + channel_offset + j] = input_data[i * input_block_align + j];
     }
 }
+
+void bmx::deinterleave_audio_channels(const unsigned char *input_data, uint32_t input_data_size,
+                                      uint32_t bits_per_sample, uint16_t channel_count,
+                                      unsigned char **output_data, uint32_t output_data_size)
+{
+    uint32_t output_block_align = (bits_per_sample + 7) / 8;
+    uint32_t input_block_align = channel_count * output_block_align;
+    uint32_t sample_count = input_data_size / input_block_align;
+
+    BMX_CHECK(output_data_size >= sample_count * output_block_align);
+
+    // the vector kernels split each block a channel at a time and the scalar pass completes the block
+    const SoundConversionKernels *kernels = get_kernels();
+    if (kernels && kernels->deinterleave) {
+        uint32_t block_samples = get_kernel_block_samples(input_block_align);
+        uint32_t block_count;
+        uint32_t i;
+        uint16_t c;
+        for (i = 0; i < sample_count; i += block_count) {
+            block_count = sample_count - i;
+            if (block_count > block_samples)
+                block_count = block_samples;
+
+            uint32_t num_converted = block_count;
+            for (c = 0; c < channel_count && num_converted > 0; c++) {
+                if (output_data[c]) {
+                    uint32_t count = kernels->deinterleave(&input_data[i * input_block_align], block_count,
+                                                           output_block_align, channel_count, c,
+                                                           &output_data[c][i * output_block_align]);
+                    if (count < num_converted)
+                        num_converted = count;
+                }
+            }
+            deinterleave_audio_channels_scalar(input_data, i + num_converted, i + block_count, output_block_align,
+                                               channel_count, output_data);
+        }
+    } else {
+        deinterleave_audio_channels_scalar(input_data, 0, sample_count, output_block_align, channel_count,
+                                           output_data);
+    }
+}
+
+void bmx::convert_pcm_to_aes3(const unsigned char *pcm_data, uint32_t sample_count, uint32_t bits_per_sample,
+                              uint8_t channel_index, uint8_t channel_count, uint8_t copy_flags,
+                              unsigned char *aes3_samples)
+{
+    uint32_t block_align = (bits_per_sample + 7) / 8;
+
+    BMX_CHECK(block_align == 2 || block_align == 3); // only 16-bit to 24-bit sample size allowed
+    BMX_CHECK(channel_index + channel_count <= 8);
+
+    const unsigned char *input = pcm_data;
+    unsigned char *output = aes3_samples;
+    uint32_t s = 0;
+
+    const SoundConversionKernels *kernels = get_kernels();
+    if (kernels && kernels->pcm_to_aes3 && channel_count == 1 && (copy_flags & (1 << channel_index))) {
+        s = kernels->pcm_to_aes3(pcm_data, sample_count, block_align, channel_index, aes3_samples);
+        input += s * block_align;
+        output += s * 4 * 8;
+    }
+
+    if (block_align == 3) { // 24-bit
+        for (; s < sample_count; s++) {
+            uint8_t c;
+            for (c = 0; c < channel_count; c++) {
+                if ((copy_flags & (1 << (channel_index + c)))) {
+                    output[0] = (channel_index + c) | ((input[0] << 4) & 0xf0);
+                    output[1] = ((input[0] >> 4) & 0x0f) | ((input[1] << 4) & 0xf0);
+                    output[2] = ((input[1] >> 4) & 0x0f) | ((input[2] << 4) & 0xf0);
+                    output[3] = ((input[2] >> 4) & 0x0f);
+                }
+                input += 3;
+                output += 4;
+            }
+
+            output += 4 * (8 - channel_count);
+        }
+    } else { // 16-bit
+        for (; s < sample_count; s++) {
+            uint8_t c;
+            for (c = 0; c < channel_count; c++) {
+                if ((copy_flags & (1 << (channel_index + c)))) {
+                    output[0] = channel_index + c;
+                    output[1] =                            ((input[0] << 4) & 0xf0);
+                    output[2] = ((input[0] >> 4) & 0x0f) | ((input[1] << 4) & 0xf0);
+                    output[3] = ((input[1] >> 4) & 0x0f);
+                }
+                input += 2;
+                output += 4;
+            }
+
+            output += 4 * (8 - channel_count);
+        }
+    }
+}
+
+void bmx::enable_sound_conversion_simd(bool enable)
+{
+    SIMD_ENABLED = enable;
+}
+
+const char* bmx::get_sound_conversion_simd_name()
+{
+    const SoundConversionKernels *kernels = get_kernels();
+    return kernels ? kernels->name : "scalar";
+}
@@ -0,0 +1,581 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define BMX_SOUND_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif (defined(__aarch64__) && !defined(__AARCH64EB__)) || defined(_M_ARM64)
+#define BMX_SOUND_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#include "SoundConversionSIMD.h"
+
+using namespace bmx;
+
+
+
+#if defined(BMX_SOUND_SIMD_X86) || defined(BMX_SOUND_SIMD_NEON)
+// writes one AES3 channel word per sample, with samples 8 words apart
+static void store_words(const uint32_t *words, uint32_t count, unsigned char *aes3_samples)
+{
+    uint32_t i;
+    for (i = 0; i < count; i++)
+        memcpy(&aes3_samples[i * 8 * 4], &words[i], 4);
+}
+#endif
+
+
+#if defined(BMX_SOUND_SIMD_X86)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_AVX2     __attribute__((target("avx2")))
+#else
+#define TARGET_AVX2
+#endif
+
+
+static bool cpu_supports_avx2()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx     = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return false;
+#endif
+}
+
+// SSE2
+
+static uint32_t deinterleave_sse2(const unsigned char *input_data, uint32_t sample_count, uint32_t block_align,
+                                  uint16_t channel_count, uint16_t channel_num, unsigned char *output_data)
+{
+    if (channel_count != 2)
+        return 0;
+
+    uint32_t i = 0;
+    if (block_align == 2) {
+        for (; i + 8 <= sample_count; i += 8) {
+            __m128i a = _mm_loadu_si128((const __m128i*)&input_data[i * 4]);
+            __m128i b = _mm_loadu_si128((const __m128i*)&input_data[i * 4 + 16]);
+            if (channel_num == 0) {
+                a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+                b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+            } else {
+                a = _mm_srai_epi32(a, 16);
+                b = _mm_srai_epi32(b, 16);
+            }
+            _mm_storeu_si128((__m128i*)&output_data[i * 2], _mm_packs_epi32(a, b));
+        }
+    } else if (block_align == 4) {
+        for (; i + 4 <= sample_count; i += 4) {
+            __m128i a = _mm_loadu_si128((const __m128i*)&input_data[i * 8]);
+            __m128i b = _mm_loadu_si128((const __m128i*)&input_data[i * 8 + 16]);
+            a = _mm_shuffle_epi32(a, _MM_SHUFFLE(3, 1, 2, 0));
+            b = _mm_shuffle_epi32(b, _MM_SHUFFLE(3, 1, 2, 0));
+            if (channel_num == 0)
+                _mm_storeu_si128((__m128i*)&output_data[i * 4], _mm_unpacklo_epi64(a, b));
+            else
+                _mm_storeu_si128((__m128i*)&output_data[i * 4], _mm_unpackhi_epi64(a, b));
+        }
+    }
+
+    return i;
+}
+
+static uint32_t interleave_sse2(const unsigned char *input_data, uint32_t sample_count, uint32_t block_align,
+                                uint16_t channel_count, uint16_t channel_num, unsigned char *output_data)
+{
+    if (channel_count != 2)
+        return 0;
+
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t i = 0;
+    if (block_align == 2) {
+        const __m128i keep_mask = (channel_num == 0 ? _mm_set1_epi32((int)0xffff0000) : _mm_set1_epi32(0x0000ffff));
+        for (; i + 8 <= sample_count; i += 8) {
+            __m128i in = _mm_loadu_si128((const __m128i*)&input_data[i * 2]);
+            __m128i lo, hi;
+            if (channel_num == 0) {
+                lo = _mm_unpacklo_epi16(in, zero);
+                hi = _mm_unpackhi_epi16(in, zero);
+            } else {
+                lo = _mm_unpacklo_epi16(zero, in);
+                hi = _mm_unpackhi_epi16(zero, in);
+            }
+            __m128i *out = (__m128i*)&output_data[i * 4];
+            __m128i a = _mm_loadu_si128(out);
+            __m128i b = _mm_loadu_si128(out + 1);
+            _mm_storeu_si128(out,     _mm_or_si128(_mm_and_si128(a, keep_mask), lo));
+            _mm_storeu_si128(out + 1, _mm_or_si128(_mm_and_si128(b, keep_mask), hi));
+        }
+    } else if (block_align == 4) {
+        for (; i + 4 <= sample_count; i += 4) {
+            __m128i in = _mm_loadu_si128((const __m128i*)&input_data[i * 4]);
+            __m128i *out = (__m128i*)&output_data[i * 8];
+            __m128i a = _mm_loadu_si128(out);
+            __m128i b = _mm_loadu_si128(out + 1);
+            // a and b are reordered to (ch0, ch0, ch1, ch1) and the channel is replaced before restoring the order
+            a = _mm_shuffle_epi32(a, _MM_SHUFFLE(3, 1, 2, 0));
+            b = _mm_shuffle_epi32(b, _MM_SHUFFLE(3, 1, 2, 0));
+            if (channel_num == 0) {
+                a = _mm_unpacklo_epi64(in, _mm_unpackhi_epi64(a, a));
+                b = _mm_unpackhi_epi64(in, b);
+            } else {
+                a = _mm_unpacklo_epi64(a, in);
+                b = _mm_unpacklo_epi64(b, _mm_srli_si128(in, 8));
+            }
+            _mm_storeu_si128(out,     _mm_shuffle_epi32(a, _MM_SHUFFLE(3, 1, 2, 0)));
+            _mm_storeu_si128(out + 1, _mm_shuffle_epi32(b, _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+    }
+
+    return i;
+}
+
+static uint32_t aes3_to_mc_pcm_sse2(const unsigned char *aes3_samples, uint32_t sample_count, uint32_t block_align,
+                                    unsigned char *pcm_data)
+{
+    if (block_align != 2)
+        return 0;
+
+    uint32_t i;
+    for (i = 0; i < sample_count; i++) {
+        __m128i a = _mm_loadu_si128((const __m128i*)&aes3_samples[i * 32]);
+        __m128i b = _mm_loadu_si128((const __m128i*)&aes3_samples[i * 32 + 16]);
+        a = _mm_srai_epi32(_mm_slli_epi32(a, 4), 16);
+        b = _mm_srai_epi32(_mm_slli_epi32(b, 4), 16);
+        _mm_storeu_si128((__m128i*)&pcm_data[i * 16], _mm_packs_epi32(a, b));
+    }
+
+    return i;
+}
+
+static uint32_t pcm_to_aes3_sse2(const unsigned char *pcm_data, uint32_t sample_count, uint32_t block_align,
+                                 uint8_t channel_num, unsigned char *aes3_samples)
+{
+    if (block_align != 2)
+        return 0;
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i index = _mm_set1_epi32(channel_num);
+    uint32_t words[4];
+    uint32_t i;
+    for (i = 0; i + 4 <= sample_count; i += 4) {
+        __m128i w = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)&pcm_data[i * 2]), zero);
+        w = _mm_or_si128(_mm_slli_epi32(w, 12), index);
+        _mm_storeu_si128((__m128i*)words, w);
+        store_words(words, 4, &aes3_samples[i * 32]);
+    }
+
+    return i;
+}
+
+
+// AVX2
+
+// compacts the 4 x 24-bit values in the low 3 bytes of each 32-bit word to 12 bytes in each 128-bit lane
+#define PACK_24BIT_SHUFFLE  0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1
+
+// expands 4 x 24-bit values in the first 12 bytes of each 128-bit lane to 32-bit words
+#define UNPACK_24BIT_SHUFFLE  0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1
+
+// writes the 2 x 12 bytes of packed 24-bit values; 4 bytes are overwritten after the 24 bytes
+TARGET_AVX2 static void store_packed_24bit_avx2(unsigned char *output, __m256i packed)
+{
+    _mm_storeu_si128((__m128i*)output, _mm256_castsi256_si128(packed));
+    _mm_storeu_si128((__m128i*)&output[12], _mm256_extracti128_si256(packed, 1));
+}
+
+TARGET_AVX2 static uint32_t deinterleave_avx2(const unsigned char *input_data, uint32_t sample_count,
+                                              uint32_t block_align, uint16_t channel_count, uint16_t channel_num,
+                                              unsigned char *output_data)
+{
+    if (channel_count < 2 || block_align < 2 || block_align > 4)
+        return 0;
+
+    uint32_t i = 0;
+    if (channel_count == 2 && block_align == 2) {
+        for (; i + 16 <= sample_count; i += 16) {
+            __m256i a = _mm256_loadu_si256((const __m256i*)&input_data[i * 4]);
+            __m256i b = _mm256_loadu_si256((const __m256i*)&input_data[i * 4 + 32]);
+            if (channel_num == 0) {
+                a = _mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16);
+                b = _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16);
+            } else {
+                a = _mm256_srai_epi32(a, 16);
+                b = _mm256_srai_epi32(b, 16);
+            }
+            __m256i p = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8);
+            _mm256_storeu_si256((__m256i*)&output_data[i * 2], p);
+        }
+        return i;
+    }
+
+    // gather 8 samples at a time. The 32-bit loads extend past the 16- and 24-bit sample and the 24-bit stores
+    // extend past the 8 samples, and so the last 2 samples are left to the scalar code
+    uint32_t stride = channel_count * block_align;
+    uint32_t reserve = (block_align == 4 ? 0 : 2);
+    const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                               _mm256_set1_epi32((int)stride));
+    const unsigned char *input = &input_data[channel_num * block_align];
+    if (block_align == 2) {
+        const __m256i mask = _mm256_set1_epi32(0xffff);
+        for (; i + 8 + reserve <= sample_count; i += 8) {
+            __m256i w = _mm256_i32gather_epi32((const int*)&input[(size_t)i * stride], offsets, 1);
+            w = _mm256_and_si256(w, mask);
+            __m256i p = _mm256_permute4x64_epi64(_mm256_packus_epi32(w, w), 0x08);
+            _mm_storeu_si128((__m128i*)&output_data[i * 2], _mm256_castsi256_si128(p));
+        }
+    } else if (block_align == 3) {
+        const __m256i shuffle = _mm256_setr_epi8(PACK_24BIT_SHUFFLE, PACK_24BIT_SHUFFLE);
+        for (; i + 8 + reserve <= sample_count; i += 8) {
+            __m256i w = _mm256_i32gather_epi32((const int*)&input[(size_t)i * stride], offsets, 1);
+            store_packed_24bit_avx2(&output_data[i * 3], _mm256_shuffle_epi8(w, shuffle));
+        }
+    } else {
+        for (; i + 8 <= sample_count; i += 8) {
+            __m256i w = _mm256_i32gather_epi32((const int*)&input[(size_t)i * stride], offsets, 1);
+            _mm256_storeu_si256((__m256i*)&output_data[i * 4], w);
+        }
+    }
+
+    return i;
+}
+
+TARGET_AVX2 static uint32_t aes3_to_pcm_avx2(const unsigned char *aes3_samples, uint32_t sample_count,
+                                             uint32_t block_align, uint8_t channel_num, unsigned char *pcm_data)
+{
+    const __m256i offsets = _mm256_setr_epi32(0, 32, 64, 96, 128, 160, 192, 224);
+    const unsigned char *input = &aes3_samples[channel_num * 4];
+    uint32_t i = 0;
+    if (block_align == 2) {
+        const __m256i mask = _mm256_set1_epi32(0xffff);
+        for (; i + 8 <= sample_count; i += 8) {
+            __m256i w = _mm256_i32gather_epi32((const int*)&input[i * 32], offsets, 1);
+            w = _mm256_and_si256(_mm256_srli_epi32(w, 12), mask);
+            __m256i p = _mm256_permute4x64_epi64(_mm256_packus_epi32(w, w), 0x08);
+            _mm_storeu_si128((__m128i*)&pcm_data[i * 2], _mm256_castsi256_si128(p));
+        }
+    } else if (block_align == 3) {
+        // the last 2 samples are left to the scalar code because the 24-bit stores extend past the 8 samples
+        const __m256i shuffle = _mm256_setr_epi8(PACK_24BIT_SHUFFLE, PACK_24BIT_SHUFFLE);
+        for (; i + 10 <= sample_count; i += 8) {
+            __m256i w = _mm256_i32gather_epi32((const int*)&input[i * 32], offsets, 1);
+            w = _mm256_srli_epi32(w, 4);
+            store_packed_24bit_avx2(&pcm_data[i * 3], _mm256_shuffle_epi8(w, shuffle));
+        }
+    }
+
+    return i;
+}
+
+TARGET_AVX2 static uint32_t aes3_to_mc_pcm_avx2(const unsigned char *aes3_samples, uint32_t sample_count,
+                                                uint32_t block_align, unsigned char *pcm_data)
+{
+    uint32_t i = 0;
+    if (block_align == 2) {
+        for (; i + 2 <= sample_count; i += 2) {
+            __m256i a = _mm256_loadu_si256((const __m256i*)&aes3_samples[i * 32]);
+            __m256i b = _mm256_loadu_si256((const __m256i*)&aes3_samples[i * 32 + 32]);
+            a = _mm256_srai_epi32(_mm256_slli_epi32(a, 4), 16);
+            b = _mm256_srai_epi32(_mm256_slli_epi32(b, 4), 16);
+            __m256i p = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8);
+            _mm256_storeu_si256((__m256i*)&pcm_data[i * 16], p);
+        }
+    } else if (block_align == 3) {
+        // the last sample is left to the scalar code because the 24-bit stores extend past the sample
+        const __m256i shuffle = _mm256_setr_epi8(PACK_24BIT_SHUFFLE, PACK_24BIT_SHUFFLE);
+        for (; i + 2 <= sample_count; i++) {
+            __m256i w = _mm256_loadu_si256((const __m256i*)&aes3_samples[i * 32]);
+            w = _mm256_srli_epi32(w, 4);
+            store_packed_24bit_avx2(&pcm_data[i * 24], _mm256_shuffle_epi8(w, shuffle));
+        }
+    }
+
+    return i;
+}
+
+TARGET_AVX2 static uint32_t pcm_to_aes3_avx2(const unsigned char *pcm_data, uint32_t sample_count,
+                                             uint32_t block_align, uint8_t channel_num, unsigned char *aes3_samples)
+{
+    const __m256i index = _mm256_set1_epi32(channel_num);
+    uint32_t words[8];
+    uint32_t i = 0;
+    if (block_align == 2) {
+        for (; i + 8 <= sample_count; i += 8) {
+            __m256i w = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)&pcm_data[i * 2]));
+            w = _mm256_or_si256(_mm256_slli_epi32(w, 12), index);
+            _mm256_storeu_si256((__m256i*)words, w);
+            store_words(words, 8, &aes3_samples[i * 32]);
+        }
+    } else if (block_align == 3) {
+        // the last 2 samples are left to the scalar code because the second load extends past the 8 samples
+        const __m256i shuffle = _mm256_setr_epi8(UNPACK_24BIT_SHUFFLE, UNPACK_24BIT_SHUFFLE);
+        for (; i + 10 <= sample_count; i += 8) {
+            __m128i lo = _mm_loadu_si128((const __m128i*)&pcm_data[i * 3]);
+            __m128i hi = _mm_loadu_si128((const __m128i*)&pcm_data[i * 3 + 12]);
+            __m256i w = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+            w = _mm256_shuffle_epi8(w, shuffle);
+            w = _mm256_or_si256(_mm256_slli_epi32(w, 4), index);
+            _mm256_storeu_si256((__m256i*)words, w);
+            store_words(words, 8, &aes3_samples[i * 32]);
+        }
+    }
+
+    return i;
+}
+
+
+static const SoundConversionKernels SSE2_KERNELS =
+{
+    "sse2",
+    deinterleave_sse2,
+    interleave_sse2,
+    0,
+    aes3_to_mc_pcm_sse2,
+    pcm_to_aes3_sse2,
+};
+
+static const SoundConversionKernels AVX2_KERNELS =
+{
+    "avx2",
+    deinterleave_avx2,
+    interleave_sse2,
+    aes3_to_pcm_avx2,
+    aes3_to_mc_pcm_avx2,
+    pcm_to_aes3_avx2,
+};
+
+#endif // BMX_SOUND_SIMD_X86
+
+
+#if defined(BMX_SOUND_SIMD_NEON)
+
+static uint32_t deinterleave_neon(const unsigned char *input_data, uint32_t sample_count, uint32_t block_align,
+                                  uint16_t channel_count, uint16_t channel_num, unsigned char *output_data)
+{
+    uint32_t i = 0;
+    if (block_align == 2) {
+        uint16_t *output = (uint16_t*)output_data;
+        const uint16_t *input = (const uint16_t*)input_data;
+        switch (channel_count)
+        {
+            case 2:
+                for (; i + 8 <= sample_count; i += 8)
+                    vst1q_u16(&output[i], vld2q_u16(&input[i * 2]).val[channel_num]);
+                break;
+            case 3:
+                for (; i + 8 <= sample_count; i += 8)
+                    vst1q_u16(&output[i], vld3q_u16(&input[i * 3]).val[channel_num]);
+                break;
+            case 4:
+                for (; i + 8 <= sample_count; i += 8)
+                    vst1q_u16(&output[i], vld4q_u16(&input[i * 4]).val[channel_num]);
+                break;
+            default:
+                break;
+        }
+    } else if (block_align == 4) {
+        uint32_t *output = (uint32_t*)output_data;
+        const uint32_t *input = (const uint32_t*)input_data;
+        switch (channel_count)
+        {
+            case 2:
+                for (; i + 4 <= sample_count; i += 4)
+                    vst1q_u32(&output[i], vld2q_u32(&input[i * 2]).val[channel_num]);
+                break;
+            case 3:
+                for (; i + 4 <= sample_count; i += 4)
+                    vst1q_u32(&output[i], vld3q_u32(&input[i * 3]).val[channel_num]);
+                break;
+            case 4:
+                for (; i + 4 <= sample_count; i += 4)
+                    vst1q_u32(&output[i], vld4q_u32(&input[i * 4]).val[channel_num]);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return i;
+}
+
+static uint32_t interleave_neon(const unsigned char *input_data, uint32_t sample_count, uint32_t block_align,
+                                uint16_t channel_count, uint16_t channel_num, unsigned char *output_data)
+{
+    uint32_t i = 0;
+    if (block_align == 2) {
+        uint16_t *output = (uint16_t*)output_data;
+        const uint16_t *input = (const uint16_t*)input_data;
+        switch (channel_count)
+        {
+            case 2:
+                for (; i + 8 <= sample_count; i += 8) {
+                    uint16x8x2_t v = vld2q_u16(&output[i * 2]);
+                    v.val[channel_num] = vld1q_u16(&input[i]);
+                    vst2q_u16(&output[i * 2], v);
+                }
+                break;
+            case 3:
+                for (; i + 8 <= sample_count; i += 8) {
+                    uint16x8x3_t v = vld3q_u16(&output[i * 3]);
+                    v.val[channel_num] = vld1q_u16(&input[i]);
+                    vst3q_u16(&output[i * 3], v);
+                }
+                break;
+            case 4:
+                for (; i + 8 <= sample_count; i += 8) {
+                    uint16x8x4_t v = vld4q_u16(&output[i * 4]);
+                    v.val[channel_num] = vld1q_u16(&input[i]);
+                    vst4q_u16(&output[i * 4], v);
+                }
+                break;
+            default:
+                break;
+        }
+    } else if (block_align == 4) {
+        uint32_t *output = (uint32_t*)output_data;
+        const uint32_t *input = (const uint32_t*)input_data;
+        switch (channel_count)
+        {
+            case 2:
+                for (; i + 4 <= sample_count; i += 4) {
+                    uint32x4x2_t v = vld2q_u32(&output[i * 2]);
+                    v.val[channel_num] = vld1q_u32(&input[i]);
+                    vst2q_u32(&output[i * 2], v);
+                }
+                break;
+            case 3:
+                for (; i + 4 <= sample_count; i += 4) {
+                    uint32x4x3_t v = vld3q_u32(&output[i * 3]);
+                    v.val[channel_num] = vld1q_u32(&input[i]);
+                    vst3q_u32(&output[i * 3], v);
+                }
+                break;
+            case 4:
+                for (; i + 4 <= sample_count; i += 4) {
+                    uint32x4x4_t v = vld4q_u32(&output[i * 4]);
+                    v.val[channel_num] = vld1q_u32(&input[i]);
+                    vst4q_u32(&output[i * 4], v);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    return i;
+}
+
+static uint32_t aes3_to_mc_pcm_neon(const unsigned char *aes3_samples, uint32_t sample_count, uint32_t block_align,
+                                    unsigned char *pcm_data)
+{
+    if (block_align != 2)
+        return 0;
+
+    uint32_t i;
+    for (i = 0; i < sample_count; i++) {
+        uint32x4_t a = vreinterpretq_u32_u8(vld1q_u8(&aes3_samples[i * 32]));
+        uint32x4_t b = vreinterpretq_u32_u8(vld1q_u8(&aes3_samples[i * 32 + 16]));
+        uint16x8_t p = vcombine_u16(vshrn_n_u32(a, 12), vshrn_n_u32(b, 12));
+        vst1q_u8(&pcm_data[i * 16], vreinterpretq_u8_u16(p));
+    }
+
+    return i;
+}
+
+static uint32_t pcm_to_aes3_neon(const unsigned char *pcm_data, uint32_t sample_count, uint32_t block_align,
+                                 uint8_t channel_num, unsigned char *aes3_samples)
+{
+    if (block_align != 2)
+        return 0;
+
+    const uint32x4_t index = vdupq_n_u32(channel_num);
+    uint32_t words[4];
+    uint32_t i;
+    for (i = 0; i + 4 <= sample_count; i += 4) {
+        uint16x4_t s = vreinterpret_u16_u8(vld1_u8(&pcm_data[i * 2]));
+        vst1q_u32(words, vorrq_u32(vshlq_n_u32(vmovl_u16(s), 12), index));
+        store_words(words, 4, &aes3_samples[i * 32]);
+    }
+
+    return i;
+}
+
+
+static const SoundConversionKernels NEON_KERNELS =
+{
+    "neon",
+    deinterleave_neon,
+    interleave_neon,
+    0,
+    aes3_to_mc_pcm_neon,
+    pcm_to_aes3_neon,
+};
+
+#endif // BMX_SOUND_SIMD_NEON
+
+
+
+const SoundConversionKernels* bmx::select_sound_conversion_kernels()
+{
+#if defined(BMX_SOUND_SIMD_X86)
+    if (cpu_supports_avx2())
+        return &AVX2_KERNELS;
+    return &SSE2_KERNELS;
+#elif defined(BMX_SOUND_SIMD_NEON)
+    return &NEON_KERNELS;
+#else
+    return 0;
+#endif
+}
+
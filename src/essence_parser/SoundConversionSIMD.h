@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef BMX_SOUND_CONVERSION_SIMD_H_
+#define BMX_SOUND_CONVERSION_SIMD_H_
+
+
+#include <bmx/BMXTypes.h>
+
+
+
+namespace bmx
+{
+
+
+// Vectorised sound conversion kernels. Each kernel converts as many samples as it can from the start of the data,
+// never reads or writes beyond the sample_count samples and returns the number of samples converted. The caller
+// converts the remaining samples using the scalar code. A kernel returns 0 if the format is not supported.
+//
+// block_align is the size of a single channel sample in bytes.
+// AES3 data starts at the first sample, i.e. after the 4 byte AES3 element header.
+
+typedef struct
+{
+    const char *name;
+
+    uint32_t (*deinterleave)(const unsigned char *input_data, uint32_t sample_count, uint32_t block_align,
+                             uint16_t channel_count, uint16_t channel_num, unsigned char *output_data);
+    uint32_t (*interleave)(const unsigned char *input_data, uint32_t sample_count, uint32_t block_align,
+                           uint16_t channel_count, uint16_t channel_num, unsigned char *output_data);
+    uint32_t (*aes3_to_pcm)(const unsigned char *aes3_samples, uint32_t sample_count, uint32_t block_align,
+                            uint8_t channel_num, unsigned char *pcm_data);
+    uint32_t (*aes3_to_mc_pcm)(const unsigned char *aes3_samples, uint32_t sample_count, uint32_t block_align,
+                               unsigned char *pcm_data);
+    uint32_t (*pcm_to_aes3)(const unsigned char *pcm_data, uint32_t sample_count, uint32_t block_align,
+                            uint8_t channel_num, unsigned char *aes3_samples);
+} SoundConversionKernels;
+
+
+// returns the kernels for the best instruction set supported by the CPU or NULL if there are none
+const SoundConversionKernels* select_sound_conversion_kernels();
+
+
+};
+
+
+
+#endif
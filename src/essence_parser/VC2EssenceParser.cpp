@@ -41,6 +41,7 @@
 #include <limits.h>
 
 #include <bmx/essence_parser/VC2EssenceParser.h>
+#include "EssenceParserUtils.h"
 #include <bmx/Utils.h>
 #include <bmx/BMXException.h>
 #include <bmx/Logging.h>
@@ -52,6 +53,8 @@ using namespace bmx;
 #define PARSE_INFO_PREFIX   0x42424344
 #define MAX_SEARCH_COUNT    100000000   // 100MB
 
+static const unsigned char PARSE_INFO_PREFIX_BYTES[] = {0x42, 0x42, 0x43, 0x44};
+
 
 typedef struct
 {
@@ -332,28 +335,26 @@ uint32_t VC2EssenceParser::ParseFrameSize(const unsigned char *data, uint32_t da
         } else { // mParseState == SEARCH_PARSE_INFO_STATE
             buffer.SetPos(mOffset + mSearchCount);
             while (buffer.GetRemSize() > 0) {
-                uint32_t next_data;
-                uint32_t read_count;
-                while (mSearchState != PARSE_INFO_PREFIX && mSearchCount < MAX_SEARCH_COUNT) {
-                    if ((mSearchState & 0x00ffffff) == (PARSE_INFO_PREFIX >> 8))
-                        read_count = 1;
-                    else if ((mSearchState & 0x0000ffff) == (PARSE_INFO_PREFIX >> 16))
-                        read_count = 2;
-                    else if ((mSearchState & 0x000000ff) == (PARSE_INFO_PREFIX >> 24))
-                        read_count = 3;
-                    else
-                        read_count = 4;
-                    try {
-                        next_data = (uint32_t)buffer.GetUIntLit(read_count);
-                    } catch (...) {
-                        // end of buffer
-                        break;
+                if (mSearchState != PARSE_INFO_PREFIX) {
+                    uint32_t search_pos = (uint32_t)buffer.GetPos();
+                    uint32_t max_search_size = 0;
+                    if (mSearchCount < MAX_SEARCH_COUNT)
+                        max_search_size = MAX_SEARCH_COUNT - mSearchCount + 3;
+                    uint32_t search_size = (uint32_t)buffer.GetRemSize();
+                    if (search_size > max_search_size)
+                        search_size = max_search_size;
+                    uint32_t prefix_offset = find_byte_sequence(&data[search_pos], search_size,
+                                                                PARSE_INFO_PREFIX_BYTES, sizeof(PARSE_INFO_PREFIX_BYTES));
+                    if (prefix_offset != ESSENCE_PARSER_NULL_OFFSET) {
+                        buffer.SetPos(search_pos + prefix_offset + 4);
+                        mSearchCount += prefix_offset + 4;
+                        mSearchState = PARSE_INFO_PREFIX;
+                    } else if (search_size == max_search_size) {
+                        mSearchCount = MAX_SEARCH_COUNT;
+                    } else if (search_size > 3) {
+                        // the last 3 bytes could be the start of a prefix and are searched again in the next call
+                        mSearchCount += search_size - 3;
                     }
-                    if (read_count == 4)
-                        mSearchState = next_data;
-                    else
-                        mSearchState = (mSearchState << (read_count * 8)) | next_data;
-                    mSearchCount += read_count;
                 }
                 if (mSearchState != PARSE_INFO_PREFIX) {
                     if (mSearchCount >= MAX_SEARCH_COUNT) {
@@ -55,23 +55,7 @@ FrameMetadata::~FrameMetadata()
 
 Frame::Frame()
 {
-    edit_rate = ZERO_RATIONAL;
-    position = NULL_FRAME_POSITION;
-    track_edit_rate = ZERO_RATIONAL;
-    track_position = NULL_FRAME_POSITION;
-    ec_position = NULL_FRAME_POSITION;
-    request_num_samples = 0;
-    first_sample_offset = 0;
-    num_samples = 0;
-    temporal_reordering = false;
-    temporal_offset = 0;
-    key_frame_offset = 0;
-    flags = 0;
-    cp_file_position = 0;
-    file_position = 0;
-    kl_size = 0;
-    file_id = (size_t)(-1);
-    element_key = g_Null_Key;
+    Frame::Reset();
 }
 
 Frame::Frame(const Frame &from)
@@ -127,6 +111,35 @@ void Frame::InsertMetadata(FrameMetadata *metadata)
     mMetadata[metadata->GetId()].push_back(metadata);
 }
 
+void Frame::Reset()
+{
+    edit_rate = ZERO_RATIONAL;
+    position = NULL_FRAME_POSITION;
+    track_edit_rate = ZERO_RATIONAL;
+    track_position = NULL_FRAME_POSITION;
+    ec_position = NULL_FRAME_POSITION;
+    request_num_samples = 0;
+    first_sample_offset = 0;
+    num_samples = 0;
+    temporal_reordering = false;
+    temporal_offset = 0;
+    key_frame_offset = 0;
+    flags = 0;
+    cp_file_position = 0;
+    file_position = 0;
+    kl_size = 0;
+    file_id = (size_t)(-1);
+    element_key = g_Null_Key;
+
+    map<string, vector<FrameMetadata*> >::const_iterator iter;
+    for (iter = mMetadata.begin(); iter != mMetadata.end(); iter++) {
+        size_t i;
+        for (i = 0; i < iter->second.size(); i++)
+            delete iter->second[i];
+    }
+    mMetadata.clear();
+}
+
 
 
 DefaultFrame::DefaultFrame()
@@ -178,9 +191,73 @@ Frame* DefaultFrame::Clone()
     return new DefaultFrame(*this);
 }
 
+void DefaultFrame::Reset()
+{
+    Frame::Reset();
+    mData.SetSize(0);
+}
+
 
 Frame* DefaultFrameFactory::CreateFrame()
 {
     return new DefaultFrame();
 }
 
+
+
+PooledFrameFactory::PooledFrameFactory(size_t max_pool_size)
+{
+    mFrameFactory = new DefaultFrameFactory();
+    mOwnFrameFactory = true;
+    mMaxPoolSize = max_pool_size;
+    mHitCount = 0;
+    mMissCount = 0;
+}
+
+PooledFrameFactory::PooledFrameFactory(FrameFactory *frame_factory, bool take_ownership, size_t max_pool_size)
+{
+    mFrameFactory = frame_factory;
+    mOwnFrameFactory = take_ownership;
+    mMaxPoolSize = max_pool_size;
+    mHitCount = 0;
+    mMissCount = 0;
+}
+
+PooledFrameFactory::~PooledFrameFactory()
+{
+    size_t i;
+    for (i = 0; i < mFreeFrames.size(); i++)
+        mFrameFactory->DeleteFrame(mFreeFrames[i]);
+
+    if (mOwnFrameFactory)
+        delete mFrameFactory;
+}
+
+Frame* PooledFrameFactory::CreateFrame()
+{
+    if (mFreeFrames.empty()) {
+        mMissCount++;
+        return mFrameFactory->CreateFrame();
+    }
+
+    mHitCount++;
+    Frame *frame = mFreeFrames.back();
+    mFreeFrames.pop_back();
+    return frame;
+}
+
+void PooledFrameFactory::DeleteFrame(Frame *frame)
+{
+    if (!frame)
+        return;
+
+    if (mFreeFrames.size() >= mMaxPoolSize) {
+        mFrameFactory->DeleteFrame(frame);
+        return;
+    }
+
+    // the frame keeps its allocated data buffer
+    frame->Reset();
+    mFreeFrames.push_back(frame);
+}
+
@@ -60,10 +60,10 @@ DefaultFrameBuffer::DefaultFrameBuffer(FrameFactory *frame_factory, bool take_ow
 
 DefaultFrameBuffer::~DefaultFrameBuffer()
 {
+    Clear(true);
+
     if (mOwnFrameFactory)
         delete mFrameFactory;
-
-    Clear(true);
 }
 
 void DefaultFrameBuffer::SetFrameFactory(FrameFactory *frame_factory, bool take_ownership)
@@ -102,6 +102,11 @@ Frame* DefaultFrameBuffer::CreateFrame()
     return mFrameFactory->CreateFrame();
 }
 
+void DefaultFrameBuffer::DeleteFrame(Frame *frame)
+{
+    mFrameFactory->DeleteFrame(frame);
+}
+
 void DefaultFrameBuffer::PushFrame(Frame *frame)
 {
     mFrames.push_back(frame);
@@ -110,7 +115,7 @@ void DefaultFrameBuffer::PushFrame(Frame *frame)
 void DefaultFrameBuffer::PopFrame(bool del_frame)
 {
     if (del_frame && mFrames.front())
-        delete mFrames.front();
+        DeleteFrame(mFrames.front());
 
     mFrames.pop_front();
 }
@@ -137,7 +142,7 @@ void DefaultFrameBuffer::Clear(bool del_frames)
     if (del_frames) {
         size_t i;
         for (i = 0; i < mFrames.size(); i++)
-            delete mFrames[i];
+            DeleteFrame(mFrames[i]);
     }
 
     mFrames.clear();
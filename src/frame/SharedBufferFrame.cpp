@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <bmx/frame/SharedBufferFrame.h>
+#include <bmx/BMXException.h>
+#include <bmx/Logging.h>
+
+using namespace std;
+using namespace bmx;
+
+
+
+SharedBuffer::SharedBuffer()
+{
+    mRefCount = 1;
+}
+
+SharedBuffer::~SharedBuffer()
+{
+}
+
+void SharedBuffer::AddRef()
+{
+    mRefCount++;
+}
+
+void SharedBuffer::Release()
+{
+    uint32_t prev_ref_count = mRefCount--;
+    BMX_ASSERT(prev_ref_count > 0);
+    if (prev_ref_count == 1)
+        delete this;
+}
+
+
+
+SharedBufferFrame::SharedBufferFrame()
+: Frame()
+{
+    mSharedBuffer = 0;
+    mSharedOffset = 0;
+    mSharedSize = 0;
+}
+
+SharedBufferFrame::SharedBufferFrame(const SharedBufferFrame &from)
+: Frame(from), mData(from.mData)
+{
+    mSharedBuffer = from.mSharedBuffer;
+    mSharedOffset = from.mSharedOffset;
+    mSharedSize   = from.mSharedSize;
+    if (mSharedBuffer)
+        mSharedBuffer->AddRef();
+}
+
+SharedBufferFrame::~SharedBufferFrame()
+{
+    ReleaseSharedBytes();
+}
+
+void SharedBufferFrame::SetSharedBytes(SharedBuffer *buffer, uint32_t offset, uint32_t size)
+{
+    BMX_CHECK(GetSize() == 0);
+    BMX_CHECK(offset <= buffer->GetByteArray()->GetSize() &&
+              size <= buffer->GetByteArray()->GetSize() - offset);
+
+    buffer->AddRef();
+    ReleaseSharedBytes();
+    mSharedBuffer = buffer;
+    mSharedOffset = offset;
+    mSharedSize   = size;
+}
+
+uint32_t SharedBufferFrame::GetSize() const
+{
+    if (mSharedBuffer)
+        return mSharedSize;
+    else
+        return mData.GetSize();
+}
+
+const unsigned char* SharedBufferFrame::GetBytes() const
+{
+    if (mSharedBuffer)
+        return mSharedBuffer->GetByteArray()->GetBytes() + mSharedOffset;
+    else
+        return mData.GetBytes();
+}
+
+void SharedBufferFrame::Grow(uint32_t min_size)
+{
+    CopySharedBytes();
+    mData.Grow(min_size);
+}
+
+uint32_t SharedBufferFrame::GetSizeAvailable() const
+{
+    if (mSharedBuffer)
+        return 0;
+    else
+        return mData.GetSizeAvailable();
+}
+
+unsigned char* SharedBufferFrame::GetBytesAvailable() const
+{
+    BMX_ASSERT(!mSharedBuffer);
+    return mData.GetBytesAvailable();
+}
+
+void SharedBufferFrame::SetSize(uint32_t size)
+{
+    if (mSharedBuffer) {
+        BMX_CHECK(size <= mSharedSize);
+        mSharedSize = size;
+    } else {
+        mData.SetSize(size);
+    }
+}
+
+void SharedBufferFrame::IncrementSize(uint32_t inc)
+{
+    CopySharedBytes();
+    mData.IncrementSize(inc);
+}
+
+Frame* SharedBufferFrame::Clone()
+{
+    return new SharedBufferFrame(*this);
+}
+
+void SharedBufferFrame::Reset()
+{
+    Frame::Reset();
+    ReleaseSharedBytes();
+    mData.SetSize(0);
+}
+
+void SharedBufferFrame::CopySharedBytes()
+{
+    if (!mSharedBuffer)
+        return;
+
+    mData.CopyBytes(mSharedBuffer->GetByteArray()->GetBytes() + mSharedOffset, mSharedSize);
+    ReleaseSharedBytes();
+}
+
+void SharedBufferFrame::ReleaseSharedBytes()
+{
+    if (mSharedBuffer) {
+        mSharedBuffer->Release();
+        mSharedBuffer = 0;
+    }
+    mSharedOffset = 0;
+    mSharedSize = 0;
+}
+
+
+
+Frame* SharedBufferFrameFactory::CreateFrame()
+{
+    return new SharedBufferFrame();
+}
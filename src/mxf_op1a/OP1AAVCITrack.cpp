@@ -138,6 +138,10 @@ void OP1AAVCITrack::WriteSamplesInt(const unsigned char *data, uint32_t size, ui
         mWriterHelper.ProcessFrame(sample_data, sample_size, &data_array, &array_size);
         mCPManager->WriteSample(mTrackIndex, data_array, array_size);
 
+        // the next frame could replace the header referenced by this frame
+        if (i + 1 < num_samples)
+            mCPManager->RetainSampleData();
+
         sample_data += sample_size;
     }
 }
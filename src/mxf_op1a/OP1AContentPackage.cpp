@@ -168,6 +168,7 @@ OP1AContentPackageElementData::OP1AContentPackageElementData(File *mxf_file, OP1
     mMXFFile = mxf_file;
     mIndexTable = index_table;
     mElement = element;
+    mDataRefsSize = 0;
     mNumSamplesWritten = 0;
     mNumSamples = element->GetNumSamples(position);
     mTotalWriteSize = 0;
@@ -190,7 +191,9 @@ uint32_t OP1AContentPackageElementData::WriteSamples(const unsigned char *data,
         write_size = size;
     }
 
-    if (mElement->is_frame_wrapped || mTotalWriteSize == 0) {
+    if (mElement->is_frame_wrapped) {
+        AppendDataRef(data, write_size);
+    } else if (mTotalWriteSize == 0) {
         mData.Append(data, write_size);
     } else {
         BMX_CHECK(mMXFFile->write(data, write_size) == write_size);
@@ -204,7 +207,11 @@ uint32_t OP1AContentPackageElementData::WriteSamples(const unsigned char *data,
 
 void OP1AContentPackageElementData::WriteSample(const CDataBuffer *data_array, uint32_t array_size)
 {
-    if (mElement->is_frame_wrapped || mTotalWriteSize == 0) {
+    if (mElement->is_frame_wrapped) {
+        uint32_t i;
+        for (i = 0; i < array_size; i++)
+            AppendDataRef(data_array[i].data, data_array[i].size);
+    } else if (mTotalWriteSize == 0) {
         uint32_t size = dba_get_total_size(data_array, array_size);
         mData.Grow(size);
         dba_copy_data(mData.GetBytesAvailable(), mData.GetSizeAvailable(), data_array, array_size);
@@ -223,6 +230,21 @@ void OP1AContentPackageElementData::WriteSample(const CDataBuffer *data_array, u
     mNumSamplesWritten++;
 }
 
+// frame wrapped sample data is referenced until either the content package is written or the write call returns,
+// so that a content package completed and written within a call is passed to the file without copying
+void OP1AContentPackageElementData::RetainData()
+{
+    if (mDataRefs.empty())
+        return;
+
+    mData.Grow(mDataRefsSize);
+    dba_copy_data(mData.GetBytesAvailable(), mData.GetSizeAvailable(), &mDataRefs[0], (uint32_t)mDataRefs.size());
+    mData.IncrementSize(mDataRefsSize);
+
+    mDataRefs.clear();
+    mDataRefsSize = 0;
+}
+
 bool OP1AContentPackageElementData::IsReady() const
 {
     return ( mElement->is_frame_wrapped && mNumSamplesWritten >= mNumSamples) ||
@@ -234,7 +256,7 @@ uint32_t OP1AContentPackageElementData::GetWriteSize() const
     if (!mElement->is_frame_wrapped) {
         return mData.GetSize();
     } else if (mElement->fixed_element_size) {
-        uint32_t essence_write_size = mxfKey_extlen + mElement->essence_llen + mData.GetSize();
+        uint32_t essence_write_size = mxfKey_extlen + mElement->essence_llen + GetDataSize();
         if (essence_write_size != mElement->fixed_element_size) {
             if (essence_write_size > mElement->fixed_element_size) {
                 BMX_EXCEPTION(("Essence KLV element size %u exceeds fixed size %u",
@@ -246,23 +268,29 @@ uint32_t OP1AContentPackageElementData::GetWriteSize() const
         }
         return mElement->fixed_element_size;
     } else {
-        return mElement->GetKAGAlignedSize(mxfKey_extlen + mElement->essence_llen + mData.GetSize());
+        return mElement->GetKAGAlignedSize(mxfKey_extlen + mElement->essence_llen + GetDataSize());
     }
 }
 
-uint32_t OP1AContentPackageElementData::Write()
+uint32_t OP1AContentPackageElementData::Write(MXFWriteBatch *write_batch)
 {
     uint32_t write_size = GetWriteSize();
 
     if (mElement->is_frame_wrapped) {
-        mElement->WriteKL(mMXFFile, mData.GetSize());
-        BMX_CHECK(mMXFFile->write(mData.GetBytes(), mData.GetSize()) == mData.GetSize());
-        if (write_size > mxfKey_extlen + mElement->essence_llen + mData.GetSize())
-            mMXFFile->writeFill(write_size - (mxfKey_extlen + mElement->essence_llen + mData.GetSize()));
+        uint32_t data_size = GetDataSize();
+        write_batch->AppendFixedKL(&mElement->element_key, mElement->essence_llen, data_size);
+        if (mData.GetSize() > 0)
+            write_batch->AppendData(mData.GetBytes(), mData.GetSize());
+        size_t i;
+        for (i = 0; i < mDataRefs.size(); i++)
+            write_batch->AppendData(mDataRefs[i].data, mDataRefs[i].size);
+        if (write_size > mxfKey_extlen + mElement->essence_llen + data_size)
+            write_batch->AppendFill(mMXFFile, write_size - (mxfKey_extlen + mElement->essence_llen + data_size));
         else
-            BMX_ASSERT(write_size == mxfKey_extlen + mElement->essence_llen + mData.GetSize());
+            BMX_ASSERT(write_size == mxfKey_extlen + mElement->essence_llen + data_size);
     } else {
         BMX_ASSERT(mTotalWriteSize == 0);
+        write_batch->Write(mMXFFile);
         mElementStartPos = mMXFFile->tell();
         mElement->WriteKL(mMXFFile, 0);
         BMX_CHECK(mMXFFile->write(mData.GetBytes(), mData.GetSize()) == mData.GetSize());
@@ -291,12 +319,26 @@ void OP1AContentPackageElementData::CompleteWrite()
 void OP1AContentPackageElementData::Reset(int64_t new_position)
 {
     mData.SetSize(0);
+    mDataRefs.clear();
+    mDataRefsSize = 0;
     mNumSamplesWritten = 0;
     mNumSamples = mElement->GetNumSamples(new_position);
     mTotalWriteSize = 0;
     mElementStartPos = 0;
 }
 
+void OP1AContentPackageElementData::AppendDataRef(const unsigned char *data, uint32_t size)
+{
+    if (size == 0)
+        return;
+
+    CDataBuffer data_ref;
+    data_ref.data = (unsigned char*)data;
+    data_ref.size = size;
+    mDataRefs.push_back(data_ref);
+    mDataRefsSize += size;
+}
+
 OP1AContentPackage::OP1AContentPackage(File *mxf_file, OP1AIndexTable *index_table, uint32_t kag_size, uint8_t min_llen,
                                        bool have_system_item, bool have_user_timecode, Rational frame_rate,
                                        uint8_t sys_meta_item_flags, vector<OP1AContentPackageElement*> elements,
@@ -394,6 +436,13 @@ void OP1AContentPackage::WriteSample(uint32_t track_index, const CDataBuffer *da
     mElementTrackIndexMap[track_index]->WriteSample(data_array, array_size);
 }
 
+void OP1AContentPackage::RetainSampleData()
+{
+    size_t i;
+    for (i = 0; i < mElementData.size(); i++)
+        mElementData[i]->RetainData();
+}
+
 bool OP1AContentPackage::IsReady()
 {
     if (mHaveSystemItem && mHaveInputUserTimecode && !mUserTimecodeSet)
@@ -444,32 +493,34 @@ uint32_t OP1AContentPackage::Write()
     if (mHaveSystemItem)
         WriteSystemItem();
 
+    // frame wrapped content packages are written in one go; clip wrapped elements write directly to the file
     uint32_t size = 0;
     size_t i;
     for (i = 0; i < mElementData.size(); i++)
-        size += mElementData[i]->Write();
+        size += mElementData[i]->Write(&mWriteBatch);
+    mWriteBatch.Write(mMXFFile);
 
     return size;
 }
 
 void OP1AContentPackage::WriteSystemItem()
 {
-    mMXFFile->writeFixedKL(&MXF_EE_K(SDTI_CP_System_Pack), FW_ESS_ELEMENT_LLEN, SYSTEM_ITEM_METADATA_PACK_SIZE);
+    mWriteBatch.AppendFixedKL(&MXF_EE_K(SDTI_CP_System_Pack), FW_ESS_ELEMENT_LLEN, SYSTEM_ITEM_METADATA_PACK_SIZE);
 
     // core fields
-    mMXFFile->writeUInt8(mSystemMetadataBitmap);                        // system metadata bitmap
-    mMXFFile->writeUInt8(mContentPackageRate);                          // content package rate
-    mMXFFile->writeUInt8(0x00);                                         // content package type (default)
-    mMXFFile->writeUInt16(0x0000);                                      // channel handle (default)
-    mMXFFile->writeUInt16((uint16_t)(mPosition & 0xffff));              // continuity count
+    mWriteBatch.AppendUInt8(mSystemMetadataBitmap);                        // system metadata bitmap
+    mWriteBatch.AppendUInt8(mContentPackageRate);                          // content package rate
+    mWriteBatch.AppendUInt8(0x00);                                         // content package type (default)
+    mWriteBatch.AppendUInt16(0x0000);                                      // channel handle (default)
+    mWriteBatch.AppendUInt16((uint16_t)(mPosition & 0xffff));              // continuity count
 
     // SMPTE Universal Label
-    mMXFFile->writeUL(&MXF_EC_L(MultipleWrappings));
+    mWriteBatch.AppendUL(&MXF_EC_L(MultipleWrappings));
 
     // (null) Package creation date / time stamp
     unsigned char ts_bytes[17];
     memset(ts_bytes, 0, sizeof(ts_bytes));
-    BMX_CHECK(mMXFFile->write(ts_bytes, sizeof(ts_bytes)) == sizeof(ts_bytes));
+    mWriteBatch.AppendCopy(ts_bytes, sizeof(ts_bytes));
 
     // User date / time stamp
     Timecode user_timecode;
@@ -483,13 +534,13 @@ void OP1AContentPackage::WriteSystemItem()
         user_timecode.Init(get_rounded_tc_base(mFrameRate), false, mPosition);
     }
     encode_smpte_timecode(user_timecode, mFieldMark, &ts_bytes[1], sizeof(ts_bytes) - 1);
-    BMX_CHECK(mMXFFile->write(ts_bytes, sizeof(ts_bytes)) == sizeof(ts_bytes));
+    mWriteBatch.AppendCopy(ts_bytes, sizeof(ts_bytes));
 
     // empty Package Metadata Set
-    mMXFFile->writeFixedKL(&MXF_EE_K(EmptyPackageMetadataSet), FW_ESS_ELEMENT_LLEN, 0);
+    mWriteBatch.AppendFixedKL(&MXF_EE_K(EmptyPackageMetadataSet), FW_ESS_ELEMENT_LLEN, 0);
 
     if (mSystemItemSize > NA_SYSTEM_ITEM_SIZE)
-        mMXFFile->writeFill(mSystemItemSize - NA_SYSTEM_ITEM_SIZE);
+        mWriteBatch.AppendFill(mMXFFile, mSystemItemSize - NA_SYSTEM_ITEM_SIZE);
 }
 
 void OP1AContentPackage::CompleteWrite()
@@ -737,6 +788,13 @@ void OP1AContentPackageManager::WriteSample(uint32_t track_index, const CDataBuf
     mContentPackages[cp_index]->WriteSample(track_index, data_array, array_size);
 }
 
+void OP1AContentPackageManager::RetainSampleData()
+{
+    size_t i;
+    for (i = 0; i < mContentPackages.size(); i++)
+        mContentPackages[i]->RetainSampleData();
+}
+
 bool OP1AContentPackageManager::HaveContentPackage() const
 {
     return !mContentPackages.empty() && mContentPackages.front()->IsReady();
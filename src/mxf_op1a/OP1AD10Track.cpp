@@ -85,6 +85,10 @@ void OP1AD10Track::WriteSamplesInt(const unsigned char *data, uint32_t size, uin
     for (i = 0; i < num_samples; i++) {
         mWriterHelper.ProcessFrame(&data[i * sample_size], sample_size, &data_array, &data_array_size);
         OP1APictureTrack::WriteSampleInt(data_array, data_array_size);
+
+        // the next frame could reallocate the padding referenced by this frame
+        if (i + 1 < num_samples)
+            mCPManager->RetainSampleData();
     }
 }
 
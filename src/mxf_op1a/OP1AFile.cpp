@@ -513,6 +513,9 @@ void OP1AFile::WriteSamples(uint32_t track_index, const unsigned char *data, uin
     GetTrack(track_index)->WriteSamplesInt(data, size, num_samples);
 
     WriteContentPackages(false);
+
+    // the data is only valid for the duration of this call; copy what buffered content packages still reference
+    mCPManager->RetainSampleData();
 }
 
 void OP1AFile::CompleteWrite()
@@ -720,6 +723,11 @@ void OP1AFile::CompleteWrite()
     }
 
 
+    // flush buffered writes
+
+    mMXFFile->flush();
+
+
     // done with the file
     delete mMXFFile;
     mMXFFile = 0;
@@ -290,6 +290,50 @@ void EssenceChunkHelper::SetIsComplete()
     mIsComplete = true;
 }
 
+void EssenceChunkHelper::WriteCache(File *cache_file) const
+{
+    BMX_ASSERT(mIsComplete);
+
+    cache_file->writeUInt64(mNumIndexedPartitions);
+    cache_file->writeUInt32((uint32_t)mEssenceChunks.size());
+    size_t i;
+    for (i = 0; i < mEssenceChunks.size(); i++) {
+        const EssenceChunk &chunk = mEssenceChunks[i];
+        cache_file->writeInt64(chunk.file_position);
+        cache_file->writeInt64(chunk.essence_offset);
+        cache_file->writeInt64(chunk.size);
+        cache_file->writeUInt8(chunk.is_complete);
+        cache_file->writeUInt64(chunk.partition_id);
+        BMX_CHECK(cache_file->write((const unsigned char*)&chunk.element_key, mxfKey_extlen) == mxfKey_extlen);
+    }
+}
+
+void EssenceChunkHelper::ReadCache(File *cache_file)
+{
+    BMX_ASSERT(mEssenceChunks.empty());
+
+    size_t num_partitions = mFileReader->mFile->getPartitions().size();
+
+    mNumIndexedPartitions = (size_t)cache_file->readUInt64();
+    BMX_CHECK(mNumIndexedPartitions <= num_partitions);
+    uint32_t num_chunks = cache_file->readUInt32();
+    uint32_t i;
+    for (i = 0; i < num_chunks; i++) {
+        EssenceChunk chunk;
+        chunk.file_position  = cache_file->readInt64();
+        chunk.essence_offset = cache_file->readInt64();
+        chunk.size           = cache_file->readInt64();
+        chunk.is_complete    = (cache_file->readUInt8() != 0);
+        chunk.partition_id   = (size_t)cache_file->readUInt64();
+        cache_file->readK(&chunk.element_key);
+        BMX_CHECK(chunk.partition_id < num_partitions);
+        mEssenceChunks.push_back(chunk);
+    }
+    mLastEssenceChunk = 0;
+
+    mIsComplete = true;
+}
+
 bool EssenceChunkHelper::HaveFilePosition(int64_t essence_offset)
 {
     if (mEssenceChunks.empty())
@@ -57,6 +57,38 @@ using namespace bmx;
 using namespace mxfpp;
 
 
+#define MAX_PREFETCH_AHEAD      32
+#define MIN_READ_QUEUE_POOL     4
+
+
+static bool parse_kl(const unsigned char *bytes, uint32_t size, mxfKey *key, uint8_t *llen, uint64_t *len)
+{
+    if (size < mxfKey_extlen + 1)
+        return false;
+    memcpy(key, bytes, mxfKey_extlen);
+
+    const unsigned char *l_bytes = &bytes[mxfKey_extlen];
+    if (l_bytes[0] < 0x80) {
+        *llen = 1;
+        *len  = l_bytes[0];
+        return true;
+    }
+
+    uint8_t num_bytes = l_bytes[0] & 0x7f;
+    if (num_bytes > 8 || size < mxfKey_extlen + 1 + (uint32_t)num_bytes)
+        return false;
+
+    uint64_t length = 0;
+    uint8_t i;
+    for (i = 0; i < num_bytes; i++)
+        length = (length << 8) | l_bytes[1 + i];
+
+    *llen = 1 + num_bytes;
+    *len  = length;
+    return true;
+}
+
+
 EssenceReaderBuffer::EssenceReaderBuffer(MXFFileReader *file_reader)
 {
     mFileReader = file_reader;
@@ -232,7 +264,234 @@ void EssenceReaderBuffer::ClearFromFrame(size_t offset)
 
 
 
-EssenceReader::EssenceReader(MXFFileReader *file_reader, bool file_is_complete, bool parse_only)
+EssenceReadQueue::EssenceReadQueue(File *file, uint32_t max_edit_units, uint64_t max_bytes)
+{
+    mFile = file;
+    mMaxEditUnits = max_edit_units;
+    mMaxBytes = max_bytes;
+    mStop = false;
+    mQueuedBytes = 0;
+
+    try
+    {
+        mThread = thread(&EssenceReadQueue::Run, this);
+    }
+    catch (...)
+    {
+        delete mFile;
+        throw;
+    }
+}
+
+EssenceReadQueue::~EssenceReadQueue()
+{
+    {
+        unique_lock<mutex> lock(mMutex);
+        ClearLocked(lock);
+        mStop = true;
+    }
+    mCondition.notify_all();
+    mThread.join();
+
+    // buffers still referenced by frames are deleted when the last frame releases them
+    size_t i;
+    for (i = 0; i < mBufferPool.size(); i++)
+        mBufferPool[i]->Release();
+
+    delete mFile;
+}
+
+bool EssenceReadQueue::IsEmpty()
+{
+    lock_guard<mutex> lock(mMutex);
+    return mEditUnits.empty();
+}
+
+int64_t EssenceReadQueue::GetNextPosition()
+{
+    lock_guard<mutex> lock(mMutex);
+    if (mEditUnits.empty())
+        return -1;
+    else
+        return mEditUnits.back().position + 1;
+}
+
+bool EssenceReadQueue::CanRequest(uint32_t size)
+{
+    lock_guard<mutex> lock(mMutex);
+    if (mMaxEditUnits > 0 && mEditUnits.size() >= mMaxEditUnits)
+        return false;
+
+    // always allow one edit unit so that edit units larger than the maximum bytes are still queued
+    return mMaxBytes == 0 || mEditUnits.empty() || mQueuedBytes + size <= mMaxBytes;
+}
+
+void EssenceReadQueue::Request(int64_t position, int64_t file_position, uint32_t size)
+{
+    {
+        lock_guard<mutex> lock(mMutex);
+        BMX_ASSERT(mEditUnits.empty() || mEditUnits.back().position + 1 == position);
+
+        QueuedEditUnit edit_unit;
+        edit_unit.position      = position;
+        edit_unit.file_position = file_position;
+        edit_unit.size          = size;
+        edit_unit.buffer        = 0;
+        edit_unit.state         = EDIT_UNIT_PENDING;
+        mEditUnits.push_back(edit_unit);
+        mQueuedBytes += size;
+    }
+    mCondition.notify_all();
+}
+
+SharedBuffer* EssenceReadQueue::Take(int64_t position, int64_t file_position, uint32_t size)
+{
+    unique_lock<mutex> lock(mMutex);
+
+    if (mEditUnits.empty() ||
+        mEditUnits.front().position != position ||
+        mEditUnits.front().file_position != file_position ||
+        mEditUnits.front().size != size)
+    {
+        ClearLocked(lock);
+        return 0;
+    }
+
+    while (mEditUnits.front().state == EDIT_UNIT_PENDING || mEditUnits.front().state == EDIT_UNIT_READING)
+        mCondition.wait(lock);
+
+    QueuedEditUnit edit_unit = mEditUnits.front();
+    mEditUnits.pop_front();
+    mQueuedBytes -= edit_unit.size;
+
+    // the caller falls back to reading from its own file and reports the error
+    if (edit_unit.state == EDIT_UNIT_FAILED) {
+        if (edit_unit.buffer)
+            edit_unit.buffer->Release();
+        ClearLocked(lock);
+        return 0;
+    }
+
+    return edit_unit.buffer;
+}
+
+void EssenceReadQueue::Invalidate(int64_t position)
+{
+    unique_lock<mutex> lock(mMutex);
+    if (!mEditUnits.empty() && mEditUnits.front().position != position)
+        ClearLocked(lock);
+}
+
+void EssenceReadQueue::Clear()
+{
+    unique_lock<mutex> lock(mMutex);
+    ClearLocked(lock);
+}
+
+void EssenceReadQueue::Run()
+{
+    unique_lock<mutex> lock(mMutex);
+    while (true) {
+        QueuedEditUnit *edit_unit = 0;
+        while (!mStop) {
+            size_t i;
+            for (i = 0; i < mEditUnits.size(); i++) {
+                if (mEditUnits[i].state == EDIT_UNIT_PENDING) {
+                    edit_unit = &mEditUnits[i];
+                    break;
+                }
+            }
+            if (edit_unit)
+                break;
+            mCondition.wait(lock);
+        }
+        if (mStop)
+            break;
+
+        // the edit unit reference remains valid whilst reading because the queue is only popped or cleared
+        // once the edit unit is no longer in the reading state and a deque push_back doesn't move elements
+        edit_unit->state = EDIT_UNIT_READING;
+        edit_unit->buffer = GetFreeBuffer();
+        SharedBuffer *buffer = edit_unit->buffer;
+        int64_t file_position = edit_unit->file_position;
+        uint32_t size = edit_unit->size;
+        lock.unlock();
+
+        bool success = false;
+        try
+        {
+            ByteArray *bytes = buffer->GetByteArray();
+            bytes->Allocate(size);
+            mFile->seek(file_position, SEEK_SET);
+            if (mFile->read(bytes->GetBytes(), size) == size) {
+                bytes->SetSize(size);
+                success = true;
+            }
+        }
+        catch (...)
+        {
+        }
+
+        lock.lock();
+        edit_unit->state = (success ? EDIT_UNIT_DONE : EDIT_UNIT_FAILED);
+        mCondition.notify_all();
+    }
+}
+
+SharedBuffer* EssenceReadQueue::GetFreeBuffer()
+{
+    // a pooled buffer is free when the pool holds the only reference
+    size_t i;
+    for (i = 0; i < mBufferPool.size(); i++) {
+        if (mBufferPool[i]->GetRefCount() == 1) {
+            mBufferPool[i]->AddRef();
+            return mBufferPool[i];
+        }
+    }
+
+    SharedBuffer *buffer = new SharedBuffer();
+    if (mBufferPool.size() < mEditUnits.size() + MIN_READ_QUEUE_POOL) {
+        buffer->AddRef();
+        mBufferPool.push_back(buffer);
+    }
+
+    return buffer;
+}
+
+void EssenceReadQueue::ClearLocked(unique_lock<mutex> &lock)
+{
+    // stop the reader from starting on pending edit units and wait for the current read to complete
+    size_t i;
+    for (i = 0; i < mEditUnits.size(); i++) {
+        if (mEditUnits[i].state == EDIT_UNIT_PENDING)
+            mEditUnits[i].state = EDIT_UNIT_FAILED;
+    }
+
+    bool reading = true;
+    while (reading) {
+        reading = false;
+        for (i = 0; i < mEditUnits.size(); i++) {
+            if (mEditUnits[i].state == EDIT_UNIT_READING) {
+                reading = true;
+                break;
+            }
+        }
+        if (reading)
+            mCondition.wait(lock);
+    }
+
+    for (i = 0; i < mEditUnits.size(); i++) {
+        if (mEditUnits[i].buffer)
+            mEditUnits[i].buffer->Release();
+    }
+    mEditUnits.clear();
+    mQueuedBytes = 0;
+}
+
+
+
+EssenceReader::EssenceReader(MXFFileReader *file_reader, bool file_is_complete, bool parse_only,
+                             File *index_cache_file)
 : mEssenceChunkHelper(file_reader), mIndexTableHelper(file_reader), mReadFrameBuffer(file_reader)
 {
     mFileReader = file_reader;
@@ -256,6 +515,10 @@ EssenceReader::EssenceReader(MXFFileReader *file_reader, bool file_is_complete,
     mLastKnownBasePosition = -1;
     mHaveFooter = file_is_complete;
     mBaseReadError = false;
+    mCPBuffer = 0;
+    mCanPrefetch = mFile->supportsPrefetch();
+    mPrefetchPosition = -1;
+    mReadQueue = 0;
 
 
     // get ImageStartOffset and ImageEndOffset properties which are used in Avid uncompressed files
@@ -282,18 +545,22 @@ EssenceReader::EssenceReader(MXFFileReader *file_reader, bool file_is_complete,
     }
 
     // if file is complete then read the index table segments, essence container layout and
-    // determine the essence wrapping type
+    // determine the essence wrapping type, or restore them from the index cache
     if (file_is_complete) {
-        if (mFileReader->mIndexSID)
-            mIndexTableHelper.ExtractIndexTable();
-
-        // first edit unit size is used to determine the essence wrapping type
-        int64_t first_edit_unit_size = 0;
-        if (mIndexTableHelper.HaveEditUnitSize(0)) {
-            int64_t offset;
-            mIndexTableHelper.GetEditUnit(0, &offset, &first_edit_unit_size);
+        if (index_cache_file) {
+            ReadIndexCache(index_cache_file);
+        } else {
+            if (mFileReader->mIndexSID)
+                mIndexTableHelper.ExtractIndexTable();
+
+            // first edit unit size is used to determine the essence wrapping type
+            int64_t first_edit_unit_size = 0;
+            if (mIndexTableHelper.HaveEditUnitSize(0)) {
+                int64_t offset;
+                mIndexTableHelper.GetEditUnit(0, &offset, &first_edit_unit_size);
+            }
+            mEssenceChunkHelper.CreateEssenceChunkIndex(first_edit_unit_size);
         }
-        mEssenceChunkHelper.CreateEssenceChunkIndex(first_edit_unit_size);
         BMX_ASSERT(mEssenceChunkHelper.IsComplete());
 
         // if the essence wrapping type still unknown then go with the guessed type
@@ -361,7 +628,27 @@ EssenceReader::EssenceReader(MXFFileReader *file_reader, bool file_is_complete,
 
 EssenceReader::~EssenceReader()
 {
+    delete mReadQueue;
     delete mFrameMetadataReader;
+    if (mCPBuffer)
+        mCPBuffer->Release();
+}
+
+bool EssenceReader::CanWriteIndexCache() const
+{
+    // the index cache only holds the state for a complete file with a complete index
+    return mFileIsComplete && mEssenceChunkHelper.IsComplete() && mIndexTableHelper.IsComplete();
+}
+
+void EssenceReader::WriteIndexCache(File *cache_file) const
+{
+    BMX_ASSERT(CanWriteIndexCache());
+
+    cache_file->writeUInt32(mFileReader->mBodySID);
+    cache_file->writeUInt32(mFileReader->mIndexSID);
+    cache_file->writeUInt8((uint8_t)mFileReader->mWrappingType);
+    mEssenceChunkHelper.WriteCache(cache_file);
+    mIndexTableHelper.WriteCache(cache_file);
 }
 
 void EssenceReader::SetReadLimits(int64_t start_position, int64_t duration)
@@ -382,6 +669,9 @@ void EssenceReader::SetReadLimits(int64_t start_position, int64_t duration)
         else
             mReadDuration = duration;
     }
+
+    if (mReadQueue)
+        mReadQueue->Clear();
 }
 
 void EssenceReader::SetBufferFrames(bool enable)
@@ -389,6 +679,29 @@ void EssenceReader::SetBufferFrames(bool enable)
     mReadFrameBuffer.SetBufferFrames(enable);
 }
 
+void EssenceReader::SetReadQueue(const string &filename, uint32_t max_edit_units, uint64_t max_bytes)
+{
+    delete mReadQueue;
+    mReadQueue = 0;
+
+    if (max_edit_units == 0 && max_bytes == 0)
+        return;
+
+    // the queue reads using its own file so that it is independent of the position in mFile
+    File *file;
+    try
+    {
+        file = mFileReader->mFileFactory->OpenReadAdditional(filename);
+    }
+    catch (...)
+    {
+        log_warn("Failed to open '%s' for the essence read queue\n", filename.c_str());
+        return;
+    }
+
+    mReadQueue = new EssenceReadQueue(file, max_edit_units, max_bytes);
+}
+
 uint32_t EssenceReader::Read(uint32_t num_samples)
 {
     uint32_t actual_read_num_samples = 0;
@@ -467,6 +780,8 @@ uint32_t EssenceReader::Read(uint32_t num_samples)
 void EssenceReader::Seek(int64_t position)
 {
     mPosition = position;
+    if (mReadQueue)
+        mReadQueue->Invalidate(position);
 }
 
 bool EssenceReader::GetIndexEntry(MXFIndexEntryExt *entry, int64_t position)
@@ -567,13 +882,22 @@ uint32_t EssenceReader::ReadFrameWrappedSamples(uint32_t num_samples)
 {
     int64_t start_position = mPosition;
 
-    map<uint32_t, MXFTrackReader*> enabled_track_readers;
+    // read the whole content package in one go if the size is known from the index and skipping over
+    // elements belonging to disabled tracks won't be cheaper
+    bool read_whole_cp = !mParseOnly;
     uint32_t i;
+    for (i = 0; i < mFileReader->GetNumInternalTrackReaders() && read_whole_cp; i++)
+        read_whole_cp = mFileReader->GetInternalTrackReader(i)->IsEnabled();
+
+    map<uint32_t, MXFTrackReader*> enabled_track_readers;
     for (i = 0; i < num_samples; i++) {
         int64_t cp_file_position;
         int64_t size;
         if (!SeekEssence(mPosition))
             return i;
+        PrefetchEditUnits(mPosition);
+        if (read_whole_cp)
+            QueueEditUnits(mPosition);
         if (mIndexTableHelper.HaveEditUnitSize(mPosition)) {
             mxfKey dummy_key = g_Null_Key;
             GetEditUnit(mPosition, &dummy_key, &cp_file_position, &size);
@@ -587,6 +911,12 @@ uint32_t EssenceReader::ReadFrameWrappedSamples(uint32_t num_samples)
             cp_file_position = mFilePosition;
         }
 
+        if (read_whole_cp && size > 0 && size <= UINT32_MAX && mNextKey == g_Null_Key) {
+            ReadContentPackage(start_position, cp_file_position, (uint32_t)size, &enabled_track_readers);
+            mPosition++;
+            continue;
+        }
+
         mxfKey key;
         uint8_t llen;
         uint64_t len;
@@ -599,39 +929,9 @@ uint32_t EssenceReader::ReadFrameWrappedSamples(uint32_t num_samples)
             bool processed_metadata = mFrameMetadataReader->ProcessFrameMetadata(&key, len);
 
             if (!processed_metadata && (mxf_is_gc_essence_element(&key) || mxf_avid_is_essence_element(&key))) {
-                uint32_t track_number = mxf_get_track_number(&key);
-                MXFTrackReader *track_reader = 0;
-                Frame *frame = 0;
-                if (enabled_track_readers.find(track_number) == enabled_track_readers.end()) {
-                    // frame does not yet exist - create it if track is enabled
-                    track_reader = mFileReader->GetInternalTrackReaderByNumber(track_number);
-                    if (start_position == mPosition && track_reader && track_reader->IsEnabled()) {
-                        frame = mReadFrameBuffer.GetFrame((uint32_t)track_reader->GetTrackIndex());
-
-                        BMX_CHECK(cp_num_read <= UINT32_MAX);
-
-                        frame->ec_position         = start_position;
-                        frame->cp_file_position    = cp_file_position;
-                        frame->file_position       = cp_file_position + cp_num_read - (mxfKey_extlen + llen);
-                        frame->kl_size             = mxfKey_extlen + llen;
-                        frame->file_id             = mFileReader->GetFileId();
-                        frame->element_key         = key;
-                        if (mIndexTableHelper.HaveEditUnit(start_position)) {
-                            frame->temporal_reordering =
-                                mIndexTableHelper.GetTemporalReordering((uint32_t)(cp_num_read - (mxfKey_extlen + llen)));
-                        }
-
-                        enabled_track_readers[track_number] = track_reader;
-                    } else {
-                        enabled_track_readers[track_number] = 0;
-                    }
-                } else {
-                    // frame exists if track is enabled - get it
-                    track_reader = enabled_track_readers[track_number];
-                    if (track_reader)
-                        frame = mReadFrameBuffer.GetFrame((uint32_t)track_reader->GetTrackIndex());
-                }
-
+                BMX_CHECK(cp_num_read <= UINT32_MAX);
+                Frame *frame = GetElementFrame(start_position, cp_file_position, cp_num_read - (mxfKey_extlen + llen),
+                                               &key, llen, &enabled_track_readers);
                 if (frame) {
                     BMX_CHECK(len <= UINT32_MAX);
                     frame->Grow((uint32_t)len);
@@ -670,6 +970,140 @@ uint32_t EssenceReader::ReadFrameWrappedSamples(uint32_t num_samples)
     return num_samples;
 }
 
+void EssenceReader::ReadContentPackage(int64_t start_position, int64_t cp_file_position, uint32_t size,
+                                       map<uint32_t, MXFTrackReader*> *enabled_track_readers)
+{
+    BMX_ASSERT(mAtCPStart && mNextKey == g_Null_Key);
+
+    try
+    {
+        bool moved_file_position = false;
+        SharedBuffer *queued_buffer = 0;
+        if (mReadQueue)
+            queued_buffer = mReadQueue->Take(mPosition, cp_file_position, size);
+        if (queued_buffer) {
+            if (mCPBuffer)
+                mCPBuffer->Release();
+            mCPBuffer = queued_buffer;
+            moved_file_position = true;
+        } else {
+            // frames may still be referencing the previous content package
+            if (mCPBuffer && mCPBuffer->GetRefCount() > 1) {
+                mCPBuffer->Release();
+                mCPBuffer = 0;
+            }
+            if (!mCPBuffer)
+                mCPBuffer = new SharedBuffer();
+
+            ByteArray *cp_buffer = mCPBuffer->GetByteArray();
+            cp_buffer->Allocate(size);
+            uint32_t num_read = mFile->read(cp_buffer->GetBytes(), size);
+            BMX_CHECK_NOLOG(num_read == size);
+            cp_buffer->SetSize(size);
+        }
+        ResetState();
+
+        const unsigned char *cp_bytes = mCPBuffer->GetByteArray()->GetBytes();
+        mxfKey key;
+        uint8_t llen;
+        uint64_t len;
+        uint32_t cp_num_read = 0;
+        while (cp_num_read < size) {
+            if (!parse_kl(&cp_bytes[cp_num_read], size - cp_num_read, &key, &llen, &len) ||
+                len > size - cp_num_read - (mxfKey_extlen + llen) ||
+                (cp_num_read > 0 && (mxf_equals_key(&key, &mEssenceStartKey) || mxf_is_partition_pack(&key))))
+            {
+                BMX_EXCEPTION(("Failed to parse content package with size 0x%x from index at file position 0x%" PRIx64,
+                               size, cp_file_position));
+            }
+
+            if (cp_num_read == 0) {
+                if (mEssenceStartKey == g_Null_Key)
+                    mEssenceStartKey = key;
+                else if (key != mEssenceStartKey)
+                    BMX_EXCEPTION(("First element in content package has different key than before"));
+            }
+
+            cp_num_read += mxfKey_extlen + llen;
+
+            // the frame metadata readers read the value from the file
+            if (mFrameMetadataReader->IsFrameMetadata(&key)) {
+                mFile->seek(cp_file_position + cp_num_read, SEEK_SET);
+                moved_file_position = true;
+            }
+            bool processed_metadata = mFrameMetadataReader->ProcessFrameMetadata(&key, len);
+
+            if (!processed_metadata && (mxf_is_gc_essence_element(&key) || mxf_avid_is_essence_element(&key))) {
+                Frame *frame = GetElementFrame(start_position, cp_file_position, cp_num_read - (mxfKey_extlen + llen),
+                                               &key, llen, enabled_track_readers);
+                if (frame) {
+                    SharedBufferFrame *shared_frame = dynamic_cast<SharedBufferFrame*>(frame);
+                    if (shared_frame && shared_frame->GetSize() == 0) {
+                        shared_frame->SetSharedBytes(mCPBuffer, cp_num_read, (uint32_t)len);
+                    } else {
+                        frame->Grow((uint32_t)len);
+                        memcpy(frame->GetBytesAvailable(), &cp_bytes[cp_num_read], (size_t)len);
+                        frame->IncrementSize((uint32_t)len);
+                    }
+                    frame->num_samples++;
+                }
+            }
+
+            cp_num_read += (uint32_t)len;
+        }
+
+        int64_t next_file_position = cp_file_position + size;
+        if (moved_file_position)
+            mFile->seek(next_file_position, SEEK_SET);
+
+        // avoid a seek when reading the next content package if it is known to follow on
+        if (GetIndexedFilePosition(mBasePosition + 1) == next_file_position)
+            SetContentPackageStart(mBasePosition + 1, next_file_position, true);
+    }
+    catch (...)
+    {
+        ResetState();
+        mBaseReadError = true;
+        throw;
+    }
+}
+
+Frame* EssenceReader::GetElementFrame(int64_t start_position, int64_t cp_file_position, int64_t kl_offset,
+                                      const mxfKey *key, uint8_t llen,
+                                      map<uint32_t, MXFTrackReader*> *enabled_track_readers)
+{
+    uint32_t track_number = mxf_get_track_number(key);
+    MXFTrackReader *track_reader = 0;
+    Frame *frame = 0;
+    if (enabled_track_readers->find(track_number) == enabled_track_readers->end()) {
+        // frame does not yet exist - create it if track is enabled
+        track_reader = mFileReader->GetInternalTrackReaderByNumber(track_number);
+        if (start_position == mPosition && track_reader && track_reader->IsEnabled()) {
+            frame = mReadFrameBuffer.GetFrame((uint32_t)track_reader->GetTrackIndex());
+
+            frame->ec_position         = start_position;
+            frame->cp_file_position    = cp_file_position;
+            frame->file_position       = cp_file_position + kl_offset;
+            frame->kl_size             = mxfKey_extlen + llen;
+            frame->file_id             = mFileReader->GetFileId();
+            frame->element_key         = *key;
+            if (mIndexTableHelper.HaveEditUnit(start_position))
+                frame->temporal_reordering = mIndexTableHelper.GetTemporalReordering((uint32_t)kl_offset);
+
+            (*enabled_track_readers)[track_number] = track_reader;
+        } else {
+            (*enabled_track_readers)[track_number] = 0;
+        }
+    } else {
+        // frame exists if track is enabled - get it
+        track_reader = (*enabled_track_readers)[track_number];
+        if (track_reader)
+            frame = mReadFrameBuffer.GetFrame((uint32_t)track_reader->GetTrackIndex());
+    }
+
+    return frame;
+}
+
 void EssenceReader::GetEditUnit(int64_t position, mxfKey *element_key, int64_t *file_position, int64_t *size)
 {
     int64_t essence_offset, essence_size;
@@ -679,6 +1113,59 @@ void EssenceReader::GetEditUnit(int64_t position, mxfKey *element_key, int64_t *
     *size = essence_size;
 }
 
+void EssenceReader::PrefetchEditUnits(int64_t position)
+{
+    if (!mCanPrefetch || !IsComplete())
+        return;
+
+    // hint the file to start reading the index-derived edit units that follow the current position
+    int64_t end_position = position + MAX_PREFETCH_AHEAD;
+    if (end_position > mIndexTableHelper.GetDuration())
+        end_position = mIndexTableHelper.GetDuration();
+    if (end_position - mReadStartPosition > mReadDuration)
+        end_position = mReadStartPosition + mReadDuration;
+
+    if (mPrefetchPosition <= position || mPrefetchPosition > end_position)
+        mPrefetchPosition = position + 1;
+
+    while (mPrefetchPosition < end_position && mIndexTableHelper.HaveEditUnitSize(mPrefetchPosition)) {
+        mxfKey dummy_key;
+        int64_t file_position;
+        int64_t size;
+        GetEditUnit(mPrefetchPosition, &dummy_key, &file_position, &size);
+        if (size <= 0 || size > UINT32_MAX || !mFile->prefetch(file_position, (uint32_t)size))
+            break;
+        mPrefetchPosition++;
+    }
+}
+
+void EssenceReader::QueueEditUnits(int64_t position)
+{
+    if (!mReadQueue || !IsComplete())
+        return;
+
+    int64_t end_position = mReadStartPosition + mReadDuration;
+    if (end_position > mIndexTableHelper.GetDuration())
+        end_position = mIndexTableHelper.GetDuration();
+
+    // request the edit units that follow the last queued edit unit, up to the queue limits
+    mReadQueue->Invalidate(position);
+    int64_t next_position = mReadQueue->GetNextPosition();
+    if (next_position < 0)
+        next_position = position;
+
+    while (next_position < end_position && mIndexTableHelper.HaveEditUnitSize(next_position)) {
+        mxfKey dummy_key;
+        int64_t file_position;
+        int64_t size;
+        GetEditUnit(next_position, &dummy_key, &file_position, &size);
+        if (size <= 0 || size > UINT32_MAX || !mReadQueue->CanRequest((uint32_t)size))
+            break;
+        mReadQueue->Request(next_position, file_position, (uint32_t)size);
+        next_position++;
+    }
+}
+
 void EssenceReader::GetEditUnitGroup(int64_t position, uint32_t max_samples, mxfKey *element_key, int64_t *file_position,
                                      int64_t *size, uint32_t *num_samples)
 {
@@ -789,6 +1276,18 @@ uint32_t EssenceReader::GetConstantEditUnitSize()
     return edit_unit_size;
 }
 
+void EssenceReader::ReadIndexCache(File *cache_file)
+{
+    uint32_t body_sid  = cache_file->readUInt32();
+    uint32_t index_sid = cache_file->readUInt32();
+    BMX_CHECK_M(body_sid == mFileReader->mBodySID && index_sid == mFileReader->mIndexSID,
+                ("Index cache BodySID %u / IndexSID %u does not match the file's %u / %u",
+                 body_sid, index_sid, mFileReader->mBodySID, mFileReader->mIndexSID));
+    mFileReader->mWrappingType = (MXFEssenceWrappingType)cache_file->readUInt8();
+    mEssenceChunkHelper.ReadCache(cache_file);
+    mIndexTableHelper.ReadCache(cache_file);
+}
+
 bool EssenceReader::SeekEssence(int64_t base_position)
 {
     try
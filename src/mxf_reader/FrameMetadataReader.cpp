@@ -82,11 +82,15 @@ void SystemScheme1Reader::Reset()
     mTrackNumbers.clear();
 }
 
+bool SystemScheme1Reader::IsFrameMetadata(const mxfKey *key)
+{
+    return mxf_equals_key_prefix(key, &SS1_KEY_PREFIX, 14) &&
+           (key->octet14 == 0x01 || key->octet14 == 0x02);
+}
+
 bool SystemScheme1Reader::ProcessFrameMetadata(const mxfKey *key, uint64_t len)
 {
-    if (!mxf_equals_key_prefix(key, &SS1_KEY_PREFIX, 14) ||
-        (key->octet14 != 0x01 && key->octet14 != 0x02))
-    {
+    if (!IsFrameMetadata(key)) {
         if (mxf_is_gc_essence_element(key))
             mTrackNumbers.push_back(mxf_get_track_number(key));
         return false;
@@ -191,9 +195,14 @@ void SDTICPSystemMetadataReader::Reset()
     mMetadata = 0;
 }
 
+bool SDTICPSystemMetadataReader::IsFrameMetadata(const mxfKey *key)
+{
+    return mxf_equals_key(key, &MXF_EE_K(SDTI_CP_System_Pack));
+}
+
 bool SDTICPSystemMetadataReader::ProcessFrameMetadata(const mxfKey *key, uint64_t len)
 {
-    if (!mxf_equals_key(key, &MXF_EE_K(SDTI_CP_System_Pack)))
+    if (!IsFrameMetadata(key))
         return false;
 
     delete mMetadata;
@@ -270,9 +279,14 @@ void SDTICPPackageMetadataReader::Reset()
     mMetadata = 0;
 }
 
+bool SDTICPPackageMetadataReader::IsFrameMetadata(const mxfKey *key)
+{
+    return mxf_equals_key_prefix(key, &SDTI_CP_PACKAGE_META_KEY_PREFIX, 15);
+}
+
 bool SDTICPPackageMetadataReader::ProcessFrameMetadata(const mxfKey *key, uint64_t len)
 {
-    if (!mxf_equals_key_prefix(key, &SDTI_CP_PACKAGE_META_KEY_PREFIX, 15))
+    if (!IsFrameMetadata(key))
         return false;
 
     delete mMetadata;
@@ -382,6 +396,16 @@ void FrameMetadataReader::Reset()
         mReaders[i]->Reset();
 }
 
+bool FrameMetadataReader::IsFrameMetadata(const mxfKey *key)
+{
+    size_t i;
+    for (i = 0; i < mReaders.size(); i++) {
+        if (mReaders[i]->IsFrameMetadata(key))
+            return true;
+    }
+    return false;
+}
+
 bool FrameMetadataReader::ProcessFrameMetadata(const mxfKey *key, uint64_t len)
 {
     bool result = false;
@@ -39,6 +39,8 @@
 #include <cstdio>
 #include <cstring>
 
+#include <algorithm>
+
 #include <libMXF++/MXF.h>
 
 #include <mxf/mxf_avid.h>
@@ -54,15 +56,15 @@ using namespace bmx;
 using namespace mxfpp;
 
 
-// temporal offset (1) + key frame offset (1) + flags (1) + stream offset (8)
+// stream offset (8) + temporal offset (1) + key frame offset (1) + flags (1)
 #define INTERNAL_INDEX_ENTRY_SIZE   11
 
 #define RUNTIME_INDEX_SEGMENT_SIZE  1500
 
-#define GET_TEMPORAL_OFFSET(pos)    (*((int8_t*)&mIndexEntries[(pos) * INTERNAL_INDEX_ENTRY_SIZE]))
-#define GET_KEY_FRAME_OFFSET(pos)   (*((int8_t*)&mIndexEntries[(pos) * INTERNAL_INDEX_ENTRY_SIZE + 1]))
-#define GET_FLAGS(pos)              (*((uint8_t*)&mIndexEntries[(pos) * INTERNAL_INDEX_ENTRY_SIZE + 2]))
-#define GET_STREAM_OFFSET(pos)      (*((int64_t*)&mIndexEntries[(pos) * INTERNAL_INDEX_ENTRY_SIZE + 3]))
+#define GET_STREAM_OFFSET(pos)      (mStreamOffsets[mEntriesStart + (pos)])
+#define GET_TEMPORAL_OFFSET(pos)    (mTemporalOffsets[mEntriesStart + (pos)])
+#define GET_KEY_FRAME_OFFSET(pos)   (mKeyFrameOffsets[mEntriesStart + (pos)])
+#define GET_FLAGS(pos)              (mFlags[mEntriesStart + (pos)])
 
 #define SEG_END(seg)    (seg->getIndexStartPosition() + seg->getIndexDuration())
 #define SEG_START(seg)  (seg->getIndexStartPosition())
@@ -94,6 +96,10 @@ IndexTableHelperSegment::IndexTableHelperSegment()
 : IndexTableSegment()
 {
     mIndexEntries = 0;
+    mStreamOffsets = 0;
+    mTemporalOffsets = 0;
+    mKeyFrameOffsets = 0;
+    mFlags = 0;
     mAllocIndexEntries = 0;
     mNumIndexEntries = 0;
     mEntriesStart = 0;
@@ -231,17 +237,16 @@ void IndexTableHelperSegment::AppendIndexEntry(uint32_t num_entries, int8_t temp
 {
     if (!mIndexEntries) {
         BMX_CHECK(num_entries > 0);
-        mIndexEntries = new unsigned char[INTERNAL_INDEX_ENTRY_SIZE * num_entries];
-        mAllocIndexEntries = num_entries;
+        AllocIndexEntries(num_entries);
     }
 
     BMX_CHECK(CanAppendIndexEntry());
 
-    int64_t entry_pos = mEntriesStart + mNumIndexEntries;
+    uint32_t entry_pos = mNumIndexEntries;
+    GET_STREAM_OFFSET(entry_pos)    = stream_offset;
     GET_TEMPORAL_OFFSET(entry_pos)  = temporal_offset;
     GET_KEY_FRAME_OFFSET(entry_pos) = key_frame_offset;
     GET_FLAGS(entry_pos)            = flags;
-    GET_STREAM_OFFSET(entry_pos)    = stream_offset;
 
     mNumIndexEntries++;
 }
@@ -284,6 +289,7 @@ void IndexTableHelperSegment::UpdateStartPosition(int64_t position)
     if (mHavePairedIndexEntries)
         diff_entries *= 2;
     mEntriesStart += diff_entries;
+    mNumIndexEntries -= diff_entries;
     setIndexStartPosition(position);
 }
 
@@ -307,14 +313,111 @@ void IndexTableHelperSegment::CopyIndexEntries(const IndexTableHelperSegment *fr
     uint32_t num_entries = duration;
     if (from_segment->mHavePairedIndexEntries)
         num_entries *= 2;
-
-    mIndexEntries = new unsigned char[INTERNAL_INDEX_ENTRY_SIZE * num_entries];
-    memcpy(mIndexEntries, from_segment->mIndexEntries, INTERNAL_INDEX_ENTRY_SIZE * num_entries);
-    mAllocIndexEntries = num_entries;
+    BMX_ASSERT(num_entries <= from_segment->mNumIndexEntries);
+
+    AllocIndexEntries(num_entries);
+    uint32_t from_start = from_segment->mEntriesStart;
+    memcpy(mStreamOffsets,   &from_segment->mStreamOffsets[from_start],   num_entries * sizeof(*mStreamOffsets));
+    memcpy(mTemporalOffsets, &from_segment->mTemporalOffsets[from_start], num_entries * sizeof(*mTemporalOffsets));
+    memcpy(mKeyFrameOffsets, &from_segment->mKeyFrameOffsets[from_start], num_entries * sizeof(*mKeyFrameOffsets));
+    memcpy(mFlags,           &from_segment->mFlags[from_start],           num_entries * sizeof(*mFlags));
     mNumIndexEntries = num_entries;
     mHavePairedIndexEntries = from_segment->mHavePairedIndexEntries;
 }
 
+void IndexTableHelperSegment::WriteCache(File *cache_file) const
+{
+    cache_file->writeInt64(getIndexStartPosition());
+    cache_file->writeInt64(getIndexDuration());
+    cache_file->writeInt32(getIndexEditRate().numerator);
+    cache_file->writeInt32(getIndexEditRate().denominator);
+    cache_file->writeUInt32(getEditUnitByteCount());
+    cache_file->writeInt64(mEssenceStartOffset);
+    cache_file->writeUInt8(mHaveExtraIndexEntries);
+    cache_file->writeInt64(mIndexEndOffset);
+    cache_file->writeUInt8(mHavePairedIndexEntries);
+    cache_file->writeUInt8(mIsFileIndexSegment);
+
+    uint32_t num_delta_entries = 0;
+    const MXFDeltaEntry *delta_entry = _cSegment->deltaEntryArray;
+    while (delta_entry) {
+        num_delta_entries++;
+        delta_entry = delta_entry->next;
+    }
+    cache_file->writeUInt32(num_delta_entries);
+    delta_entry = _cSegment->deltaEntryArray;
+    while (delta_entry) {
+        cache_file->writeInt8(delta_entry->posTableIndex);
+        cache_file->writeUInt8(delta_entry->slice);
+        cache_file->writeUInt32(delta_entry->elementData);
+        delta_entry = delta_entry->next;
+    }
+
+    // the index entry arrays are written in host byte order so that they can be read back with a single copy
+    cache_file->writeUInt32(mNumIndexEntries);
+    if (mNumIndexEntries > 0) {
+        uint32_t num_entries = mNumIndexEntries;
+        uint32_t offsets_size = num_entries * sizeof(*mStreamOffsets);
+        BMX_CHECK(cache_file->write((const unsigned char*)&GET_STREAM_OFFSET(0), offsets_size) == offsets_size);
+        BMX_CHECK(cache_file->write((const unsigned char*)&GET_TEMPORAL_OFFSET(0), num_entries) == num_entries);
+        BMX_CHECK(cache_file->write((const unsigned char*)&GET_KEY_FRAME_OFFSET(0), num_entries) == num_entries);
+        BMX_CHECK(cache_file->write(&GET_FLAGS(0), num_entries) == num_entries);
+    }
+}
+
+void IndexTableHelperSegment::ReadCache(File *cache_file)
+{
+    BMX_ASSERT(!mIndexEntries);
+
+    mxfRational edit_rate;
+    setIndexStartPosition(cache_file->readInt64());
+    setIndexDuration(cache_file->readInt64());
+    edit_rate.numerator   = cache_file->readInt32();
+    edit_rate.denominator = cache_file->readInt32();
+    setIndexEditRate(edit_rate);
+    setEditUnitByteCount(cache_file->readUInt32());
+    mEssenceStartOffset     = cache_file->readInt64();
+    mHaveExtraIndexEntries  = (cache_file->readUInt8() != 0);
+    mIndexEndOffset         = cache_file->readInt64();
+    mHavePairedIndexEntries = (cache_file->readUInt8() != 0);
+    mIsFileIndexSegment     = (cache_file->readUInt8() != 0);
+
+    uint32_t num_delta_entries = cache_file->readUInt32();
+    uint32_t i;
+    for (i = 0; i < num_delta_entries; i++) {
+        int8_t pos_table_index = cache_file->readInt8();
+        uint8_t slice = cache_file->readUInt8();
+        uint32_t element_data = cache_file->readUInt32();
+        appendDeltaEntry(pos_table_index, slice, element_data);
+    }
+
+    uint32_t num_entries = cache_file->readUInt32();
+    if (num_entries > 0) {
+        BMX_CHECK(num_entries <= UINT32_MAX / sizeof(*mStreamOffsets));
+        AllocIndexEntries(num_entries);
+        uint32_t offsets_size = num_entries * sizeof(*mStreamOffsets);
+        BMX_CHECK(cache_file->read((unsigned char*)mStreamOffsets, offsets_size) == offsets_size);
+        BMX_CHECK(cache_file->read((unsigned char*)mTemporalOffsets, num_entries) == num_entries);
+        BMX_CHECK(cache_file->read((unsigned char*)mKeyFrameOffsets, num_entries) == num_entries);
+        BMX_CHECK(cache_file->read(mFlags, num_entries) == num_entries);
+        mNumIndexEntries = num_entries;
+    }
+}
+
+void IndexTableHelperSegment::AllocIndexEntries(uint32_t num_entries)
+{
+    BMX_ASSERT(!mIndexEntries);
+
+    // the stream offsets are placed first to ensure they are 8-byte aligned
+    mIndexEntries     = new unsigned char[INTERNAL_INDEX_ENTRY_SIZE * (size_t)num_entries];
+    mStreamOffsets    = (int64_t*)mIndexEntries;
+    mTemporalOffsets  = (int8_t*)&mIndexEntries[sizeof(int64_t) * (size_t)num_entries];
+    mKeyFrameOffsets  = &mTemporalOffsets[num_entries];
+    mFlags            = (uint8_t*)&mKeyFrameOffsets[num_entries];
+    mAllocIndexEntries = num_entries;
+    mEntriesStart = 0;
+}
+
 
 
 
@@ -323,6 +426,7 @@ IndexTableHelper::IndexTableHelper(MXFFileReader *file_reader)
     mFileReader = file_reader;
     mFile = file_reader->mFile;
     mIsComplete = false;
+    mSegmentStartsValid = false;
     mLastEditUnitSegment = 0;
     mEditUnitSize = 0;
     mEssenceDataSize = 0;
@@ -428,6 +532,7 @@ void IndexTableHelper::SetConstantEditUnitSize(Rational edit_rate, uint32_t size
     IndexTableHelperSegment *segment = mSegments.back();
     segment->setIndexEditRate(edit_rate);
     segment->setEditUnitByteCount(size);
+    mSegmentStartsValid = false;
 
     mEditRate = edit_rate;
     mEditUnitSize = size;
@@ -498,6 +603,8 @@ void IndexTableHelper::UpdateIndex(int64_t position, int64_t essence_offset, int
             mSegments.back()->AppendIndexEntry(0, 0, 0, 0, essence_offset);
 
         mSegments.push_back(segment.release());
+        if (mSegmentStartsValid)
+            mSegmentStarts.push_back(position);
     }
 
     mDuration++;
@@ -522,37 +629,16 @@ void IndexTableHelper::GetEditUnit(int64_t position, int8_t *temporal_offset, in
     BMX_ASSERT(!mSegments.empty());
     BMX_CHECK(mDuration == 0 || position < mDuration);
 
+    if (!mSegmentStartsValid)
+        UpdateSegmentStarts();
+
+    // try the last used segment first because reads are mostly sequential
     int result = mSegments[mLastEditUnitSegment]->GetEditUnit(position, temporal_offset, key_frame_offset, flags,
                                                               offset);
     if (result < 0) {
-        // TODO: binary search
-        if (result == -2) {
-            // segment is before mLastEditUnitSegment
-            size_t i;
-            for (i = mLastEditUnitSegment; i > 0; i--) {
-                result = mSegments[i - 1]->GetEditUnit(position, temporal_offset, key_frame_offset, flags,
-                                                       offset);
-                if (result >= 0) {
-                    mLastEditUnitSegment = i - 1;
-                    break;
-                } else if (result == -1) {
-                    break;
-                }
-            }
-        } else {
-            // segment is after mLastEditUnitSegment
-            size_t i;
-            for (i = mLastEditUnitSegment + 1; i < mSegments.size(); i++) {
-                result = mSegments[i]->GetEditUnit(position, temporal_offset, key_frame_offset, flags,
-                                                   offset);
-                if (result >= 0) {
-                    mLastEditUnitSegment = i;
-                    break;
-                } else if (result == -2) {
-                    break;
-                }
-            }
-        }
+        mLastEditUnitSegment = FindSegment(position);
+        result = mSegments[mLastEditUnitSegment]->GetEditUnit(position, temporal_offset, key_frame_offset, flags,
+                                                              offset);
     }
     BMX_CHECK_M(result == 0,
                ("Failed to find edit unit index information for position 0x%" PRIx64, position));
@@ -638,6 +724,45 @@ bool IndexTableHelper::GetIndexEntry(MXFIndexEntryExt *entry, int64_t position)
     return true;
 }
 
+void IndexTableHelper::WriteCache(File *cache_file) const
+{
+    BMX_ASSERT(mIsComplete);
+
+    cache_file->writeInt32(mEditRate.numerator);
+    cache_file->writeInt32(mEditRate.denominator);
+    cache_file->writeInt64(mDuration);
+    cache_file->writeUInt32(mEditUnitSize);
+    cache_file->writeInt64(mEssenceDataSize);
+
+    cache_file->writeUInt32((uint32_t)mSegments.size());
+    size_t i;
+    for (i = 0; i < mSegments.size(); i++)
+        mSegments[i]->WriteCache(cache_file);
+}
+
+void IndexTableHelper::ReadCache(File *cache_file)
+{
+    BMX_ASSERT(mSegments.empty());
+
+    mEditRate.numerator   = cache_file->readInt32();
+    mEditRate.denominator = cache_file->readInt32();
+    mDuration             = cache_file->readInt64();
+    mEditUnitSize         = cache_file->readUInt32();
+    mEssenceDataSize      = cache_file->readInt64();
+
+    uint32_t num_segments = cache_file->readUInt32();
+    uint32_t i;
+    for (i = 0; i < num_segments; i++) {
+        unique_ptr<IndexTableHelperSegment> segment(new IndexTableHelperSegment());
+        segment->ReadCache(cache_file);
+        mSegments.push_back(segment.release());
+    }
+    mSegmentStartsValid = false;
+    mLastEditUnitSegment = 0;
+
+    mIsComplete = true;
+}
+
 void IndexTableHelper::InsertCBEIndexSegment(unique_ptr<IndexTableHelperSegment> &new_segment_up)
 {
     IndexTableHelperSegment *new_segment = new_segment_up.get();
@@ -658,6 +783,7 @@ void IndexTableHelper::InsertCBEIndexSegment(unique_ptr<IndexTableHelperSegment>
             // replace runtime generated index segment
             delete mSegments.front();
             mSegments.clear();
+            mSegmentStartsValid = false;
         } else {
             // existing CBE segments
 
@@ -681,6 +807,7 @@ void IndexTableHelper::InsertCBEIndexSegment(unique_ptr<IndexTableHelperSegment>
 
     mSegments.push_back(new_segment);
     new_segment_up.release();
+    mSegmentStartsValid = false;
 
     if (mSegments.size() == 1) {
         mEditUnitSize = new_segment->GetEditUnitSize();
@@ -759,6 +886,7 @@ void IndexTableHelper::InsertVBEIndexSegment(unique_ptr<IndexTableHelperSegment>
     }
 
     mDuration = new_duration;
+    mSegmentStartsValid = false;
 }
 
 IndexTableHelperSegment* IndexTableHelper::CreateStartSegment(IndexTableHelperSegment *segment, uint32_t duration)
@@ -772,3 +900,27 @@ IndexTableHelperSegment* IndexTableHelper::CreateStartSegment(IndexTableHelperSe
     return new_segment.release();
 }
 
+
+size_t IndexTableHelper::FindSegment(int64_t position)
+{
+    BMX_ASSERT(mSegmentStartsValid && !mSegmentStarts.empty());
+
+    // the segment is the last one starting at or before the position
+    vector<int64_t>::const_iterator iter = upper_bound(mSegmentStarts.begin(), mSegmentStarts.end(), position);
+    if (iter == mSegmentStarts.begin())
+        return 0;
+
+    return (size_t)(iter - mSegmentStarts.begin()) - 1;
+}
+
+void IndexTableHelper::UpdateSegmentStarts()
+{
+    mSegmentStarts.resize(mSegments.size());
+    size_t i;
+    for (i = 0; i < mSegments.size(); i++)
+        mSegmentStarts[i] = mSegments[i]->getIndexStartPosition();
+
+    if (mLastEditUnitSegment >= mSegments.size())
+        mLastEditUnitSegment = 0;
+    mSegmentStartsValid = true;
+}
@@ -41,9 +41,12 @@
 #include <algorithm>
 #include <memory>
 #include <set>
+#include <thread>
+#include <mutex>
 
 #include <bmx/mxf_reader/MXFFileReader.h>
 #include <bmx/mxf_reader/MXFTimedTextTrackReader.h>
+#include <bmx/mxf_reader/MXFIndexCache.h>
 #include <bmx/mxf_helper/PictureMXFDescriptorHelper.h>
 #include <bmx/mxf_helper/TimedTextMXFDescriptorHelper.h>
 #include <bmx/essence_parser/AVCEssenceParser.h>
@@ -133,6 +136,63 @@ static bool compare_track_reader(const MXFTrackReader *left_reader, const MXFTra
 
 
 
+typedef struct
+{
+    const vector<MXFFileReader*> *readers;
+    const vector<string> *filenames;
+    vector<File*> *files;
+    vector<MXFFileReader::OpenResult> *results;
+    int mode_flags;
+    size_t next_index;
+    bool have_failure;
+    mutex next_index_mutex;
+} OpenMultipleData;
+
+
+
+static MXFFileReader::OpenResult open_reader(MXFFileReader *reader, File *file, const string &filename,
+                                             int mode_flags)
+{
+    MXFFileReader::OpenResult result;
+    if (filename.empty())
+        result = reader->Open(file, URI("stdin:"), URI(), "");
+    else
+        result = reader->Open(file, filename, mode_flags);
+    if (result != MXFFileReader::MXF_RESULT_SUCCESS)
+        delete file;
+
+    return result;
+}
+
+static void open_multiple_worker(OpenMultipleData *data)
+{
+    while (true) {
+        size_t index;
+        File *file;
+        {
+            lock_guard<mutex> lock(data->next_index_mutex);
+            if (data->have_failure || data->next_index >= data->readers->size())
+                break;
+            index = data->next_index;
+            data->next_index++;
+            file = (*data->files)[index];
+            (*data->files)[index] = 0;
+        }
+
+        MXFFileReader::OpenResult result = MXFFileReader::MXF_RESULT_OPEN_FAIL;
+        if (file)
+            result = open_reader((*data->readers)[index], file, (*data->filenames)[index], data->mode_flags);
+        (*data->results)[index] = result;
+
+        if (result != MXFFileReader::MXF_RESULT_SUCCESS) {
+            lock_guard<mutex> lock(data->next_index_mutex);
+            data->have_failure = true;
+        }
+    }
+}
+
+
+
 string MXFFileReader::ResultToString(OpenResult result)
 {
     size_t index = (size_t)(result);
@@ -141,6 +201,57 @@ string MXFFileReader::ResultToString(OpenResult result)
     return RESULT_STRINGS[index];
 }
 
+vector<MXFFileReader::OpenResult> MXFFileReader::OpenMultiple(const vector<MXFFileReader*> &readers,
+                                                              const vector<string> &filenames,
+                                                              uint32_t num_threads, int mode_flags)
+{
+    BMX_ASSERT(readers.size() == filenames.size());
+
+    // the files are opened in order on this thread so that the file factory state, e.g. the order of
+    // input checksum files, doesn't depend on thread scheduling
+    vector<File*> files(readers.size(), 0);
+    vector<OpenResult> results(readers.size(), MXF_RESULT_OPEN_FAIL);
+    size_t i;
+    for (i = 0; i < readers.size(); i++) {
+        try
+        {
+            files[i] = readers[i]->mFileFactory->OpenRead(filenames[i]);
+        }
+        catch (...)
+        {
+            files[i] = 0;
+        }
+    }
+
+    // the partitions, header metadata and essence index are read concurrently
+    OpenMultipleData data;
+    data.readers    = &readers;
+    data.filenames  = &filenames;
+    data.files      = &files;
+    data.results    = &results;
+    data.mode_flags = mode_flags;
+    data.next_index = 0;
+    data.have_failure = false;
+
+    size_t num_workers = min((size_t)num_threads, readers.size());
+    if (num_workers <= 1) {
+        open_multiple_worker(&data);
+    } else {
+        vector<thread> workers;
+        for (i = 0; i < num_workers; i++)
+            workers.push_back(thread(open_multiple_worker, &data));
+        for (i = 0; i < workers.size(); i++)
+            workers[i].join();
+    }
+
+    // close the files that were not passed to a reader following a failure
+    for (i = 0; i < files.size(); i++)
+        delete files[i];
+
+    return results;
+}
+
+
 
 MXFFileReader::MXFFileReader()
 : MXFReader()
@@ -163,6 +274,9 @@ MXFFileReader::MXFFileReader()
     mReadDuration = -1;
     mFileOrigin = 0;
     mEnableIndexFile = true;
+    mEnableIndexCache = false;
+    mReadQueueMaxEditUnits = 0;
+    mReadQueueMaxBytes = 0;
     mEssenceReader = 0;
     mRequireFrameInfoCount = 0;
     mST436ManifestCount = 2;
@@ -256,6 +370,18 @@ void MXFFileReader::SetEnableIndexFile(bool enable)
     mEnableIndexFile = enable;
 }
 
+void MXFFileReader::SetIndexCache(bool enable, const string &cache_dir)
+{
+    mEnableIndexCache = enable;
+    mIndexCacheDir = cache_dir;
+}
+
+void MXFFileReader::SetReadQueue(uint32_t max_edit_units, uint64_t max_bytes)
+{
+    mReadQueueMaxEditUnits = max_edit_units;
+    mReadQueueMaxBytes = max_bytes;
+}
+
 MXFFileReader::OpenResult MXFFileReader::Open(string filename, int mode_flags)
 {
     File *file = 0;
@@ -348,8 +474,17 @@ MXFFileReader::OpenResult MXFFileReader::Open(File *file, const URI &abs_uri, co
         bool file_is_complete = false;
         Partition *metadata_partition = 0;
         bool own_metadata_partition = false;
+        unique_ptr<MXFIndexCache> index_cache;
+        bool read_index_cache = false;
         if (mEnableIndexFile) {
-            if (mFile->isSeekable()) {
+            if (mEnableIndexCache && mFile->isSeekable() && !filename.empty() && !mxf_http_is_url(filename)) {
+                index_cache.reset(new MXFIndexCache(MXFIndexCache::GetCacheFilename(mIndexCacheDir,
+                                                                                    abs_uri.ToFilename()),
+                                                    filename));
+                read_index_cache = index_cache->Read(mFile);
+                file_is_complete = read_index_cache;
+            }
+            if (!read_index_cache && mFile->isSeekable()) {
                 file_is_complete = mFile->readPartitions();
                 if (!file_is_complete) {
                     BMX_ASSERT(mFile->getPartitions().size() == 1);
@@ -434,7 +569,52 @@ MXFFileReader::OpenResult MXFFileReader::Open(File *file, const URI &abs_uri, co
 
         // create internal essence reader
         if (!mInternalTrackReaders.empty() && mBodySID != 0) {
-            mEssenceReader = new EssenceReader(this, file_is_complete, mOpenModeFlags & MXF_MODE_PARSE_ONLY);
+            if (read_index_cache) {
+                MXFEssenceWrappingType wrapping_type = mWrappingType;
+                try
+                {
+                    mEssenceReader = new EssenceReader(this, file_is_complete, mOpenModeFlags & MXF_MODE_PARSE_ONLY,
+                                                       index_cache->GetReadFile());
+                }
+                catch (const MXFException &ex)
+                {
+                    log_warn("Failed to restore essence index from index cache: %s\n", ex.getMessage().c_str());
+                }
+                catch (const BMXException &ex)
+                {
+                    log_warn("Failed to restore essence index from index cache: %s\n", ex.what());
+                }
+                catch (...)
+                {
+                    log_warn("Failed to restore essence index from index cache\n");
+                }
+                index_cache->CloseRead();
+
+                if (!mEssenceReader) {
+                    // fall back to reading the partitions and index from the file and re-writing the cache
+                    mWrappingType = wrapping_type;
+                    read_index_cache = false;
+                    file_is_complete = mFile->readPartitions();
+                    if (!file_is_complete) {
+                        mxfKey key;
+                        uint8_t llen;
+                        uint64_t len;
+                        mFile->seek(header_partition.getThisPartition(), SEEK_SET);
+                        mFile->readKL(&key, &llen, &len);
+                        mFile->skip(len);
+                    }
+                }
+            }
+            if (!mEssenceReader) {
+                mEssenceReader = new EssenceReader(this, file_is_complete, mOpenModeFlags & MXF_MODE_PARSE_ONLY);
+                if (index_cache.get() && file_is_complete)
+                    index_cache->Write(mFile, mEssenceReader);
+            }
+            if ((mReadQueueMaxEditUnits > 0 || mReadQueueMaxBytes > 0) && IsFrameWrapped() &&
+                mFile->isSeekable() && !filename.empty() && !mxf_http_is_url(filename))
+            {
+                mEssenceReader->SetReadQueue(filename, mReadQueueMaxEditUnits, mReadQueueMaxBytes);
+            }
 
             CheckRequireFrameInfo();
             if (mRequireFrameInfoCount > 0)
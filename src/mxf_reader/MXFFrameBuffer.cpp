@@ -138,10 +138,18 @@ Frame* MXFFrameBuffer::CreateFrame()
         return mTargetBuffer->CreateFrame();
 }
 
+void MXFFrameBuffer::DeleteFrame(Frame *frame)
+{
+    if (mUseTemporaryBuffer)
+        mTemporaryBuffer.DeleteFrame(frame);
+    else
+        mTargetBuffer->DeleteFrame(frame);
+}
+
 void MXFFrameBuffer::PushFrame(Frame *frame)
 {
     if (frame->IsEmpty() && !mEmptyFrames) {
-        delete frame;
+        DeleteFrame(frame);
         return;
     }
 
@@ -37,6 +37,9 @@
 
 #include <algorithm>
 #include <set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <bmx/mxf_reader/MXFGroupReader.h>
 #include <bmx/mxf_reader/MXFFileReader.h>
@@ -63,6 +66,143 @@ typedef struct
 } GroupTrackReader;
 
 
+namespace bmx
+{
+class MXFGroupMemberReadWorker
+{
+public:
+    MXFGroupMemberReadWorker(MXFReader *reader);
+    ~MXFGroupMemberReadWorker();
+
+    void StartRead(int64_t position, uint32_t num_samples);
+    uint32_t CompleteRead(bool *read_error, string *read_error_message);
+
+private:
+    void Run();
+
+private:
+    MXFReader *mReader;
+
+    mutex mMutex;
+    condition_variable mCondition;
+    bool mStop;
+    bool mHaveRequest;
+    bool mHaveResult;
+
+    int64_t mPosition;
+    uint32_t mNumSamples;
+    uint32_t mNumRead;
+    bool mReadError;
+    string mReadErrorMessage;
+
+    thread mThread;
+};
+};
+
+
+
+MXFGroupMemberReadWorker::MXFGroupMemberReadWorker(MXFReader *reader)
+{
+    mReader = reader;
+    mStop = false;
+    mHaveRequest = false;
+    mHaveResult = false;
+    mPosition = 0;
+    mNumSamples = 0;
+    mNumRead = 0;
+    mReadError = false;
+
+    mThread = thread(&MXFGroupMemberReadWorker::Run, this);
+}
+
+MXFGroupMemberReadWorker::~MXFGroupMemberReadWorker()
+{
+    {
+        lock_guard<mutex> lock(mMutex);
+        mStop = true;
+    }
+    mCondition.notify_all();
+    mThread.join();
+}
+
+void MXFGroupMemberReadWorker::StartRead(int64_t position, uint32_t num_samples)
+{
+    {
+        lock_guard<mutex> lock(mMutex);
+        BMX_ASSERT(!mHaveRequest && !mHaveResult);
+        mPosition = position;
+        mNumSamples = num_samples;
+        mHaveRequest = true;
+    }
+    mCondition.notify_all();
+}
+
+uint32_t MXFGroupMemberReadWorker::CompleteRead(bool *read_error, string *read_error_message)
+{
+    unique_lock<mutex> lock(mMutex);
+    while (!mHaveResult)
+        mCondition.wait(lock);
+    mHaveResult = false;
+
+    *read_error = mReadError;
+    *read_error_message = mReadErrorMessage;
+    return mNumRead;
+}
+
+void MXFGroupMemberReadWorker::Run()
+{
+    unique_lock<mutex> lock(mMutex);
+    while (true) {
+        while (!mStop && !mHaveRequest)
+            mCondition.wait(lock);
+        if (mStop)
+            break;
+
+        int64_t position = mPosition;
+        uint32_t num_samples = mNumSamples;
+        mHaveRequest = false;
+        lock.unlock();
+
+        uint32_t num_read = 0;
+        bool read_error = false;
+        string read_error_message;
+        try
+        {
+            // ensure member reader is in sync
+            if (mReader->GetPosition() != position)
+                mReader->Seek(position);
+
+            num_read = mReader->Read(num_samples, false);
+            if (num_read < num_samples && mReader->ReadError()) {
+                read_error = true;
+                read_error_message = mReader->ReadErrorMessage();
+            }
+        }
+        catch (const MXFException &ex)
+        {
+            read_error = true;
+            read_error_message = ex.getMessage();
+        }
+        catch (const BMXException &ex)
+        {
+            read_error = true;
+            read_error_message = ex.what();
+        }
+        catch (...)
+        {
+            read_error = true;
+        }
+
+        lock.lock();
+        mNumRead = num_read;
+        mReadError = read_error;
+        mReadErrorMessage = read_error_message;
+        mHaveResult = true;
+        mCondition.notify_all();
+    }
+}
+
+
 
 static bool compare_group_track_reader(const GroupTrackReader &left_reader, const GroupTrackReader &right_reader)
 {
@@ -102,10 +242,13 @@ MXFGroupReader::MXFGroupReader()
     mEmptyFramesSet = false;
     mReadStartPosition = 0;
     mReadDuration = -1;
+    mParallelRead = false;
 }
 
 MXFGroupReader::~MXFGroupReader()
 {
+    StopReadWorkers();
+
     size_t i;
     for (i = 0; i < mReaders.size(); i++)
         delete mReaders[i];
@@ -137,6 +280,13 @@ void MXFGroupReader::AddReader(MXFReader *reader)
     mReaders.push_back(reader);
 }
 
+void MXFGroupReader::SetParallelRead(bool enable)
+{
+    if (!enable)
+        StopReadWorkers();
+    mParallelRead = enable;
+}
+
 bool MXFGroupReader::Finalize()
 {
     try
@@ -402,36 +552,11 @@ uint32_t MXFGroupReader::Read(uint32_t num_samples, bool is_top)
             SetNextFrameTrackPositions();
         }
 
-        uint32_t max_read_num_samples = 0;
-        size_t i;
-        for (i = 0; i < mReaders.size(); i++) {
-            if (!mReaders[i]->IsEnabled())
-                continue;
-
-            int64_t member_current_position = CONVERT_GROUP_POS(current_position);
-
-            // ensure external reader is in sync
-            if (mReaders[i]->GetPosition() != member_current_position)
-                mReaders[i]->Seek(member_current_position);
-
-
-            uint32_t member_num_samples = (uint32_t)convert_duration_higher(num_samples,
-                                                                            current_position,
-                                                                            mSampleSequences[i],
-                                                                            mSampleSequenceSizes[i]);
-
-            uint32_t member_num_read = mReaders[i]->Read(member_num_samples, false);
-            if (member_num_read < member_num_samples && mReaders[i]->ReadError())
-                throw BMXException(mReaders[i]->ReadErrorMessage());
-
-            uint32_t group_num_read = (uint32_t)convert_duration_lower(member_num_read,
-                                                                       member_current_position,
-                                                                       mSampleSequences[i],
-                                                                       mSampleSequenceSizes[i]);
-
-            if (group_num_read > max_read_num_samples)
-                max_read_num_samples = group_num_read;
-        }
+        uint32_t max_read_num_samples;
+        if (mParallelRead)
+            max_read_num_samples = ParallelReadMembers(num_samples, current_position);
+        else
+            max_read_num_samples = ReadMembers(num_samples, current_position);
 
         CompleteRead();
 
@@ -696,6 +821,104 @@ void MXFGroupReader::SetTemporaryFrameBuffer(bool enable)
         mReaders[i]->SetTemporaryFrameBuffer(enable);
 }
 
+uint32_t MXFGroupReader::ReadMembers(uint32_t num_samples, int64_t current_position)
+{
+    uint32_t max_read_num_samples = 0;
+    size_t i;
+    for (i = 0; i < mReaders.size(); i++) {
+        if (!mReaders[i]->IsEnabled())
+            continue;
+
+        int64_t member_current_position = CONVERT_GROUP_POS(current_position);
+
+        // ensure external reader is in sync
+        if (mReaders[i]->GetPosition() != member_current_position)
+            mReaders[i]->Seek(member_current_position);
+
+
+        uint32_t member_num_samples = (uint32_t)convert_duration_higher(num_samples,
+                                                                        current_position,
+                                                                        mSampleSequences[i],
+                                                                        mSampleSequenceSizes[i]);
+
+        uint32_t member_num_read = mReaders[i]->Read(member_num_samples, false);
+        if (member_num_read < member_num_samples && mReaders[i]->ReadError())
+            throw BMXException(mReaders[i]->ReadErrorMessage());
+
+        uint32_t group_num_read = (uint32_t)convert_duration_lower(member_num_read,
+                                                                   member_current_position,
+                                                                   mSampleSequences[i],
+                                                                   mSampleSequenceSizes[i]);
+
+        if (group_num_read > max_read_num_samples)
+            max_read_num_samples = group_num_read;
+    }
+
+    return max_read_num_samples;
+}
+
+uint32_t MXFGroupReader::ParallelReadMembers(uint32_t num_samples, int64_t current_position)
+{
+    size_t i;
+    if (mReadWorkers.size() != mReaders.size()) {
+        StopReadWorkers();
+        for (i = 0; i < mReaders.size(); i++)
+            mReadWorkers.push_back(new MXFGroupMemberReadWorker(mReaders[i]));
+    }
+
+    vector<uint32_t> member_num_samples(mReaders.size(), 0);
+    for (i = 0; i < mReaders.size(); i++) {
+        if (!mReaders[i]->IsEnabled())
+            continue;
+
+        member_num_samples[i] = (uint32_t)convert_duration_higher(num_samples,
+                                                                  current_position,
+                                                                  mSampleSequences[i],
+                                                                  mSampleSequenceSizes[i]);
+        mReadWorkers[i]->StartRead(CONVERT_GROUP_POS(current_position), member_num_samples[i]);
+    }
+
+    // wait for all members to complete before reporting an error so that no worker is left reading
+    uint32_t max_read_num_samples = 0;
+    bool have_error = false;
+    string error_message;
+    for (i = 0; i < mReaders.size(); i++) {
+        if (!mReaders[i]->IsEnabled())
+            continue;
+
+        bool member_read_error;
+        string member_read_error_message;
+        uint32_t member_num_read = mReadWorkers[i]->CompleteRead(&member_read_error, &member_read_error_message);
+        if (member_read_error) {
+            if (!have_error) {
+                have_error = true;
+                error_message = member_read_error_message;
+            }
+            continue;
+        }
+
+        uint32_t group_num_read = (uint32_t)convert_duration_lower(member_num_read,
+                                                                   CONVERT_GROUP_POS(current_position),
+                                                                   mSampleSequences[i],
+                                                                   mSampleSequenceSizes[i]);
+
+        if (group_num_read > max_read_num_samples)
+            max_read_num_samples = group_num_read;
+    }
+    if (have_error)
+        throw BMXException(error_message);
+
+    return max_read_num_samples;
+}
+
+void MXFGroupReader::StopReadWorkers()
+{
+    size_t i;
+    for (i = 0; i < mReadWorkers.size(); i++)
+        delete mReadWorkers[i];
+    mReadWorkers.clear();
+}
+
 void MXFGroupReader::StartRead()
 {
     size_t i;
@@ -0,0 +1,367 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#define __STDC_FORMAT_MACROS
+#define __STDC_LIMIT_MACROS
+
+#include <cstdio>
+#include <cerrno>
+#include <cstring>
+
+#include <algorithm>
+#include <memory>
+
+#include <bmx/mxf_reader/MXFIndexCache.h>
+#include <bmx/mxf_reader/EssenceReader.h>
+#include <bmx/MXFChecksumFile.h>
+#include <bmx/ByteArray.h>
+#include <bmx/MD5.h>
+#include <bmx/Utils.h>
+#include <bmx/BMXException.h>
+#include <bmx/Logging.h>
+
+#if defined(_WIN32)
+#include <mxf/mxf_win32_file.h>
+#if !defined(__MINGW32__)
+#include <mxf/mxf_win32_mmap.h>
+#endif
+#else
+#include <mxf/mxf_posix_mmap.h>
+#endif
+
+using namespace std;
+using namespace bmx;
+using namespace mxfpp;
+
+
+#define CACHE_VERSION       2
+#define BYTE_ORDER_MARKER   0x01020304
+
+// the size of the file header and footer that is hashed to detect a modified file
+#define KEY_HASH_SIZE       (64 * 1024)
+
+// the MD5 digest of the cache file content that precedes it and the end marker
+#define CACHE_DIGEST_SIZE   16
+
+#define CACHE_SUFFIX        ".bmxidx"
+
+static const unsigned char CACHE_MAGIC[8]      = {'B', 'M', 'X', 'I', 'D', 'X', 'C', '\n'};
+static const unsigned char CACHE_END_MAGIC[8]  = {'B', 'M', 'X', 'I', 'D', 'X', 'E', '\n'};
+
+
+
+static void hash_file_range(File *mxf_file, int64_t start, int64_t size, bmx::ByteArray *buffer,
+                            MD5Context *md5_context)
+{
+    mxf_file->seek(start, SEEK_SET);
+    while (size > 0) {
+        uint32_t count = (uint32_t)min(size, (int64_t)buffer->GetAllocatedSize());
+        BMX_CHECK(mxf_file->read(buffer->GetBytes(), count) == count);
+        md5_update(md5_context, buffer->GetBytes(), count);
+        size -= count;
+    }
+}
+
+
+
+string MXFIndexCache::GetCacheFilename(const string &cache_dir, const string &filename)
+{
+    if (cache_dir.empty())
+        return filename + CACHE_SUFFIX;
+
+    // include a hash of the full filename to avoid clashes between files with the same name in different directories
+    MD5Context md5_context;
+    unsigned char digest[16];
+    md5_init(&md5_context);
+    md5_update(&md5_context, (const unsigned char*)filename.c_str(), (uint32_t)filename.size());
+    md5_final(digest, &md5_context);
+
+    string cache_filename = cache_dir;
+    if (!check_ends_with_dir_separator(cache_filename))
+        cache_filename.append("/");
+    cache_filename.append(strip_path(filename)).append(".");
+    cache_filename.append(md5_digest_str(digest).substr(0, 16));
+    cache_filename.append(CACHE_SUFFIX);
+
+    return cache_filename;
+}
+
+MXFIndexCache::MXFIndexCache(const string &cache_filename, const string &filename)
+{
+    mCacheFilename = cache_filename;
+    mFilename = filename;
+    mCacheFile = 0;
+    mFileSize = -1;
+    mFileModTime = 0;
+    memset(mFileDigest, 0, sizeof(mFileDigest));
+}
+
+MXFIndexCache::~MXFIndexCache()
+{
+    CloseRead();
+}
+
+bool MXFIndexCache::Read(File *mxf_file)
+{
+    if (!check_file_exists(mCacheFilename))
+        return false;
+
+    vector<Partition*> partitions;
+    try
+    {
+        MXFFile *cache_cfile = 0;
+#if defined(_WIN32)
+#if !defined(__MINGW32__)
+        BMX_CHECK(mxf_win32_mmap_open_read(mCacheFilename.c_str(), MXF_WIN32_FLAG_SEQUENTIAL_SCAN, &cache_cfile));
+#else
+        BMX_CHECK(mxf_win32_file_open_read(mCacheFilename.c_str(), MXF_WIN32_FLAG_SEQUENTIAL_SCAN, &cache_cfile));
+#endif
+#else
+        BMX_CHECK(mxf_posix_mmap_open_read(mCacheFilename.c_str(), MXF_POSIX_FLAG_SEQUENTIAL_SCAN, &cache_cfile));
+#endif
+        mCacheFile = new File(cache_cfile);
+
+        // a cache file without the end marker was not completely written
+        unsigned char magic[sizeof(CACHE_MAGIC)];
+        BMX_CHECK(mCacheFile->size() >= (int64_t)(sizeof(CACHE_MAGIC) + CACHE_DIGEST_SIZE + sizeof(CACHE_END_MAGIC)));
+        mCacheFile->seek(mCacheFile->size() - sizeof(CACHE_END_MAGIC), SEEK_SET);
+        BMX_CHECK(mCacheFile->read(magic, sizeof(magic)) == sizeof(magic));
+        BMX_CHECK_M(memcmp(magic, CACHE_END_MAGIC, sizeof(magic)) == 0,
+                    ("Index cache is incomplete"));
+
+        mCacheFile->seek(0, SEEK_SET);
+        BMX_CHECK(mCacheFile->read(magic, sizeof(magic)) == sizeof(magic));
+        BMX_CHECK_M(memcmp(magic, CACHE_MAGIC, sizeof(magic)) == 0,
+                    ("Not an index cache file"));
+
+        uint32_t version = mCacheFile->readUInt32();
+        uint32_t byte_order;
+        BMX_CHECK(mCacheFile->read((unsigned char*)&byte_order, sizeof(byte_order)) == sizeof(byte_order));
+        if (version != CACHE_VERSION || byte_order != BYTE_ORDER_MARKER) {
+            log_info("Ignoring index cache '%s' written by an incompatible version or platform\n",
+                     mCacheFilename.c_str());
+            CloseRead();
+            return false;
+        }
+
+        CalcFileKey(mxf_file);
+
+        // the modification time has a 1 second resolution and so the digest is always checked as well
+        int64_t file_size     = mCacheFile->readInt64();
+        int64_t file_mod_time = mCacheFile->readInt64();
+        unsigned char file_digest[16];
+        BMX_CHECK(mCacheFile->read(file_digest, sizeof(file_digest)) == sizeof(file_digest));
+        if (file_size != mFileSize ||
+            file_mod_time != mFileModTime ||
+            memcmp(file_digest, mFileDigest, sizeof(file_digest)) != 0)
+        {
+            log_info("Ignoring stale index cache '%s'\n", mCacheFilename.c_str());
+            CloseRead();
+            return false;
+        }
+
+        // check the cache content is intact before restoring anything from it
+        int64_t content_pos = mCacheFile->tell();
+        int64_t digest_pos = mCacheFile->size() - sizeof(CACHE_END_MAGIC) - CACHE_DIGEST_SIZE;
+        unsigned char cache_digest[CACHE_DIGEST_SIZE];
+        unsigned char calc_cache_digest[CACHE_DIGEST_SIZE];
+        bmx::ByteArray buffer(KEY_HASH_SIZE);
+        MD5Context md5_context;
+        md5_init(&md5_context);
+        hash_file_range(mCacheFile, 0, digest_pos, &buffer, &md5_context);
+        md5_final(calc_cache_digest, &md5_context);
+        BMX_CHECK(mCacheFile->read(cache_digest, sizeof(cache_digest)) == sizeof(cache_digest));
+        BMX_CHECK_M(memcmp(cache_digest, calc_cache_digest, sizeof(cache_digest)) == 0,
+                    ("Index cache content digest mismatch"));
+        mCacheFile->seek(content_pos, SEEK_SET);
+
+        // restore the partitions following the header partition
+        BMX_CHECK(mxf_file->getPartitions().size() == 1);
+        uint32_t num_partitions = mCacheFile->readUInt32();
+        uint32_t i;
+        for (i = 0; i < num_partitions; i++) {
+            mxfKey key;
+            uint8_t llen;
+            uint64_t len;
+            mCacheFile->readKL(&key, &llen, &len);
+            BMX_CHECK(mxf_is_partition_pack(&key));
+            partitions.push_back(Partition::read(mCacheFile, &key, len));
+        }
+        for (i = 0; i < partitions.size(); i++)
+            mxf_file->appendPartition(partitions[i]);
+        // the cache file is positioned at the essence reader state read by EssenceReader
+
+        log_debug("Read index cache '%s'\n", mCacheFilename.c_str());
+        return true;
+    }
+    catch (const BMXException &ex)
+    {
+        log_warn("Failed to read index cache '%s': %s\n", mCacheFilename.c_str(), ex.what());
+    }
+    catch (...)
+    {
+        log_warn("Failed to read index cache '%s'\n", mCacheFilename.c_str());
+    }
+
+    size_t i;
+    for (i = 0; i < partitions.size(); i++)
+        delete partitions[i];
+    CloseRead();
+
+    return false;
+}
+
+void MXFIndexCache::CloseRead()
+{
+    delete mCacheFile;
+    mCacheFile = 0;
+}
+
+bool MXFIndexCache::Write(File *mxf_file, const EssenceReader *essence_reader)
+{
+    if (!essence_reader->CanWriteIndexCache()) {
+        log_debug("Not writing index cache '%s' because the essence index is incomplete\n", mCacheFilename.c_str());
+        return false;
+    }
+
+    // write to a temporary file and rename so that concurrent readers never see a partially written cache
+    string temp_filename = mCacheFilename + "." + get_uuid_string(generate_uuid()) + ".tmp";
+    File *cache_file = 0;
+    MXFChecksumFile *checksum_file = 0;
+    int64_t file_position = mxf_file->tell();
+    try
+    {
+        if (mFileSize < 0)
+            CalcFileKey(mxf_file);
+
+        MXFFile *cache_cfile = 0;
+        BMX_CHECK_M(mxf_disk_file_open_new(temp_filename.c_str(), &cache_cfile),
+                    ("Failed to create file"));
+        try
+        {
+            checksum_file = mxf_checksum_file_open(cache_cfile, MD5_CHECKSUM);
+        }
+        catch (...)
+        {
+            mxf_file_close(&cache_cfile);
+            throw;
+        }
+        cache_file = new File(mxf_checksum_file_get_file(checksum_file));
+
+        uint32_t byte_order = BYTE_ORDER_MARKER;
+        BMX_CHECK(cache_file->write(CACHE_MAGIC, sizeof(CACHE_MAGIC)) == sizeof(CACHE_MAGIC));
+        cache_file->writeUInt32(CACHE_VERSION);
+        BMX_CHECK(cache_file->write((const unsigned char*)&byte_order, sizeof(byte_order)) == sizeof(byte_order));
+        cache_file->writeInt64(mFileSize);
+        cache_file->writeInt64(mFileModTime);
+        BMX_CHECK(cache_file->write(mFileDigest, sizeof(mFileDigest)) == sizeof(mFileDigest));
+
+        // copy the partition packs following the header partition pack
+        const vector<Partition*> &partitions = mxf_file->getPartitions();
+        uint16_t runin_len = mxf_get_runin_len(mxf_file->getCFile());
+        bmx::ByteArray buffer;
+        cache_file->writeUInt32((uint32_t)(partitions.size() - 1));
+        size_t i;
+        for (i = 1; i < partitions.size(); i++) {
+            mxfKey key;
+            uint8_t llen;
+            uint64_t len;
+            mxf_file->seek(runin_len + partitions[i]->getThisPartition(), SEEK_SET);
+            mxf_file->readKL(&key, &llen, &len);
+            BMX_CHECK(len <= UINT32_MAX);
+            buffer.Allocate((uint32_t)len);
+            BMX_CHECK(mxf_file->read(buffer.GetBytes(), (uint32_t)len) == len);
+            cache_file->writeFixedKL(&key, llen, len);
+            BMX_CHECK(cache_file->write(buffer.GetBytes(), (uint32_t)len) == len);
+        }
+
+        essence_reader->WriteIndexCache(cache_file);
+
+        unsigned char cache_digest[CACHE_DIGEST_SIZE];
+        BMX_CHECK(mxf_checksum_file_final(checksum_file));
+        mxf_checksum_file_digest(checksum_file, cache_digest, sizeof(cache_digest));
+        // the digest and end marker are not part of the checksum and are written to the underlying file
+        BMX_CHECK(mxf_file_write(cache_cfile, cache_digest, sizeof(cache_digest)) == sizeof(cache_digest));
+        BMX_CHECK(mxf_file_write(cache_cfile, CACHE_END_MAGIC, sizeof(CACHE_END_MAGIC)) == sizeof(CACHE_END_MAGIC));
+        cache_file->flush();
+        delete cache_file;
+        cache_file = 0;
+
+#if defined(_WIN32)
+        remove(mCacheFilename.c_str());
+#endif
+        BMX_CHECK_M(rename(temp_filename.c_str(), mCacheFilename.c_str()) == 0,
+                    ("Failed to rename '%s': %s", temp_filename.c_str(), bmx_strerror(errno).c_str()));
+
+        mxf_file->seek(file_position, SEEK_SET);
+
+        log_debug("Wrote index cache '%s'\n", mCacheFilename.c_str());
+        return true;
+    }
+    catch (const BMXException &ex)
+    {
+        log_warn("Failed to write index cache '%s': %s\n", mCacheFilename.c_str(), ex.what());
+    }
+    catch (...)
+    {
+        log_warn("Failed to write index cache '%s'\n", mCacheFilename.c_str());
+    }
+
+    delete cache_file;
+    remove(temp_filename.c_str());
+    try
+    {
+        mxf_file->seek(file_position, SEEK_SET);
+    }
+    catch (...)
+    {
+    }
+
+    return false;
+}
+
+void MXFIndexCache::CalcFileKey(File *mxf_file)
+{
+    mFileSize = mxf_file->size();
+    mFileModTime = get_file_mod_time(mFilename);
+
+    bmx::ByteArray buffer(KEY_HASH_SIZE);
+    MD5Context md5_context;
+    md5_init(&md5_context);
+    int64_t header_size = min(mFileSize, (int64_t)KEY_HASH_SIZE);
+    int64_t footer_start = max(header_size, mFileSize - KEY_HASH_SIZE);
+    hash_file_range(mxf_file, 0, header_size, &buffer, &md5_context);
+    hash_file_range(mxf_file, footer_start, mFileSize - footer_start, &buffer, &md5_context);
+    md5_final(mFileDigest, &md5_context);
+}
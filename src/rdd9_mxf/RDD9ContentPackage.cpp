@@ -179,14 +179,17 @@ uint32_t RDD9ContentPackageElement::GetElementSize(uint32_t data_size) const
         return GetKAGAlignedSize(mxfKey_extlen + LLEN + data_size);
 }
 
-void RDD9ContentPackageElement::Write(File *mxf_file, unsigned char *data, uint32_t size)
+void RDD9ContentPackageElement::AppendKL(MXFWriteBatch *write_batch, uint32_t data_size)
 {
-    uint32_t element_size = GetElementSize(size);
+    write_batch->AppendFixedKL(&mElementKey, LLEN, data_size);
+}
+
+void RDD9ContentPackageElement::AppendFill(MXFWriteBatch *write_batch, File *mxf_file, uint32_t data_size)
+{
+    uint32_t element_size = GetElementSize(data_size);
 
-    mxf_file->writeFixedKL(&mElementKey, LLEN, size);
-    BMX_CHECK(mxf_file->write(data, size) == size);
-    if (element_size > mxfKey_extlen + LLEN + size)
-        mxf_file->writeFill(element_size - (mxfKey_extlen + LLEN + size));
+    if (element_size > mxfKey_extlen + LLEN + data_size)
+        write_batch->AppendFill(mxf_file, element_size - (mxfKey_extlen + LLEN + data_size));
 }
 
 uint32_t RDD9ContentPackageElement::GetKAGAlignedSize(uint32_t klv_size) const
@@ -209,6 +212,7 @@ RDD9ContentPackageElementData::RDD9ContentPackageElementData(File *mxf_file, RDD
     mIndexTable = index_table;
     mElement = element;
     mPosition = position;
+    mDataRefsSize = 0;
     mNumSamplesWritten = 0;
     mNumSamples = element->GetNumSamples(position);
 }
@@ -230,12 +234,27 @@ uint32_t RDD9ContentPackageElementData::WriteSamples(const unsigned char *data,
         write_num_samples = num_samples;
     uint32_t write_size = (size / num_samples) * write_num_samples;
 
-    mData.Append(data, write_size);
+    AppendDataRef(data, write_size);
     mNumSamplesWritten += write_num_samples;
 
     return write_num_samples;
 }
 
+// sample data is referenced until either the content package is written or the write call returns,
+// so that a content package completed and written within a call is passed to the file without copying
+void RDD9ContentPackageElementData::RetainData()
+{
+    if (mDataRefs.empty())
+        return;
+
+    mData.Grow(mDataRefsSize);
+    dba_copy_data(mData.GetBytesAvailable(), mData.GetSizeAvailable(), &mDataRefs[0], (uint32_t)mDataRefs.size());
+    mData.IncrementSize(mDataRefsSize);
+
+    mDataRefs.clear();
+    mDataRefsSize = 0;
+}
+
 bool RDD9ContentPackageElementData::IsComplete() const
 {
     return mNumSamplesWritten > 0 && mNumSamplesWritten >= mNumSamples;
@@ -243,22 +262,44 @@ bool RDD9ContentPackageElementData::IsComplete() const
 
 uint32_t RDD9ContentPackageElementData::GetElementSize() const
 {
-    return mElement->GetElementSize(mData.GetSize());
+    return mElement->GetElementSize(GetDataSize());
 }
 
-void RDD9ContentPackageElementData::Write()
+void RDD9ContentPackageElementData::Write(MXFWriteBatch *write_batch)
 {
-    mElement->Write(mMXFFile, mData.GetBytes(), mData.GetSize());
+    uint32_t data_size = GetDataSize();
+
+    mElement->AppendKL(write_batch, data_size);
+    if (mData.GetSize() > 0)
+        write_batch->AppendData(mData.GetBytes(), mData.GetSize());
+    size_t i;
+    for (i = 0; i < mDataRefs.size(); i++)
+        write_batch->AppendData(mDataRefs[i].data, mDataRefs[i].size);
+    mElement->AppendFill(write_batch, mMXFFile, data_size);
 }
 
 void RDD9ContentPackageElementData::Reset(int64_t new_position)
 {
     mData.SetSize(0);
+    mDataRefs.clear();
+    mDataRefsSize = 0;
     mPosition = new_position;
     mNumSamplesWritten = 0;
     mNumSamples = mElement->GetNumSamples(new_position);
 }
 
+void RDD9ContentPackageElementData::AppendDataRef(const unsigned char *data, uint32_t size)
+{
+    if (size == 0)
+        return;
+
+    CDataBuffer data_ref;
+    data_ref.data = (unsigned char*)data;
+    data_ref.size = size;
+    mDataRefs.push_back(data_ref);
+    mDataRefsSize += size;
+}
+
 
 
 RDD9ContentPackage::RDD9ContentPackage(File *mxf_file, RDD9IndexTable *index_table, bool have_user_timecode,
@@ -323,6 +364,13 @@ uint32_t RDD9ContentPackage::WriteSamples(uint32_t track_index, const unsigned c
     return mElementTrackIndexMap[track_index]->WriteSamples(data, size, num_samples);
 }
 
+void RDD9ContentPackage::RetainSampleData()
+{
+    size_t i;
+    for (i = 0; i < mElementData.size(); i++)
+        mElementData[i]->RetainData();
+}
+
 uint32_t RDD9ContentPackage::GetSoundSampleCount() const
 {
     uint32_t min_sample_count = 0;
@@ -383,16 +431,18 @@ void RDD9ContentPackage::Write()
 
     WriteSystemItem();
 
+    // the system item and elements are written in one go
     size_t i;
     for (i = 0; i < mElementData.size(); i++)
-        mElementData[i]->Write();
+        mElementData[i]->Write(&mWriteBatch);
+    mWriteBatch.Write(mMXFFile);
 }
 
 void RDD9ContentPackage::WriteSystemItem()
 {
     static const uint32_t SYSTEM_ITEM_METADATA_PACK_SIZE = 7 + 16 + 17 + 17;
 
-    mMXFFile->writeFixedKL(&MXF_EE_K(SDTI_CP_System_Pack), LLEN, SYSTEM_ITEM_METADATA_PACK_SIZE);
+    mWriteBatch.AppendFixedKL(&MXF_EE_K(SDTI_CP_System_Pack), LLEN, SYSTEM_ITEM_METADATA_PACK_SIZE);
 
     // system metadata bitmap = 0x50
     // b7 = 0 (FEC not used)
@@ -405,19 +455,19 @@ void RDD9ContentPackage::WriteSystemItem()
     // b0 = 0 (control element)
 
     // core fields
-    mMXFFile->writeUInt8(0x50 | mSysMetaItemFlags);                     // system metadata bitmap
-    mMXFFile->writeUInt8(get_system_item_cp_rate(mFrameRate));          // content package rate
-    mMXFFile->writeUInt8(0x00);                                         // content package type (default)
-    mMXFFile->writeUInt16(0x0000);                                      // channel handle (default)
-    mMXFFile->writeUInt16((uint16_t)(mPosition & 0xffff));              // continuity count
+    mWriteBatch.AppendUInt8(0x50 | mSysMetaItemFlags);                     // system metadata bitmap
+    mWriteBatch.AppendUInt8(get_system_item_cp_rate(mFrameRate));          // content package rate
+    mWriteBatch.AppendUInt8(0x00);                                         // content package type (default)
+    mWriteBatch.AppendUInt16(0x0000);                                      // channel handle (default)
+    mWriteBatch.AppendUInt16((uint16_t)(mPosition & 0xffff));              // continuity count
 
     // SMPTE Universal Label
-    mMXFFile->writeUL(&MXF_EC_L(MultipleWrappings));
+    mWriteBatch.AppendUL(&MXF_EC_L(MultipleWrappings));
 
     // (null) Package creation date / time stamp
     unsigned char ts_bytes[17];
     memset(ts_bytes, 0, sizeof(ts_bytes));
-    BMX_CHECK(mMXFFile->write(ts_bytes, sizeof(ts_bytes)) == sizeof(ts_bytes));
+    mWriteBatch.AppendCopy(ts_bytes, sizeof(ts_bytes));
 
     // User date / time stamp
     Timecode user_timecode;
@@ -431,16 +481,16 @@ void RDD9ContentPackage::WriteSystemItem()
         user_timecode.Init(get_rounded_tc_base(mFrameRate), false, mPosition);
     }
     encode_smpte_timecode(user_timecode, false, &ts_bytes[1], sizeof(ts_bytes) - 1);
-    BMX_CHECK(mMXFFile->write(ts_bytes, sizeof(ts_bytes)) == sizeof(ts_bytes));
+    mWriteBatch.AppendCopy(ts_bytes, sizeof(ts_bytes));
 
 
     // empty Package Metadata Set
-    mMXFFile->writeFixedKL(&MXF_EE_K(EmptyPackageMetadataSet), LLEN, 0);
+    mWriteBatch.AppendFixedKL(&MXF_EE_K(EmptyPackageMetadataSet), LLEN, 0);
 
 
     // align to KAG
-    mMXFFile->writeFill(KAG_SIZE - (mxfKey_extlen + LLEN + SYSTEM_ITEM_METADATA_PACK_SIZE +
-                                    mxfKey_extlen + LLEN));
+    mWriteBatch.AppendFill(mMXFFile, KAG_SIZE - (mxfKey_extlen + LLEN + SYSTEM_ITEM_METADATA_PACK_SIZE +
+                                                 mxfKey_extlen + LLEN));
 }
 
 
@@ -602,6 +652,13 @@ void RDD9ContentPackageManager::WriteSamples(uint32_t track_index, const unsigne
     }
 }
 
+void RDD9ContentPackageManager::RetainSampleData()
+{
+    size_t i;
+    for (i = 0; i < mContentPackages.size(); i++)
+        mContentPackages[i]->RetainSampleData();
+}
+
 bool RDD9ContentPackageManager::HaveContentPackage(bool final_write)
 {
     if (final_write && !mSoundSequenceOffsetSet)
@@ -409,6 +409,9 @@ void RDD9File::WriteSamples(uint32_t track_index, const unsigned char *data, uin
     GetTrack(track_index)->WriteSamplesInt(data, size, num_samples);
 
     WriteContentPackages(false);
+
+    // the data is only valid for the duration of this call; copy what buffered content packages still reference
+    mCPManager->RetainSampleData();
 }
 
 void RDD9File::CompleteWrite()
@@ -527,6 +530,11 @@ void RDD9File::CompleteWrite()
     }
 
 
+    // flush buffered writes
+
+    mMXFFile->flush();
+
+
     // done with the file
     delete mMXFFile;
     mMXFFile = 0;
@@ -0,0 +1,56 @@
+# Test reading an MXF OP1a file over HTTP, using a local server, with different cache and prefetch settings.
+
+include("${TEST_SOURCE_DIR}/../mxf_reader/test_common.cmake")
+
+
+create_compare_test_file(http_file 10)
+
+if(TEST_MODE STREQUAL "samples" OR TEST_MODE STREQUAL "data")
+    # There is no test data because the HTTP read output is compared with the local file read output
+    return()
+endif()
+
+# Each item is a set of mxf2raw HTTP options, with ';' replaced by ',', optionally preceded by
+# http_file_server options and a '|'
+set(http_options_list
+    "--http-cache,1"
+    "--http-min-read,65536,--http-cache,4"
+    "--http-min-read,65536,--http-cache,8,--http-prefetch,4"
+    "--http-min-read,4096,--http-cache,2,--http-prefetch,8"
+    "--http-min-read,65536,--http-prefetch,4,--http-disable-seek"
+    # A response that is cut short, as when a connection is dropped, doesn't move the end of the file
+    "--cut,3000000|--http-min-read,65536,--http-cache,8,--http-prefetch,4"
+    "--cut,3000000|--http-min-read,65536,--http-cache,4"
+    # The cut lands in an essence block that is prefetched while the previous block is read, and the
+    # latency keeps the cut response open until the read is waiting on it
+    "--latency,50,--cut,1150000|--http-min-read,65536,--http-cache,16,--http-prefetch,8"
+)
+
+foreach(http_options ${http_options_list})
+    set(server_options)
+    if(http_options MATCHES "^([^|]*)\\|(.*)$")
+        string(REPLACE "," ";" server_options "${CMAKE_MATCH_1}")
+        set(http_options "${CMAKE_MATCH_2}")
+    endif()
+    string(REPLACE "," ";" http_options "${http_options}")
+
+    execute_process(COMMAND ${HTTP_FILE_SERVER}
+        ${server_options}
+        ${output_file}
+        ${MXF2RAW}
+        --regtest
+        --info
+        --track-chksum md5
+        ${http_options}
+        "{url}"
+        OUTPUT_VARIABLE http_output
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to read MXF file over HTTP with options '${server_options}' '${http_options}': ${ret}")
+    endif()
+
+    if(NOT http_output STREQUAL expected_output)
+        message(FATAL_ERROR "Output reading MXF file over HTTP with options '${server_options}' '${http_options}' differs from local file output")
+    endif()
+endforeach()
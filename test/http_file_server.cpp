@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#define __STDC_FORMAT_MACROS
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <inttypes.h>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+
+// A minimal HTTP/1.1 server that serves a single file with support for byte range requests.
+// It is used as a stand-in for an object store when testing reading MXF files over HTTP.
+
+static string g_filename;
+static int64_t g_file_size;
+static unsigned int g_latency_msec;
+static int64_t g_cut_offset;
+static atomic<bool> g_cut_done;
+
+
+static bool send_all(int fd, const char *data, size_t size)
+{
+    while (size > 0) {
+        ssize_t num_sent = send(fd, data, size, MSG_NOSIGNAL);
+        if (num_sent < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += num_sent;
+        size -= (size_t)num_sent;
+    }
+    return true;
+}
+
+static bool send_file_range(int fd, int file_fd, int64_t first, int64_t last)
+{
+    char buffer[65536];
+    int64_t offset = first;
+    while (offset <= last) {
+        size_t count = sizeof(buffer);
+        if ((int64_t)count > last - offset + 1)
+            count = (size_t)(last - offset + 1);
+        ssize_t num_read = pread(file_fd, buffer, count, offset);
+        if (num_read <= 0)
+            return false;
+        if (!send_all(fd, buffer, (size_t)num_read))
+            return false;
+        offset += num_read;
+    }
+    return true;
+}
+
+static bool handle_request(int fd, int file_fd, const string &request, bool *keep_alive)
+{
+    string lower_request = request;
+    size_t i;
+    for (i = 0; i < lower_request.size(); i++)
+        lower_request[i] = (char)tolower((unsigned char)lower_request[i]);
+
+    bool head_request = (request.compare(0, 5, "HEAD ") == 0);
+    if (!head_request && request.compare(0, 4, "GET ") != 0)
+        return false;
+
+    *keep_alive = (lower_request.find("\r\nconnection: close") == string::npos);
+
+    int64_t first = 0;
+    int64_t last = g_file_size - 1;
+    bool range_request = false;
+    size_t range_pos = lower_request.find("\r\nrange: bytes=");
+    if (range_pos != string::npos) {
+        const char *range_str = &lower_request.c_str()[range_pos + strlen("\r\nrange: bytes=")];
+        int64_t range_last;
+        int num_values = sscanf(range_str, "%" PRId64 "-%" PRId64, &first, &range_last);
+        if (num_values < 1)
+            return false;
+        if (num_values == 2 && range_last < last)
+            last = range_last;
+        range_request = true;
+    }
+
+    if (g_latency_msec > 0)
+        usleep(g_latency_msec * 1000);
+
+    char header[512];
+    if (range_request && first >= g_file_size) {
+        snprintf(header, sizeof(header),
+                 "HTTP/1.1 416 Range Not Satisfiable\r\n"
+                 "Accept-Ranges: bytes\r\n"
+                 "Content-Range: bytes */%" PRId64 "\r\n"
+                 "Content-Length: 0\r\n"
+                 "\r\n",
+                 g_file_size);
+        return send_all(fd, header, strlen(header));
+    }
+
+    if (range_request) {
+        snprintf(header, sizeof(header),
+                 "HTTP/1.1 206 Partial Content\r\n"
+                 "Accept-Ranges: bytes\r\n"
+                 "Content-Range: bytes %" PRId64 "-%" PRId64 "/%" PRId64 "\r\n"
+                 "Content-Length: %" PRId64 "\r\n"
+                 "\r\n",
+                 first, last, g_file_size, last - first + 1);
+    } else {
+        snprintf(header, sizeof(header),
+                 "HTTP/1.1 200 OK\r\n"
+                 "Accept-Ranges: bytes\r\n"
+                 "Content-Length: %" PRId64 "\r\n"
+                 "\r\n",
+                 g_file_size);
+    }
+    if (!send_all(fd, header, strlen(header)))
+        return false;
+
+    if (head_request)
+        return true;
+
+    // Simulate a dropped connection by cutting short the first response that covers the cut offset.
+    // The connection is held open for the latency before it is closed so that a client can be left
+    // waiting on the incomplete response
+    bool expected_cut_done = false;
+    if (g_cut_offset >= 0 && first <= g_cut_offset && last >= g_cut_offset &&
+        g_cut_done.compare_exchange_strong(expected_cut_done, true))
+    {
+        if (g_cut_offset > first)
+            send_file_range(fd, file_fd, first, g_cut_offset - 1);
+        if (g_latency_msec > 0)
+            usleep(g_latency_msec * 1000);
+        return false;
+    }
+
+    return send_file_range(fd, file_fd, first, last);
+}
+
+static void handle_connection(int fd)
+{
+    int file_fd = open(g_filename.c_str(), O_RDONLY);
+    if (file_fd < 0) {
+        fprintf(stderr, "%s: failed to open file: %s\n", g_filename.c_str(), strerror(errno));
+        close(fd);
+        return;
+    }
+
+    string received;
+    bool keep_alive = true;
+    while (keep_alive) {
+        size_t end_pos;
+        while ((end_pos = received.find("\r\n\r\n")) == string::npos) {
+            char buffer[4096];
+            ssize_t num_read = recv(fd, buffer, sizeof(buffer), 0);
+            if (num_read < 0 && errno == EINTR)
+                continue;
+            if (num_read <= 0)
+                break;
+            received.append(buffer, (size_t)num_read);
+        }
+        if (end_pos == string::npos)
+            break;
+
+        string request = received.substr(0, end_pos + 2);
+        received.erase(0, end_pos + 4);
+        if (!handle_request(fd, file_fd, request, &keep_alive))
+            break;
+    }
+
+    close(file_fd);
+    close(fd);
+}
+
+static void accept_connections(int listen_fd)
+{
+    while (true) {
+        int fd = accept(listen_fd, 0, 0);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            break;
+        }
+        int nodelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+        thread(handle_connection, fd).detach();
+    }
+}
+
+static void print_usage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s [--latency <msec>] [--cut <offset>] <filename> <command> [<arg>]*\n", cmd);
+    fprintf(stderr, "Serves <filename> over HTTP and runs <command>, replacing '{url}' in the arguments with the file URL\n");
+    fprintf(stderr, "The --cut option closes the connection at <offset> in the first response that includes it\n");
+    fprintf(stderr, "The --latency option delays each response and the closing of the connection for --cut\n");
+}
+
+int main(int argc, const char **argv)
+{
+    int cmdln_index = 1;
+
+    g_latency_msec = 0;
+    if (cmdln_index + 1 < argc && strcmp(argv[cmdln_index], "--latency") == 0) {
+        if (sscanf(argv[cmdln_index + 1], "%u", &g_latency_msec) != 1) {
+            print_usage(argv[0]);
+            fprintf(stderr, "Invalid <msec> %s\n", argv[cmdln_index + 1]);
+            return 1;
+        }
+        cmdln_index += 2;
+    }
+    g_cut_offset = -1;
+    g_cut_done = false;
+    if (cmdln_index + 1 < argc && strcmp(argv[cmdln_index], "--cut") == 0) {
+        if (sscanf(argv[cmdln_index + 1], "%" PRId64, &g_cut_offset) != 1 || g_cut_offset < 0) {
+            print_usage(argv[0]);
+            fprintf(stderr, "Invalid <offset> %s\n", argv[cmdln_index + 1]);
+            return 1;
+        }
+        cmdln_index += 2;
+    }
+    if (cmdln_index + 2 > argc) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    g_filename = argv[cmdln_index++];
+    struct stat stat_buf;
+    if (stat(g_filename.c_str(), &stat_buf) != 0) {
+        fprintf(stderr, "%s: failed to stat file: %s\n", g_filename.c_str(), strerror(errno));
+        return 1;
+    }
+    g_file_size = stat_buf.st_size;
+
+    int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        fprintf(stderr, "Failed to create socket: %s\n", strerror(errno));
+        return 1;
+    }
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port        = 0;
+    socklen_t addr_len = sizeof(addr);
+    if (bind(listen_fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        listen(listen_fd, 16) != 0 ||
+        getsockname(listen_fd, (struct sockaddr*)&addr, &addr_len) != 0)
+    {
+        fprintf(stderr, "Failed to listen on socket: %s\n", strerror(errno));
+        return 1;
+    }
+
+    char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%u/file.mxf", (unsigned int)ntohs(addr.sin_port));
+
+    vector<string> args;
+    for (; cmdln_index < argc; cmdln_index++) {
+        string arg = argv[cmdln_index];
+        size_t url_pos;
+        while ((url_pos = arg.find("{url}")) != string::npos)
+            arg.replace(url_pos, strlen("{url}"), url);
+        args.push_back(arg);
+    }
+
+    // Fork before starting any threads
+    pid_t pid = fork();
+    if (pid < 0) {
+        fprintf(stderr, "Failed to fork: %s\n", strerror(errno));
+        return 1;
+    } else if (pid == 0) {
+        close(listen_fd);
+        vector<char*> exec_args;
+        size_t i;
+        for (i = 0; i < args.size(); i++)
+            exec_args.push_back(&args[i][0]);
+        exec_args.push_back(0);
+        execvp(exec_args[0], &exec_args[0]);
+        fprintf(stderr, "Failed to execute '%s': %s\n", exec_args[0], strerror(errno));
+        _exit(127);
+    }
+
+    thread(accept_connections, listen_fd).detach();
+
+    int status;
+    while (waitpid(pid, &status, 0) < 0) {
+        if (errno != EINTR) {
+            fprintf(stderr, "Failed to wait for command: %s\n", strerror(errno));
+            return 1;
+        }
+    }
+
+    if (WIFEXITED(status))
+        return WEXITSTATUS(status);
+    return 1;
+}
@@ -0,0 +1,76 @@
+# Test finding the raw essence frame boundaries using parallel chunk parsing.
+
+include("${TEST_SOURCE_DIR}/../testing.cmake")
+
+
+if(TEST_MODE STREQUAL "samples" OR TEST_MODE STREQUAL "data")
+    # There is no test data because the output using the frame scan is compared with the output without it
+    return()
+endif()
+
+# The AVC-Intra essence, parsed as AVC, only has parameter sets in the first frame and so the frames after the
+# first chunk are parsed across the chunk seams
+execute_process(COMMAND ${CREATE_TEST_ESSENCE}
+    -t 14
+    -d 24
+    video_raw_frame_scan_mpeg2lg
+    OUTPUT_QUIET
+    RESULT_VARIABLE ret
+)
+if(NOT ret EQUAL 0)
+    message(FATAL_ERROR "Failed to create test MPEG-2 video: ${ret}")
+endif()
+
+execute_process(COMMAND ${CREATE_TEST_ESSENCE}
+    -t 8
+    -d 24
+    video_raw_frame_scan_avc
+    OUTPUT_QUIET
+    RESULT_VARIABLE ret
+)
+if(NOT ret EQUAL 0)
+    message(FATAL_ERROR "Failed to create test AVC video: ${ret}")
+endif()
+
+foreach(essence mpeg2lg avc)
+    if(essence STREQUAL "mpeg2lg")
+        set(input --mpeg2lg_422p_hl_1080i video_raw_frame_scan_mpeg2lg)
+    else()
+        set(input --avc_high_422_intra video_raw_frame_scan_avc)
+    endif()
+
+    execute_process(COMMAND ${RAW2BMX}
+        --regtest
+        -t op1a
+        -o test_raw_frame_scan_expected.mxf
+        ${input}
+        OUTPUT_QUIET
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to create ${essence} MXF file: ${ret}")
+    endif()
+    file(MD5 test_raw_frame_scan_expected.mxf expected_md5)
+
+    # The minimum chunk sizes result in 4 chunks and in fewer chunks than threads
+    foreach(chunk_size 10000 2000000)
+        execute_process(COMMAND ${RAW2BMX}
+            --regtest
+            -t op1a
+            -o test_raw_frame_scan.mxf
+            --scan-threads 4
+            --scan-chunk ${chunk_size}
+            ${input}
+            OUTPUT_QUIET
+            RESULT_VARIABLE ret
+        )
+        if(NOT ret EQUAL 0)
+            message(FATAL_ERROR "Failed to create ${essence} MXF file with chunk size ${chunk_size}: ${ret}")
+        endif()
+        file(MD5 test_raw_frame_scan.mxf scan_md5)
+
+        if(NOT scan_md5 STREQUAL expected_md5)
+            message(FATAL_ERROR "Output for ${essence} with chunk size ${chunk_size} differs from output without the frame scan")
+        endif()
+    endforeach()
+endforeach()
@@ -93,3 +93,125 @@ function(run_tests tests duration)
         run_test(${test} ${test_frame_rate} ${duration})
     endforeach()
 endfunction()
+
+# Create an MXF OP1a file with body partitions for a test that compares the mxf2raw output with and
+# without a reader option. Outside the samples and data modes the file is read with the ARGN options and
+# the output is set in expected_output. output_file is set to the created file
+function(create_compare_test_file test partition_interval)
+    if(TEST_MODE STREQUAL "samples")
+        file(MAKE_DIRECTORY ${BMX_TEST_SAMPLES_DIR})
+
+        set(output_file ${BMX_TEST_SAMPLES_DIR}/test_${test}.mxf)
+    else()
+        set(output_file test_${test}.mxf)
+    endif()
+
+    execute_process(COMMAND ${CREATE_TEST_ESSENCE}
+        -t 1
+        -d 24
+        audio_${test}
+        OUTPUT_QUIET
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to create test audio: ${ret}")
+    endif()
+
+    execute_process(COMMAND ${CREATE_TEST_ESSENCE}
+        -t 14
+        -d 24
+        video_${test}
+        OUTPUT_QUIET
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to create test video: ${ret}")
+    endif()
+
+    execute_process(COMMAND ${RAW2BMX}
+        --regtest
+        -t op1a
+        -o ${output_file}
+        --part ${partition_interval}
+        --mpeg2lg_422p_hl_1080i video_${test}
+        -q 16 --pcm audio_${test}
+        OUTPUT_QUIET
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to create MXF file: ${ret}")
+    endif()
+
+    set(output_file ${output_file} PARENT_SCOPE)
+
+    if(TEST_MODE STREQUAL "samples" OR TEST_MODE STREQUAL "data")
+        return()
+    endif()
+
+    execute_process(COMMAND ${MXF2RAW}
+        --regtest
+        --info
+        --track-chksum md5
+        ${ARGN}
+        ${output_file}
+        OUTPUT_VARIABLE expected_output
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to read MXF file: ${ret}")
+    endif()
+
+    set(expected_output "${expected_output}" PARENT_SCOPE)
+endfunction()
+
+# Create the Avid OP-Atom video and 2 audio files of a clip for a test that compares the mxf2raw output
+# of reading them as a group with and without a reader option. group_files is set to the created files
+function(create_group_test_files test)
+    if(TEST_MODE STREQUAL "samples")
+        file(MAKE_DIRECTORY ${BMX_TEST_SAMPLES_DIR})
+
+        set(output_prefix ${BMX_TEST_SAMPLES_DIR}/test_${test})
+    else()
+        set(output_prefix test_${test})
+    endif()
+
+    execute_process(COMMAND ${CREATE_TEST_ESSENCE}
+        -t 1
+        -d 24
+        audio_${test}
+        OUTPUT_QUIET
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to create test audio: ${ret}")
+    endif()
+
+    execute_process(COMMAND ${CREATE_TEST_ESSENCE}
+        -t 2
+        -d 24
+        video_${test}
+        OUTPUT_QUIET
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to create test video: ${ret}")
+    endif()
+
+    execute_process(COMMAND ${RAW2BMX}
+        --regtest
+        -t avid
+        -f 25
+        --clip test_${test}
+        -o ${output_prefix}
+        --iecdv25 video_${test}
+        -q 16 --pcm audio_${test}
+        -q 16 --pcm audio_${test}
+        OUTPUT_QUIET
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to create MXF files: ${ret}")
+    endif()
+
+    set(group_files ${output_prefix}_v1.mxf ${output_prefix}_a1.mxf ${output_prefix}_a2.mxf PARENT_SCOPE)
+endfunction()
@@ -0,0 +1,85 @@
+# Test reading an MXF OP1a file with body partitions when the index cache is written and then read back.
+
+include("${TEST_SOURCE_DIR}/test_common.cmake")
+
+
+create_compare_test_file(index_cache 5 --start 7)
+
+if(TEST_MODE STREQUAL "samples" OR TEST_MODE STREQUAL "data")
+    # There is no test data because the output using the index cache is compared with the output without it
+    return()
+endif()
+
+set(cache_dir index_cache)
+file(REMOVE_RECURSE ${cache_dir})
+file(MAKE_DIRECTORY ${cache_dir})
+
+# The first read writes the index cache and the second read uses it
+foreach(pass write read)
+    execute_process(COMMAND ${MXF2RAW}
+        --regtest
+        --info
+        --track-chksum md5
+        --start 7
+        --index-cache-dir ${cache_dir}
+        ${output_file}
+        OUTPUT_VARIABLE cache_output
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to read MXF file in index cache ${pass} pass: ${ret}")
+    endif()
+
+    if(NOT cache_output STREQUAL expected_output)
+        message(FATAL_ERROR "Output in index cache ${pass} pass differs from output without the index cache")
+    endif()
+
+    file(GLOB cache_files ${cache_dir}/*.bmxidx)
+    list(LENGTH cache_files num_cache_files)
+    if(NOT num_cache_files EQUAL 1)
+        message(FATAL_ERROR "Expected 1 index cache file after ${pass} pass, found ${num_cache_files}")
+    endif()
+endforeach()
+
+# A cache file with a matching key and end marker but corrupt content is ignored and re-written
+file(GLOB cache_file ${cache_dir}/*.bmxidx)
+file(READ ${cache_file} cache_hex HEX)
+string(LENGTH "${cache_hex}" cache_size)
+math(EXPR cache_size "${cache_size} / 2")
+math(EXPR corrupt_size "${cache_size} / 2")
+execute_process(COMMAND ${FILE_TRUNCATE} ${corrupt_size} ${cache_file}
+    RESULT_VARIABLE ret
+)
+if(NOT ret EQUAL 0)
+    message(FATAL_ERROR "Failed to truncate index cache file: ${ret}")
+endif()
+file(APPEND ${cache_file} "BMXIDXE\n")
+
+string(REGEX REPLACE "LogMessages:.*$" "" expected_output_no_log "${expected_output}")
+foreach(pass corrupt rewritten)
+    execute_process(COMMAND ${MXF2RAW}
+        --regtest
+        --info
+        --track-chksum md5
+        --start 7
+        --index-cache-dir ${cache_dir}
+        ${output_file}
+        OUTPUT_VARIABLE cache_output
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to read MXF file with ${pass} index cache: ${ret}")
+    endif()
+
+    if(pass STREQUAL "corrupt")
+        if(NOT cache_output MATCHES "Failed to read index cache")
+            message(FATAL_ERROR "Corrupt index cache was not detected")
+        endif()
+        string(REGEX REPLACE "LogMessages:.*$" "" cache_output "${cache_output}")
+        if(NOT cache_output STREQUAL expected_output_no_log)
+            message(FATAL_ERROR "Output with corrupt index cache differs from output without the index cache")
+        endif()
+    elseif(NOT cache_output STREQUAL expected_output)
+        message(FATAL_ERROR "Output with ${pass} index cache differs from output without the index cache")
+    endif()
+endforeach()
@@ -0,0 +1,95 @@
+# Test reading an MXF OP1a file where the footer partition index table segments overlap and replace the
+# segments in the body partitions.
+
+include("${TEST_SOURCE_DIR}/test_common.cmake")
+
+
+if(TEST_MODE STREQUAL "samples")
+    file(MAKE_DIRECTORY ${BMX_TEST_SAMPLES_DIR})
+
+    set(output_file ${BMX_TEST_SAMPLES_DIR}/test_index_segments.mxf)
+    set(resegment_file ${BMX_TEST_SAMPLES_DIR}/test_index_segments_reseg.mxf)
+else()
+    set(output_file test_index_segments.mxf)
+    set(resegment_file test_index_segments_reseg.mxf)
+endif()
+
+execute_process(COMMAND ${CREATE_TEST_ESSENCE}
+    -t 1
+    -d 48
+    audio_index_segments
+)
+execute_process(COMMAND ${CREATE_TEST_ESSENCE}
+    -t 14
+    -d 48
+    video_index_segments
+)
+
+# The body partitions contain index table segments 0:12, 12:12, 24:12 and 36:12
+execute_process(COMMAND ${RAW2BMX}
+    --regtest
+    -t op1a
+    -o ${output_file}
+    --part 12
+    --repeat-index
+    --mpeg2lg_422p_hl_1080i video_index_segments
+    -q 16 --pcm audio_index_segments
+    OUTPUT_QUIET
+    RESULT_VARIABLE ret
+)
+if(NOT ret EQUAL 0)
+    message(FATAL_ERROR "Failed to create MXF file: ${ret}")
+endif()
+
+# The footer partition segments are read in the given order. 26:4 splits body segment 24:12, 0:5 shortens the
+# start of 0:12, 17:9 shortens the end of 12:12 and replaces the remainder of 24:12, 5:12 replaces the shortened
+# segments and 30:18 replaces the remaining segments
+configure_file(${output_file} ${resegment_file} COPYONLY)
+execute_process(COMMAND ${RESEGMENT_INDEX}
+    "26:4,0:5,17:9,5:12,30:18"
+    ${resegment_file}
+    RESULT_VARIABLE ret
+)
+if(NOT ret EQUAL 0)
+    message(FATAL_ERROR "Failed to re-segment index table: ${ret}")
+endif()
+
+if(TEST_MODE STREQUAL "samples" OR TEST_MODE STREQUAL "data")
+    # There is no test data because the output of the re-segmented file is compared with the output of the original
+    return()
+endif()
+
+
+function(read_index_segments_file input_file output_var)
+    execute_process(COMMAND ${MXF2RAW}
+        --regtest
+        --info
+        --track-chksum md5
+        ${ARGN}
+        ${input_file}
+        OUTPUT_VARIABLE output
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to read MXF file '${input_file}' with '${ARGN}': ${ret}")
+    endif()
+
+    set(${output_var} "${output}" PARENT_SCOPE)
+endfunction()
+
+function(check_index_segments)
+    read_index_segments_file(${output_file} expected_output ${ARGN})
+    read_index_segments_file(${resegment_file} resegment_output ${ARGN})
+
+    if(NOT resegment_output STREQUAL expected_output)
+        message(FATAL_ERROR "Output of the re-segmented file with '${ARGN}' differs from output of the original")
+    endif()
+endfunction()
+
+check_index_segments()
+
+# Seek to and read the edit units either side of each segment boundary
+foreach(boundary 5 12 17 24 26 30 36)
+    math(EXPR start "${boundary} - 1")
+    check_index_segments(--start ${start} --dur 2)
+endforeach()
@@ -0,0 +1,87 @@
+# Test opening the files of a group and of a sequence concurrently.
+
+include("${TEST_SOURCE_DIR}/test_common.cmake")
+
+
+create_group_test_files(open_threads)
+
+# The sequence files are created without --regtest so that they have different material packages and
+# are not read as a group
+if(TEST_MODE STREQUAL "samples")
+    set(seq_prefix ${BMX_TEST_SAMPLES_DIR}/test_open_threads_seq)
+else()
+    set(seq_prefix test_open_threads_seq)
+endif()
+set(seq_files)
+set(index 0)
+foreach(start_tc "00:00:00:00" "00:00:00:24" "00:00:01:23")
+    execute_process(COMMAND ${RAW2BMX}
+        -t op1a
+        -f 25
+        -y ${start_tc}
+        -o ${seq_prefix}${index}.mxf
+        --iecdv25 video_open_threads
+        -q 16 --pcm audio_open_threads
+        OUTPUT_QUIET
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to create MXF file: ${ret}")
+    endif()
+
+    # the sequence reader orders the files by timecode
+    list(INSERT seq_files 0 ${seq_prefix}${index}.mxf)
+    math(EXPR index "${index} + 1")
+endforeach()
+
+if(TEST_MODE STREQUAL "samples" OR TEST_MODE STREQUAL "data")
+    # There is no test data because the output opening files concurrently is compared with the output without it
+    return()
+endif()
+
+
+function(check_open_threads name input_args expect_success)
+    foreach(open_threads 1 4)
+        execute_process(COMMAND ${MXF2RAW}
+            --regtest
+            --info
+            --track-chksum md5
+            --open-threads ${open_threads}
+            ${input_args}
+            OUTPUT_VARIABLE output
+            ERROR_VARIABLE output
+            RESULT_VARIABLE ret
+        )
+        if(expect_success AND NOT ret EQUAL 0)
+            message(FATAL_ERROR "Failed to read ${name} with ${open_threads} open threads: ${ret}")
+        elseif(NOT expect_success)
+            if(ret EQUAL 0)
+                message(FATAL_ERROR "Opening ${name} with ${open_threads} open threads did not fail")
+            endif()
+            string(REGEX MATCHALL "Failed to open MXF file" open_errors "${output}")
+            list(LENGTH open_errors num_open_errors)
+            if(NOT num_open_errors EQUAL 1)
+                message(FATAL_ERROR "Expected 1 open error for ${name} with ${open_threads} open threads, found ${num_open_errors}")
+            endif()
+        endif()
+
+        if(open_threads EQUAL 1)
+            set(expected_output "${output}")
+        elseif(NOT output STREQUAL expected_output)
+            message(FATAL_ERROR "Output for ${name} with ${open_threads} open threads differs from output with 1 open thread")
+        endif()
+    endforeach()
+endfunction()
+
+check_open_threads("group" "--group;${group_files}" TRUE)
+check_open_threads("sequence" "${seq_files}" TRUE)
+
+# A file that is not an MXF file fails to open. No files are passed to a reader after the failure and
+# the files that were opened but not passed to a reader are closed
+set(invalid_file audio_open_threads)
+set(group_files_with_invalid ${group_files})
+list(INSERT group_files_with_invalid 1 ${invalid_file})
+set(seq_files_with_invalid ${seq_files})
+list(INSERT seq_files_with_invalid 1 ${invalid_file})
+check_open_threads("group with an invalid file" "--group;${group_files_with_invalid}" FALSE)
+check_open_threads("sequence with an invalid file" "${seq_files_with_invalid}" FALSE)
@@ -0,0 +1,77 @@
+# Test reading a group of Avid OP-Atom files with a read thread per file.
+
+include("${TEST_SOURCE_DIR}/test_common.cmake")
+
+
+create_group_test_files(parallel_read)
+
+if(TEST_MODE STREQUAL "samples" OR TEST_MODE STREQUAL "data")
+    # There is no test data because the output using parallel reads is compared with the output without it
+    return()
+endif()
+
+
+foreach(read_args "" "--parallel-read")
+    execute_process(COMMAND ${MXF2RAW}
+        --regtest
+        --info
+        --track-chksum md5
+        ${read_args}
+        --group ${group_files}
+        OUTPUT_VARIABLE output
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to read MXF files with '${read_args}': ${ret}")
+    endif()
+
+    if(read_args STREQUAL "")
+        set(expected_output "${output}")
+    elseif(NOT output STREQUAL expected_output)
+        message(FATAL_ERROR "Output with '${read_args}' differs from output without parallel reads")
+    endif()
+endforeach()
+
+# A member file that is cut short causes a read error part way through. The error is reported once and
+# the read workers are stopped when the group reader is deleted
+list(GET group_files 2 audio_file)
+set(truncated_file truncated_parallel_read_a2.mxf)
+file(READ ${audio_file} audio_hex HEX)
+string(LENGTH "${audio_hex}" truncated_size)
+math(EXPR truncated_size "${truncated_size} * 2 / 5")
+configure_file(${audio_file} ${truncated_file} COPYONLY)
+execute_process(COMMAND ${FILE_TRUNCATE} ${truncated_size} ${truncated_file}
+    RESULT_VARIABLE ret
+)
+if(NOT ret EQUAL 0)
+    message(FATAL_ERROR "Failed to truncate MXF file: ${ret}")
+endif()
+list(REMOVE_AT group_files 2)
+list(APPEND group_files ${truncated_file})
+
+foreach(read_args "" "--parallel-read")
+    execute_process(COMMAND ${MXF2RAW}
+        --regtest
+        --info
+        --track-chksum md5
+        ${read_args}
+        --group ${group_files}
+        OUTPUT_VARIABLE output
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to read MXF files with a truncated member and '${read_args}': ${ret}")
+    endif()
+
+    string(REGEX MATCHALL "A read error occurred" read_errors "${output}")
+    list(LENGTH read_errors num_read_errors)
+    if(NOT num_read_errors EQUAL 1)
+        message(FATAL_ERROR "Expected 1 read error with '${read_args}', found ${num_read_errors}")
+    endif()
+
+    if(read_args STREQUAL "")
+        set(expected_output "${output}")
+    elseif(NOT output STREQUAL expected_output)
+        message(FATAL_ERROR "Output with a truncated member and '${read_args}' differs from output without parallel reads")
+    endif()
+endforeach()
@@ -0,0 +1,32 @@
+# Test reading an MXF OP1a file with body partitions using the essence read queue.
+
+include("${TEST_SOURCE_DIR}/test_common.cmake")
+
+
+create_compare_test_file(read_queue 5 --start 7)
+
+if(TEST_MODE STREQUAL "samples" OR TEST_MODE STREQUAL "data")
+    # There is no test data because the output using the read queue is compared with the output without it
+    return()
+endif()
+
+# Limit the queue by edit unit count and by size
+foreach(queue_args "--read-queue;4" "--read-queue-size;100000")
+    execute_process(COMMAND ${MXF2RAW}
+        --regtest
+        --info
+        --track-chksum md5
+        --start 7
+        ${queue_args}
+        ${output_file}
+        OUTPUT_VARIABLE queue_output
+        RESULT_VARIABLE ret
+    )
+    if(NOT ret EQUAL 0)
+        message(FATAL_ERROR "Failed to read MXF file with '${queue_args}': ${ret}")
+    endif()
+
+    if(NOT queue_output STREQUAL expected_output)
+        message(FATAL_ERROR "Output with '${queue_args}' differs from output without the read queue")
+    endif()
+endforeach()
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#define __STDC_FORMAT_MACROS
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <inttypes.h>
+#include <vector>
+
+#include <mxf/mxf.h>
+
+using namespace std;
+
+
+// Re-segments the complete index table in the footer partition of a file written with a repeated index, e.g.
+// raw2bmx -t op1a --repeat-index. The new segments are written in the given order and can have boundaries that
+// differ from the segments in the body partitions, so that the reader has to split or shorten segments
+
+
+typedef struct
+{
+    int64_t start;
+    int64_t duration;
+} SegmentRange;
+
+
+static void print_usage(const char *cmd)
+{
+    fprintf(stderr, "Usage: %s <start>:<duration>[,<start>:<duration>]* <filename>\n", cmd);
+    fprintf(stderr, "Re-writes the footer partition index table as segments with the given edit unit ranges\n");
+}
+
+static bool parse_ranges(const char *arg, vector<SegmentRange> *ranges)
+{
+    const char *str = arg;
+    while (*str) {
+        SegmentRange range;
+        int num_chars;
+        if (sscanf(str, "%" PRId64 ":%" PRId64 "%n", &range.start, &range.duration, &num_chars) != 2 ||
+            range.start < 0 || range.duration <= 0)
+        {
+            return false;
+        }
+        ranges->push_back(range);
+        str += num_chars;
+        if (*str == ',')
+            str++;
+        else if (*str)
+            return false;
+    }
+
+    return !ranges->empty();
+}
+
+static bool resegment_index(MXFFile *mxf_file, const vector<SegmentRange> &ranges)
+{
+    mxfKey key;
+    uint8_t llen;
+    uint64_t len;
+    MXFPartition *header_partition = 0;
+    MXFPartition *footer_partition = 0;
+    vector<MXFIndexTableSegment*> segments;
+    vector<MXFIndexEntry*> entries;
+    vector<MXFIndexTableSegment*> new_segments;
+    vector<uint8_t> rip_data;
+    int64_t index_start;
+    int64_t rip_start;
+    int64_t file_size;
+    bool result = false;
+    size_t i;
+
+    if (!mxf_read_header_pp_kl(mxf_file, &key, &llen, &len) ||
+        !mxf_read_partition(mxf_file, &key, len, &header_partition))
+    {
+        fprintf(stderr, "Failed to read header partition pack\n");
+        goto end;
+    }
+    if (header_partition->footerPartition == 0 ||
+        !mxf_file_seek(mxf_file, header_partition->footerPartition, SEEK_SET) ||
+        !mxf_read_kl(mxf_file, &key, &llen, &len) ||
+        !mxf_is_footer_partition_pack(&key) ||
+        !mxf_read_partition(mxf_file, &key, len, &footer_partition))
+    {
+        fprintf(stderr, "Failed to read footer partition pack\n");
+        goto end;
+    }
+    if (footer_partition->headerByteCount > 0 &&
+        !mxf_skip(mxf_file, footer_partition->headerByteCount))
+    {
+        goto end;
+    }
+
+    // read the index table segments and the random index pack that follows them
+    index_start = mxf_file_tell(mxf_file);
+    while (true) {
+        if (!mxf_read_next_nonfiller_kl(mxf_file, &key, &llen, &len)) {
+            fprintf(stderr, "Failed to read footer partition KL\n");
+            goto end;
+        }
+        if (!mxf_is_index_table_segment(&key))
+            break;
+
+        MXFIndexTableSegment *segment;
+        if (!mxf_read_index_table_segment(mxf_file, len, &segment)) {
+            fprintf(stderr, "Failed to read index table segment\n");
+            goto end;
+        }
+        segments.push_back(segment);
+    }
+    if (!mxf_equals_key(&key, &g_RandomIndexPack_key)) {
+        fprintf(stderr, "Footer partition index table is not followed by the random index pack\n");
+        goto end;
+    }
+    rip_start = mxf_file_tell(mxf_file) - mxfKey_extlen - llen;
+    file_size = mxf_file_size(mxf_file);
+    rip_data.resize((size_t)(file_size - rip_start));
+    if (!mxf_file_seek(mxf_file, rip_start, SEEK_SET) ||
+        mxf_file_read(mxf_file, &rip_data[0], (uint32_t)rip_data.size()) != rip_data.size())
+    {
+        fprintf(stderr, "Failed to read random index pack\n");
+        goto end;
+    }
+
+    // collect the index entries of the complete index table
+    for (i = 0; i < segments.size(); i++) {
+        if (segments[i]->editUnitByteCount != 0 || segments[i]->indexStartPosition != (int64_t)entries.size()) {
+            fprintf(stderr, "Footer partition doesn't contain a complete VBE index table\n");
+            goto end;
+        }
+        MXFIndexEntry *entry = segments[i]->indexEntryArray;
+        while (entry) {
+            entries.push_back(entry);
+            entry = entry->next;
+        }
+    }
+    if (entries.empty()) {
+        fprintf(stderr, "Footer partition doesn't contain index entries\n");
+        goto end;
+    }
+
+    // create and write the new segments
+    if (!mxf_file_seek(mxf_file, index_start, SEEK_SET))
+        goto end;
+    for (i = 0; i < ranges.size(); i++) {
+        if (ranges[i].start + ranges[i].duration > (int64_t)entries.size()) {
+            fprintf(stderr, "Segment range %" PRId64 ":%" PRId64 " exceeds the index duration %" PRIu64 "\n",
+                    ranges[i].start, ranges[i].duration, (uint64_t)entries.size());
+            goto end;
+        }
+
+        MXFIndexTableSegment *new_segment;
+        if (!mxf_create_index_table_segment(&new_segment))
+            goto end;
+        new_segments.push_back(new_segment);
+
+        mxf_generate_uuid(&new_segment->instanceUID);
+        new_segment->indexEditRate         = segments[0]->indexEditRate;
+        new_segment->indexStartPosition    = ranges[i].start;
+        new_segment->indexDuration         = ranges[i].duration;
+        new_segment->indexSID              = segments[0]->indexSID;
+        new_segment->bodySID               = segments[0]->bodySID;
+        new_segment->sliceCount            = segments[0]->sliceCount;
+        new_segment->posTableCount         = segments[0]->posTableCount;
+        new_segment->singleIndexLocation   = segments[0]->singleIndexLocation;
+        new_segment->singleEssenceLocation = segments[0]->singleEssenceLocation;
+        new_segment->forwardIndexDirection = segments[0]->forwardIndexDirection;
+
+        MXFDeltaEntry *delta_entry = segments[0]->deltaEntryArray;
+        while (delta_entry) {
+            if (!mxf_default_add_delta_entry(0, 0, new_segment, delta_entry->posTableIndex, delta_entry->slice,
+                                             delta_entry->elementData))
+            {
+                goto end;
+            }
+            delta_entry = delta_entry->next;
+        }
+
+        int64_t position;
+        for (position = ranges[i].start; position < ranges[i].start + ranges[i].duration; position++) {
+            MXFIndexEntry *entry = entries[(size_t)position];
+            if (!mxf_default_add_index_entry(0, 0, new_segment, entry->temporalOffset, entry->keyFrameOffset,
+                                             entry->flags, entry->streamOffset, entry->sliceOffset,
+                                             entry->posTable))
+            {
+                goto end;
+            }
+        }
+
+        if (!mxf_write_index_table_segment(mxf_file, new_segment)) {
+            fprintf(stderr, "Failed to write index table segment\n");
+            goto end;
+        }
+    }
+
+    // the file can't be truncated and so the new index table must not be smaller than the original
+    if (mxf_file_tell(mxf_file) < rip_start) {
+        fprintf(stderr, "Re-segmented index table is smaller than the original\n");
+        goto end;
+    }
+    footer_partition->indexByteCount = (uint64_t)(mxf_file_tell(mxf_file) - index_start);
+    if (mxf_file_write(mxf_file, &rip_data[0], (uint32_t)rip_data.size()) != rip_data.size() ||
+        !mxf_file_seek(mxf_file, header_partition->footerPartition, SEEK_SET) ||
+        !mxf_write_partition(mxf_file, footer_partition))
+    {
+        fprintf(stderr, "Failed to write footer partition\n");
+        goto end;
+    }
+
+    result = true;
+
+end:
+    for (i = 0; i < new_segments.size(); i++)
+        mxf_free_index_table_segment(&new_segments[i]);
+    for (i = 0; i < segments.size(); i++)
+        mxf_free_index_table_segment(&segments[i]);
+    mxf_free_partition(&footer_partition);
+    mxf_free_partition(&header_partition);
+    return result;
+}
+
+int main(int argc, const char **argv)
+{
+    vector<SegmentRange> ranges;
+    const char *filename;
+    MXFFile *mxf_file;
+
+    if (argc != 3) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    if (!parse_ranges(argv[1], &ranges)) {
+        print_usage(argv[0]);
+        fprintf(stderr, "Invalid segment ranges %s\n", argv[1]);
+        return 1;
+    }
+
+    filename = argv[2];
+
+    if (!mxf_disk_file_open_modify(filename, &mxf_file)) {
+        fprintf(stderr, "%s: failed to open file\n", filename);
+        return 1;
+    }
+    mxf_file_set_min_llen(mxf_file, 4);
+
+    bool result = resegment_index(mxf_file, ranges);
+
+    mxf_file_close(&mxf_file);
+
+    return result ? 0 : 1;
+}
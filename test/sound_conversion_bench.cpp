@@ -0,0 +1,593 @@
+/*
+ * Copyright (C) 2026, British Broadcasting Corporation
+ * All Rights Reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the British Broadcasting Corporation nor the names
+ *       of its contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <vector>
+#include <chrono>
+
+#include <bmx/essence_parser/SoundConversion.h>
+#include <bmx/BMXException.h>
+
+using namespace std;
+using namespace bmx;
+
+
+#define FILL_BYTE       0xa5
+
+static const uint32_t SAMPLE_COUNTS[] = {0, 1, 2, 3, 7, 8, 9, 10, 11, 15, 16, 17, 18, 31, 33, 1601, 1602, 1920};
+static const uint16_t CHANNEL_COUNTS[] = {1, 2, 3, 4, 6, 8, 16};
+
+static uint32_t rand_state = 1;
+
+
+static void fill_random(vector<unsigned char> &data)
+{
+    size_t i;
+    for (i = 0; i < data.size(); i++) {
+        rand_state = rand_state * 1103515245 + 12345;
+        data[i] = (unsigned char)(rand_state >> 16);
+    }
+}
+
+static void fill_aes3(vector<unsigned char> &data, uint32_t sample_count, uint8_t valid_flags)
+{
+    data.resize(4 + sample_count * 8 * 4);
+    fill_random(data);
+    data[0] = 0;
+    data[1] = (unsigned char)(sample_count & 0xff);
+    data[2] = (unsigned char)((sample_count >> 8) & 0xff);
+    data[3] = valid_flags;
+}
+
+
+class Conversion
+{
+public:
+    virtual ~Conversion() {}
+
+    virtual const char* GetName() = 0;
+    virtual void Prepare(uint32_t sample_count) = 0;
+    virtual void Convert() = 0;
+    virtual vector<unsigned char> GetOutput() = 0;
+};
+
+
+class DeinterleaveConversion : public Conversion
+{
+public:
+    DeinterleaveConversion(uint32_t bits_per_sample, uint16_t channel_count, uint16_t channel_num)
+    {
+        mBitsPerSample = bits_per_sample;
+        mChannelCount = channel_count;
+        mChannelNum = channel_num;
+        snprintf(mName, sizeof(mName), "deinterleave_audio %u-bit %u/%u channel",
+                 bits_per_sample, channel_num, channel_count);
+    }
+
+    virtual const char* GetName() { return mName; }
+
+    virtual void Prepare(uint32_t sample_count)
+    {
+        mInput.resize(sample_count * mChannelCount * (mBitsPerSample / 8));
+        fill_random(mInput);
+        mOutput.assign(sample_count * (mBitsPerSample / 8), FILL_BYTE);
+    }
+
+    virtual void Convert()
+    {
+        deinterleave_audio(mInput.data(), (uint32_t)mInput.size(), mBitsPerSample, mChannelCount, mChannelNum,
+                           mOutput.data(), (uint32_t)mOutput.size());
+    }
+
+    virtual vector<unsigned char> GetOutput() { return mOutput; }
+
+private:
+    uint32_t mBitsPerSample;
+    uint16_t mChannelCount;
+    uint16_t mChannelNum;
+    char mName[128];
+    vector<unsigned char> mInput;
+    vector<unsigned char> mOutput;
+};
+
+
+class DeinterleaveChannelsConversion : public Conversion
+{
+public:
+    DeinterleaveChannelsConversion(uint32_t bits_per_sample, uint16_t channel_count, bool skip_odd)
+    {
+        mBitsPerSample = bits_per_sample;
+        mChannelCount = channel_count;
+        mSkipOdd = skip_odd;
+        snprintf(mName, sizeof(mName), "deinterleave_audio_channels %u-bit %u channels%s",
+                 bits_per_sample, channel_count, (skip_odd ? " (skip odd)" : ""));
+    }
+
+    virtual const char* GetName() { return mName; }
+
+    virtual void Prepare(uint32_t sample_count)
+    {
+        mInput.resize(sample_count * mChannelCount * (mBitsPerSample / 8));
+        fill_random(mInput);
+        mOutput.assign(mChannelCount * sample_count * (mBitsPerSample / 8), FILL_BYTE);
+        mOutputPtrs.clear();
+        uint16_t c;
+        for (c = 0; c < mChannelCount; c++) {
+            if (mSkipOdd && (c & 1))
+                mOutputPtrs.push_back(0);
+            else
+                mOutputPtrs.push_back(&mOutput[c * sample_count * (mBitsPerSample / 8)]);
+        }
+        mOutputSize = sample_count * (mBitsPerSample / 8);
+    }
+
+    virtual void Convert()
+    {
+        deinterleave_audio_channels(mInput.data(), (uint32_t)mInput.size(), mBitsPerSample, mChannelCount,
+                                    mOutputPtrs.data(), mOutputSize);
+    }
+
+    virtual vector<unsigned char> GetOutput() { return mOutput; }
+
+private:
+    uint32_t mBitsPerSample;
+    uint16_t mChannelCount;
+    bool mSkipOdd;
+    char mName[128];
+    vector<unsigned char> mInput;
+    vector<unsigned char> mOutput;
+    vector<unsigned char*> mOutputPtrs;
+    uint32_t mOutputSize;
+};
+
+
+class InterleaveConversion : public Conversion
+{
+public:
+    InterleaveConversion(uint32_t bits_per_sample, uint16_t channel_count, uint16_t channel_num)
+    {
+        mBitsPerSample = bits_per_sample;
+        mChannelCount = channel_count;
+        mChannelNum = channel_num;
+        snprintf(mName, sizeof(mName), "interleave_audio %u-bit %u/%u channel",
+                 bits_per_sample, channel_num, channel_count);
+    }
+
+    virtual const char* GetName() { return mName; }
+
+    virtual void Prepare(uint32_t sample_count)
+    {
+        mInput.resize(sample_count * (mBitsPerSample / 8));
+        fill_random(mInput);
+        mOutput.resize(sample_count * mChannelCount * (mBitsPerSample / 8));
+        fill_random(mOutput);
+    }
+
+    virtual void Convert()
+    {
+        interleave_audio(mInput.data(), (uint32_t)mInput.size(), mBitsPerSample, mChannelCount, mChannelNum,
+                         mOutput.data(), (uint32_t)mOutput.size());
+    }
+
+    virtual vector<unsigned char> GetOutput() { return mOutput; }
+
+private:
+    uint32_t mBitsPerSample;
+    uint16_t mChannelCount;
+    uint16_t mChannelNum;
+    char mName[128];
+    vector<unsigned char> mInput;
+    vector<unsigned char> mOutput;
+};
+
+
+class AES3ToPCMConversion : public Conversion
+{
+public:
+    AES3ToPCMConversion(uint32_t bits_per_sample, uint8_t channel_num, uint8_t valid_flags)
+    {
+        mBitsPerSample = bits_per_sample;
+        mChannelNum = channel_num;
+        mValidFlags = valid_flags;
+        snprintf(mName, sizeof(mName), "convert_aes3_to_pcm %u-bit channel %u valid 0x%02x",
+                 bits_per_sample, channel_num, valid_flags);
+    }
+
+    virtual const char* GetName() { return mName; }
+
+    virtual void Prepare(uint32_t sample_count)
+    {
+        fill_aes3(mInput, sample_count, mValidFlags);
+        mOutput.assign(sample_count * (mBitsPerSample / 8), FILL_BYTE);
+    }
+
+    virtual void Convert()
+    {
+        convert_aes3_to_pcm(mInput.data(), (uint32_t)mInput.size(), false, mBitsPerSample, mChannelNum,
+                            mOutput.data(), (uint32_t)mOutput.size());
+    }
+
+    virtual vector<unsigned char> GetOutput() { return mOutput; }
+
+private:
+    uint32_t mBitsPerSample;
+    uint8_t mChannelNum;
+    uint8_t mValidFlags;
+    char mName[128];
+    vector<unsigned char> mInput;
+    vector<unsigned char> mOutput;
+};
+
+
+class AES3ToMCPCMConversion : public Conversion
+{
+public:
+    AES3ToMCPCMConversion(uint32_t bits_per_sample, uint8_t channel_count, uint8_t valid_flags)
+    {
+        mBitsPerSample = bits_per_sample;
+        mChannelCount = channel_count;
+        mValidFlags = valid_flags;
+        snprintf(mName, sizeof(mName), "convert_aes3_to_mc_pcm %u-bit %u channels valid 0x%02x",
+                 bits_per_sample, channel_count, valid_flags);
+    }
+
+    virtual const char* GetName() { return mName; }
+
+    virtual void Prepare(uint32_t sample_count)
+    {
+        fill_aes3(mInput, sample_count, mValidFlags);
+        mOutput.assign(sample_count * mChannelCount * (mBitsPerSample / 8), FILL_BYTE);
+    }
+
+    virtual void Convert()
+    {
+        convert_aes3_to_mc_pcm(mInput.data(), (uint32_t)mInput.size(), false, mBitsPerSample, mChannelCount,
+                               mOutput.data(), (uint32_t)mOutput.size());
+    }
+
+    virtual vector<unsigned char> GetOutput() { return mOutput; }
+
+private:
+    uint32_t mBitsPerSample;
+    uint8_t mChannelCount;
+    uint8_t mValidFlags;
+    char mName[128];
+    vector<unsigned char> mInput;
+    vector<unsigned char> mOutput;
+};
+
+
+class AES3ToPCMChannelsConversion : public Conversion
+{
+public:
+    AES3ToPCMChannelsConversion(uint32_t bits_per_sample, uint8_t channel_count, uint8_t valid_flags)
+    {
+        mBitsPerSample = bits_per_sample;
+        mChannelCount = channel_count;
+        mValidFlags = valid_flags;
+        snprintf(mName, sizeof(mName), "convert_aes3_to_pcm_channels %u-bit %u channels valid 0x%02x",
+                 bits_per_sample, channel_count, valid_flags);
+    }
+
+    virtual const char* GetName() { return mName; }
+
+    virtual void Prepare(uint32_t sample_count)
+    {
+        fill_aes3(mInput, sample_count, mValidFlags);
+        mOutputSize = sample_count * (mBitsPerSample / 8);
+        mOutput.assign(mChannelCount * mOutputSize, FILL_BYTE);
+        mOutputPtrs.clear();
+        uint8_t c;
+        for (c = 0; c < mChannelCount; c++) {
+            if (c == 2)
+                mOutputPtrs.push_back(0);
+            else
+                mOutputPtrs.push_back(&mOutput[c * mOutputSize]);
+        }
+    }
+
+    virtual void Convert()
+    {
+        convert_aes3_to_pcm_channels(mInput.data(), (uint32_t)mInput.size(), false, mBitsPerSample, mChannelCount,
+                                     mOutputPtrs.data(), mOutputSize);
+    }
+
+    virtual vector<unsigned char> GetOutput() { return mOutput; }
+
+private:
+    uint32_t mBitsPerSample;
+    uint8_t mChannelCount;
+    uint8_t mValidFlags;
+    char mName[128];
+    vector<unsigned char> mInput;
+    vector<unsigned char> mOutput;
+    vector<unsigned char*> mOutputPtrs;
+    uint32_t mOutputSize;
+};
+
+
+class PCMToAES3Conversion : public Conversion
+{
+public:
+    PCMToAES3Conversion(uint32_t bits_per_sample, uint8_t channel_index, uint8_t channel_count, uint8_t copy_flags)
+    {
+        mBitsPerSample = bits_per_sample;
+        mChannelIndex = channel_index;
+        mChannelCount = channel_count;
+        mCopyFlags = copy_flags;
+        snprintf(mName, sizeof(mName), "convert_pcm_to_aes3 %u-bit channels %u-%u copy 0x%02x",
+                 bits_per_sample, channel_index, channel_index + channel_count - 1, copy_flags);
+    }
+
+    virtual const char* GetName() { return mName; }
+
+    virtual void Prepare(uint32_t sample_count)
+    {
+        mSampleCount = sample_count;
+        mInput.resize(sample_count * mChannelCount * (mBitsPerSample / 8));
+        fill_random(mInput);
+        mOutput.assign(4 + sample_count * 8 * 4, FILL_BYTE);
+    }
+
+    virtual void Convert()
+    {
+        convert_pcm_to_aes3(mInput.data(), mSampleCount, mBitsPerSample, mChannelIndex, mChannelCount, mCopyFlags,
+                            &mOutput[4 + mChannelIndex * 4]);
+    }
+
+    virtual vector<unsigned char> GetOutput() { return mOutput; }
+
+private:
+    uint32_t mBitsPerSample;
+    uint8_t mChannelIndex;
+    uint8_t mChannelCount;
+    uint8_t mCopyFlags;
+    uint32_t mSampleCount;
+    char mName[128];
+    vector<unsigned char> mInput;
+    vector<unsigned char> mOutput;
+};
+
+
+
+static vector<Conversion*> create_conversions(bool all)
+{
+    static const uint32_t PCM_BITS[] = {16, 24, 32};
+    static const uint32_t AES3_BITS[] = {16, 24};
+
+    vector<Conversion*> conversions;
+    size_t b, i;
+    uint16_t c;
+
+    for (b = 0; b < sizeof(PCM_BITS) / sizeof(PCM_BITS[0]); b++) {
+        for (i = 0; i < sizeof(CHANNEL_COUNTS) / sizeof(CHANNEL_COUNTS[0]); i++) {
+            uint16_t channel_count = CHANNEL_COUNTS[i];
+            for (c = 0; c < channel_count; c++) {
+                if (!all && c != channel_count - 1)
+                    continue;
+                conversions.push_back(new DeinterleaveConversion(PCM_BITS[b], channel_count, c));
+                conversions.push_back(new InterleaveConversion(PCM_BITS[b], channel_count, c));
+            }
+            conversions.push_back(new DeinterleaveChannelsConversion(PCM_BITS[b], channel_count, false));
+            if (all)
+                conversions.push_back(new DeinterleaveChannelsConversion(PCM_BITS[b], channel_count, true));
+        }
+    }
+
+    for (b = 0; b < sizeof(AES3_BITS) / sizeof(AES3_BITS[0]); b++) {
+        for (c = 0; c < 8; c++) {
+            if (!all && c != 7)
+                continue;
+            conversions.push_back(new AES3ToPCMConversion(AES3_BITS[b], (uint8_t)c, 0xff));
+            if (all)
+                conversions.push_back(new AES3ToPCMConversion(AES3_BITS[b], (uint8_t)c, 0x5a));
+        }
+        for (c = 1; c <= 8; c++) {
+            if (!all && c != 8)
+                continue;
+            conversions.push_back(new AES3ToMCPCMConversion(AES3_BITS[b], (uint8_t)c, 0xff));
+            conversions.push_back(new AES3ToPCMChannelsConversion(AES3_BITS[b], (uint8_t)c, 0xff));
+            if (all) {
+                conversions.push_back(new AES3ToMCPCMConversion(AES3_BITS[b], (uint8_t)c, 0x5a));
+                conversions.push_back(new AES3ToPCMChannelsConversion(AES3_BITS[b], (uint8_t)c, 0x5a));
+            }
+        }
+        uint8_t index, count;
+        for (index = 0; index < 8; index++) {
+            for (count = 1; index + count <= 8; count++) {
+                if (!all && (index != 1 || (count != 1 && count != 2)))
+                    continue;
+                conversions.push_back(new PCMToAES3Conversion(AES3_BITS[b], index, count, 0xff));
+                if (all)
+                    conversions.push_back(new PCMToAES3Conversion(AES3_BITS[b], index, count, 0x5a));
+            }
+        }
+    }
+
+    return conversions;
+}
+
+static void delete_conversions(vector<Conversion*> &conversions)
+{
+    size_t i;
+    for (i = 0; i < conversions.size(); i++)
+        delete conversions[i];
+    conversions.clear();
+}
+
+static bool check(const char *simd_name)
+{
+    vector<Conversion*> conversions = create_conversions(true);
+    uint32_t num_failed = 0;
+    uint32_t num_checked = 0;
+    size_t i, j;
+    for (i = 0; i < conversions.size(); i++) {
+        for (j = 0; j < sizeof(SAMPLE_COUNTS) / sizeof(SAMPLE_COUNTS[0]); j++) {
+            uint32_t seed = rand_state;
+
+            enable_sound_conversion_simd(false);
+            conversions[i]->Prepare(SAMPLE_COUNTS[j]);
+            conversions[i]->Convert();
+            vector<unsigned char> scalar_output = conversions[i]->GetOutput();
+
+            rand_state = seed;
+            enable_sound_conversion_simd(true);
+            conversions[i]->Prepare(SAMPLE_COUNTS[j]);
+            conversions[i]->Convert();
+            vector<unsigned char> simd_output = conversions[i]->GetOutput();
+
+            if (simd_output != scalar_output) {
+                fprintf(stderr, "Mismatch: %s, %u samples\n", conversions[i]->GetName(), SAMPLE_COUNTS[j]);
+                num_failed++;
+            }
+            num_checked++;
+        }
+    }
+    delete_conversions(conversions);
+
+    printf("Checked %u %s conversions against scalar: %u failed\n", num_checked, simd_name, num_failed);
+    return num_failed == 0;
+}
+
+static double time_conversion(Conversion *conversion, bool simd, uint32_t iterations)
+{
+    enable_sound_conversion_simd(simd);
+
+    // warm-up
+    conversion->Convert();
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    uint32_t i;
+    for (i = 0; i < iterations; i++)
+        conversion->Convert();
+    chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+    return chrono::duration<double, nano>(end - start).count() / iterations;
+}
+
+static void benchmark(const char *simd_name, uint32_t sample_count, uint32_t iterations)
+{
+    vector<Conversion*> conversions = create_conversions(false);
+
+    printf("%-68s %12s %12s %8s\n", "Conversion", "scalar (ns)", simd_name, "speedup");
+    size_t i;
+    for (i = 0; i < conversions.size(); i++) {
+        conversions[i]->Prepare(sample_count);
+        double scalar_ns = time_conversion(conversions[i], false, iterations);
+        double simd_ns = time_conversion(conversions[i], true, iterations);
+        printf("%-68s %12.0f %12.0f %7.2fx\n", conversions[i]->GetName(), scalar_ns, simd_ns,
+               (simd_ns > 0.0 ? scalar_ns / simd_ns : 0.0));
+    }
+
+    delete_conversions(conversions);
+}
+
+static void usage(const char *cmd)
+{
+    fprintf(stderr, "Compare the scalar and vectorised sound conversion functions\n");
+    fprintf(stderr, "Usage: %s [options]\n", cmd);
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, " -h | --help        Show usage and exit\n");
+    fprintf(stderr, " --check            Check that the vectorised output is identical to the scalar output and exit\n");
+    fprintf(stderr, " --samples <count>  Number of samples converted per call. Default 1920\n");
+    fprintf(stderr, " --iter <count>     Number of timed calls per conversion. Default 2000\n");
+}
+
+int main(int argc, const char **argv)
+{
+    uint32_t sample_count = 1920;
+    uint32_t iterations = 2000;
+    bool do_check = false;
+    int cmdln_index;
+
+    for (cmdln_index = 1; cmdln_index < argc; cmdln_index++) {
+        if (strcmp(argv[cmdln_index], "-h") == 0 ||
+            strcmp(argv[cmdln_index], "--help") == 0)
+        {
+            usage(argv[0]);
+            return 0;
+        }
+        else if (strcmp(argv[cmdln_index], "--check") == 0)
+        {
+            do_check = true;
+        }
+        else if (strcmp(argv[cmdln_index], "--samples") == 0 ||
+                 strcmp(argv[cmdln_index], "--iter") == 0)
+        {
+            unsigned int value;
+            if (cmdln_index + 1 >= argc ||
+                sscanf(argv[cmdln_index + 1], "%u", &value) != 1 || value == 0 || value > 65535 * 64)
+            {
+                usage(argv[0]);
+                fprintf(stderr, "Invalid or missing argument for option '%s'\n", argv[cmdln_index]);
+                return 1;
+            }
+            if (strcmp(argv[cmdln_index], "--samples") == 0)
+                sample_count = value;
+            else
+                iterations = value;
+            cmdln_index++;
+        }
+        else
+        {
+            usage(argv[0]);
+            fprintf(stderr, "Unknown option '%s'\n", argv[cmdln_index]);
+            return 1;
+        }
+    }
+
+    const char *simd_name = get_sound_conversion_simd_name();
+
+    try
+    {
+        if (do_check)
+            return check(simd_name) ? 0 : 1;
+
+        if (sample_count > 65535) {
+            fprintf(stderr, "AES3 sample count %u exceeds the maximum 65535\n", sample_count);
+            return 1;
+        }
+        benchmark(simd_name, sample_count, iterations);
+    }
+    catch (const BMXException &ex)
+    {
+        fprintf(stderr, "BMX exception: %s\n", ex.what());
+        return 1;
+    }
+
+    return 0;
+}
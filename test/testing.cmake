@@ -358,6 +358,7 @@ function(setup_test_dir dir_name)
         -D RAW2BMX=$<TARGET_FILE:raw2bmx>
         -D CREATE_TEST_ESSENCE=$<TARGET_FILE:create_test_essence>
         -D FILE_TRUNCATE=$<TARGET_FILE:file_truncate>
+        -D RESEGMENT_INDEX=$<TARGET_FILE:resegment_index>
         -D TEST_SOURCE_DIR=${CMAKE_CURRENT_SOURCE_DIR}
         -D BMX_TEST_SAMPLES_DIR=${BMX_TEST_SAMPLES_DIR}/${dir_name}
         PARENT_SCOPE